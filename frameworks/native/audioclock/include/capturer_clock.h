@@ -16,6 +16,8 @@
 #ifndef CAPTURER_CLOCK_H
 #define CAPTURER_CLOCK_H
 
+#include <array>
+#include <atomic>
 #include <mutex>
 #include "audio_info.h"
 
@@ -32,13 +34,40 @@ public:
     bool GetTimeStampByPosition(uint64_t capturerPos, uint64_t& timestamp);
     void SetTimeStampByPosition(uint64_t timestamp, uint32_t srcSampleRate, uint64_t posIncSize);
 private:
+    // timestamp = timestamp + (pos - position) * nsPerFrame, the line fitted over the recent pairs
+    struct ClockModel {
+        uint64_t position = 0;
+        uint64_t timestamp = 0;
+        double nsPerFrame = 0.0;
+    };
+
+    static constexpr size_t HISTORY_SIZE = 128; // about 2.5s of 20ms callbacks
+    static constexpr size_t MIN_FIT_SIZE = 8;
+
+    bool IsOffModel(uint64_t position, uint64_t timestamp);
+    void UpdateModel();
+    void PublishModel(const ClockModel &model);
+    void ReadModel(ClockModel &model);
+
     uint64_t position_ = 0;
     uint64_t timestamp_ = 0;
-    uint64_t logTimestamp_ = 0;
+    std::atomic<uint64_t> logTimestamp_ = 0;
     uint32_t capturerSampleRate_ = 0;
     uint64_t lastPosInc_ = 0;
     bool isRunning_ = false;
-    std::mutex clockMtx_;
+    std::mutex clockMtx_; // serializes the writers, readers only go through the seqlock below
+
+    // (position, timestamp) pairs of the current timeline, oldest first from historyStart_
+    std::array<std::pair<uint64_t, uint64_t>, HISTORY_SIZE> history_ = {};
+    size_t historyStart_ = 0;
+    size_t historySize_ = 0;
+    ClockModel model_;
+
+    // seqlock published copy of model_, odd modelSeq_ means an update is in progress
+    std::atomic<uint32_t> modelSeq_ = 0;
+    std::atomic<uint64_t> modelPosition_ = 0;
+    std::atomic<uint64_t> modelTimestamp_ = 0;
+    std::atomic<double> modelNsPerFrame_ = 0.0;
 };
 
 } // namespace AudioStandard
@@ -18,6 +18,8 @@
 #endif
 
 #include "capturer_clock.h"
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <cinttypes>
 #include "audio_hdi_log.h"
@@ -27,6 +29,10 @@ namespace OHOS {
 namespace AudioStandard {
 
 constexpr uint64_t AUDIO_CAPTURER_CLOCK_LOG_TIME_NS = 1000'000'000; // 1s
+// a pair this far off the fitted line starts a new timeline instead of bending the fit
+constexpr double AUDIO_CAPTURER_CLOCK_MAX_RESIDUAL_NS = 20'000'000; // 20ms
+// device crystals are specified within a few hundred ppm, a steeper fit is callback jitter
+constexpr double AUDIO_CAPTURER_CLOCK_MAX_DRIFT = 0.001; // 1000ppm
 CapturerClock::CapturerClock(uint32_t capturerSampleRate)
     : capturerSampleRate_(capturerSampleRate)
 {
@@ -35,45 +41,29 @@ CapturerClock::CapturerClock(uint32_t capturerSampleRate)
 
 bool CapturerClock::GetTimeStampByPosition(uint64_t capturerPos, uint64_t& timestamp)
 {
-    std::lock_guard<std::mutex> lock(clockMtx_);
-    CHECK_AND_RETURN_RET(timestamp_ != 0, false);
+    ClockModel model;
+    ReadModel(model);
+    CHECK_AND_RETURN_RET(model.timestamp != 0, false);
     CHECK_AND_RETURN_RET_LOG(capturerSampleRate_ != 0, false, "capturerSampleRate_ is 0!");
 
-    AUDIO_DEBUG_LOG("capturerPos:%{public}" PRIu64 " position_:%{public}" PRIu64,
-        capturerPos, position_);
-
-    if (capturerPos == position_) {
-        timestamp = timestamp_;
-        if (logTimestamp_ == 0 || (timestamp > logTimestamp_ &&
-            timestamp - logTimestamp_ >= AUDIO_CAPTURER_CLOCK_LOG_TIME_NS)) {
-            logTimestamp_ = timestamp;
-            AUDIO_INFO_LOG("capPos:%{public}" PRIu64 " capPts:%{public}" PRIu64 " sysPts:%{public}" PRIu64,
-            capturerPos, logTimestamp_, ClockTime::GetCurNano());
-        }
-        return true;
-    }
-
-    // If the requested position does not equal the clock position,
-    // the timestamp to returned is estimated using the clock position.
-    uint64_t posDetla = 0;
-    uint64_t tsDetla = 0;
-    if (position_ > capturerPos) {
-        posDetla = position_ - capturerPos;
-        tsDetla = posDetla * AUDIO_NS_PER_SECOND / capturerSampleRate_;
-        CHECK_AND_RETURN_RET_LOG(timestamp_ > tsDetla, false, "timestamp suboverflow timestamp_=%{public}" PRIu64
-                                    "tsDetla=%{public}" PRIu64, timestamp_, tsDetla);
-        timestamp = timestamp_ - tsDetla;
-    } else {
-        posDetla = capturerPos - position_;
-        tsDetla = posDetla * AUDIO_NS_PER_SECOND / capturerSampleRate_;
-        timestamp = timestamp_ + tsDetla;
-    }
-    if (logTimestamp_ == 0 || (timestamp > logTimestamp_ &&
-        timestamp - logTimestamp_ >= AUDIO_CAPTURER_CLOCK_LOG_TIME_NS)) {
-        logTimestamp_ = timestamp;
-        AUDIO_WARNING_LOG("Pos:%{public}" PRIu64 " posDetla:%{public}" PRIu64 " tsDetla:%{public}" PRIu64
-            " capPos:%{public}" PRIu64 " capPts:%{public}" PRIu64 " sysPts:%{public}" PRIu64, position_,
-            posDetla, tsDetla, capturerPos, logTimestamp_, ClockTime::GetCurNano());
+    AUDIO_DEBUG_LOG("capturerPos:%{public}" PRIu64 " position:%{public}" PRIu64,
+        capturerPos, model.position);
+
+    // The timestamp of the requested position is read off the line fitted over the recent clock positions.
+    double tsDetla = (capturerPos >= model.position ? static_cast<double>(capturerPos - model.position) :
+        -static_cast<double>(model.position - capturerPos)) * model.nsPerFrame;
+    CHECK_AND_RETURN_RET_LOG(-tsDetla < static_cast<double>(model.timestamp) &&
+        tsDetla < static_cast<double>(std::numeric_limits<int64_t>::max() - model.timestamp), false,
+        "timestamp overflow timestamp=%{public}" PRIu64 " tsDetla=%{public}f", model.timestamp, tsDetla);
+    timestamp = static_cast<uint64_t>(static_cast<int64_t>(model.timestamp) + std::llround(tsDetla));
+
+    uint64_t logTimestamp = logTimestamp_.load(std::memory_order_relaxed);
+    if (logTimestamp == 0 || (timestamp > logTimestamp &&
+        timestamp - logTimestamp >= AUDIO_CAPTURER_CLOCK_LOG_TIME_NS)) {
+        logTimestamp_.store(timestamp, std::memory_order_relaxed);
+        AUDIO_INFO_LOG("Pos:%{public}" PRIu64 " nsPerFrame:%{public}f capPos:%{public}" PRIu64
+            " capPts:%{public}" PRIu64 " sysPts:%{public}" PRIu64, model.position, model.nsPerFrame,
+            capturerPos, timestamp, ClockTime::GetCurNano());
     }
     return true;
 }
@@ -100,6 +90,93 @@ void CapturerClock::SetTimeStampByPosition(
     position_ += lastPosInc_;
     lastPosInc_ = posIncSize;
     timestamp_ = timestamp;
+
+    if (IsOffModel(position_, timestamp_)) {
+        AUDIO_INFO_LOG("timeline restarts at pos:%{public}" PRIu64 " ts:%{public}" PRIu64, position_, timestamp_);
+        historySize_ = 0;
+    }
+    if (historySize_ == HISTORY_SIZE) {
+        history_[historyStart_] = {position_, timestamp_};
+        historyStart_ = (historyStart_ + 1) % HISTORY_SIZE;
+    } else {
+        history_[(historyStart_ + historySize_) % HISTORY_SIZE] = {position_, timestamp_};
+        historySize_++;
+    }
+    UpdateModel();
+}
+
+bool CapturerClock::IsOffModel(uint64_t position, uint64_t timestamp)
+{
+    CHECK_AND_RETURN_RET(historySize_ > 0, false);
+    const auto &[lastPosition, lastTimestamp] = history_[(historyStart_ + historySize_ - 1) % HISTORY_SIZE];
+    CHECK_AND_RETURN_RET(position >= lastPosition && timestamp >= lastTimestamp, true);
+
+    double expected = static_cast<double>(model_.timestamp) +
+        static_cast<double>(position - model_.position) * model_.nsPerFrame;
+    return std::fabs(static_cast<double>(timestamp) - expected) > AUDIO_CAPTURER_CLOCK_MAX_RESIDUAL_NS;
+}
+
+void CapturerClock::UpdateModel()
+{
+    CHECK_AND_RETURN(capturerSampleRate_ != 0 && historySize_ > 0);
+    double nominalNsPerFrame = static_cast<double>(AUDIO_NS_PER_SECOND) / capturerSampleRate_;
+    ClockModel model = {position_, timestamp_, nominalNsPerFrame};
+
+    // Least squares line through the pairs, in offsets from the newest pair so doubles keep the precision.
+    // Too few pairs only give back the callback jitter, the newest pair is used as it is until then.
+    if (historySize_ >= MIN_FIT_SIZE) {
+        std::array<std::pair<double, double>, HISTORY_SIZE> offsets;
+        double meanPos = 0.0;
+        double meanTs = 0.0;
+        for (size_t i = 0; i < historySize_; i++) {
+            const auto &[position, timestamp] = history_[(historyStart_ + i) % HISTORY_SIZE];
+            offsets[i] = {-static_cast<double>(position_ - position), -static_cast<double>(timestamp_ - timestamp)};
+            meanPos += offsets[i].first;
+            meanTs += offsets[i].second;
+        }
+        meanPos /= historySize_;
+        meanTs /= historySize_;
+        double sumPosPos = 0.0;
+        double sumPosTs = 0.0;
+        for (size_t i = 0; i < historySize_; i++) {
+            sumPosPos += (offsets[i].first - meanPos) * (offsets[i].first - meanPos);
+            sumPosTs += (offsets[i].first - meanPos) * (offsets[i].second - meanTs);
+        }
+        if (sumPosPos > 0.0) {
+            model.nsPerFrame = std::clamp(sumPosTs / sumPosPos,
+                nominalNsPerFrame * (1 - AUDIO_CAPTURER_CLOCK_MAX_DRIFT),
+                nominalNsPerFrame * (1 + AUDIO_CAPTURER_CLOCK_MAX_DRIFT));
+        }
+        int64_t fittedOffset = std::llround(meanTs - model.nsPerFrame * meanPos);
+        model.timestamp = static_cast<uint64_t>(static_cast<int64_t>(timestamp_) + fittedOffset);
+    }
+    model_ = model;
+    PublishModel(model);
+}
+
+void CapturerClock::PublishModel(const ClockModel &model)
+{
+    uint32_t seq = modelSeq_.load(std::memory_order_relaxed);
+    modelSeq_.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    modelPosition_.store(model.position, std::memory_order_relaxed);
+    modelTimestamp_.store(model.timestamp, std::memory_order_relaxed);
+    modelNsPerFrame_.store(model.nsPerFrame, std::memory_order_relaxed);
+    modelSeq_.store(seq + 2, std::memory_order_release);
+}
+
+void CapturerClock::ReadModel(ClockModel &model)
+{
+    uint32_t seqBegin = 0;
+    uint32_t seqEnd = 0;
+    do {
+        seqBegin = modelSeq_.load(std::memory_order_acquire);
+        model.position = modelPosition_.load(std::memory_order_relaxed);
+        model.timestamp = modelTimestamp_.load(std::memory_order_relaxed);
+        model.nsPerFrame = modelNsPerFrame_.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        seqEnd = modelSeq_.load(std::memory_order_relaxed);
+    } while ((seqBegin & 1) != 0 || seqBegin != seqEnd);
 }
 
 void CapturerClock::Start()
@@ -108,6 +185,8 @@ void CapturerClock::Start()
 
     std::lock_guard<std::mutex> lock(clockMtx_);
     isRunning_ = true;
+    // the device timeline does not continue across a stop, fit afresh
+    historySize_ = 0;
 }
 
 void CapturerClock::Stop()
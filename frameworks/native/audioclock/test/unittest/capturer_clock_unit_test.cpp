@@ -13,7 +13,10 @@
  * limitations under the License.
  */
 
+#include <cmath>
 #include <iostream>
+#include <random>
+#include <thread>
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include "audio_utils.h"
@@ -42,6 +45,16 @@ constexpr uint64_t MOCK_TIMESTAMP_4 = 1'100'000'000;
 constexpr uint64_t MOCK_TIMESTAMP_4_IN_CAPTURER = 1'120'000'000;
 constexpr uint64_t MOCK_TIMESTAMP_5 = 1'120'000'000;
 constexpr uint64_t MOCK_TIMESTAMP_5_IN_CAPTURER = 1'140'000'000;
+constexpr uint32_t MOCK_CALLBACK_NUM = 1000;
+constexpr double MOCK_JITTER_NS = 2'000'000; // callbacks land up to 2ms late
+constexpr double MOCK_DEVICE_DRIFT = 200e-6; // the device crystal runs 200ppm slow
+
+// time of position pos on a device whose 48k clock drifts from the monotonic clock
+uint64_t GetDeviceTime(uint64_t pos)
+{
+    double nsPerFrame = static_cast<double>(AUDIO_NS_PER_SECOND) / MOCK_SAMPLE_RATE * (1 + MOCK_DEVICE_DRIFT);
+    return MOCK_TIMESTAMP_1 + static_cast<uint64_t>(std::llround(pos * nsPerFrame));
+}
 
 class CapturerClockUnitTest : public testing::Test {
 public:
@@ -109,5 +122,118 @@ HWTEST_F(CapturerClockUnitTest, CapturerClockUnitTest_002, TestSize.Level1)
     EXPECT_EQ(timestamp, MOCK_TIMESTAMP_5_IN_CAPTURER);
 }
 
+/**
+ * @tc.name   : Test capturer clock
+ * @tc.number : CapturerClockUnitTest_003
+ * @tc.desc   : Test the fitted timestamps on a jittered timeline are smoother than the raw callback times
+ */
+HWTEST_F(CapturerClockUnitTest, CapturerClockUnitTest_003, TestSize.Level1)
+{
+    CapturerClock clock(MOCK_SAMPLE_RATE);
+    clock.Start();
+    std::mt19937 random(0);
+    std::uniform_real_distribution<double> jitter(0, MOCK_JITTER_NS);
+
+    double rawSquareSum = 0.0;
+    double fittedSquareSum = 0.0;
+    uint32_t checkNum = 0;
+    for (uint32_t i = 0; i < MOCK_CALLBACK_NUM; i++) {
+        uint64_t pos = i * MOCK_POSITION_INC;
+        uint64_t rawTime = GetDeviceTime(pos) + static_cast<uint64_t>(jitter(random));
+        clock.SetTimeStampByPosition(rawTime, MOCK_SAMPLE_RATE, MOCK_POSITION_INC);
+        if (i < CapturerClock::HISTORY_SIZE) {
+            continue;
+        }
+        // the jitter has a mean, only the spread around it counts
+        double trueTime = static_cast<double>(GetDeviceTime(pos)) + MOCK_JITTER_NS / 2;
+        uint64_t timestamp = 0;
+        ASSERT_TRUE(clock.GetTimeStampByPosition(pos, timestamp));
+        rawSquareSum += std::pow(static_cast<double>(rawTime) - trueTime, 2);
+        fittedSquareSum += std::pow(static_cast<double>(timestamp) - trueTime, 2);
+        checkNum++;
+    }
+    double rawError = std::sqrt(rawSquareSum / checkNum);
+    double fittedError = std::sqrt(fittedSquareSum / checkNum);
+    EXPECT_LT(fittedError, rawError / 3);
+}
+
+/**
+ * @tc.name   : Test capturer clock
+ * @tc.number : CapturerClockUnitTest_004
+ * @tc.desc   : Test the fitted rate follows the device drift when extrapolating a second ahead
+ */
+HWTEST_F(CapturerClockUnitTest, CapturerClockUnitTest_004, TestSize.Level1)
+{
+    CapturerClock clock(MOCK_SAMPLE_RATE);
+    clock.Start();
+    uint64_t lastPos = 0;
+    for (uint32_t i = 0; i < CapturerClock::HISTORY_SIZE; i++) {
+        lastPos = i * MOCK_POSITION_INC;
+        clock.SetTimeStampByPosition(GetDeviceTime(lastPos), MOCK_SAMPLE_RATE, MOCK_POSITION_INC);
+    }
+
+    uint64_t aheadPos = lastPos + MOCK_SAMPLE_RATE;
+    uint64_t timestamp = 0;
+    ASSERT_TRUE(clock.GetTimeStampByPosition(aheadPos, timestamp));
+    // the nominal rate would be 200us off here
+    EXPECT_LT(std::fabs(static_cast<double>(timestamp) - static_cast<double>(GetDeviceTime(aheadPos))), 1000.0);
+}
+
+/**
+ * @tc.name   : Test capturer clock
+ * @tc.number : CapturerClockUnitTest_005
+ * @tc.desc   : Test a jump in the device timeline restarts the fit instead of bending it
+ */
+HWTEST_F(CapturerClockUnitTest, CapturerClockUnitTest_005, TestSize.Level1)
+{
+    CapturerClock clock(MOCK_SAMPLE_RATE);
+    clock.Start();
+    uint64_t pos = 0;
+    for (uint32_t i = 0; i < CapturerClock::HISTORY_SIZE; i++) {
+        pos = i * MOCK_POSITION_INC;
+        clock.SetTimeStampByPosition(GetDeviceTime(pos), MOCK_SAMPLE_RATE, MOCK_POSITION_INC);
+    }
+    EXPECT_EQ(clock.historySize_, CapturerClock::HISTORY_SIZE);
+
+    const uint64_t jumpNs = 100'000'000;
+    pos += MOCK_POSITION_INC;
+    clock.SetTimeStampByPosition(GetDeviceTime(pos) + jumpNs, MOCK_SAMPLE_RATE, MOCK_POSITION_INC);
+    EXPECT_EQ(clock.historySize_, 1);
+    uint64_t timestamp = 0;
+    ASSERT_TRUE(clock.GetTimeStampByPosition(pos, timestamp));
+    EXPECT_EQ(timestamp, GetDeviceTime(pos) + jumpNs);
+}
+
+/**
+ * @tc.name   : Test capturer clock
+ * @tc.number : CapturerClockUnitTest_006
+ * @tc.desc   : Test readers never see a half published model while the capture thread updates it
+ */
+HWTEST_F(CapturerClockUnitTest, CapturerClockUnitTest_006, TestSize.Level1)
+{
+    CapturerClock clock(MOCK_SAMPLE_RATE);
+    clock.Start();
+    clock.SetTimeStampByPosition(MOCK_TIMESTAMP_1, MOCK_SAMPLE_RATE, MOCK_POSITION_INC);
+
+    // every published model lies on the same exact line, so any torn read shows up as a wrong timestamp
+    std::atomic<bool> isWriting = true;
+    std::thread writer([&clock, &isWriting]() {
+        for (uint32_t i = 1; i < MOCK_CALLBACK_NUM * 10; i++) {
+            clock.SetTimeStampByPosition(MOCK_TIMESTAMP_1 + i * (MOCK_TIMESTAMP_2 - MOCK_TIMESTAMP_1),
+                MOCK_SAMPLE_RATE, MOCK_POSITION_INC);
+        }
+        isWriting = false;
+    });
+    uint32_t mismatchNum = 0;
+    while (isWriting) {
+        uint64_t timestamp = 0;
+        if (!clock.GetTimeStampByPosition(MOCK_POSITION_3, timestamp) || timestamp != MOCK_TIMESTAMP_3) {
+            mismatchNum++;
+        }
+    }
+    writer.join();
+    EXPECT_EQ(mismatchNum, 0);
+}
+
 } // namespace AudioStandard
 } // namespace OHOS
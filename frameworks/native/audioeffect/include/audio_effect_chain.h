@@ -89,6 +89,7 @@ private:
     int32_t UpdateEffectParamInner();
     void CrossFadeProcess(float *bufOut, uint32_t frameLen);
 
+    // guards the effect handles, ioBufferConfig_, currSceneType_ and latency_, the render thread applies under it
     std::mutex reloadMutex_;
     std::string sceneType_ = "";
     std::string effectMode_ = "";
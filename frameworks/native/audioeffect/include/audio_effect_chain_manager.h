@@ -60,6 +60,7 @@ const uint32_t MAX_UINT_VOLUME_NUM = 10000;
 const uint32_t MAX_UINT_DSP_VOLUME = 65535;
 const std::string DEFAULT_SCENE_TYPE = "SCENE_DEFAULT";
 const std::string DEFAULT_PRESET_SCENE = "SCENE_MUSIC";
+const int32_t INVALID_SCENE_TYPE_HANDLE = -1;
 
 struct SessionEffectInfo {
     std::string sceneMode;
@@ -122,6 +123,10 @@ public:
     int32_t ReleaseAudioEffectChainDynamic(const std::string &sceneType);
     bool ExistAudioEffectChain(const std::string &sceneType, const std::string &effectMode);
     int32_t ApplyAudioEffectChain(const std::string &sceneType, std::unique_ptr<EffectBufferAttr> &bufferAttr);
+    // Resolve a scene type once, the handle stays valid for the life of the process.
+    int32_t GetSceneTypeHandle(const std::string &sceneType);
+    // Render thread entry, takes no string work and no manager lock.
+    int32_t ApplyAudioEffectChain(int32_t sceneTypeHandle, std::unique_ptr<EffectBufferAttr> &bufferAttr);
     void SetOutputDeviceSink(int32_t device, const std::string &sinkName);
     bool GetOffloadEnabled();
     int32_t UpdateMultichannelConfig(const std::string &sceneType);
@@ -215,12 +220,17 @@ private:
         const std::string &defaultSceneTypeAndDeviceKey, int32_t ret);
     bool IsDeviceTypeSupportingSpatialization();
     std::string GetEffectChainByMode(std::string effectChainKey);
+    void PublishEffectChainSnapshot();
     std::map<std::string, std::shared_ptr<AudioEffectLibEntry>> effectToLibraryEntryMap_;
     std::map<std::string, std::string> effectToLibraryNameMap_;
     std::map<std::string, std::vector<std::string>> effectChainToEffectsMap_;
     std::map<std::string, std::string> sceneTypeAndModeToEffectChainNameMap_;
     std::map<std::string, std::shared_ptr<AudioEffectChain>> sceneTypeToEffectChainMap_;
     std::map<std::string, int32_t> sceneTypeToEffectChainCountMap_;
+    // scene type handle -> scene type, only grows
+    std::vector<std::string> sceneTypeHandles_;
+    // scene type handle -> effect chain on the current device, rebuilt under dynamicMutex_ on every chain change
+    std::shared_ptr<const std::vector<std::shared_ptr<AudioEffectChain>>> effectChainSnapshot_ = nullptr;
     std::set<std::string> sessionIDSet_;
     std::map<std::string, std::set<std::string>> sceneTypeToSessionIDMap_;
     std::map<std::string, SessionEffectInfo> sessionIDToEffectInfoMap_;
@@ -241,8 +251,9 @@ private:
     bool isInitialized_ = false;
     std::mutex dynamicMutex_;
     std::atomic<bool> spatializationEnabled_ = false;
-    bool headTrackingEnabled_ = false;
-    bool btOffloadEnabled_ = false;
+    // read by the render thread without dynamicMutex_
+    std::atomic<bool> headTrackingEnabled_ = false;
+    std::atomic<bool> btOffloadEnabled_ = false;
     bool spkOffloadEnabled_ = false;
     bool initializedLogFlag_ = true;
     bool btOffloadSupported_ = false;
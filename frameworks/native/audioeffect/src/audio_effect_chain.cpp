@@ -130,6 +130,7 @@ void AudioEffectChain::SetLidState(const std::string &lidState)
 
 void AudioEffectChain::SetEffectCurrSceneType(AudioEffectScene currSceneType)
 {
+    std::lock_guard<std::mutex> lock(reloadMutex_);
     currSceneType_ = currSceneType;
 }
 
@@ -177,6 +178,7 @@ void AudioEffectChain::ReleaseEffectChain()
     libHandles_.clear();
 }
 
+// call with reloadMutex_ held
 int32_t AudioEffectChain::SetEffectParamToHandle(AudioEffectHandle handle, int32_t &replyData)
 {
     AudioEffectConfig tmpIoBufferConfig = ioBufferConfig_;
@@ -271,6 +273,8 @@ void AudioEffectChain::AddEffectHandle(AudioEffectHandle handle, AudioEffectLibr
     int32_t ret;
     int32_t replyData = 0;
     int32_t latencyData = 0;
+    // the render thread reads the config and walks the handles under the same lock
+    std::lock_guard<std::mutex> lock(reloadMutex_);
     currSceneType_ = currSceneType;
     AudioEffectTransInfo cmdInfo = {sizeof(AudioEffectConfig), &ioBufferConfig_};
     AudioEffectTransInfo replyInfo = {sizeof(int32_t), &replyData};
@@ -329,12 +333,14 @@ int32_t AudioEffectChain::UpdateEffectParam()
 void AudioEffectChain::ApplyEffectChain(float *bufIn, float *bufOut, uint32_t frameLen, AudioEffectProcInfo procInfo)
 {
     Trace trace("AudioEffectChain::ApplyEffectChain");
+    // scene types sharing one chain may be applied from parallel render workers, the whole frame is one section
+    std::lock_guard<std::mutex> lock(reloadMutex_);
     size_t inTotlen = frameLen * ioBufferConfig_.inputCfg.channels * sizeof(float);
     size_t outTotlen = frameLen * ioBufferConfig_.outputCfg.channels * sizeof(float);
     DumpFileUtil::WriteDumpFile(dumpFileInput_, static_cast<void *>(bufIn), inTotlen);
     DumpEffectProcessData(dumpNameIn_, static_cast<void *>(bufIn), inTotlen);
 
-    if (IsEmptyEffectHandles()) {
+    if (standByEffectHandles_.size() == 0) {
         CHECK_AND_RETURN_LOG(memcpy_s(bufOut, outTotlen, bufIn, outTotlen) == 0, "memcpy error in apply effect");
         DumpFileUtil::WriteDumpFile(dumpFileOutput_, static_cast<void *>(bufOut), outTotlen);
         return;
@@ -349,7 +355,6 @@ void AudioEffectChain::ApplyEffectChain(float *bufIn, float *bufOut, uint32_t fr
 
     audioBufIn_.frameLength = frameLen;
     audioBufOut_.frameLength = frameLen;
-    std::lock_guard<std::mutex> lock(reloadMutex_);
     for (size_t i = 0; i < standByEffectHandles_.size(); ++i) {
 #ifdef SENSOR_ENABLE
         if ((!procInfo.btOffloadEnabled) && procInfo.headTrackingEnabled) {
@@ -371,6 +376,7 @@ void AudioEffectChain::ApplyEffectChain(float *bufIn, float *bufOut, uint32_t fr
 
 void AudioEffectChain::UpdateBufferConfig(uint32_t &channels, uint64_t &channelLayout)
 {
+    std::lock_guard<std::mutex> lock(reloadMutex_);
     channels = ioBufferConfig_.outputCfg.channels;
     channelLayout = ioBufferConfig_.outputCfg.channelLayout;
 }
@@ -383,21 +389,22 @@ bool AudioEffectChain::IsEmptyEffectHandles()
 
 int32_t AudioEffectChain::UpdateMultichannelIoBufferConfig(const uint32_t &channels, const uint64_t &channelLayout)
 {
+    std::lock_guard<std::mutex> lock(reloadMutex_);
     if (ioBufferConfig_.inputCfg.channels == channels && ioBufferConfig_.inputCfg.channelLayout == channelLayout) {
         return SUCCESS;
     }
     ioBufferConfig_.inputCfg.channels = channels;
     ioBufferConfig_.inputCfg.channelLayout = channelLayout;
-    if (IsEmptyEffectHandles()) {
+    if (standByEffectHandles_.size() == 0) {
         return SUCCESS;
     }
-    std::lock_guard<std::mutex> lock(reloadMutex_);
     UpdateMultichannelIoBufferConfigInner();
     return SUCCESS;
 }
 
 void AudioEffectChain::ResetIoBufferConfig()
 {
+    std::lock_guard<std::mutex> lock(reloadMutex_);
     ioBufferConfig_.inputCfg.channels = DEFAULT_NUM_CHANNEL;
     ioBufferConfig_.inputCfg.channelLayout = DEFAULT_NUM_CHANNELLAYOUT;
     ioBufferConfig_.outputCfg.channels = DEFAULT_NUM_CHANNEL;
@@ -412,6 +419,7 @@ void AudioEffectChain::ResetIoBufferConfig()
 
 AudioEffectConfig AudioEffectChain::GetIoBufferConfig()
 {
+    std::lock_guard<std::mutex> lock(reloadMutex_);
     return ioBufferConfig_;
 }
 
@@ -424,6 +432,7 @@ void AudioEffectChain::StoreOldEffectChainInfo(std::string &sceneMode, AudioEffe
 
 uint32_t AudioEffectChain::GetLatency()
 {
+    std::lock_guard<std::mutex> lock(reloadMutex_);
     return latency_;
 }
 
@@ -520,6 +529,7 @@ void AudioEffectChain::SetCurrChannelLayoutNoCheck(const uint64_t channelLayout)
 
 void AudioEffectChain::GetInputChannelInfo(uint32_t &channels, uint64_t &channelLayout)
 {
+    std::lock_guard<std::mutex> lock(reloadMutex_);
     channels = ioBufferConfig_.inputCfg.channels;
     channelLayout = ioBufferConfig_.inputCfg.channelLayout;
 }
@@ -123,6 +123,7 @@ int32_t AudioEffectChainManager::UpdateDeviceInfo(int32_t device, const std::str
     if (!isInitialized_) {
         deviceType_ = (DeviceType)device;
         deviceSink_ = sinkName;
+        PublishEffectChainSnapshot();
         AUDIO_INFO_LOG("has not beed initialized");
         return ERROR;
     }
@@ -135,6 +136,7 @@ int32_t AudioEffectChainManager::UpdateDeviceInfo(int32_t device, const std::str
     AUDIO_PRERELEASE_LOGI("delete all chains when device type change");
     DeleteAllChains();
     deviceType_ = (DeviceType)device;
+    PublishEffectChainSnapshot();
 
     return SUCCESS;
 }
@@ -463,6 +465,55 @@ int32_t AudioEffectChainManager::ApplyAudioEffectChain(const std::string &sceneT
     return SUCCESS;
 }
 
+int32_t AudioEffectChainManager::GetSceneTypeHandle(const std::string &sceneType)
+{
+    std::lock_guard<std::mutex> lock(dynamicMutex_);
+    auto it = std::find(sceneTypeHandles_.begin(), sceneTypeHandles_.end(), sceneType);
+    if (it != sceneTypeHandles_.end()) {
+        return static_cast<int32_t>(it - sceneTypeHandles_.begin());
+    }
+    sceneTypeHandles_.push_back(sceneType);
+    PublishEffectChainSnapshot();
+    AUDIO_INFO_LOG("sceneType %{public}s handle %{public}zu", sceneType.c_str(), sceneTypeHandles_.size() - 1);
+    return static_cast<int32_t>(sceneTypeHandles_.size() - 1);
+}
+
+int32_t AudioEffectChainManager::ApplyAudioEffectChain(int32_t sceneTypeHandle,
+    std::unique_ptr<EffectBufferAttr> &bufferAttr)
+{
+    Trace trace("AudioEffectChainManager::ApplyAudioEffectChain");
+    size_t totLen = static_cast<size_t>(bufferAttr->frameLen * bufferAttr->numChans * sizeof(float));
+    // the snapshot keeps the chain alive even if it is released meanwhile, the chain guards its handles itself
+    auto snapshot = std::atomic_load(&effectChainSnapshot_);
+    if (snapshot == nullptr || sceneTypeHandle < 0 || static_cast<size_t>(sceneTypeHandle) >= snapshot->size() ||
+        (*snapshot)[sceneTypeHandle] == nullptr) {
+        CHECK_AND_RETURN_RET_LOG(memcpy_s(bufferAttr->bufOut, totLen, bufferAttr->bufIn, totLen) == 0, ERROR,
+            "memcpy error when no effect applied");
+        return ERROR;
+    }
+
+    const std::shared_ptr<AudioEffectChain> &audioEffectChain = (*snapshot)[sceneTypeHandle];
+    AudioEffectProcInfo procInfo = {headTrackingEnabled_, btOffloadEnabled_};
+    audioEffectChain->ApplyEffectChain(bufferAttr->bufIn, bufferAttr->bufOut, bufferAttr->frameLen, procInfo);
+    audioEffectChain->UpdateBufferConfig(bufferAttr->outChannels, bufferAttr->outChannelLayout);
+    return SUCCESS;
+}
+
+// call with dynamicMutex_ held after sceneTypeToEffectChainMap_ or deviceType_ changed
+void AudioEffectChainManager::PublishEffectChainSnapshot()
+{
+    auto snapshot = std::make_shared<std::vector<std::shared_ptr<AudioEffectChain>>>(sceneTypeHandles_.size());
+    const std::string deviceTypeName = GetDeviceTypeName();
+    for (size_t handle = 0; handle < sceneTypeHandles_.size(); handle++) {
+        auto it = sceneTypeToEffectChainMap_.find(sceneTypeHandles_[handle] + "_&_" + deviceTypeName);
+        if (it != sceneTypeToEffectChainMap_.end()) {
+            (*snapshot)[handle] = it->second;
+        }
+    }
+    std::atomic_store(&effectChainSnapshot_,
+        std::shared_ptr<const std::vector<std::shared_ptr<AudioEffectChain>>>(std::move(snapshot)));
+}
+
 // LCOV_EXCL_START
 int32_t AudioEffectChainManager::EffectDspVolumeUpdate(std::shared_ptr<AudioEffectVolume> audioEffectVolume)
 {
@@ -1092,6 +1143,7 @@ void AudioEffectChainManager::ResetInfo()
     isDefaultEffectChainExisted_ = false;
     currDspStreamUsage_ = INITIAL_DSP_STREAMUSAGE;
     currDspSceneType_ = SCENE_INITIAL;
+    PublishEffectChainSnapshot();
     std::shared_ptr<AudioEffectVolume> audioEffectVolume = AudioEffectVolume::GetInstance();
     CHECK_AND_RETURN_LOG(audioEffectVolume != nullptr, "null audioEffectVolume");
     audioEffectVolume->SetDspVolume(INITIAL_DSP_VOLUME);
@@ -1662,7 +1714,9 @@ int32_t AudioEffectChainManager::CreateAudioEffectChainDynamicInner(const std::s
             return SUCCESS;
         }
     }
-    return NotifyAndCreateAudioEffectChain(sceneType);
+    int32_t ret = NotifyAndCreateAudioEffectChain(sceneType);
+    PublishEffectChainSnapshot();
+    return ret;
 }
 
 void AudioEffectChainManager::WaitAndReleaseEffectChain(const std::string &sceneType,
@@ -1691,6 +1745,7 @@ void AudioEffectChainManager::WaitAndReleaseEffectChain(const std::string &scene
             AUDIO_INFO_LOG("default effect chain is released");
         }
         sceneTypeToEffectChainMap_.erase(sceneTypeAndDeviceKey);
+        PublishEffectChainSnapshot();
         AUDIO_INFO_LOG("sceneTypeAndDeviceKey [%{public}s] is being released", sceneTypeAndDeviceKey.c_str());
     }
 }
@@ -1789,12 +1844,12 @@ int32_t AudioEffectChainManager::UpdateMultichannelConfigInner(const std::string
 int32_t AudioEffectChainManager::UpdateSpatializationStateInner(AudioSpatializationState spatializationState)
 {
     Trace trace("AudioEffectChainManager::UpdateSpatializationStateInner previous state: " +
-        std::to_string(spatializationEnabled_.load()) + std::to_string(headTrackingEnabled_) +
+        std::to_string(spatializationEnabled_.load()) + std::to_string(headTrackingEnabled_.load()) +
         " current state: " + std::to_string(spatializationState.spatializationEnabled) +
         std::to_string(spatializationState.headTrackingEnabled));
     HILOG_COMM_INFO("begin to update spatialization state, current state: %{public}d and %{public}d, previous state: \
         %{public}d and %{public}d", spatializationState.spatializationEnabled, spatializationState.headTrackingEnabled,
-        spatializationEnabled_.load(), headTrackingEnabled_);
+        spatializationEnabled_.load(), headTrackingEnabled_.load());
 
     if (spatializationEnabled_ != spatializationState.spatializationEnabled) {
         UpdateSpatializationEnabled(spatializationState);
@@ -653,6 +653,68 @@ HWTEST(AudioEffectChainManagerUnitTest, ApplyAudioEffectChain_004, TestSize.Leve
     AudioEffectChainManager::GetInstance()->ResetInfo();
 }
 
+/**
+* @tc.name   : Test ApplyAudioEffectChain API
+* @tc.number : ApplyAudioEffectChain_005
+* @tc.desc   : Test ApplyAudioEffectChain interface(using scene type handle).
+*/
+HWTEST(AudioEffectChainManagerUnitTest, ApplyAudioEffectChain_005, TestSize.Level1)
+{
+    vector<float> bufInVector(10000, 0);
+    vector<float> bufOutVector(10000, 0);
+    int numChans = 2;
+    int frameLen = 960;
+    uint32_t outChannels = INFOCHANNELS;
+    uint64_t outChannelLayout = INFOCHANNELLAYOUT;
+    auto eBufferAttr = make_unique<EffectBufferAttr>(bufInVector.data(), bufOutVector.data(), numChans, frameLen,
+        outChannels, outChannelLayout);
+    string sceneType = "SCENE_MOVIE";
+
+    AudioEffectChainManager::GetInstance()->InitAudioEffectChainManager(DEFAULT_EFFECT_CHAINS,
+        DEFAULT_EFFECT_CHAIN_MANAGER_PARAM, DEFAULT_EFFECT_LIBRARY_LIST);
+    int32_t handle = AudioEffectChainManager::GetInstance()->GetSceneTypeHandle(sceneType);
+    EXPECT_NE(INVALID_SCENE_TYPE_HANDLE, handle);
+    EXPECT_EQ(handle, AudioEffectChainManager::GetInstance()->GetSceneTypeHandle(sceneType));
+    EXPECT_NE(handle, AudioEffectChainManager::GetInstance()->GetSceneTypeHandle("SCENE_MUSIC"));
+
+    int32_t result = AudioEffectChainManager::GetInstance()->ApplyAudioEffectChain(handle, eBufferAttr);
+    EXPECT_EQ(ERROR, result);
+    AudioEffectChainManager::GetInstance()->CreateAudioEffectChainDynamic(sceneType);
+    result = AudioEffectChainManager::GetInstance()->ApplyAudioEffectChain(handle, eBufferAttr);
+    EXPECT_EQ(SUCCESS, result);
+    AudioEffectChainManager::GetInstance()->ResetInfo();
+    result = AudioEffectChainManager::GetInstance()->ApplyAudioEffectChain(handle, eBufferAttr);
+    EXPECT_EQ(ERROR, result);
+}
+
+/**
+* @tc.name   : Test ApplyAudioEffectChain API
+* @tc.number : ApplyAudioEffectChain_006
+* @tc.desc   : Test ApplyAudioEffectChain interface(using invalid scene type handle).
+*/
+HWTEST(AudioEffectChainManagerUnitTest, ApplyAudioEffectChain_006, TestSize.Level1)
+{
+    vector<float> bufInVector(10000, 1.0f);
+    vector<float> bufOutVector(10000, 0);
+    int numChans = 2;
+    int frameLen = 960;
+    uint32_t outChannels = INFOCHANNELS;
+    uint64_t outChannelLayout = INFOCHANNELLAYOUT;
+    auto eBufferAttr = make_unique<EffectBufferAttr>(bufInVector.data(), bufOutVector.data(), numChans, frameLen,
+        outChannels, outChannelLayout);
+
+    AudioEffectChainManager::GetInstance()->InitAudioEffectChainManager(DEFAULT_EFFECT_CHAINS,
+        DEFAULT_EFFECT_CHAIN_MANAGER_PARAM, DEFAULT_EFFECT_LIBRARY_LIST);
+    int32_t result = AudioEffectChainManager::GetInstance()->ApplyAudioEffectChain(INVALID_SCENE_TYPE_HANDLE,
+        eBufferAttr);
+    EXPECT_EQ(ERROR, result);
+    // no chain, the input is passed through
+    EXPECT_EQ(1.0f, bufOutVector[numChans * frameLen - 1]);
+    result = AudioEffectChainManager::GetInstance()->ApplyAudioEffectChain(INT32_MAX, eBufferAttr);
+    EXPECT_EQ(ERROR, result);
+    AudioEffectChainManager::GetInstance()->ResetInfo();
+}
+
 /**
 * @tc.name   : Test SetOutputDeviceSink API
 * @tc.number : SetOutputDeviceSink_001
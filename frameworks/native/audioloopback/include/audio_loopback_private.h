@@ -83,6 +83,7 @@ private:
     void DestroyAudioLoopback();
     void DestroyAudioLoopbackInner();
     bool IsAudioLoopbackSupported();
+    bool FallbackToSoftwareLoopback();
     bool CheckDeviceSupport();
     bool EnableLoopback();
     void DisableLoopback();
@@ -90,7 +90,7 @@ bool AudioLoopbackPrivate::Enable(bool enable)
 {
     Trace trace("AudioLoopbackPrivate::Enable");
     std::lock_guard<std::mutex> lock(loopbackMutex_);
-    if (!IsAudioLoopbackSupported()) {
+    if (!IsAudioLoopbackSupported() && !FallbackToSoftwareLoopback()) {
         HILOG_COMM_INFO("AudioLoopback not support");
         return false;
     }
@@ -219,6 +219,8 @@ AudioLoopbackEqualizerPreset AudioLoopbackPrivate::GetEqualizerPreset()
 
 bool AudioLoopbackPrivate::SetKaraokeParameters(const std::string &parameters)
 {
+    // the soft link is set up by the policy and carries the mic unprocessed, the karaoke dsp is hardware only
+    CHECK_AND_RETURN_RET(mode_ != LOOPBACK_SOFTWARE, true);
     bool ret = AudioPolicyManager::GetInstance().SetKaraokeParameters(parameters);
     if (!ret) {
         HILOG_COMM_INFO("SetKaraokeParameters failed");
@@ -248,7 +250,9 @@ void AudioLoopbackPrivate::CreateAudioLoopback()
         HILOG_COMM_INFO("CreateRenderer failed");
         return;
     }
-    if (!audioRenderer_->IsFastRenderer()) {
+    if (mode_ == LOOPBACK_SOFTWARE) {
+        audioRenderer_->SetRenderMode(RENDER_MODE_CALLBACK);
+    } else if (!audioRenderer_->IsFastRenderer()) {
         HILOG_COMM_INFO("CreateFastRenderer failed");
         return;
     }
@@ -263,7 +267,9 @@ void AudioLoopbackPrivate::CreateAudioLoopback()
 
     AudioCapturerInfo capturerInfo;
     audioCapturer_->GetCapturerInfo(capturerInfo);
-    if (capturerInfo.capturerFlags != STREAM_FLAG_FAST) {
+    if (mode_ == LOOPBACK_SOFTWARE) {
+        audioCapturer_->SetCaptureMode(CAPTURE_MODE_CALLBACK);
+    } else if (capturerInfo.capturerFlags != STREAM_FLAG_FAST) {
         HILOG_COMM_INFO("CreateFastCapturer failed");
         return;
     }
@@ -334,7 +340,7 @@ AudioRendererOptions AudioLoopbackPrivate::GenerateRendererConfig()
     rendererOptions.streamInfo.channels = AudioChannel::STEREO;
     rendererOptions.rendererInfo.contentType = ContentType::CONTENT_TYPE_MUSIC;
     rendererOptions.rendererInfo.streamUsage = StreamUsage::STREAM_USAGE_MUSIC;
-    rendererOptions.rendererInfo.rendererFlags = STREAM_FLAG_FAST;
+    rendererOptions.rendererInfo.rendererFlags = mode_ == LOOPBACK_SOFTWARE ? AUDIO_FLAG_NORMAL : STREAM_FLAG_FAST;
     rendererOptions.rendererInfo.isLoopback = true;
     rendererOptions.rendererInfo.loopbackMode = mode_;
     return rendererOptions;
@@ -348,7 +354,7 @@ AudioCapturerOptions AudioLoopbackPrivate::GenerateCapturerConfig()
     capturerOptions.streamInfo.format = AudioSampleFormat::SAMPLE_S16LE;
     capturerOptions.streamInfo.channels = AudioChannel::STEREO;
     capturerOptions.capturerInfo.sourceType = SourceType::SOURCE_TYPE_MIC;
-    capturerOptions.capturerInfo.capturerFlags = STREAM_FLAG_FAST;
+    capturerOptions.capturerInfo.capturerFlags = mode_ == LOOPBACK_SOFTWARE ? AUDIO_FLAG_NORMAL : STREAM_FLAG_FAST;
     capturerOptions.capturerInfo.isLoopback = true;
     capturerOptions.capturerInfo.loopbackMode = mode_;
     return capturerOptions;
@@ -360,6 +366,18 @@ bool AudioLoopbackPrivate::IsAudioLoopbackSupported()
     return AudioPolicyManager::GetInstance().IsAudioLoopbackSupported(mode_);
 }
 
+bool AudioLoopbackPrivate::FallbackToSoftwareLoopback()
+{
+    // without a hardware loop the audio engine links the normal capturer to the normal renderer instead
+    CHECK_AND_RETURN_RET(mode_ == LOOPBACK_HARDWARE, false);
+    CHECK_AND_RETURN_RET(AudioPolicyManager::GetInstance().IsAudioLoopbackSupported(LOOPBACK_SOFTWARE), false);
+    AUDIO_INFO_LOG("hardware loopback not supported, use software loopback");
+    mode_ = LOOPBACK_SOFTWARE;
+    rendererOptions_ = GenerateRendererConfig();
+    capturerOptions_ = GenerateCapturerConfig();
+    return true;
+}
+
 bool AudioLoopbackPrivate::CheckDeviceSupport()
 {
     isRendererUsb_ = AudioPolicyManager::GetInstance().GetActiveOutputDevice() == DEVICE_TYPE_USB_HEADSET;
@@ -387,6 +405,10 @@ void AudioLoopbackPrivate::OnReadData(size_t length)
     int32_t ret = audioCapturer_->GetBufferDesc(bufDesc);
     CHECK_AND_RETURN_LOG(ret == SUCCESS, "get bufDesc failed, bufLength=%{public}zu, dataLength=%{public}zu",
         bufDesc.bufLength, bufDesc.dataLength);
+    if (mode_ == LOOPBACK_SOFTWARE) {
+        // a callback capturer blocks until its buffer is handed back, the mic data reaches the sink via the link
+        audioCapturer_->Enqueue(bufDesc);
+    }
 }
 
 void AudioLoopbackPrivate::OnWriteData(size_t length)
@@ -471,8 +493,8 @@ void AudioLoopbackPrivate::UpdateStatus()
     const bool isDeviceValid = isRendererUsb_.load() && isCapturerUsb_.load();
     const bool isStateRunning = (rendererState_.load() == RENDERER_RUNNING) &&
         (capturerState_.load() == CAPTURER_RUNNING);
-    const bool isFastValid = (rendererFastStatus_.load() == FASTSTATUS_FAST) &&
-        (capturerFastStatus_.load() == FASTSTATUS_FAST);
+    const bool isFastValid = mode_ == LOOPBACK_SOFTWARE || ((rendererFastStatus_.load() == FASTSTATUS_FAST) &&
+        (capturerFastStatus_.load() == FASTSTATUS_FAST));
     newState = (isDeviceValid && isStateRunning && isFastValid) ? LOOPBACK_STATE_RUNNING : LOOPBACK_STATE_DESTROYED;
 
     if (newState == LOOPBACK_STATE_RUNNING) {
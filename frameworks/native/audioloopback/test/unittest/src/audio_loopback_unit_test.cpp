@@ -386,5 +386,30 @@ HWTEST_F(AudioLoopbackUnitTest, Audio_Loopback_DestroyAudioLoopback_002, TestSiz
     EXPECT_EQ(audioLoopback->audioRenderer_, nullptr);
     EXPECT_EQ(audioLoopback->audioCapturer_, nullptr);
 }
+
+HWTEST_F(AudioLoopbackUnitTest, Audio_Loopback_SoftwareMode_001, TestSize.Level1)
+{
+    auto audioLoopback = std::make_shared<AudioLoopbackPrivate>(LOOPBACK_SOFTWARE, AppInfo());
+    EXPECT_EQ(audioLoopback->rendererOptions_.rendererInfo.rendererFlags, AUDIO_FLAG_NORMAL);
+    EXPECT_EQ(audioLoopback->rendererOptions_.rendererInfo.loopbackMode, LOOPBACK_SOFTWARE);
+    EXPECT_EQ(audioLoopback->capturerOptions_.capturerInfo.capturerFlags, AUDIO_FLAG_NORMAL);
+    EXPECT_EQ(audioLoopback->capturerOptions_.capturerInfo.loopbackMode, LOOPBACK_SOFTWARE);
+    EXPECT_FALSE(audioLoopback->FallbackToSoftwareLoopback());
+
+    audioLoopback->currentState_ = LOOPBACK_STATE_RUNNING;
+    EXPECT_EQ(audioLoopback->SetVolume(1), SUCCESS);
+    EXPECT_TRUE(audioLoopback->EnableLoopback());
+}
+
+HWTEST_F(AudioLoopbackUnitTest, Audio_Loopback_SoftwareMode_002, TestSize.Level1)
+{
+    std::shared_ptr<MockAudioCapturer> mockCapturer = std::make_shared<NiceMock<MockAudioCapturer>>();
+    auto audioLoopback = std::make_shared<AudioLoopbackPrivate>(LOOPBACK_SOFTWARE, AppInfo());
+    audioLoopback->audioCapturer_ = mockCapturer;
+    EXPECT_CALL(*mockCapturer, GetBufferDesc(_)).WillOnce(Return(SUCCESS));
+    EXPECT_CALL(*mockCapturer, Enqueue(_)).Times(1);
+    audioLoopback->OnReadData(0);
+    audioLoopback->audioCapturer_ = nullptr;
+}
 } // namespace AudioStandard
 } // namespace OHOS
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LOG_TAG
+#define LOG_TAG "AudioRtSchedule"
+#endif
+
+#include "audio_rt_schedule.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <sched.h>
+#include <signal.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "audio_common_log.h"
+
+namespace OHOS {
+namespace AudioStandard {
+namespace {
+#ifndef SCHED_DEADLINE
+constexpr uint32_t SCHED_DEADLINE = 6;
+#endif
+constexpr uint64_t SCHED_FLAG_RESET_ON_FORK_BIT = 0x01;
+// a thread may use this share of every period, the rest is left for the other deadline threads
+constexpr uint64_t DEADLINE_RUNTIME_PERCENT = 25;
+constexpr uint64_t PERCENT = 100;
+// the kernel refuses runtimes under 1024 ns and, by default, periods outside 100 us to 4 s
+constexpr uint64_t MIN_RUNTIME_NS = 1024;
+constexpr uint64_t MIN_PERIOD_NS = 100000;
+constexpr uint64_t MAX_PERIOD_NS = 4000000000;
+
+// layout of the kernel struct sched_attr, which libc does not export
+struct KernelSchedAttr {
+    uint32_t size;
+    uint32_t schedPolicy;
+    uint64_t schedFlags;
+    int32_t schedNice;
+    uint32_t schedPriority;
+    uint64_t schedRuntime;
+    uint64_t schedDeadline;
+    uint64_t schedPeriod;
+};
+}
+
+int32_t AudioRtScheduleShim::SetDeadline(pid_t tid, const AudioRtScheduleParam &param)
+{
+#ifdef SYS_sched_setattr
+    KernelSchedAttr attr = {};
+    attr.size = sizeof(attr);
+    attr.schedPolicy = SCHED_DEADLINE;
+    attr.schedFlags = SCHED_FLAG_RESET_ON_FORK_BIT;
+    attr.schedRuntime = param.runtimeNs;
+    attr.schedDeadline = param.deadlineNs;
+    attr.schedPeriod = param.periodNs;
+    return syscall(SYS_sched_setattr, tid, &attr, 0) == 0 ? 0 : -errno;
+#else
+    return -ENOSYS;
+#endif
+}
+
+int32_t AudioRtScheduleShim::SetFifo(pid_t tid, int32_t priority)
+{
+    struct sched_param param = {0};
+    param.sched_priority = priority;
+    return sched_setscheduler(tid, SCHED_FIFO | SCHED_RESET_ON_FORK, &param) == 0 ? 0 : -errno;
+}
+
+int32_t AudioRtScheduleShim::SetNormal(pid_t tid)
+{
+    struct sched_param param = {0};
+    return sched_setscheduler(tid, SCHED_OTHER, &param) == 0 ? 0 : -errno;
+}
+
+bool AudioRtScheduleShim::IsThreadAlive(pid_t tid)
+{
+    // signal 0 only checks the target, EPERM means it exists in a process we may not signal
+    return kill(tid, 0) == 0 || errno == EPERM;
+}
+
+AudioRtSchedule::AudioRtSchedule() : shim_(std::make_shared<AudioRtScheduleShim>())
+{
+}
+
+AudioRtSchedule &AudioRtSchedule::GetInstance()
+{
+    static AudioRtSchedule instance;
+    return instance;
+}
+
+AudioRtScheduleParam AudioRtSchedule::MakeParam(uint64_t periodNs, uint64_t runtimeNs)
+{
+    AudioRtScheduleParam param;
+    param.periodNs = periodNs;
+    // the data of a period is due when the next one starts
+    param.deadlineNs = periodNs;
+    if (runtimeNs == AUDIO_RT_DEFAULT_RUNTIME_NS) {
+        runtimeNs = periodNs * DEADLINE_RUNTIME_PERCENT / PERCENT;
+    }
+    // the kernel refuses a runtime above the deadline
+    param.runtimeNs = std::max(std::min(runtimeNs, param.deadlineNs), MIN_RUNTIME_NS);
+    return param;
+}
+
+AudioRtSchedulePolicy AudioRtSchedule::Schedule(pid_t tid, uint64_t periodNs, uint64_t runtimeNs,
+    int32_t fifoPriority)
+{
+    tid = (tid == 0) ? gettid() : tid;
+    std::lock_guard<std::mutex> lock(mutex_);
+    RemoveExitedThreads();
+    if (periodNs >= MIN_PERIOD_NS && periodNs <= MAX_PERIOD_NS) {
+        AudioRtScheduleParam param = MakeParam(periodNs, runtimeNs);
+        int32_t ret = shim_->SetDeadline(tid, param);
+        if (ret == 0) {
+            AUDIO_INFO_LOG("tid %{public}d deadline, runtime %{public}" PRIu64 " period %{public}" PRIu64 " ns",
+                tid, param.runtimeNs, param.periodNs);
+            policies_[tid] = AudioRtSchedulePolicy::DEADLINE;
+            return AudioRtSchedulePolicy::DEADLINE;
+        }
+        AUDIO_WARNING_LOG("tid %{public}d deadline refused: %{public}d, try fifo", tid, ret);
+    }
+    int32_t ret = shim_->SetFifo(tid, fifoPriority);
+    if (ret == 0) {
+        AUDIO_INFO_LOG("tid %{public}d fifo, priority %{public}d", tid, fifoPriority);
+        policies_[tid] = AudioRtSchedulePolicy::FIFO;
+        return AudioRtSchedulePolicy::FIFO;
+    }
+    AUDIO_ERR_LOG("tid %{public}d fifo refused: %{public}d, stays normal", tid, ret);
+    policies_.erase(tid);
+    return AudioRtSchedulePolicy::NORMAL;
+}
+
+int32_t AudioRtSchedule::Unschedule(pid_t tid)
+{
+    tid = (tid == 0) ? gettid() : tid;
+    std::lock_guard<std::mutex> lock(mutex_);
+    policies_.erase(tid);
+    int32_t ret = shim_->SetNormal(tid);
+    CHECK_AND_RETURN_RET_LOG(ret == 0, ret, "tid %{public}d reset refused: %{public}d", tid, ret);
+    return 0;
+}
+
+AudioRtSchedulePolicy AudioRtSchedule::GetPolicy(pid_t tid)
+{
+    tid = (tid == 0) ? gettid() : tid;
+    std::lock_guard<std::mutex> lock(mutex_);
+    RemoveExitedThreads();
+    auto it = policies_.find(tid);
+    return it == policies_.end() ? AudioRtSchedulePolicy::NORMAL : it->second;
+}
+
+// threads that exit without Unschedule leave their entry behind, and the kernel may hand the tid out again
+void AudioRtSchedule::RemoveExitedThreads()
+{
+    for (auto it = policies_.begin(); it != policies_.end();) {
+        if (shim_->IsThreadAlive(it->first)) {
+            ++it;
+            continue;
+        }
+        AUDIO_INFO_LOG("tid %{public}d exited, forget its policy", it->first);
+        it = policies_.erase(it);
+    }
+}
+
+void AudioRtSchedule::SetShim(std::shared_ptr<AudioRtScheduleShim> shim)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    shim_ = (shim != nullptr) ? shim : std::make_shared<AudioRtScheduleShim>();
+}
+} // namespace AudioStandard
+} // namespace OHOS
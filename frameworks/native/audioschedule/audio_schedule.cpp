@@ -34,6 +34,7 @@
 
 #include "audio_utils.h"
 #include "audio_common_log.h"
+#include "audio_rt_schedule.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -172,6 +173,17 @@ bool SetEndpointThreadPriority()
     return res;
 }
 
+// the resource scheduler gives the server threads their policy itself, the period is not needed
+void ScheduleThreadInServerWithPeriod(pid_t pid, pid_t tid, uint64_t /* periodNs */, uint64_t /* runtimeNs */)
+{
+    ScheduleThreadInServer(pid, tid);
+}
+
+bool SetEndpointThreadPriorityWithPeriod(uint64_t /* periodNs */, uint64_t /* runtimeNs */)
+{
+    return SetEndpointThreadPriority();
+}
+
 bool ResetEndpointThreadPriority()
 {
     struct sched_param param = {0};
@@ -185,15 +197,55 @@ bool ResetEndpointThreadPriority()
     return true;
 };
 #else
-void ScheduleReportData(uint32_t /* pid */, uint32_t /* tid */, const char* /* bundleName*/) {};
-void ScheduleThreadInServer(pid_t pid, pid_t tid) {};
-void UnscheduleThreadInServer(pid_t tid) {};
+// without the resource scheduler the server threads are handed to the kernel real-time classes directly
+void ScheduleReportData(pid_t /* pid */, pid_t /* tid */, const char* /* bundleName*/) {};
+void ScheduleReportDataWithQosLevel(pid_t /* pid */, pid_t /* tid */, const char* /* bundleName*/,
+    int32_t /* qosLevel */) {};
+
+void ScheduleThreadInServer(pid_t pid, pid_t tid)
+{
+    ScheduleThreadInServerWithPeriod(pid, tid, AUDIO_RT_DEFAULT_PERIOD_NS, AUDIO_RT_DEFAULT_RUNTIME_NS);
+}
+
+void ScheduleThreadInServerWithPeriod(pid_t /* pid */, pid_t tid, uint64_t periodNs, uint64_t runtimeNs)
+{
+    AudioRtSchedule::GetInstance().Schedule(tid, periodNs, runtimeNs, AUDIO_RT_DEFAULT_FIFO_PRIORITY);
+}
+
+void UnscheduleThreadInServer(pid_t /* pid */, pid_t tid)
+{
+    AudioRtSchedule::GetInstance().Unschedule(tid);
+}
+
 void OnAddResSchedService(uint32_t audioServerPid) {};
-void SetProcessDataThreadPriority(int32_t priority) {};
-void ResetProcessDataThreadPriority() {};
-void UnscheduleReportData(uint32_t /* pid */, uint32_t /* tid */, const char* /* bundleName*/) {};
-bool SetEndpointThreadPriority() { return false; };
-bool ResetEndpointThreadPriority() { return false; };
+
+void SetProcessDataThreadPriority(int32_t priority)
+{
+    AudioRtSchedule::GetInstance().Schedule(0, AUDIO_RT_DEFAULT_PERIOD_NS, AUDIO_RT_DEFAULT_RUNTIME_NS, priority);
+}
+
+void ResetProcessDataThreadPriority()
+{
+    AudioRtSchedule::GetInstance().Unschedule(0);
+}
+
+void UnscheduleReportData(pid_t /* pid */, pid_t /* tid */, const char* /* bundleName*/) {};
+
+bool SetEndpointThreadPriority()
+{
+    return SetEndpointThreadPriorityWithPeriod(AUDIO_RT_DEFAULT_PERIOD_NS, AUDIO_RT_DEFAULT_RUNTIME_NS);
+}
+
+bool SetEndpointThreadPriorityWithPeriod(uint64_t periodNs, uint64_t runtimeNs)
+{
+    return AudioRtSchedule::GetInstance().Schedule(0, periodNs, runtimeNs, AUDIO_RT_DEFAULT_FIFO_PRIORITY) !=
+        AudioRtSchedulePolicy::NORMAL;
+}
+
+bool ResetEndpointThreadPriority()
+{
+    return AudioRtSchedule::GetInstance().Unschedule(0) == 0;
+}
 #endif
 
 #ifdef __cplusplus
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AUDIO_RT_SCHEDULE_H
+#define AUDIO_RT_SCHEDULE_H
+
+#include <inttypes.h>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <sys/types.h>
+
+namespace OHOS {
+namespace AudioStandard {
+// the HPAE frame period, used when the caller does not know the period of its thread
+constexpr uint64_t AUDIO_RT_DEFAULT_PERIOD_NS = 20000000;
+// asks for the default share of the period as runtime
+constexpr uint64_t AUDIO_RT_DEFAULT_RUNTIME_NS = 0;
+// priority of the threads that fall back to SCHED_FIFO without asking for one
+constexpr int32_t AUDIO_RT_DEFAULT_FIFO_PRIORITY = 1;
+
+struct AudioRtScheduleParam {
+    uint64_t runtimeNs = 0;
+    uint64_t deadlineNs = 0;
+    uint64_t periodNs = 0;
+};
+
+enum class AudioRtSchedulePolicy {
+    NORMAL,
+    DEADLINE,
+    FIFO,
+};
+
+/**
+ * The scheduling syscalls used by AudioRtSchedule. Every call returns 0 or -errno, unittests replace it to check
+ * the parameters without needing CAP_SYS_NICE.
+ */
+class AudioRtScheduleShim {
+public:
+    virtual ~AudioRtScheduleShim() = default;
+    // sched_setattr with SCHED_DEADLINE
+    virtual int32_t SetDeadline(pid_t tid, const AudioRtScheduleParam &param);
+    // sched_setscheduler with SCHED_FIFO
+    virtual int32_t SetFifo(pid_t tid, int32_t priority);
+    // sched_setscheduler with SCHED_OTHER
+    virtual int32_t SetNormal(pid_t tid);
+    // false once the thread has exited
+    virtual bool IsThreadAlive(pid_t tid);
+};
+
+/**
+ * Real-time scheduling for audio threads on hosts without the platform resource scheduler. A thread first asks the
+ * kernel for a SCHED_DEADLINE reservation sized from its period, and gets SCHED_FIFO when the kernel refuses it,
+ * for example when the deadline bandwidth is used up.
+ */
+class AudioRtSchedule {
+public:
+    static AudioRtSchedule &GetInstance();
+
+    // runtimeNs is the work the thread does in a period, AUDIO_RT_DEFAULT_RUNTIME_NS reserves a fixed share of it
+    static AudioRtScheduleParam MakeParam(uint64_t periodNs, uint64_t runtimeNs);
+
+    // tid 0 is the calling thread
+    AudioRtSchedulePolicy Schedule(pid_t tid, uint64_t periodNs, uint64_t runtimeNs, int32_t fifoPriority);
+    int32_t Unschedule(pid_t tid);
+    AudioRtSchedulePolicy GetPolicy(pid_t tid);
+
+    void SetShim(std::shared_ptr<AudioRtScheduleShim> shim);
+
+private:
+    AudioRtSchedule();
+    void RemoveExitedThreads();
+
+    std::mutex mutex_;
+    std::shared_ptr<AudioRtScheduleShim> shim_;
+    std::unordered_map<pid_t, AudioRtSchedulePolicy> policies_;
+};
+} // namespace AudioStandard
+} // namespace OHOS
+#endif // AUDIO_RT_SCHEDULE_H
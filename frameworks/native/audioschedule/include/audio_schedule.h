@@ -26,12 +26,15 @@ extern "C" {
 void ScheduleReportData(pid_t pid, pid_t tid, const char *bundleName);
 void ScheduleReportDataWithQosLevel(pid_t pid, pid_t tid, const char *bundleName, int32_t qosLevel);
 void ScheduleThreadInServer(pid_t pid, pid_t tid);
+// for threads that wake up every periodNs and work about runtimeNs of it, 0 runtime takes the default share
+void ScheduleThreadInServerWithPeriod(pid_t pid, pid_t tid, uint64_t periodNs, uint64_t runtimeNs);
 void UnscheduleThreadInServer(pid_t pid, pid_t tid);
 void OnAddResSchedService(uint32_t audioServerPid);
 void SetProcessDataThreadPriority(int32_t priority);
 void ResetProcessDataThreadPriority();
 void UnscheduleReportData(pid_t pid, pid_t tid, const char* bundleName);
 bool SetEndpointThreadPriority();
+bool SetEndpointThreadPriorityWithPeriod(uint64_t periodNs, uint64_t runtimeNs);
 bool ResetEndpointThreadPriority();
 
 #ifdef __cplusplus
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "audio_rt_schedule.h"
+
+#include <cerrno>
+#include <set>
+#include <unistd.h>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace AudioStandard {
+namespace {
+constexpr pid_t TEST_TID = 1234;
+constexpr pid_t EXITED_TID = 1235;
+constexpr uint64_t HPAE_PERIOD_NS = 20000000;
+constexpr uint64_t FAST_PERIOD_NS = 5000000;
+constexpr uint64_t MEASURED_RUNTIME_NS = 3000000;
+constexpr int32_t TEST_FIFO_PRIORITY = 3;
+
+class FakeRtScheduleShim : public AudioRtScheduleShim {
+public:
+    int32_t SetDeadline(pid_t tid, const AudioRtScheduleParam &param) override
+    {
+        deadlineCalls.push_back({tid, param});
+        return deadlineRet;
+    }
+
+    int32_t SetFifo(pid_t tid, int32_t priority) override
+    {
+        fifoCalls.push_back({tid, priority});
+        return fifoRet;
+    }
+
+    int32_t SetNormal(pid_t tid) override
+    {
+        normalCalls.push_back(tid);
+        return 0;
+    }
+
+    bool IsThreadAlive(pid_t tid) override
+    {
+        return exitedTids.count(tid) == 0;
+    }
+
+    int32_t deadlineRet = 0;
+    int32_t fifoRet = 0;
+    std::vector<std::pair<pid_t, AudioRtScheduleParam>> deadlineCalls;
+    std::vector<std::pair<pid_t, int32_t>> fifoCalls;
+    std::vector<pid_t> normalCalls;
+    std::set<pid_t> exitedTids;
+};
+}
+
+class AudioRtScheduleUnitTest : public ::testing::Test {
+public:
+    static void SetUpTestCase(){};
+    static void TearDownTestCase(){};
+    virtual void SetUp()
+    {
+        shim_ = std::make_shared<FakeRtScheduleShim>();
+        AudioRtSchedule::GetInstance().SetShim(shim_);
+    }
+    virtual void TearDown()
+    {
+        AudioRtSchedule::GetInstance().Unschedule(TEST_TID);
+        AudioRtSchedule::GetInstance().Unschedule(EXITED_TID);
+        AudioRtSchedule::GetInstance().SetShim(nullptr);
+    }
+
+protected:
+    std::shared_ptr<FakeRtScheduleShim> shim_;
+};
+
+/**
+ * @tc.name   : Test AudioRtSchedule
+ * @tc.number : AudioRtScheduleUnitTest_001
+ * @tc.desc   : The deadline reservation is sized from the period.
+ */
+HWTEST_F(AudioRtScheduleUnitTest, AudioRtScheduleUnitTest_001, TestSize.Level1)
+{
+    AudioRtSchedulePolicy policy = AudioRtSchedule::GetInstance().Schedule(TEST_TID, HPAE_PERIOD_NS,
+        AUDIO_RT_DEFAULT_RUNTIME_NS, TEST_FIFO_PRIORITY);
+    EXPECT_EQ(policy, AudioRtSchedulePolicy::DEADLINE);
+    ASSERT_EQ(shim_->deadlineCalls.size(), 1u);
+    EXPECT_EQ(shim_->deadlineCalls[0].first, TEST_TID);
+    const AudioRtScheduleParam &param = shim_->deadlineCalls[0].second;
+    EXPECT_EQ(param.periodNs, HPAE_PERIOD_NS);
+    EXPECT_EQ(param.deadlineNs, HPAE_PERIOD_NS);
+    EXPECT_GT(param.runtimeNs, 0u);
+    EXPECT_LT(param.runtimeNs, param.deadlineNs);
+    EXPECT_TRUE(shim_->fifoCalls.empty());
+    EXPECT_EQ(AudioRtSchedule::GetInstance().GetPolicy(TEST_TID), AudioRtSchedulePolicy::DEADLINE);
+
+    AudioRtScheduleParam fastParam = AudioRtSchedule::MakeParam(FAST_PERIOD_NS, AUDIO_RT_DEFAULT_RUNTIME_NS);
+    EXPECT_EQ(fastParam.deadlineNs, FAST_PERIOD_NS);
+    EXPECT_EQ(fastParam.runtimeNs * HPAE_PERIOD_NS, param.runtimeNs * FAST_PERIOD_NS);
+}
+
+/**
+ * @tc.name   : Test AudioRtSchedule
+ * @tc.number : AudioRtScheduleUnitTest_002
+ * @tc.desc   : A refused deadline reservation falls back to SCHED_FIFO with the asked priority.
+ */
+HWTEST_F(AudioRtScheduleUnitTest, AudioRtScheduleUnitTest_002, TestSize.Level1)
+{
+    shim_->deadlineRet = -EBUSY;
+    AudioRtSchedulePolicy policy = AudioRtSchedule::GetInstance().Schedule(TEST_TID, HPAE_PERIOD_NS,
+        AUDIO_RT_DEFAULT_RUNTIME_NS, TEST_FIFO_PRIORITY);
+    EXPECT_EQ(policy, AudioRtSchedulePolicy::FIFO);
+    EXPECT_EQ(shim_->deadlineCalls.size(), 1u);
+    ASSERT_EQ(shim_->fifoCalls.size(), 1u);
+    EXPECT_EQ(shim_->fifoCalls[0].first, TEST_TID);
+    EXPECT_EQ(shim_->fifoCalls[0].second, TEST_FIFO_PRIORITY);
+
+    shim_->fifoRet = -EPERM;
+    policy = AudioRtSchedule::GetInstance().Schedule(TEST_TID, HPAE_PERIOD_NS, AUDIO_RT_DEFAULT_RUNTIME_NS,
+        TEST_FIFO_PRIORITY);
+    EXPECT_EQ(policy, AudioRtSchedulePolicy::NORMAL);
+    EXPECT_EQ(AudioRtSchedule::GetInstance().GetPolicy(TEST_TID), AudioRtSchedulePolicy::NORMAL);
+}
+
+/**
+ * @tc.name   : Test AudioRtSchedule
+ * @tc.number : AudioRtScheduleUnitTest_003
+ * @tc.desc   : Periods the kernel cannot take go straight to SCHED_FIFO, unscheduling resets the calling thread.
+ */
+HWTEST_F(AudioRtScheduleUnitTest, AudioRtScheduleUnitTest_003, TestSize.Level1)
+{
+    AudioRtSchedulePolicy policy = AudioRtSchedule::GetInstance().Schedule(TEST_TID, 0, AUDIO_RT_DEFAULT_RUNTIME_NS,
+        TEST_FIFO_PRIORITY);
+    EXPECT_EQ(policy, AudioRtSchedulePolicy::FIFO);
+    EXPECT_TRUE(shim_->deadlineCalls.empty());
+
+    policy = AudioRtSchedule::GetInstance().Schedule(0, HPAE_PERIOD_NS, AUDIO_RT_DEFAULT_RUNTIME_NS,
+        TEST_FIFO_PRIORITY);
+    EXPECT_EQ(policy, AudioRtSchedulePolicy::DEADLINE);
+    ASSERT_EQ(shim_->deadlineCalls.size(), 1u);
+    EXPECT_EQ(shim_->deadlineCalls[0].first, gettid());
+    EXPECT_EQ(AudioRtSchedule::GetInstance().Unschedule(0), 0);
+    ASSERT_EQ(shim_->normalCalls.size(), 1u);
+    EXPECT_EQ(shim_->normalCalls[0], gettid());
+    EXPECT_EQ(AudioRtSchedule::GetInstance().GetPolicy(0), AudioRtSchedulePolicy::NORMAL);
+}
+
+/**
+ * @tc.name   : Test AudioRtSchedule
+ * @tc.number : AudioRtScheduleUnitTest_004
+ * @tc.desc   : The runtime the caller measured is reserved as is, never more than the period.
+ */
+HWTEST_F(AudioRtScheduleUnitTest, AudioRtScheduleUnitTest_004, TestSize.Level1)
+{
+    AudioRtSchedulePolicy policy = AudioRtSchedule::GetInstance().Schedule(TEST_TID, FAST_PERIOD_NS,
+        MEASURED_RUNTIME_NS, TEST_FIFO_PRIORITY);
+    EXPECT_EQ(policy, AudioRtSchedulePolicy::DEADLINE);
+    ASSERT_EQ(shim_->deadlineCalls.size(), 1u);
+    EXPECT_EQ(shim_->deadlineCalls[0].second.periodNs, FAST_PERIOD_NS);
+    EXPECT_EQ(shim_->deadlineCalls[0].second.runtimeNs, MEASURED_RUNTIME_NS);
+
+    AudioRtScheduleParam param = AudioRtSchedule::MakeParam(FAST_PERIOD_NS, HPAE_PERIOD_NS);
+    EXPECT_EQ(param.runtimeNs, param.deadlineNs);
+}
+
+/**
+ * @tc.name   : Test AudioRtSchedule
+ * @tc.number : AudioRtScheduleUnitTest_005
+ * @tc.desc   : Threads that exit without unscheduling lose their policy, the others keep it.
+ */
+HWTEST_F(AudioRtScheduleUnitTest, AudioRtScheduleUnitTest_005, TestSize.Level1)
+{
+    AudioRtSchedule::GetInstance().Schedule(TEST_TID, HPAE_PERIOD_NS, AUDIO_RT_DEFAULT_RUNTIME_NS,
+        TEST_FIFO_PRIORITY);
+    AudioRtSchedule::GetInstance().Schedule(EXITED_TID, HPAE_PERIOD_NS, AUDIO_RT_DEFAULT_RUNTIME_NS,
+        TEST_FIFO_PRIORITY);
+    EXPECT_EQ(AudioRtSchedule::GetInstance().GetPolicy(EXITED_TID), AudioRtSchedulePolicy::DEADLINE);
+
+    shim_->exitedTids.insert(EXITED_TID);
+    EXPECT_EQ(AudioRtSchedule::GetInstance().GetPolicy(EXITED_TID), AudioRtSchedulePolicy::NORMAL);
+    EXPECT_EQ(AudioRtSchedule::GetInstance().GetPolicy(TEST_TID), AudioRtSchedulePolicy::DEADLINE);
+    EXPECT_EQ(AudioRtSchedule::GetInstance().policies_.count(EXITED_TID), 0u);
+}
+} // namespace AudioStandard
+} // namespace OHOS
@@ -44,6 +44,8 @@ public:
     virtual std::shared_ptr<AudioXmlNode> GetChildrenNode() = 0;
     virtual std::shared_ptr<AudioXmlNode> GetCopyNode() = 0;
     virtual int32_t Config(const char *fileName, const char *encoding, int32_t options) = 0;
+    // Same as Config, for a document that is already in memory.
+    virtual int32_t ConfigMemory(const char *buffer, int32_t size, const char *encoding, int32_t options) = 0;
     virtual void MoveToNext() = 0;
     virtual void MoveToChildren() = 0;
 
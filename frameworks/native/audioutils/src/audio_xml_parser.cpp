@@ -38,11 +38,13 @@ const char *LIBXML_SO_PATH = "libxml2.z.so";
 struct XmlFuncHandle {
     void *libHandle = nullptr;
     xmlDoc *(*xmlReadFile)(const char *fileName, const char *encoding, int32_t options);
+    xmlDoc *(*xmlReadMemory)(const char *buffer, int32_t size, const char *url, const char *encoding, int32_t options);
     xmlNode *(*xmlDocGetRootElement)(xmlDoc *doc);
     bool (*xmlHasProp)(const xmlNode *node, const xmlChar *propName);
     xmlChar *(*xmlGetProp)(const xmlNode *node, const xmlChar *propName);
     void (*xmlFreeDoc)(xmlDoc *doc);
     void (*xmlFree)(xmlChar *content);
+    void (*xmlInitParser)();
     void (*xmlCleanupParser)();
     int32_t (*xmlStrcmp)(const xmlChar *propName1, const xmlChar *propName2);
     xmlChar *(*xmlNodeGetContent)(const xmlNode *cur);
@@ -62,6 +64,7 @@ public:
     std::shared_ptr<AudioXmlNode> GetChildrenNode() override;
     std::shared_ptr<AudioXmlNode> GetCopyNode() override;
     int32_t Config(const char *fileName, const char *encoding, int32_t options) override;
+    int32_t ConfigMemory(const char *buffer, int32_t size, const char *encoding, int32_t options) override;
     void MoveToNext() override;
     void MoveToChildren() override;
 
@@ -93,6 +96,8 @@ bool DlopenUtils::Init()
         xmlFuncHandle_->libHandle = libHandle;
         xmlFuncHandle_->xmlReadFile =
             reinterpret_cast<decltype(xmlFuncHandle_->xmlReadFile)>(dlsym(libHandle, "xmlReadFile"));
+        xmlFuncHandle_->xmlReadMemory =
+            reinterpret_cast<decltype(xmlFuncHandle_->xmlReadMemory)>(dlsym(libHandle, "xmlReadMemory"));
         xmlFuncHandle_->xmlDocGetRootElement =
             reinterpret_cast<decltype(xmlFuncHandle_->xmlDocGetRootElement)>(dlsym(libHandle, "xmlDocGetRootElement"));
         xmlFuncHandle_->xmlHasProp =
@@ -103,12 +108,19 @@ bool DlopenUtils::Init()
             reinterpret_cast<decltype(xmlFuncHandle_->xmlFreeDoc)>(dlsym(libHandle, "xmlFreeDoc"));
         xmlFuncHandle_->xmlFree =
             reinterpret_cast<decltype(xmlFuncHandle_->xmlFree)>(dlsym(libHandle, "xmlFree"));
+        xmlFuncHandle_->xmlInitParser =
+            reinterpret_cast<decltype(xmlFuncHandle_->xmlInitParser)>(dlsym(libHandle, "xmlInitParser"));
         xmlFuncHandle_->xmlCleanupParser =
             reinterpret_cast<decltype(xmlFuncHandle_->xmlCleanupParser)>(dlsym(libHandle, "xmlCleanupParser"));
         xmlFuncHandle_->xmlStrcmp =
             reinterpret_cast<decltype(xmlFuncHandle_->xmlStrcmp)>(dlsym(libHandle, "xmlStrcmp"));
         xmlFuncHandle_->xmlNodeGetContent =
             reinterpret_cast<decltype(xmlFuncHandle_->xmlNodeGetContent)>(dlsym(libHandle, "xmlNodeGetContent"));
+        // libxml2 sets up its globals lazily on the first parse, which is not safe when the first parses run on
+        // several threads at once
+        if (xmlFuncHandle_->xmlInitParser != nullptr) {
+            xmlFuncHandle_->xmlInitParser();
+        }
         AUDIO_INFO_LOG("Libxml2 open success");
     }
     refCount_.store(refCount_.load() + 1);
@@ -201,6 +213,17 @@ int32_t AudioXmlNodeInner::Config(const char *fileName, const char *encoding, in
     return SUCCESS;
 }
 
+int32_t AudioXmlNodeInner::ConfigMemory(const char *buffer, int32_t size, const char *encoding, int32_t options)
+{
+    CHECK_AND_RETURN_RET_LOG(xmlFuncHandle_ != nullptr, ERROR, "xmlFuncHandle is nullptr!");
+    CHECK_AND_RETURN_RET_LOG(xmlFuncHandle_->xmlReadMemory != nullptr, ERROR, "xmlReadMemory is nullptr!");
+    doc_ = xmlFuncHandle_->xmlReadMemory(buffer, size, nullptr, encoding, options);
+    CHECK_AND_RETURN_RET_LOG(doc_ != nullptr, ERROR, "xmlReadMemory failed! size :%{public}d", size);
+    curNode_ = xmlFuncHandle_->xmlDocGetRootElement(doc_);
+    CHECK_AND_RETURN_RET_LOG(curNode_ != nullptr, ERROR, "xmlDocGetRootElement failed!");
+    return SUCCESS;
+}
+
 void AudioXmlNodeInner::MoveToNext()
 {
     CHECK_AND_RETURN_LOG(curNode_ != nullptr, "curNode_ is nullptr! Cannot MoveToNext!");
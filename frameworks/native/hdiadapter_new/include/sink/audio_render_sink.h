@@ -110,7 +110,7 @@ private:
     void CheckLatencySignal(uint8_t *data, size_t len);
     void AdjustStereoToMono(char *data, uint64_t len);
     void AdjustAudioBalance(char *data, uint64_t len);
-    void CheckUpdateState(char *data, uint64_t len);
+    void CheckUpdateState(float peak);
     std::string GetAttrInfoStr(const struct AudioSampleAttributes &attrInfo);
     int32_t UpdateDPAttr(const std::string &dpInfo);
     std::string GetDPDeviceInfo(const std::string &condition);
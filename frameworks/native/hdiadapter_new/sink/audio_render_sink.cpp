@@ -245,19 +245,27 @@ int32_t AudioRenderSink::RenderFrame(char &data, uint64_t len, uint64_t &writeLe
     if (audioBalanceState_) {
         AdjustAudioBalance(&data, len);
     }
-    CheckUpdateState(&data, len);
-    if (switchDeviceMute_ || deviceConnectedFlag_) {
+    BufferDesc buffer = { reinterpret_cast<uint8_t *>(&data), len, len };
+    AudioStreamInfo streamInfo(static_cast<AudioSamplingRate>(attr_.sampleRate), AudioEncodingType::ENCODING_PCM,
+        static_cast<AudioSampleFormat>(attr_.format), static_cast<AudioChannel>(attr_.channel));
+    VolumeStats stats;
+    bool isMuteFrame = switchDeviceMute_ || deviceConnectedFlag_;
+    if (isMuteFrame) {
         Trace trace("AudioRenderSink::RenderFrame::renderEmpty");
+        // max amplitude reports what the streams rendered, so it is taken before the frame is muted
+        VolumeTools::CountVolumeLevel(buffer, streamInfo.format, streamInfo.channels, stats);
+        CheckUpdateState(stats.peak);
         if (memset_s(reinterpret_cast<void *>(&data), static_cast<size_t>(len), 0, static_cast<size_t>(len)) != EOK) {
             AUDIO_WARNING_LOG("call memset_s fail");
         }
     }
     CheckLatencySignal(reinterpret_cast<uint8_t *>(&data), len);
 
-    BufferDesc buffer = { reinterpret_cast<uint8_t *>(&data), len, len };
-    AudioStreamInfo streamInfo(static_cast<AudioSamplingRate>(attr_.sampleRate), AudioEncodingType::ENCODING_PCM,
-        static_cast<AudioSampleFormat>(attr_.format), static_cast<AudioChannel>(attr_.channel));
-    VolumeTools::DfxOperation(buffer, streamInfo, logUtilsTag_, volumeDataCount_);
+    // the dfx volume reports what the device gets, unmuted frames take the max amplitude from the same pass
+    VolumeTools::DfxOperation(buffer, streamInfo, logUtilsTag_, volumeDataCount_, stats);
+    if (!isMuteFrame) {
+        CheckUpdateState(stats.peak);
+    }
     if (AudioDump::GetInstance().GetVersionType() == DumpFileUtil::BETA_VERSION) {
         DumpFileUtil::WriteDumpFile(dumpFile_, static_cast<void *>(&data), len);
         AudioCacheMgr::GetInstance().CacheData(dumpFileName_, static_cast<void *>(&data), len);
@@ -1081,14 +1089,14 @@ void AudioRenderSink::AdjustAudioBalance(char *data, uint64_t len)
     }
 }
 
-void AudioRenderSink::CheckUpdateState(char *data, uint64_t len)
+void AudioRenderSink::CheckUpdateState(float peak)
 {
     if (startUpdate_) {
         if (renderFrameNum_ == 0) {
             last10FrameStartTime_ = ClockTime::GetCurNano();
         }
         renderFrameNum_++;
-        maxAmplitude_ = UpdateMaxAmplitude(static_cast<ConvertHdiFormat>(attr_.format), data, len);
+        maxAmplitude_ = peak;
         if (renderFrameNum_ == GET_MAX_AMPLITUDE_FRAMES_THRESHOLD) {
             renderFrameNum_ = 0;
             if (last10FrameStartTime_ > lastGetMaxAmplitudeTime_) {
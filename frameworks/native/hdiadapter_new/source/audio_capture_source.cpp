@@ -1236,7 +1236,8 @@ void AudioCaptureSource::CaptureThreadLoop(void)
     AUDIO_INFO_LOG("start, sourceType: %{public}d, captureDataLen: %{public}u", attr_.sourceType, captureDataLen);
     std::vector<uint8_t> buffer;
     buffer.resize(captureDataLen);
-    ScheduleThreadInServer(getpid(), gettid());
+    ScheduleThreadInServerWithPeriod(getpid(), gettid(),
+        static_cast<uint64_t>(FRAME_TIME_LEN_MS) * AUDIO_NS_PER_SECOND / SECOND_TO_MILLISECOND, 0);
     while (isCaptureThreadRunning_) {
         Trace trace("CaptureRefInput");
         uint64_t replyBytes = 0;
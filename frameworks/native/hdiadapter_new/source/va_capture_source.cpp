@@ -126,7 +126,8 @@ std::shared_ptr<VAInputStreamAttribute> VACaptureSource::MakeVAStreamAttributeFr
 int32_t VACaptureSource::InitOperator()
 {
     CHECK_AND_RETURN_RET_LOG(inputStream_ != nullptr, ERR_OPERATION_FAILED, "input stream is nullptr");
-    uint32_t bufferCapacity = attr_.bufferSize * 2;
+    // page aligned so the operator can map the ring twice and copy across the wrap in one go
+    uint32_t bufferCapacity = static_cast<uint32_t>(AudioMirroredRing::RoundUpSize(attr_.bufferSize * 2));
     std::shared_ptr<VASharedBuffer> vaBuffer = VASharedBuffer::CreateFromLocal(bufferCapacity);
     CHECK_AND_RETURN_RET_LOG(vaBuffer != nullptr, ERR_OPERATION_FAILED, "vaBuffer is null");
     bufferOperator_ = std::make_shared<VASharedBufferOperator>(*vaBuffer);
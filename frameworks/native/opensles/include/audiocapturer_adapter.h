@@ -20,6 +20,7 @@
 #include <OpenSLES_Platform.h>
 #include <iostream>
 #include <map>
+#include <set>
 #include <audio_capturer.h>
 #include <audio_system_manager.h>
 #include <readorwritecallback_adapter.h>
@@ -31,8 +32,9 @@ public:
     static AudioCapturerAdapter* GetInstance();
     std::shared_ptr<AudioCapturer> GetAudioCapturerById(SLuint32 id);
     void EraseAudioCapturerById(SLuint32 id);
-    SLresult CreateAudioCapturerAdapter
-        (SLuint32 id, SLDataSource *dataSource, SLDataSink *dataSink, AudioStreamType streamType);
+    SLresult CreateAudioCapturerAdapter(SLuint32 id, SLDataSource *dataSource, SLDataSink *dataSink,
+        AudioStreamType streamType, bool isLowLatency = false);
+    bool IsFastCaptureById(SLuint32 id);
     SLresult SetCaptureStateAdapter(SLuint32 id, SLuint32 state);
     SLresult GetCaptureStateAdapter(SLuint32 id, SLuint32 *state);
     SLresult EnqueueAdapter(SLuint32 id, const void *buffer, SLuint32 size);
@@ -47,6 +49,8 @@ private:
     std::map<SLuint32, std::shared_ptr<AudioCapturer>> captureMap_;
     std::shared_ptr<ReadOrWriteCallbackAdapter> callbackPtr_;
     std::map<SLuint32, std::shared_ptr<ReadOrWriteCallbackAdapter>> callbackMap_;
+    // ids of the recorders running on the fast (mmap) path
+    std::set<SLuint32> fastCaptureIds_;
 
     void ConvertPcmFormat(SLDataFormat_PCM *slFormat, AudioCapturerParams *capturerParams);
     AudioSampleFormat SlToOhosSampelFormat(SLDataFormat_PCM *pcmFormat);
@@ -20,6 +20,7 @@
 #include <OpenSLES_Platform.h>
 #include <iostream>
 #include <map>
+#include <set>
 #include <audio_renderer.h>
 #include <audio_system_manager.h>
 #include <readorwritecallback_adapter.h>
@@ -31,8 +32,9 @@ public:
     static AudioPlayerAdapter* GetInstance();
     std::shared_ptr<AudioRenderer> GetAudioRenderById(SLuint32 id);
     void EraseAudioRenderById(SLuint32 id);
-    SLresult CreateAudioPlayerAdapter
-        (SLuint32 id, SLDataSource *dataSource, SLDataSink *dataSink, AudioStreamType streamType);
+    SLresult CreateAudioPlayerAdapter(SLuint32 id, SLDataSource *dataSource, SLDataSink *dataSink,
+        AudioStreamType streamType, bool isLowLatency = false);
+    bool IsFastRenderById(SLuint32 id);
     SLresult SetPlayStateAdapter(SLuint32 id, SLuint32 state);
     SLresult GetPlayStateAdapter(SLuint32 id, SLuint32 *state);
     SLresult SetVolumeLevelAdapter(SLuint32 id, SLmillibel level);
@@ -51,7 +53,10 @@ private:
     std::map<SLuint32, std::shared_ptr<AudioRenderer>> renderMap_;
     std::shared_ptr<ReadOrWriteCallbackAdapter> callbackPtr_;
     std::map<SLuint32, std::shared_ptr<ReadOrWriteCallbackAdapter>> callbackMap_;
+    // ids of the players running on the fast (mmap) path
+    std::set<SLuint32> fastRenderIds_;
 
+    SLresult EnqueueFastAdapter(std::shared_ptr<AudioRenderer> audioRenderer, const void *buffer, SLuint32 size);
     void ConvertPcmFormat(SLDataFormat_PCM *slFormat, AudioRendererParams *rendererParams);
     AudioSampleFormat SlToOhosSampelFormat(SLDataFormat_PCM *pcmFormat);
     AudioSamplingRate SlToOhosSamplingRate(SLDataFormat_PCM *pcmFormat);
@@ -19,6 +19,7 @@
 #include <OpenSLES.h>
 #include <OpenSLES_OpenHarmony.h>
 #include <OpenSLES_Platform.h>
+#include <OpenSLES_OpenHarmony_Ext.h>
 
 #include <iostream>
 #include <cstdlib>
@@ -75,6 +76,7 @@ struct IVolume {
 struct CEngine {
     IObject mObject;
     IEngine mEngine;
+    SLuint32 mPerformanceMode;
 };
 
 struct CAudioPlayer {
@@ -17,6 +17,7 @@
 #endif
 
 #include <common.h>
+#include <audio_errors.h>
 
 using namespace std;
 using namespace OHOS;
@@ -50,10 +51,16 @@ void AudioCapturerAdapter::EraseAudioCapturerById(SLuint32 id)
     AUDIO_INFO_LOG("id: %{public}lu", id);
     captureMap_.erase(id);
     callbackMap_.erase(id);
+    fastCaptureIds_.erase(id);
+}
+
+bool AudioCapturerAdapter::IsFastCaptureById(SLuint32 id)
+{
+    return fastCaptureIds_.count(id) > 0;
 }
 
 SLresult AudioCapturerAdapter::CreateAudioCapturerAdapter(SLuint32 id, SLDataSource *dataSource,
-    SLDataSink *dataSink, AudioStreamType streamType)
+    SLDataSink *dataSink, AudioStreamType streamType, bool isLowLatency)
 {
     AUDIO_INFO_LOG("in");
     SLDataFormat_PCM *pcmFormat = (SLDataFormat_PCM *)dataSink->pFormat;
@@ -66,7 +73,7 @@ SLresult AudioCapturerAdapter::CreateAudioCapturerAdapter(SLuint32 id, SLDataSou
     capturerOptions.streamInfo.format = capturerParams.audioSampleFormat;
     capturerOptions.streamInfo.channels = capturerParams.audioChannel;
     capturerOptions.capturerInfo.sourceType = SourceType::SOURCE_TYPE_MIC;
-    capturerOptions.capturerInfo.capturerFlags = 0;
+    capturerOptions.capturerInfo.capturerFlags = isLowLatency ? AUDIO_FLAG_MMAP : AUDIO_FLAG_NORMAL;
     capturerOptions.capturerInfo.recorderType = RECORDER_TYPE_OPENSL_ES;
     shared_ptr<AudioCapturer> capturerHolder = AudioCapturer::CreateCapturer(capturerOptions);
     CHECK_AND_RETURN_RET_LOG(capturerHolder, SL_RESULT_RESOURCE_ERROR,
@@ -75,6 +82,13 @@ SLresult AudioCapturerAdapter::CreateAudioCapturerAdapter(SLuint32 id, SLDataSou
     AUDIO_INFO_LOG("CreateAudioCapturerAdapter ID: %{public}lu", id);
     capturerHolder->SetCaptureMode(CAPTURE_MODE_CALLBACK);
     captureMap_.insert(make_pair(id, capturerHolder));
+    AudioCapturerInfo capturerInfo;
+    capturerHolder->GetCapturerInfo(capturerInfo);
+    if (isLowLatency && capturerInfo.capturerFlags == AUDIO_FLAG_MMAP) {
+        fastCaptureIds_.insert(id);
+    } else if (isLowLatency) {
+        AUDIO_WARNING_LOG("fast path not available, ID: %{public}lu falls back to normal", id);
+    }
     return SL_RESULT_SUCCESS;
 }
 
@@ -147,6 +161,15 @@ SLresult AudioCapturerAdapter::EnqueueAdapter(SLuint32 id, const void *buffer, S
     bufDesc.buffer = (uint8_t*) buffer;
     bufDesc.bufLength = size;
     bufDesc.dataLength = size;
+    if (IsFastCaptureById(id)) {
+        // GetBuffer hands out the span of the mmap stream, give it back as that span
+        BufferDesc spanDesc = {};
+        CHECK_AND_RETURN_RET_LOG(audioCapturer->GetBufferDesc(spanDesc) == SUCCESS && spanDesc.buffer != nullptr,
+            SL_RESULT_RESOURCE_ERROR, "get span failed");
+        CHECK_AND_RETURN_RET_LOG(size <= spanDesc.bufLength, SL_RESULT_BUFFER_INSUFFICIENT,
+            "size %{public}lu over span size %{public}zu", size, spanDesc.bufLength);
+        bufDesc.bufLength = (bufDesc.buffer == spanDesc.buffer) ? spanDesc.bufLength : size;
+    }
     AUDIO_INFO_LOG("bufferlength: %{public}zu", bufDesc.bufLength);
     audioCapturer->Enqueue(bufDesc);
     return SL_RESULT_SUCCESS;
@@ -17,6 +17,7 @@
 #endif
 
 #include <common.h>
+#include <audio_errors.h>
 
 using namespace std;
 using namespace OHOS;
@@ -48,11 +49,17 @@ void AudioPlayerAdapter::EraseAudioRenderById(SLuint32 id)
     AUDIO_INFO_LOG("id: %{public}lu", id);
     renderMap_.erase(id);
     callbackMap_.erase(id);
+    fastRenderIds_.erase(id);
     return;
 }
 
-SLresult AudioPlayerAdapter::CreateAudioPlayerAdapter
-    (SLuint32 id, SLDataSource *dataSource, SLDataSink *dataSink, AudioStreamType streamType)
+bool AudioPlayerAdapter::IsFastRenderById(SLuint32 id)
+{
+    return fastRenderIds_.count(id) > 0;
+}
+
+SLresult AudioPlayerAdapter::CreateAudioPlayerAdapter(SLuint32 id, SLDataSource *dataSource, SLDataSink *dataSink,
+    AudioStreamType streamType, bool isLowLatency)
 {
     SLDataFormat_PCM *pcmFormat = (SLDataFormat_PCM *)dataSource->pFormat;
     AudioRendererParams rendererParams;
@@ -65,7 +72,7 @@ SLresult AudioPlayerAdapter::CreateAudioPlayerAdapter
     rendererOptions.streamInfo.channels = rendererParams.channelCount;
     rendererOptions.rendererInfo.contentType = ContentType::CONTENT_TYPE_MUSIC;
     rendererOptions.rendererInfo.streamUsage = StreamUsage::STREAM_USAGE_MEDIA;
-    rendererOptions.rendererInfo.rendererFlags = RENDERER_NEW;
+    rendererOptions.rendererInfo.rendererFlags = isLowLatency ? AUDIO_FLAG_MMAP : RENDERER_NEW;
     /*Set isOffloadAllowed before renderer creation when setOffloadAllowed is disabled. */
     rendererOptions.rendererInfo.isOffloadAllowed = false;
     rendererOptions.rendererInfo.playerType = PLAYER_TYPE_OPENSL_ES;
@@ -77,6 +84,11 @@ SLresult AudioPlayerAdapter::CreateAudioPlayerAdapter
     AUDIO_INFO_LOG("ID: %{public}lu", id);
     rendererHolder->SetRenderMode(RENDER_MODE_CALLBACK);
     renderMap_.insert(make_pair(id, rendererHolder));
+    if (isLowLatency && rendererHolder->IsFastRenderer()) {
+        fastRenderIds_.insert(id);
+    } else if (isLowLatency) {
+        AUDIO_WARNING_LOG("fast path not available, ID: %{public}lu falls back to normal", id);
+    }
     return SL_RESULT_SUCCESS;
 }
 
@@ -182,6 +194,10 @@ SLresult AudioPlayerAdapter::EnqueueAdapter(SLuint32 id, const void *buffer, SLu
         return SL_RESULT_RESOURCE_ERROR;
     }
 
+    if (IsFastRenderById(id)) {
+        return EnqueueFastAdapter(audioRenderer, buffer, size);
+    }
+
     BufferDesc bufDesc = {};
     bufDesc.buffer = (uint8_t*) buffer;
     bufDesc.bufLength = size;
@@ -190,6 +206,25 @@ SLresult AudioPlayerAdapter::EnqueueAdapter(SLuint32 id, const void *buffer, SLu
     return SL_RESULT_SUCCESS;
 }
 
+SLresult AudioPlayerAdapter::EnqueueFastAdapter(shared_ptr<AudioRenderer> audioRenderer, const void *buffer,
+    SLuint32 size)
+{
+    // GetBuffer hands out the span of the mmap stream, data written there is enqueued as that span
+    BufferDesc spanDesc = {};
+    CHECK_AND_RETURN_RET_LOG(audioRenderer->GetBufferDesc(spanDesc) == SUCCESS && spanDesc.buffer != nullptr,
+        SL_RESULT_RESOURCE_ERROR, "get span failed");
+    CHECK_AND_RETURN_RET_LOG(size <= spanDesc.bufLength, SL_RESULT_BUFFER_INSUFFICIENT,
+        "size %{public}lu over span size %{public}zu", size, spanDesc.bufLength);
+
+    BufferDesc bufDesc = {};
+    bufDesc.buffer = (uint8_t*) buffer;
+    bufDesc.bufLength = (bufDesc.buffer == spanDesc.buffer) ? spanDesc.bufLength : size;
+    bufDesc.dataLength = size;
+    CHECK_AND_RETURN_RET_LOG(audioRenderer->Enqueue(bufDesc) == SUCCESS, SL_RESULT_RESOURCE_ERROR,
+        "enqueue failed");
+    return SL_RESULT_SUCCESS;
+}
+
 SLresult AudioPlayerAdapter::ClearAdapter(SLuint32 id)
 {
     shared_ptr<AudioRenderer> audioRenderer = GetAudioRenderById(id);
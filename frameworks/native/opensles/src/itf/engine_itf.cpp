@@ -56,7 +56,8 @@ static SLresult CreateAudioPlayer(
     IOHBufferQueueInit(&thiz->mBufferQueue, SL_IID_PLAY, audioPlayerId);
     *pPlayer = &thiz->mObject.mItf;
     SLresult ret = AudioPlayerAdapter::GetInstance()->
-        CreateAudioPlayerAdapter(audioPlayerId, pAudioSrc, pAudioSnk, OHOS::AudioStandard::STREAM_MUSIC);
+        CreateAudioPlayerAdapter(audioPlayerId, pAudioSrc, pAudioSnk, OHOS::AudioStandard::STREAM_MUSIC,
+        thiz->mObject.mEngine->mPerformanceMode == SL_OH_PERFORMANCE_MODE_LOW_LATENCY);
     if (ret != SL_RESULT_SUCCESS) {
         return SL_RESULT_RESOURCE_ERROR;
     }
@@ -82,7 +83,8 @@ static SLresult CreateAudioRecorder(
     IOHBufferQueueInit(&thiz->mBufferQueue, SL_IID_RECORD, audioRecorderId);
     *pRecorder = &thiz->mObject.mItf;
     SLresult ret = AudioCapturerAdapter::GetInstance()->
-        CreateAudioCapturerAdapter(audioRecorderId, pAudioSrc, pAudioSnk, OHOS::AudioStandard::STREAM_MUSIC);
+        CreateAudioCapturerAdapter(audioRecorderId, pAudioSrc, pAudioSnk, OHOS::AudioStandard::STREAM_MUSIC,
+        thiz->mObject.mEngine->mPerformanceMode == SL_OH_PERFORMANCE_MODE_LOW_LATENCY);
     if (ret != SL_RESULT_SUCCESS) {
         return SL_RESULT_RESOURCE_ERROR;
     }
@@ -15,6 +15,25 @@
 
 #include <common.h>
 
+static SLresult GetPerformanceMode(SLuint32 numOptions, const SLEngineOption *pEngineOptions,
+    SLuint32 *performanceMode)
+{
+    if (pEngineOptions == nullptr) {
+        return SL_RESULT_SUCCESS;
+    }
+    for (SLuint32 i = 0; i < numOptions; i++) {
+        if (pEngineOptions[i].feature != SL_ENGINEOPTION_OH_PERFORMANCE_MODE) {
+            continue;
+        }
+        if (pEngineOptions[i].data != SL_OH_PERFORMANCE_MODE_NONE &&
+            pEngineOptions[i].data != SL_OH_PERFORMANCE_MODE_LOW_LATENCY) {
+            return SL_RESULT_PARAMETER_INVALID;
+        }
+        *performanceMode = pEngineOptions[i].data;
+    }
+    return SL_RESULT_SUCCESS;
+}
+
 SLresult SLAPIENTRY slCreateEngine(SLObjectItf *pEngine, SLuint32 numOptions,
     const SLEngineOption *pEngineOptions, SLuint32 numInterfaces,
     const SLInterfaceID *pInterfaceIds, const SLboolean *pInterfaceRequired)
@@ -22,11 +41,16 @@ SLresult SLAPIENTRY slCreateEngine(SLObjectItf *pEngine, SLuint32 numOptions,
     if (pEngine == nullptr) {
         return SL_RESULT_PARAMETER_INVALID;
     }
+    SLuint32 performanceMode = SL_OH_PERFORMANCE_MODE_NONE;
+    if (GetPerformanceMode(numOptions, pEngineOptions, &performanceMode) != SL_RESULT_SUCCESS) {
+        return SL_RESULT_PARAMETER_INVALID;
+    }
     ClassTable *engineClass = ObjectIdToClass(SL_OBJECTID_ENGINE);
     CEngine *thiz = (CEngine *) Construct(engineClass, nullptr);
     if (thiz == nullptr) {
         return SL_RESULT_PARAMETER_INVALID;
     }
+    thiz->mPerformanceMode = performanceMode;
     IObjectInit(&thiz->mObject);
     IEngineInit(&thiz->mEngine);
     *pEngine = &thiz->mObject.mItf;
@@ -1599,5 +1599,72 @@ HWTEST(AudioOpenslesPlayerUnitTest, Audio_Opensles_Capture_GetPositionUpdatePeri
     SLresult result = (*captureItf_)->GetPositionUpdatePeriod(nullptr, nullptr);
     EXPECT_TRUE(result == SL_RESULT_FEATURE_UNSUPPORTED);
 }
+
+HWTEST(AudioOpenslesPlayerUnitTest, Audio_Opensles_CreateEngine_PerformanceMode_001, TestSize.Level1)
+{
+    SLObjectItf engineObject = nullptr;
+    SLEngineOption engineOption = {SL_ENGINEOPTION_OH_PERFORMANCE_MODE, SL_OH_PERFORMANCE_MODE_LOW_LATENCY + 1};
+    SLresult result = slCreateEngine(&engineObject, 1, &engineOption, 0, nullptr, nullptr);
+    EXPECT_TRUE(result == SL_RESULT_PARAMETER_INVALID);
+
+    engineOption.data = SL_OH_PERFORMANCE_MODE_LOW_LATENCY;
+    result = slCreateEngine(&engineObject, 1, &engineOption, 0, nullptr, nullptr);
+    EXPECT_TRUE(result == SL_RESULT_SUCCESS);
+    EXPECT_EQ(((CEngine *)engineObject)->mPerformanceMode, SL_OH_PERFORMANCE_MODE_LOW_LATENCY);
+    (*engineObject)->Destroy(engineObject);
+}
+
+HWTEST(AudioOpenslesPlayerUnitTest, Audio_Opensles_CreateAudioPlayer_LowLatency_001, TestSize.Level1)
+{
+    SLObjectItf engineObject = nullptr;
+    SLEngineItf engineEngine = nullptr;
+    SLEngineOption engineOption = {SL_ENGINEOPTION_OH_PERFORMANCE_MODE, SL_OH_PERFORMANCE_MODE_LOW_LATENCY};
+    ASSERT_TRUE(slCreateEngine(&engineObject, 1, &engineOption, 0, nullptr, nullptr) == SL_RESULT_SUCCESS);
+    (*engineObject)->Realize(engineObject, SL_BOOLEAN_FALSE);
+    (*engineObject)->GetInterface(engineObject, SL_IID_ENGINE, &engineEngine);
+
+    SLDataLocator_BufferQueue slBufferQueue = {
+        SL_DATALOCATOR_BUFFERQUEUE,
+        0
+    };
+    SLDataFormat_PCM pcmFormat = {
+        SL_DATAFORMAT_PCM,
+        AudioChannel::STEREO,
+        SL_SAMPLINGRATE_48,
+        SL_PCMSAMPLEFORMAT_FIXED_16,
+        0,
+        0,
+        0
+    };
+    SLDataLocator_OutputMix slOutputMix = {SL_DATALOCATOR_OUTPUTMIX, nullptr};
+    SLDataSink slSink = {&slOutputMix, nullptr};
+    SLDataSource slSource = {&slBufferQueue, &pcmFormat};
+    SLObjectItf playerObject = nullptr;
+    SLresult result = (*engineEngine)->CreateAudioPlayer(engineEngine, &playerObject, &slSource,
+        &slSink, 0, nullptr, nullptr);
+    ASSERT_TRUE(result == SL_RESULT_SUCCESS);
+
+    // the fast path is only a request, the adapter has to follow what the renderer really got
+    SLuint32 id = ((CAudioPlayer *)playerObject)->mPlay.mId;
+    shared_ptr<AudioRenderer> audioRenderer = AudioPlayerAdapter::GetInstance()->GetAudioRenderById(id);
+    ASSERT_NE(audioRenderer, nullptr);
+    bool isFast = AudioPlayerAdapter::GetInstance()->IsFastRenderById(id);
+    EXPECT_EQ(isFast, audioRenderer->IsFastRenderer());
+    if (!isFast) {
+        // the fallback to the normal renderer is checked above, the rest needs the fast path
+        (*playerObject)->Destroy(playerObject);
+        (*engineObject)->Destroy(engineObject);
+        GTEST_SKIP() << "no fast renderer on this device";
+    }
+
+    SLuint8 *buffer = nullptr;
+    SLuint32 size = 0;
+    AudioPlayerAdapter::GetInstance()->GetBufferAdapter(id, &buffer, &size);
+    EXPECT_NE(buffer, nullptr);
+    result = AudioPlayerAdapter::GetInstance()->EnqueueAdapter(id, buffer, size + 1);
+    EXPECT_TRUE(result == SL_RESULT_BUFFER_INSUFFICIENT);
+    (*playerObject)->Destroy(playerObject);
+    (*engineObject)->Destroy(engineObject);
+}
 } // namespace AudioStandard
 } // namespace OHOS
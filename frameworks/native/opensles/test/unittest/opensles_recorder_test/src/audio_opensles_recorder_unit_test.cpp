@@ -962,5 +962,72 @@ HWTEST(AudioOpenslesRecorderUnitTest, Audio_Opensles_Capture_SlToOhosChannel_012
     EXPECT_TRUE(result == SL_RESULT_SUCCESS);
     (*pcmCapturerObject_)->Destroy(pcmCapturerObject_);
 }
+
+HWTEST(AudioOpenslesRecorderUnitTest, Audio_Opensles_Capture_CreateAudioRecorder_LowLatency_001, TestSize.Level1)
+{
+    SLObjectItf engineObject = nullptr;
+    SLEngineItf engineEngine = nullptr;
+    SLEngineOption engineOption = {SL_ENGINEOPTION_OH_PERFORMANCE_MODE, SL_OH_PERFORMANCE_MODE_LOW_LATENCY};
+    ASSERT_TRUE(slCreateEngine(&engineObject, 1, &engineOption, 0, nullptr, nullptr) == SL_RESULT_SUCCESS);
+    (*engineObject)->Realize(engineObject, SL_BOOLEAN_FALSE);
+    (*engineObject)->GetInterface(engineObject, SL_IID_ENGINE, &engineEngine);
+
+    SLDataLocator_IODevice io_device = {
+        SL_DATALOCATOR_IODEVICE,
+        SL_IODEVICE_AUDIOINPUT,
+        SL_DEFAULTDEVICEID_AUDIOINPUT,
+        NULL
+    };
+    SLDataSource audioSource = {
+        &io_device,
+        NULL
+    };
+    SLDataLocator_BufferQueue buffer_queue = {
+        SL_DATALOCATOR_BUFFERQUEUE,
+        3
+    };
+    SLDataFormat_PCM format_pcm = {
+        SL_DATAFORMAT_PCM,
+        OHOS::AudioStandard::AudioChannel::STEREO,
+        OHOS::AudioStandard::AudioSamplingRate::SAMPLE_RATE_48000,
+        SL_PCMSAMPLEFORMAT_FIXED_16,
+        0,
+        0,
+        0
+    };
+    SLDataSink audioSink = {
+        &buffer_queue,
+        &format_pcm
+    };
+    SLObjectItf recorderObject = nullptr;
+    SLresult result = (*engineEngine)->CreateAudioRecorder(engineEngine, &recorderObject, &audioSource,
+        &audioSink, 0, nullptr, nullptr);
+    ASSERT_TRUE(result == SL_RESULT_SUCCESS);
+
+    // the fast path is only a request, the adapter has to follow what the capturer really got
+    SLuint32 id = ((CAudioRecorder *)recorderObject)->mId;
+    shared_ptr<AudioCapturer> audioCapturer = AudioCapturerAdapter::GetInstance()->GetAudioCapturerById(id);
+    ASSERT_NE(audioCapturer, nullptr);
+    AudioCapturerInfo capturerInfo;
+    audioCapturer->GetCapturerInfo(capturerInfo);
+    bool isFast = AudioCapturerAdapter::GetInstance()->IsFastCaptureById(id);
+    EXPECT_EQ(isFast, capturerInfo.capturerFlags == AUDIO_FLAG_MMAP);
+    if (!isFast) {
+        // the fallback to the normal capturer is checked above, the rest needs the fast path
+        (*recorderObject)->Destroy(recorderObject);
+        (*engineObject)->Destroy(engineObject);
+        GTEST_SKIP() << "no fast capturer on this device";
+    }
+
+    SLuint8 *buffer = nullptr;
+    SLuint32 size = 0;
+    AudioCapturerAdapter::GetInstance()->GetBufferAdapter(id, &buffer, &size);
+    EXPECT_NE(buffer, nullptr);
+    result = AudioCapturerAdapter::GetInstance()->EnqueueAdapter(id, buffer, size + 1);
+    EXPECT_TRUE(result == SL_RESULT_BUFFER_INSUFFICIENT);
+    (*recorderObject)->Destroy(recorderObject);
+    EXPECT_FALSE(AudioCapturerAdapter::GetInstance()->IsFastCaptureById(id));
+    (*engineObject)->Destroy(engineObject);
+}
 } // namespace AudioStandard
 } // namespace OHOS
@@ -16,6 +16,7 @@
 #ifndef AUDIO_TONEPLAYER_IMPL_H
 #define AUDIO_TONEPLAYER_IMPL_H
 
+#include <array>
 #include <map>
 #include <thread>
 #include <mutex>
@@ -53,6 +54,16 @@ public:
     };
 
 private:
+    // sine of one wave, advanced by rotating a unit phasor instead of evaluating sin() on an ever growing index
+    struct ToneOscillator {
+        uint16_t freq = 0;
+        uint32_t nextSample = 0; // sampleCount_ the phasor is positioned at
+        double cosPhase = 1.0;
+        double sinPhase = 0.0;
+        double cosStep = 1.0;
+        double sinStep = 0.0;
+    };
+
     bool InitAudioRenderer();
     bool InitToneWaveInfo();
     bool AudioToneSequenceGen(BufferDesc &bufDesc);
@@ -62,6 +73,7 @@ private:
     void GetCurrentSegmentUpdated();
     bool CheckToneContinuity();
     int32_t GetSamples(uint16_t *freqs, int8_t *buffer, uint32_t samples);
+    void ResetOscillator(ToneOscillator &oscillator, uint16_t freq, uint32_t sampleIndex);
     static std::string Str16ToStr8(std::u16string str);
     static std::string GetCountryCode();
 
@@ -87,6 +99,7 @@ private:
     uint32_t maxSample_ = 0;  // Maximum number of audio samples played (maximun tone duration)
     uint32_t samplingRate_ = 0;  // Audio Sampling rate
     uint32_t sampleCount_ = 0; // Initial value should be zero before any new Tone renderering
+    std::array<ToneOscillator, TONEINFO_MAX_WAVES + 1> oscillators_ = {};
 
     // to wait for audio rendere callback completion after a change is requested
     FILE *dumpFile_ = nullptr;
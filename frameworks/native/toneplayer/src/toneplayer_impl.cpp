@@ -321,24 +321,41 @@ bool TonePlayerImpl::ContinueToneplay(uint32_t reqSample, int8_t *audioBuffer)
     return true;
 }
 
+void TonePlayerImpl::ResetOscillator(ToneOscillator &oscillator, uint16_t freq, uint32_t sampleIndex)
+{
+    // reduce the start phase in integers, so it is exact however far into the tone sampleIndex is
+    uint64_t phaseNum = (static_cast<uint64_t>(freq) * sampleIndex) % samplingRate_;
+    double startPhase = CDOUBLE * M_PI * static_cast<double>(phaseNum) / samplingRate_;
+    double step = CDOUBLE * M_PI * freq / samplingRate_;
+    oscillator.freq = freq;
+    oscillator.nextSample = sampleIndex;
+    oscillator.cosPhase = cos(startPhase);
+    oscillator.sinPhase = sin(startPhase);
+    oscillator.cosStep = cos(step);
+    oscillator.sinStep = sin(step);
+}
+
 int32_t TonePlayerImpl::GetSamples(uint16_t *freqs, int8_t *buffer, uint32_t reqSamples)
 {
     Trace trace("GetSamples");
-    uint32_t index;
+    CHECK_AND_RETURN_RET_LOG(samplingRate_ > 0, ERR_INVALID_PARAM, "invalid samplingRate_");
     uint8_t *data;
     uint16_t freqVal;
-    float pi = 3.1415926;
     for (uint32_t i = 0; i <= TONEINFO_MAX_WAVES; i++) {
         if (freqs[i] == 0) {
             break;
         }
         freqVal = freqs[i];
         AUDIO_DEBUG_LOG("GetSamples Freq: %{public}d sampleCount_: %{public}d", freqVal, sampleCount_);
-        index = sampleCount_;
+        ToneOscillator &oscillator = oscillators_[i];
+        if (oscillator.freq != freqVal || oscillator.nextSample != sampleCount_) {
+            ResetOscillator(oscillator, freqVal, sampleCount_);
+        }
+        double cosPhase = oscillator.cosPhase;
+        double sinPhase = oscillator.sinPhase;
         data = reinterpret_cast<uint8_t*>(buffer);
-        double factor = freqVal * 2 * pi / samplingRate_; // 2 is a parameter in the sine wave formula
         for (uint32_t idx = 0; idx < reqSamples; idx++) {
-            int16_t sample = amplitudeType_ * sin(factor * index);
+            int16_t sample = amplitudeType_ * sinPhase;
             uint32_t result;
             if (i == 0) {
                 result = (sample & 0xFF);
@@ -353,8 +370,15 @@ int32_t TonePlayerImpl::GetSamples(uint16_t *freqs, int8_t *buffer, uint32_t req
                 *data += (result >> BIT8) + ((sample & 0xFF00) >> BIT8);
                 data++;
             }
-            index++;
+            double nextCos = cosPhase * oscillator.cosStep - sinPhase * oscillator.sinStep;
+            sinPhase = sinPhase * oscillator.cosStep + cosPhase * oscillator.sinStep;
+            cosPhase = nextCos;
         }
+        // rounding makes the phasor drift off the unit circle slowly, pull it back once per block
+        double norm = sqrt(cosPhase * cosPhase + sinPhase * sinPhase);
+        oscillator.cosPhase = cosPhase / norm;
+        oscillator.sinPhase = sinPhase / norm;
+        oscillator.nextSample = sampleCount_ + reqSamples;
     }
     sampleCount_ += reqSamples;
     return 0;
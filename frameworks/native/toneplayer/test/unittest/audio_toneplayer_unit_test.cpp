@@ -13,6 +13,8 @@
  * limitations under the License.
  */
 
+#include <cmath>
+#include <vector>
 #include <gtest/gtest.h>
 #include "tone_player_impl.h"
 #include "audio_renderer_private.h"
@@ -1412,5 +1414,146 @@ HWTEST(AudioToneplayerUnitTest, TonePlayerImpl_026, TestSize.Level4)
     bool ret = toneplayer->CheckToneStopped();
     EXPECT_EQ(ret, true);
 }
+
+namespace {
+constexpr uint32_t TONE_SAMPLE_RATE = 48000;
+constexpr uint32_t TONE_BLOCK_SAMPLES = 960; // 20ms, as requested by the renderer callback
+
+// the previous generator: sin() of the absolute sample index, per sample and per wave
+std::vector<int16_t> GenerateLegacyTone(const std::vector<uint16_t> &freqs, int32_t amplitude,
+    uint32_t startSample, uint32_t sampleNum)
+{
+    float pi = 3.1415926;
+    std::vector<int16_t> samples(sampleNum, 0);
+    for (uint16_t freq : freqs) {
+        double factor = freq * 2 * pi / TONE_SAMPLE_RATE;
+        for (uint32_t i = 0; i < sampleNum; i++) {
+            int16_t sample = amplitude * sin(factor * (startSample + i));
+            samples[i] = static_cast<int16_t>(static_cast<uint16_t>(samples[i]) + static_cast<uint16_t>(sample));
+        }
+    }
+    return samples;
+}
+
+// exact phase reduced in integers, truncated to int16 like the generators do
+int16_t GetIdealToneSample(const std::vector<uint16_t> &freqs, int32_t amplitude, uint32_t index)
+{
+    uint16_t sum = 0;
+    for (uint16_t freq : freqs) {
+        uint64_t phaseNum = (static_cast<uint64_t>(freq) * index) % TONE_SAMPLE_RATE;
+        int16_t sample = amplitude * sin(2 * M_PI * phaseNum / TONE_SAMPLE_RATE);
+        sum += static_cast<uint16_t>(sample);
+    }
+    return static_cast<int16_t>(sum);
+}
+
+std::vector<int16_t> GenerateTone(TonePlayerImpl &toneplayer, const std::vector<uint16_t> &freqs,
+    int32_t amplitude, uint32_t startSample, uint32_t sampleNum)
+{
+    uint16_t waveFreq[TONEINFO_MAX_WAVES + 1] = {0};
+    for (size_t i = 0; i < freqs.size() && i <= TONEINFO_MAX_WAVES; i++) {
+        waveFreq[i] = freqs[i];
+    }
+    toneplayer.samplingRate_ = TONE_SAMPLE_RATE;
+    toneplayer.amplitudeType_ = amplitude;
+    toneplayer.sampleCount_ = startSample;
+    std::vector<int16_t> samples(sampleNum, 0);
+    for (uint32_t offset = 0; offset < sampleNum; offset += TONE_BLOCK_SAMPLES) {
+        uint32_t blockSamples = std::min(TONE_BLOCK_SAMPLES, sampleNum - offset);
+        toneplayer.GetSamples(waveFreq, reinterpret_cast<int8_t *>(samples.data() + offset), blockSamples);
+    }
+    return samples;
+}
+
+// Ratio of the tone power to everything else in dB. The window holds whole cycles of every tone, so projecting
+// onto each tone frequency gives its exact amplitude and phase.
+double MeasureToneSinad(const std::vector<int16_t> &samples, const std::vector<uint16_t> &freqs)
+{
+    std::vector<double> fitted(samples.size(), 0.0);
+    for (uint16_t freq : freqs) {
+        double omega = 2 * M_PI * freq / TONE_SAMPLE_RATE;
+        double cosSum = 0.0;
+        double sinSum = 0.0;
+        for (size_t i = 0; i < samples.size(); i++) {
+            cosSum += samples[i] * cos(omega * i);
+            sinSum += samples[i] * sin(omega * i);
+        }
+        double cosAmp = 2 * cosSum / samples.size();
+        double sinAmp = 2 * sinSum / samples.size();
+        for (size_t i = 0; i < samples.size(); i++) {
+            fitted[i] += cosAmp * cos(omega * i) + sinAmp * sin(omega * i);
+        }
+    }
+    double tonePower = 0.0;
+    double noisePower = 0.0;
+    for (size_t i = 0; i < samples.size(); i++) {
+        tonePower += fitted[i] * fitted[i];
+        noisePower += (samples[i] - fitted[i]) * (samples[i] - fitted[i]);
+    }
+    return 10 * log10(tonePower / noisePower);
+}
+}
+
+/**
+ * @tc.name  : Test TonePlayerImpl API
+ * @tc.type  : FUNC
+ * @tc.number: TonePlayerImpl_027
+ * @tc.desc  : Test GetSamples interface. The oscillator follows the exact sine and is at least as pure as the
+ *             previous sin() output.
+ */
+HWTEST(AudioToneplayerUnitTest, TonePlayerImpl_027, TestSize.Level1)
+{
+    AudioRendererInfo rendererInfo = {};
+    rendererInfo.contentType = ContentType::CONTENT_TYPE_MUSIC;
+    rendererInfo.streamUsage = StreamUsage::STREAM_USAGE_DTMF;
+    std::shared_ptr<TonePlayerImpl> toneplayer = std::make_shared<TonePlayerImpl>("", rendererInfo);
+    ASSERT_NE(toneplayer, nullptr);
+
+    const std::vector<uint16_t> freqs = {1000};
+    const int32_t amplitude = 8000;
+    std::vector<int16_t> samples = GenerateTone(*toneplayer, freqs, amplitude, 0, TONE_SAMPLE_RATE);
+    std::vector<int16_t> legacy = GenerateLegacyTone(freqs, amplitude, 0, TONE_SAMPLE_RATE);
+    EXPECT_EQ(toneplayer->sampleCount_, TONE_SAMPLE_RATE);
+    for (uint32_t i = 0; i < TONE_SAMPLE_RATE; i++) {
+        ASSERT_LE(std::abs(samples[i] - GetIdealToneSample(freqs, amplitude, i)), 1) << "sample " << i;
+    }
+    double sinad = MeasureToneSinad(samples, freqs);
+    EXPECT_GE(sinad, MeasureToneSinad(legacy, freqs) - 0.5);
+    EXPECT_GE(sinad, 80.0);
+}
+
+/**
+ * @tc.name  : Test TonePlayerImpl API
+ * @tc.type  : FUNC
+ * @tc.number: TonePlayerImpl_028
+ * @tc.desc  : Test GetSamples interface. A dual tone an hour into playback keeps its purity, and a segment
+ *             restart picks up the right phase.
+ */
+HWTEST(AudioToneplayerUnitTest, TonePlayerImpl_028, TestSize.Level1)
+{
+    AudioRendererInfo rendererInfo = {};
+    rendererInfo.contentType = ContentType::CONTENT_TYPE_MUSIC;
+    rendererInfo.streamUsage = StreamUsage::STREAM_USAGE_DTMF;
+    std::shared_ptr<TonePlayerImpl> toneplayer = std::make_shared<TonePlayerImpl>("", rendererInfo);
+    ASSERT_NE(toneplayer, nullptr);
+
+    const std::vector<uint16_t> freqs = {697, 1209};
+    const int32_t amplitude = 800;
+    const uint32_t oneHour = TONE_SAMPLE_RATE * 3600;
+    std::vector<int16_t> samples = GenerateTone(*toneplayer, freqs, amplitude, oneHour, TONE_SAMPLE_RATE);
+    std::vector<int16_t> legacy = GenerateLegacyTone(freqs, amplitude, oneHour, TONE_SAMPLE_RATE);
+    for (uint32_t i = 0; i < TONE_SAMPLE_RATE; i++) {
+        ASSERT_LE(std::abs(samples[i] - GetIdealToneSample(freqs, amplitude, oneHour + i)), 2) << "sample " << i;
+    }
+    double sinad = MeasureToneSinad(samples, freqs);
+    EXPECT_GE(sinad, MeasureToneSinad(legacy, freqs) - 0.5);
+    EXPECT_GE(sinad, 50.0);
+
+    // a new segment starts over at sample 0
+    std::vector<int16_t> restarted = GenerateTone(*toneplayer, freqs, amplitude, 0, TONE_BLOCK_SAMPLES);
+    for (uint32_t i = 0; i < TONE_BLOCK_SAMPLES; i++) {
+        ASSERT_LE(std::abs(restarted[i] - GetIdealToneSample(freqs, amplitude, i)), 2) << "sample " << i;
+    }
+}
 } // namespace AudioStandard
 } // namespace OHOS
@@ -553,6 +553,8 @@ enum RecorderType : int32_t {
 enum AudioLoopbackMode {
     /** The hardware mode of audio loopback.*/
     LOOPBACK_HARDWARE = 0,
+    /** The audio engine links the capturer to the renderer, used where the device has no hardware loopback.*/
+    LOOPBACK_SOFTWARE = 1,
 };
 
 enum AudioLoopbackStatus {
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OPENSLES_OPENHARMONY_EXT_H
+#define OPENSLES_OPENHARMONY_EXT_H
+
+#include <OpenSLES.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Engine option for slCreateEngine. Its data selects the stream path of the players and recorders created by the
+ * engine, one of the SL_OH_PERFORMANCE_MODE values.
+ */
+#define SL_ENGINEOPTION_OH_PERFORMANCE_MODE ((SLuint32) 0x00010001)
+
+/** default path, streams go through the mixer **/
+#define SL_OH_PERFORMANCE_MODE_NONE ((SLuint32) 0x00000000)
+/** ask for the fast (mmap) path, streams fall back to the default path when the device cannot take them **/
+#define SL_OH_PERFORMANCE_MODE_LOW_LATENCY ((SLuint32) 0x00000001)
+
+#ifdef __cplusplus
+}
+#endif
+#endif // OPENSLES_OPENHARMONY_EXT_H
@@ -151,6 +151,7 @@ private:
     bool IsClusterDisConnected(HpaeProcessorType sceneType);
     bool QueryOneStreamUnderrun();
     void DeleteNodesByTraversal(uint32_t sessionId);
+    std::shared_ptr<HpaeWorkerPool> GetSceneWorkerPool();
 
 private:
 
@@ -161,6 +162,7 @@ private:
     std::shared_ptr<IHpaeOutputCluster> outputCluster_ = nullptr;
     HpaeNoLockQueue hpaeNoLockQueue_;
     std::unique_ptr<HpaeSignalProcessThread> hpaeSignalProcessThread_ = nullptr;
+    std::shared_ptr<HpaeWorkerPool> sceneWorkerPool_ = nullptr;
     std::atomic<bool> isInit_ = false;
     std::atomic<bool> isMute_ = false;
     std::atomic<bool> isSuspend_ = false;
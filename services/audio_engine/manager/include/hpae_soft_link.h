@@ -20,7 +20,8 @@
 #include "i_capturer_stream.h"
 #include "i_renderer_stream.h"
 #include "hpae_define.h"
-#include "audio_ring_cache.h"
+#include "hpae_spsc_ring_buffer.h"
+#include "hpae_drift_compensator.h"
 
 namespace OHOS {
 namespace AudioStandard {
@@ -70,9 +71,15 @@ public:
 
     // for unit test
     HpaeSoftLinkState GetStreamStateById(uint32_t sessionId);
+    // for unit test and benchmark, sets up the ring from the given devices instead of asking the manager
+    int32_t InitBuffer(const HpaeSinkInfo &sinkInfo, const HpaeSourceInfo &sourceInfo);
+    uint32_t GetTargetLatencyMs() const;
 private:
     int32_t GetDeviceInfo();
     int32_t CreateStream();
+    int32_t InitBuffer();
+    uint32_t GetLinkFrameLen() const;
+    uint32_t GetBufferFrameLen() const;
     void FlushRingCache();
     void TransSinkInfoToStreamInfo(HpaeStreamInfo &info, const HpaeStreamClassType &streamClassType);
     void StopInner();
@@ -86,8 +93,13 @@ private:
     HpaeSourceInfo sourceInfo_;
     HpaeStreamInfo rendererStreamInfo_;
     HpaeStreamInfo capturerStreamInfo_;
-    std::unique_ptr<AudioRingCache> bufferQueue_ = nullptr;
-    std::vector<char> tempBuffer_;
+    // float frames, filled on the capturer callback, drained on the renderer callback
+    std::unique_ptr<HpaeSpscRingBuffer> bufferQueue_ = nullptr;
+    // source and sink run on different clocks, the renderer side resamples to keep the ring level
+    std::unique_ptr<HpaeDriftCompensator> driftCompensator_ = nullptr;
+    std::atomic<bool> isRingFlushed_ = false;
+    std::vector<float> capturerFloatData_;
+    std::vector<float> rendererFloatData_;
     std::atomic<HpaeSoftLinkState> state_ = HpaeSoftLinkState::INVALID;
     std::mutex stateMutex_;
     uint8_t isStreamOperationFinish_ = 0;
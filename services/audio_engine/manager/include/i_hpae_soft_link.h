@@ -23,6 +23,8 @@ namespace HPAE {
 enum class SoftLinkMode : int32_t {
     HEARING_AID = 0,
     OFFLOADINNERCAP_AID = 1,
+    // mic to speaker with the least buffering the device periods allow, for karaoke without a DSP loopback
+    LOOPBACK = 2,
 };
 
 class IHpaeSoftLink {
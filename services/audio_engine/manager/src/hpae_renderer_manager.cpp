@@ -29,6 +29,8 @@
 #include "hpae_remote_output_cluster.h"
 #include "hpae_message_queue_monitor.h"
 #include "hpae_stream_move_monitor.h"
+#include "audio_qosmanager.h"
+#include "parameter.h"
 
 constexpr int32_t DEFAULT_EFFECT_RATE = 48000;
 constexpr int32_t DEFAULT_EFFECT_FRAME_LEN = 960;
@@ -42,6 +44,8 @@ namespace {
     constexpr int64_t BUFFER_DURATION_US = 10 * 1000; // 10ms
     constexpr int64_t UNDERRUN_BYPASS_DURATION_NS = 60 * 1000 * 1000; // 60ms
     const std::string REMOTE_DEVICE_CLASS = "remote";
+    constexpr int32_t DEFAULT_SCENE_WORKER_NUM = 0; // opt in through const.multimedia.audio.scene_worker_num
+    constexpr int32_t MAX_SCENE_WORKER_NUM = 4;
 }
 HpaeRendererManager::HpaeRendererManager(HpaeSinkInfo &sinkInfo)
     : hpaeNoLockQueue_(CURRENT_REQUEST_COUNT), sinkInfo_(sinkInfo)
@@ -960,6 +964,7 @@ int32_t HpaeRendererManager::InitManager(bool isReload)
         outputCluster_ = std::make_unique<HpaeRemoteOutputCluster>(nodeInfo, sinkInfo_);
     } else {
         outputCluster_ = std::make_unique<HpaeOutputCluster>(nodeInfo);
+        outputCluster_->SetWorkerPool(GetSceneWorkerPool());
     }
     outputCluster_->SetTimeoutStopThd(sinkInfo_.suspendTime);
     int32_t ret = outputCluster_->GetInstance(sinkInfo_.deviceClass, sinkInfo_.deviceNetId);
@@ -984,6 +989,23 @@ int32_t HpaeRendererManager::InitManager(bool isReload)
     return SUCCESS;
 }
 
+// Workers for the output mixer to render the scene process clusters in parallel, off unless the product enables
+// them. The mixer falls back to pulling in turn when its inputs share a node.
+std::shared_ptr<HpaeWorkerPool> HpaeRendererManager::GetSceneWorkerPool()
+{
+    if (sceneWorkerPool_ != nullptr) {
+        return sceneWorkerPool_;
+    }
+    int32_t workerNum = GetIntParameter("const.multimedia.audio.scene_worker_num", DEFAULT_SCENE_WORKER_NUM);
+    CHECK_AND_RETURN_RET(workerNum != 0, nullptr);
+    CHECK_AND_RETURN_RET_LOG(workerNum > 0 && workerNum <= MAX_SCENE_WORKER_NUM, nullptr,
+        "scene workers disabled, num %{public}d", workerNum);
+    int32_t setPriority = GetIntParameter("const.multimedia.audio_setPriority", 1);
+    sceneWorkerPool_ = std::make_shared<HpaeWorkerPool>(static_cast<uint32_t>(workerNum), "OS_SceneWorker",
+        [setPriority]() { SetThreadQosLevelAsync(setPriority); });
+    return sceneWorkerPool_;
+}
+
 void HpaeRendererManager::InitDefaultNodeInfo()
 {
     HpaeNodeInfo defaultNodeInfo;
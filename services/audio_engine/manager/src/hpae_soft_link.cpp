@@ -18,12 +18,14 @@
 #endif
 
 #include "hpae_soft_link.h"
+#include <algorithm>
 #ifdef ENABLE_HOOK_PCM
 #include <thread>
 #endif
 #include "audio_errors.h"
 #include "audio_utils.h"
 #include "audio_volume.h"
+#include "hpae_format_convert.h"
 #include "i_hpae_manager.h"
 #include "audio_engine_log.h"
 
@@ -35,6 +37,9 @@ static constexpr uint32_t MAX_VALID_SESSIONID = 99999;
 static constexpr uint32_t OPERATION_TIMEOUT_IN_MS = 1000; // 1000ms
 static constexpr uint32_t MS_PER_SECOND = 1000;
 static constexpr uint32_t DEFAULT_RING_BUFFER_NUM = 4;
+static constexpr uint32_t TARGET_LATENCY_MS = 40;
+static constexpr uint32_t LOOPBACK_RING_BUFFER_NUM = 3;
+static constexpr uint32_t LOOPBACK_MIN_TARGET_LATENCY_MS = 10;
 static constexpr int32_t MAX_OVERFLOW_UNDERRUN_COUNT = 50; // 1s
 uint32_t HpaeSoftLink::g_sessionId = FIRST_SESSIONID; // begin at 90000
 std::shared_ptr<IHpaeSoftLink> IHpaeSoftLink::CreateSoftLink(uint32_t sinkIdx, uint32_t sourceIdx, SoftLinkMode mode)
@@ -81,13 +86,8 @@ int32_t HpaeSoftLink::Init()
 
     int32_t ret = GetDeviceInfo();
     CHECK_AND_RETURN_RET(ret == SUCCESS, ERR_OPERATION_FAILED);
-
-    size_t frameBytes = sinkInfo_.channels * static_cast<size_t>(GetSizeFromFormat(sinkInfo_.format)) *
-        FRAME_LEN_20MS * sinkInfo_.samplingRate / MS_PER_SECOND;
-    size_t size = DEFAULT_RING_BUFFER_NUM * frameBytes;
-    bufferQueue_ = AudioRingCache::Create(size);
-    CHECK_AND_RETURN_RET_LOG(bufferQueue_ != nullptr, ERR_OPERATION_FAILED, "bufferQueue create error");
-    tempBuffer_.resize(frameBytes);
+    ret = InitBuffer();
+    CHECK_AND_RETURN_RET(ret == SUCCESS, ERR_OPERATION_FAILED);
     ret = CreateStream();
     if (ret == SUCCESS) {
         state_ = HpaeSoftLinkState::PREPARED;
@@ -95,6 +95,63 @@ int32_t HpaeSoftLink::Init()
     return ret;
 }
 
+uint32_t HpaeSoftLink::GetLinkFrameLen() const
+{
+    // a loopback stream runs at the sink period, so the nodes between the link and the device add no rebuffering
+    if (linkMode_ == SoftLinkMode::LOOPBACK && sinkInfo_.frameLen > 0) {
+        return static_cast<uint32_t>(sinkInfo_.frameLen);
+    }
+    return FRAME_LEN_20MS * static_cast<uint32_t>(sinkInfo_.samplingRate) / MS_PER_SECOND;
+}
+
+uint32_t HpaeSoftLink::GetBufferFrameLen() const
+{
+    uint32_t frameLen = GetLinkFrameLen();
+    CHECK_AND_RETURN_RET(linkMode_ == SoftLinkMode::LOOPBACK && sourceInfo_.samplingRate > 0, frameLen);
+    // the capturer hands over a whole mic period at once, which may be longer than the sink period
+    uint64_t sourceFrameLen = static_cast<uint64_t>(sourceInfo_.frameLen) *
+        static_cast<uint64_t>(sinkInfo_.samplingRate) / static_cast<uint64_t>(sourceInfo_.samplingRate);
+    return std::max(frameLen, static_cast<uint32_t>(sourceFrameLen));
+}
+
+uint32_t HpaeSoftLink::GetTargetLatencyMs() const
+{
+    CHECK_AND_RETURN_RET(linkMode_ == SoftLinkMode::LOOPBACK, TARGET_LATENCY_MS);
+    // the consumer needs one whole period of the slower side in the ring, anything above that is only jitter margin
+    uint32_t periodMs = sinkInfo_.samplingRate == 0 ? 0 :
+        GetBufferFrameLen() * MS_PER_SECOND / static_cast<uint32_t>(sinkInfo_.samplingRate);
+    return std::max(periodMs, LOOPBACK_MIN_TARGET_LATENCY_MS);
+}
+
+int32_t HpaeSoftLink::InitBuffer(const HpaeSinkInfo &sinkInfo, const HpaeSourceInfo &sourceInfo)
+{
+    CHECK_AND_RETURN_RET_LOG(state_.load() == HpaeSoftLinkState::NEW, ERR_ILLEGAL_STATE, "init buffer error state");
+    sinkInfo_ = sinkInfo;
+    sourceInfo_ = sourceInfo;
+    return InitBuffer();
+}
+
+int32_t HpaeSoftLink::InitBuffer()
+{
+    CHECK_AND_RETURN_RET_LOG(sinkInfo_.channels > 0 && sinkInfo_.samplingRate > 0, ERR_INVALID_PARAM,
+        "invalid sink info, channels %{public}u rate %{public}u", static_cast<uint32_t>(sinkInfo_.channels),
+        static_cast<uint32_t>(sinkInfo_.samplingRate));
+    size_t frameSamples = static_cast<size_t>(sinkInfo_.channels) * GetLinkFrameLen();
+    size_t bufferFrameSamples = static_cast<size_t>(sinkInfo_.channels) * GetBufferFrameLen();
+    uint32_t ringBufferNum = linkMode_ == SoftLinkMode::LOOPBACK ? LOOPBACK_RING_BUFFER_NUM : DEFAULT_RING_BUFFER_NUM;
+    size_t size = ringBufferNum * bufferFrameSamples * sizeof(float);
+    bufferQueue_ = HpaeSpscRingBuffer::Create(size);
+    CHECK_AND_RETURN_RET_LOG(bufferQueue_ != nullptr, ERR_OPERATION_FAILED, "bufferQueue create error");
+    uint32_t targetLatencyMs = GetTargetLatencyMs();
+    driftCompensator_ = std::make_unique<HpaeDriftCompensator>(sinkInfo_.samplingRate, sinkInfo_.channels,
+        targetLatencyMs);
+    capturerFloatData_.resize(bufferFrameSamples);
+    rendererFloatData_.resize(frameSamples);
+    AUDIO_INFO_LOG("mode %{public}d, frameLen %{public}u, ring %{public}u periods of %{public}u, target %{public}u ms",
+        static_cast<int32_t>(linkMode_), GetLinkFrameLen(), ringBufferNum, GetBufferFrameLen(), targetLatencyMs);
+    return SUCCESS;
+}
+
 int32_t HpaeSoftLink::GetDeviceInfo()
 {
     Trace trace("HpaeSoftLink::GetDeviceInfo");
@@ -139,7 +196,7 @@ void HpaeSoftLink::TransSinkInfoToStreamInfo(HpaeStreamInfo &info, const HpaeStr
     info.samplingRate = sinkInfo_.samplingRate;
     info.format = sinkInfo_.format;
     info.channelLayout = sinkInfo_.channelLayout;
-    info.frameLen = FRAME_LEN_20MS * static_cast<uint32_t>(sinkInfo_.samplingRate) / MS_PER_SECOND;
+    info.frameLen = GetLinkFrameLen();
     info.streamClassType = streamClassType;
     info.isMoveAble = false;
     info.sessionId = GenerateSessionId();
@@ -152,8 +209,17 @@ void HpaeSoftLink::TransSinkInfoToStreamInfo(HpaeStreamInfo &info, const HpaeStr
         info.effectInfo.effectScene = SCENE_VOIP_DOWN;
         info.effectInfo.systemVolumeType = STREAM_VOICE_CALL;
         info.effectInfo.streamUsage = STREAM_USAGE_VOICE_COMMUNICATION;
+        if (linkMode_ == SoftLinkMode::LOOPBACK) {
+            // EQ or reverb configured on the music scene chain applies to the loopback,
+            // no fade in so the first note is kept
+            info.streamType = STREAM_MUSIC;
+            info.fadeType = NONE_FADE;
+            info.effectInfo.effectScene = SCENE_MUSIC;
+            info.effectInfo.systemVolumeType = STREAM_MUSIC;
+            info.effectInfo.streamUsage = STREAM_USAGE_MUSIC;
+        }
     } else {
-        info.streamType = STREAM_SOURCE_VOICE_CALL;
+        info.streamType = linkMode_ == SoftLinkMode::LOOPBACK ? STREAM_RECORDING : STREAM_SOURCE_VOICE_CALL;
         info.deviceName = sourceInfo_.deviceName;
         if (linkMode_ == SoftLinkMode::OFFLOADINNERCAP_AID) {
             info.sourceType = SOURCE_TYPE_OFFLOAD_CAPTURE;
@@ -306,6 +372,8 @@ void HpaeSoftLink::FlushRingCache()
 {
     CHECK_AND_RETURN_LOG(bufferQueue_ != nullptr, "ring cache is null");
     bufferQueue_->ResetBuffer();
+    // the compensator belongs to the renderer thread, let it reset itself on the next callback
+    isRingFlushed_.store(true);
 }
 
 void HpaeSoftLink::OnStatusUpdate(IOperation operation, uint32_t streamIndex)
@@ -342,13 +410,21 @@ int32_t HpaeSoftLink::OnStreamData(AudioCallBackStreamInfo& callbackStreamInfo)
 #endif
     int8_t *inputData = callbackStreamInfo.inputData;
     size_t requestDataLen = callbackStreamInfo.requestDataLen;
-    OptResult result = bufferQueue_->GetReadableSize();
-    CHECK_AND_RETURN_RET_LOG(result.ret == OPERATION_SUCCESS, ERROR,
-        "ringBuffer get readable invalid size: %{public}zu", result.size);
-    if (result.size == 0 || result.size < requestDataLen) {
+    const size_t frameSize = sinkInfo_.channels * static_cast<size_t>(GetSizeFromFormat(sinkInfo_.format));
+    CHECK_AND_RETURN_RET_LOG(inputData != nullptr && driftCompensator_ != nullptr && frameSize > 0, ERROR,
+        "invalid param");
+    if (isRingFlushed_.exchange(false)) {
+        driftCompensator_->Reset();
+    }
+    const uint32_t frameLen = static_cast<uint32_t>(requestDataLen / frameSize);
+    const size_t sampleCount = static_cast<size_t>(frameLen) * sinkInfo_.channels;
+    if (rendererFloatData_.size() < sampleCount) {
+        rendererFloatData_.resize(sampleCount);
+    }
+    if (driftCompensator_->Process(*bufferQueue_, rendererFloatData_.data(), frameLen,
+        ClockTime::GetCurNano()) != SUCCESS) {
         ++underRunCount_;
-        AUDIO_DEBUG_LOG("underrun[%{public}d]!, readable size is invalid, result.size[%{public}zu],"
-            "requestDataLen[%{public}zu]", underRunCount_, result.size, requestDataLen);
+        AUDIO_DEBUG_LOG("underrun[%{public}d]!, requestDataLen[%{public}zu]", underRunCount_, requestDataLen);
     } else {
         underRunCount_ = 0;
     }
@@ -357,9 +433,7 @@ int32_t HpaeSoftLink::OnStreamData(AudioCallBackStreamInfo& callbackStreamInfo)
         underRunCount_ = 0;
         return ERROR;
     }
-    AUDIO_DEBUG_LOG("readable size: %{public}zu, requestDataLen: %{public}zu", result.size, requestDataLen);
-    result = bufferQueue_->Dequeue({reinterpret_cast<uint8_t *>(inputData), requestDataLen});
-    CHECK_AND_RETURN_RET_LOG(result.ret == OPERATION_SUCCESS, ERROR, "ringBuffer dequeue failed");
+    ConvertFromFloat(sinkInfo_.format, static_cast<unsigned>(sampleCount), rendererFloatData_.data(), inputData);
     return SUCCESS;
 }
 
@@ -392,14 +466,19 @@ int32_t HpaeSoftLink::OnStreamData(AudioCallBackCapturerStreamInfo& callbackStre
     if (linkMode_ == SoftLinkMode::HEARING_AID && sinkInfo_.channels == STEREO) {
         CopyRightToLeft(reinterpret_cast<uint8_t *>(outputData), requestDataLen, sinkInfo_.format);
     }
+    const size_t frameSize = sinkInfo_.channels * static_cast<size_t>(GetSizeFromFormat(sinkInfo_.format));
+    CHECK_AND_RETURN_RET_LOG(outputData != nullptr && driftCompensator_ != nullptr && frameSize > 0, ERROR,
+        "invalid param");
+    const uint32_t frameLen = static_cast<uint32_t>(requestDataLen / frameSize);
+    const size_t sampleCount = static_cast<size_t>(frameLen) * sinkInfo_.channels;
+    const size_t floatDataLen = sampleCount * sizeof(float);
     OptResult result = bufferQueue_->GetWritableSize();
     CHECK_AND_RETURN_RET_LOG(result.ret == OPERATION_SUCCESS, ERR_READ_FAILED,
         "ringBuffer get writeable invalid size: %{public}zu", result.size);
-    if (result.size == 0 || result.size < requestDataLen) {
+    if (result.size == 0 || result.size < floatDataLen) {
         ++overFlowCount_;
         AUDIO_DEBUG_LOG("overflow[%{public}d]!, writable size is invalid, result.size[%{public}zu],"
-            "requestDataLen[%{public}zu]", overFlowCount_, result.size, requestDataLen);
-        bufferQueue_->Dequeue({reinterpret_cast<uint8_t *>(tempBuffer_.data()), requestDataLen});
+            "floatDataLen[%{public}zu]", overFlowCount_, result.size, floatDataLen);
     } else {
         overFlowCount_ = 0;
     }
@@ -408,9 +487,17 @@ int32_t HpaeSoftLink::OnStreamData(AudioCallBackCapturerStreamInfo& callbackStre
         overFlowCount_ = 0;
         return ERROR;
     }
-    AUDIO_DEBUG_LOG("writable size: %{public}zu, requestDataLen: %{public}zu", result.size, requestDataLen);
-    result = bufferQueue_->Enqueue({reinterpret_cast<uint8_t *>(outputData), requestDataLen});
+    // only the renderer side may read the ring, so on overflow the newest frame is dropped
+    CHECK_AND_RETURN_RET(overFlowCount_ == 0, SUCCESS);
+    CHECK_AND_RETURN_RET(sampleCount > 0, SUCCESS);
+    if (capturerFloatData_.size() < sampleCount) {
+        capturerFloatData_.resize(sampleCount);
+    }
+    ConvertToFloat(sinkInfo_.format, static_cast<unsigned>(sampleCount), outputData, capturerFloatData_.data());
+    AUDIO_DEBUG_LOG("writable size: %{public}zu, floatDataLen: %{public}zu", result.size, floatDataLen);
+    result = bufferQueue_->Enqueue({reinterpret_cast<uint8_t *>(capturerFloatData_.data()), floatDataLen});
     CHECK_AND_RETURN_RET_LOG(result.ret == OPERATION_SUCCESS, ERROR, "ringBuffer enqueue failed");
+    driftCompensator_->OnProducerWrite(frameLen, ClockTime::GetCurNano());
     return SUCCESS;
 }
 
@@ -15,12 +15,14 @@
 
 #ifndef HPAE_COBUFFER_NODE_H
 #define HPAE_COBUFFER_NODE_H
+#include <atomic>
 #include <memory>
-#include <mutex>
-#include "audio_ring_cache.h"
+#include <set>
 #include "high_resolution_timer.h"
 #include "hpae_node.h"
 #include "hpae_pcm_buffer.h"
+#include "hpae_spsc_ring_buffer.h"
+#include "hpae_drift_compensator.h"
 
 #ifdef ENABLE_HOOK_PCM
 #include "hpae_pcm_dumper.h"
@@ -52,18 +54,21 @@ public:
     void SetOutputClusterConnected(bool isConnect);
     bool IsOutputClusterConnected();
 private:
-    void FillSilenceFramesInner(uint32_t latencyMs);
     void ProcessInputFrameInner(HpaePcmBuffer* buffer);
     void ProcessOutputFrameInner();
-    std::mutex mutex_;
-    bool enqueueRunning_ = false;
+    // Enqueue and DoProcess run on different manager threads, they only share the ring and these flags
+    std::atomic<bool> enqueueRunning_ = false;
+    bool outputRunning_ = false;
+    uint32_t silenceFramesToFill_ = 0;
     InputPort<HpaePcmBuffer *> inputStream_;
     OutputPort<HpaePcmBuffer *> outputStream_;
     PcmBufferInfo pcmBufferInfo_;
     HpaePcmBuffer coBufferOut_;
     HpaePcmBuffer silenceData_;
-    std::unique_ptr<AudioRingCache> ringCache_ = nullptr;
-    int32_t enqueueCount_ = 1;
+    std::unique_ptr<HpaeSpscRingBuffer> ringCache_ = nullptr;
+    // the producer and output clusters run on different device clocks
+    HpaeDriftCompensator driftCompensator_;
+    std::atomic<int32_t> enqueueCount_ = 1;
     uint64_t latency_  = 0; // in ms
     bool isOutputClusterConnected_ = false;
     std::set<HpaeProcessorType> connectedProcessCluster_;
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPAE_DRIFT_COMPENSATOR_H
+#define HPAE_DRIFT_COMPENSATOR_H
+#include <atomic>
+#include <memory>
+#include <vector>
+#include "audio_proresampler.h"
+#include "hpae_spsc_ring_buffer.h"
+
+namespace OHOS {
+namespace AudioStandard {
+namespace HPAE {
+/**
+ * Consumer side of a ring that bridges two devices running on different clocks. The ring carries interleaved
+ * float frames. Instead of running into underrun or overflow recovery, the output is resampled at a ratio steered
+ * by a PI controller on the ring fill level, so the fill level settles at the target latency.
+ * The producer reports its writes so the fill level can be followed between two producer blocks.
+ */
+class HpaeDriftCompensator {
+public:
+    HpaeDriftCompensator(uint32_t sampleRate, uint32_t channels, uint32_t targetLatencyMs);
+    ~HpaeDriftCompensator() = default;
+
+    // Producer side, call after enqueueing frameLen frames at timeNs.
+    void OnProducerWrite(uint32_t frameLen, int64_t timeNs);
+    // Consumer side, produces outFrameLen frames. When the ring runs dry it returns ERROR, the frames it could
+    // produce are kept and only the missing tail is padded with silence.
+    int32_t Process(HpaeSpscRingBuffer &ring, float *outBuffer, uint32_t outFrameLen, int64_t timeNs);
+    // Forget the controller state and staged input, call when the producer restarts.
+    void Reset();
+    double GetDriftPpm() const;
+
+private:
+    double GetFillFrames(size_t bufferedFrames, int64_t timeNs);
+    void UpdateDrift(double fillFrames, uint32_t outFrameLen);
+    uint32_t FillInput(HpaeSpscRingBuffer &ring, size_t readableFrames, uint32_t outFrameLen);
+
+    uint32_t sampleRate_ = 0;
+    uint32_t channels_ = 0;
+    double targetFrames_ = 0.0;
+    std::unique_ptr<ProResampler> resampler_ = nullptr;
+    std::vector<float> inBuffer_;
+    uint32_t inFrames_ = 0; // frames taken from the ring but not consumed by the resampler yet
+    bool isFirstFrame_ = true;
+    double avgFillFrames_ = 0.0;
+    double integral_ = 0.0;
+    double driftPpm_ = 0.0;
+    std::atomic<int64_t> lastWriteTimeNs_ = 0;
+    std::atomic<uint32_t> lastWriteFrames_ = 0;
+};
+}  // namespace HPAE
+}  // namespace AudioStandard
+}  // namespace OHOS
+#endif
@@ -19,6 +19,8 @@
 #include "hpae_node.h"
 #include "hpae_plugin_node.h"
 #include "audio_limiter.h"
+#include "hpae_worker_pool.h"
+#include "hpae_node_callback_deferrer.h"
 
 namespace OHOS {
 namespace AudioStandard {
@@ -28,7 +30,10 @@ class HpaeMixerNode : public HpaePluginNode {
 public:
     HpaeMixerNode(HpaeNodeInfo &nodeInfo);
     virtual ~HpaeMixerNode();
+    virtual void DoProcess() override;
     virtual bool Reset() override;
+    // Pull the inputs concurrently while every input is fed by its own node, otherwise they are pulled in turn.
+    void SetWorkerPool(const std::shared_ptr<HpaeWorkerPool> &workerPool);
     int32_t SetupAudioLimiter();
     int32_t InitAudioLimiter();
     virtual void SetNodeInfo(HpaeNodeInfo& nodeInfo) override;
@@ -42,12 +47,18 @@ private:
     bool CheckUpdateInfo(HpaePcmBuffer *input);
     bool CheckUpdateInfoForDisConnect();
     void DrainProcess();
+    bool CollectDisjointInputs();
+    void PrepareInputsInParallel();
     std::unordered_map<uint32_t, float> streamVolumeMap_;
     PcmBufferInfo pcmBufferInfo_;
     HpaePcmBuffer mixedOutput_;
     HpaePcmBuffer tmpOutput_;
     std::unique_ptr<AudioLimiter> limiter_ = nullptr;
     uint32_t waitFrames_ = 0;
+    std::shared_ptr<HpaeWorkerPool> workerPool_ = nullptr;
+    std::vector<OutputPort<HpaePcmBuffer *> *> preOutputPorts_;
+    std::vector<HpaeNode *> preNodes_;
+    std::vector<std::unique_ptr<HpaeNodeCallbackDeferrer>> callbackDeferrers_;
 };
 
 }  // namespace HPAE
@@ -23,6 +23,7 @@
 #include <sstream>
 #include "hpae_pcm_buffer.h"
 #include "hpae_define.h"
+#include "hpae_node_callback_deferrer.h"
 #include "audio_log.h"
 
 namespace OHOS {
@@ -144,9 +145,11 @@ public:
         return nodeInfo_.nodeName;
     }
     
+    // on a worker thread the callbacks are queued and replayed on the render thread later
     virtual std::weak_ptr<INodeCallback> GetNodeStatusCallback()
     {
-        return nodeInfo_.statusCallback;
+        HpaeNodeCallbackDeferrer *deferrer = HpaeNodeCallbackDeferrer::GetCurrent();
+        return deferrer != nullptr ? deferrer->Wrap(nodeInfo_.statusCallback) : nodeInfo_.statusCallback;
     }
 
     virtual std::string GetTraceInfo()
@@ -189,10 +192,13 @@ public:
     void WriteDataToOutput(T data, HpaeBufferType bufferType = HPAE_BUFFER_TYPE_DEFAULT);
     OutputPort(const OutputPort &that) = delete;
     T PullOutputData();
+    // run the node for this period ahead of the pull, a later PullOutputData returns the cached data
+    void PrepareOutputData();
     void AddInput(InputPort<T> *input);
     void AddInput(InputPort<T> *input, const std::shared_ptr<HpaeNode> &node);
     bool RemoveInput(InputPort<T> *input, HpaeBufferType bufferType = HPAE_BUFFER_TYPE_DEFAULT);
     size_t GetInputNum() const;
+    size_t GetCoInputNum() const;
     uint32_t GetNodeId();
 private:
     std::set<InputPort<T>*> inputPortSet_;
@@ -350,6 +356,14 @@ T OutputPort<T>::PullOutputData()
     }
 }
 
+template <class T>
+void OutputPort<T>::PrepareOutputData()
+{
+    if (outputData_.empty()) {
+        hpaeNode_->DoProcess();
+    }
+}
+
 template <class T>
 void OutputPort<T>::WriteDataToOutput(T data, HpaeBufferType bufferType)
 {
@@ -388,6 +402,12 @@ size_t OutputPort<T>::GetInputNum() const
 {
     return inputPortSet_.size();
 }
+
+template <class T>
+size_t OutputPort<T>::GetCoInputNum() const
+{
+    return coInputPorts_.size();
+}
 template <class T>
 bool OutputPort<T>::RemoveInput(InputPort<T> *input, HpaeBufferType bufferType)
 {
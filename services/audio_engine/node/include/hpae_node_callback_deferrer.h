@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPAE_NODE_CALLBACK_DEFERRER_H
+#define HPAE_NODE_CALLBACK_DEFERRER_H
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "hpae_msg_channel.h"
+
+namespace OHOS {
+namespace AudioStandard {
+namespace HPAE {
+class HpaeDeferredNodeCallback;
+
+/**
+ * Holds back the node status callbacks raised while nodes run on a worker thread. The managers handle their
+ * callbacks on the render thread only, so the queued calls are replayed there once the workers are joined.
+ * OnRequestLatency has to answer at once, it is forwarded directly but serialized across workers.
+ */
+class HpaeNodeCallbackDeferrer {
+public:
+    // installs the deferrer on the current thread for its lifetime
+    class Scope {
+    public:
+        explicit Scope(HpaeNodeCallbackDeferrer &deferrer);
+        ~Scope();
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+    private:
+        HpaeNodeCallbackDeferrer *prevDeferrer_ = nullptr;
+    };
+
+    HpaeNodeCallbackDeferrer();
+    ~HpaeNodeCallbackDeferrer();
+    HpaeNodeCallbackDeferrer(const HpaeNodeCallbackDeferrer &) = delete;
+    HpaeNodeCallbackDeferrer &operator=(const HpaeNodeCallbackDeferrer &) = delete;
+
+    // nullptr unless the current thread is inside a Scope
+    static HpaeNodeCallbackDeferrer *GetCurrent();
+    // a callback that queues into this deferrer instead of reaching the target
+    std::weak_ptr<INodeCallback> Wrap(const std::weak_ptr<INodeCallback> &callback);
+    void Post(std::function<void()> &&call);
+    // runs the queued calls in the order they were raised, on the calling thread
+    void Replay();
+    size_t GetPendingNum() const;
+private:
+    std::unordered_map<INodeCallback *, std::shared_ptr<HpaeDeferredNodeCallback>> proxies_;
+    std::vector<std::function<void()>> pendingCalls_;
+};
+}  // namespace HPAE
+}  // namespace AudioStandard
+}  // namespace OHOS
+#endif // HPAE_NODE_CALLBACK_DEFERRER_H
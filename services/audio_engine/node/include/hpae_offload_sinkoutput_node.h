@@ -71,6 +71,8 @@ private:
     // Set hdi buffer size, change after render frame success
     void SetBufferSizeWhileRenderFrame();
     void SetBufferSize();
+    // frames to render ahead in one write, enough to fill the free hdi cache
+    size_t GetBurstFrameCount();
     int32_t ProcessRenderFrame();
     // get presentation position from hdi, only trigger in offloadcallback
     int32_t UpdatePresentationPosition();
@@ -88,12 +90,13 @@ private:
     bool CheckIfSuspend();
     // check renderFrame ret to decide whether need sleep
     void OffloadNeedSleep(int32_t retType);
-    // renderFrame and set state
-    int32_t WriteFrameToHdi();
+    // renderFrame and set state, OFFLOAD_FULL when hdi takes only part of the data
+    int32_t WriteFrameToHdi(char &data, size_t len);
 
     InputPort<HpaePcmBuffer*> inputStream_;
     std::vector<char> renderFrameData_;
-    std::vector<char> renderFrameDataTemp_;
+    size_t renderOffset_ = 0; // bytes of renderFrameData_ already accepted by hdi
+    std::vector<char> renderFrameDataTemp_; // faded in copy of the first write
     std::shared_ptr<IAudioRenderSink> audioRendererSink_ = nullptr;
     uint32_t renderId_ = HDI_INVALID_ID;
     IAudioSinkAttr sinkOutAttr_;
@@ -113,6 +116,7 @@ private:
     bool firstWriteHdi_ = true;
     uint64_t writePos_ = 0;
     int32_t setHdiBufferSizeNum_ = 0;
+    uint32_t hdiBufferSizeMs_ = 0;
 
     std::atomic<bool> isHdiFull_ = false;
 
@@ -53,6 +53,7 @@ public:
     int32_t SetSyncId(int32_t syncId) override;
     uint32_t GetHdiLatency() override;
     uint64_t GetLatency(HpaeProcessorType sceneType) override;
+    void SetWorkerPool(const std::shared_ptr<HpaeWorkerPool> &workerPool) override;
 
 private:
     std::shared_ptr<HpaeMixerNode> mixerNode_ = nullptr;
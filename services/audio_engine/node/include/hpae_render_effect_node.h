@@ -62,6 +62,7 @@ private:
     std::unique_ptr<HpaePcmBuffer> directOutput_ = nullptr;
     std::unique_ptr<HpaePcmBuffer> collaborativeOutput_ = nullptr;
     std::string sceneType_ = "EFFECT_NONE";
+    int32_t sceneTypeHandle_ = -1;
     int64_t silenceDataUs_ = 0;
     bool isByPassEffect_ = false;
     bool isDisplayEffectZeroVolume_ = false;
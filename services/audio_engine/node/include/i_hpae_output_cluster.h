@@ -16,6 +16,7 @@
 #ifndef I_HPAE_OUTPUT_CLUSTER_H
 #define I_HPAE_OUTPUT_CLUSTER_H
 #include "hpae_node.h"
+#include "hpae_worker_pool.h"
 #include "sink/i_audio_render_sink.h"
 
 namespace OHOS {
@@ -47,6 +48,7 @@ public:
     virtual uint32_t GetHdiLatency() { return 0; };
     virtual uint64_t GetLatency(HpaeProcessorType sceneType) { return 0; };
     virtual void UpdateStreamInfo(const std::shared_ptr<OutputNode<HpaePcmBuffer *>> preNode) {};
+    virtual void SetWorkerPool(const std::shared_ptr<HpaeWorkerPool> &workerPool) {};
 };
 }  // namespace HPAE
 }  // namespace AudioStandard
@@ -18,7 +18,9 @@
 
 #include "hpae_co_buffer_node.h"
 #include "hpae_define.h"
+#include "audio_errors.h"
 #include "audio_effect_log.h"
+#include "audio_utils.h"
 
 namespace OHOS {
 namespace AudioStandard {
@@ -26,7 +28,7 @@ namespace HPAE {
 static constexpr int32_t DEFAULT_FRAME_LEN = 960;
 static constexpr int32_t MAX_CACHE_SIZE = 500;
 static constexpr int32_t MS_PER_SECOND = 1000;
-static constexpr int32_t TEST_LATENCY = 280;
+static constexpr uint32_t TEST_LATENCY = 280;
 static constexpr int32_t ENQUEUE_DONE_FRAME = 10;
 
 HpaeCoBufferNode::HpaeCoBufferNode()
@@ -34,7 +36,8 @@ HpaeCoBufferNode::HpaeCoBufferNode()
       outputStream_(this),
       pcmBufferInfo_(STEREO, DEFAULT_FRAME_LEN, SAMPLE_RATE_48000),
       coBufferOut_(pcmBufferInfo_),
-      silenceData_(pcmBufferInfo_)
+      silenceData_(pcmBufferInfo_),
+      driftCompensator_(SAMPLE_RATE_48000, STEREO, TEST_LATENCY)
 {
 #ifdef ENABLE_HIDUMP_DFX
     SetNodeName("HpaeCoBufferNode");
@@ -45,7 +48,7 @@ HpaeCoBufferNode::HpaeCoBufferNode()
                         static_cast<size_t>(MAX_CACHE_SIZE) /
                         static_cast<size_t>(MS_PER_SECOND);
     AUDIO_INFO_LOG("Created ring cache, size: %{public}zu", size);
-    ringCache_ = AudioRingCache::Create(size);
+    ringCache_ = HpaeSpscRingBuffer::Create(size);
     CHECK_AND_RETURN_LOG(ringCache_ != nullptr, "Create ring cache failed");
 }
 
@@ -59,43 +62,58 @@ HpaeCoBufferNode::~HpaeCoBufferNode()
 
 void HpaeCoBufferNode::Enqueue(HpaePcmBuffer* buffer)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    
 #ifdef ENABLE_HOOK_PCM
     if (inputPcmDumper_ && buffer) {
         const size_t dumpSize = buffer->GetFrameLen() * sizeof(float) * buffer->GetChannelCount();
         inputPcmDumper_->Dump(reinterpret_cast<int8_t*>(buffer->GetPcmDataBuffer()), dumpSize);
     }
 #endif
-    // process input buffer
-    ProcessInputFrameInner(buffer);
-    
     // process enqueue flag
-    if (enqueueCount_ < ENQUEUE_DONE_FRAME) {
-        enqueueCount_++;
-    } else if (enqueueCount_ == ENQUEUE_DONE_FRAME) {
-        enqueueCount_++;
-        enqueueRunning_ = true;
-        // fill silence frames for latency adjustment
+    int32_t enqueueCount = enqueueCount_.load();
+    if (enqueueCount < ENQUEUE_DONE_FRAME) {
+        enqueueCount_.compare_exchange_strong(enqueueCount, enqueueCount + 1);
+    } else if (enqueueCount == ENQUEUE_DONE_FRAME &&
+        enqueueCount_.compare_exchange_strong(enqueueCount, enqueueCount + 1)) {
+        // drop what was cached before, the output side pads silence frames for latency adjustment
         HILOG_COMM_INFO("Filling silence frames for latency adjustment");
-        ringCache_->ResetBuffer();
-        FillSilenceFramesInner(TEST_LATENCY);
+        if (ringCache_ != nullptr) {
+            ringCache_->ResetBuffer();
+        }
+        enqueueRunning_.store(true);
     }
+
+    // process input buffer
+    ProcessInputFrameInner(buffer);
 }
 
 void HpaeCoBufferNode::DoProcess()
 {
-    std::unique_lock<std::mutex> lock(mutex_);
-    
     // write silence data if enqueue is not running
-    if (!enqueueRunning_) {
+    if (!enqueueRunning_.load()) {
+        outputRunning_ = false;
         outputStream_.WriteDataToOutput(&silenceData_);
         return;
     }
-    
-    // process output buffer
-    ProcessOutputFrameInner();
-    
+    if (!outputRunning_) {
+        outputRunning_ = true;
+        silenceFramesToFill_ = TEST_LATENCY / FRAME_LEN_20MS;
+        driftCompensator_.Reset();
+        // skip what the producer dropped right away, the silence frames below do not read the ring and the stale
+        // data would otherwise keep the producer from enqueueing until they are done
+        if (ringCache_ != nullptr) {
+            ringCache_->GetReadableSize();
+        }
+    }
+
+    if (silenceFramesToFill_ > 0) {
+        // the producer keeps filling the ring meanwhile, which builds up the latency
+        silenceFramesToFill_--;
+        outputStream_.WriteDataToOutput(&silenceData_);
+    } else {
+        // process output buffer
+        ProcessOutputFrameInner();
+    }
+
 #ifdef ENABLE_HOOK_PCM
     if (outputPcmDumper_) {
         const size_t dumpSize = coBufferOut_.GetFrameLen() * sizeof(float) * coBufferOut_.GetChannelCount();
@@ -176,32 +194,6 @@ void HpaeCoBufferNode::SetLatency(uint32_t latency)
     AUDIO_INFO_LOG("latency is %{public}d", latency);
 }
 
-void HpaeCoBufferNode::FillSilenceFramesInner(uint32_t latencyMs)
-{
-    CHECK_AND_RETURN_LOG(ringCache_ != nullptr, "Ring cache is null");
-    
-    uint32_t offset = 0;
-    const size_t frameSize = silenceData_.GetFrameLen() * silenceData_.GetChannelCount() * sizeof(float);
-    
-    while (offset < latencyMs) {
-        // check writable size
-        OptResult result = ringCache_->GetWritableSize();
-        CHECK_AND_RETURN_LOG(result.ret == OPERATION_SUCCESS, "Get writable size failed");
-        if (result.size < frameSize) {
-            AUDIO_WARNING_LOG("Insufficient space for silence frame: %{public}zu < %{public}zu",
-                result.size, frameSize);
-            break;
-        }
-        
-        // create silence frame
-        BufferWrap bufferWrap = {reinterpret_cast<uint8_t *>(silenceData_.GetPcmDataBuffer()), frameSize};
-        result = ringCache_->Enqueue(bufferWrap);
-        CHECK_AND_RETURN_LOG(result.ret == OPERATION_SUCCESS, "Enqueue silence frame failed");
-        offset += FRAME_LEN_20MS;
-    }
-    AUDIO_INFO_LOG("Filled %{public}u ms of silence frames", offset);
-}
-
 void HpaeCoBufferNode::ProcessInputFrameInner(HpaePcmBuffer* buffer)
 {
     CHECK_AND_RETURN_LOG(ringCache_ != nullptr && buffer != nullptr,
@@ -219,37 +211,25 @@ void HpaeCoBufferNode::ProcessInputFrameInner(HpaePcmBuffer* buffer)
     BufferWrap bufferWrap = {reinterpret_cast<uint8_t*>(buffer->GetPcmDataBuffer()), writeLen};
     result = ringCache_->Enqueue(bufferWrap);
     CHECK_AND_RETURN_LOG(result.ret == OPERATION_SUCCESS, "Enqueue data failed");
+    driftCompensator_.OnProducerWrite(buffer->GetFrameLen(), ClockTime::GetCurNano());
 }
 
 void HpaeCoBufferNode::ProcessOutputFrameInner()
 {
     CHECK_AND_RETURN_LOG(ringCache_ != nullptr, "Ring cache is null");
-    
-    const size_t requestDataLen = static_cast<size_t>(SAMPLE_RATE_48000) *
-                                  static_cast<size_t>(STEREO) *
-                                  sizeof(float) *
-                                  static_cast<size_t>(FRAME_LEN_20MS) /
-                                  static_cast<size_t>(MS_PER_SECOND);
-    
-    // check readable size
-    OptResult result = ringCache_->GetReadableSize();
-    CHECK_AND_RETURN_LOG(result.ret == OPERATION_SUCCESS, "Get readable size failed");
-    
-    if (result.size < requestDataLen) {
-        AUDIO_WARNING_LOG("Insufficient data: %{public}zu < %{public}zu, outputting silence",
-            result.size, requestDataLen);
+
+    // resample the ring content slightly so its fill level stays at the latency, instead of under/overrunning
+    int32_t ret = driftCompensator_.Process(*ringCache_, coBufferOut_.GetPcmDataBuffer(), DEFAULT_FRAME_LEN,
+        ClockTime::GetCurNano());
+    if (ret == ERR_INVALID_PARAM) {
         outputStream_.WriteDataToOutput(&silenceData_);
-    } else {
-        // read buffer
-        BufferWrap bufferWrap = {reinterpret_cast<uint8_t *>(coBufferOut_.GetPcmDataBuffer()), requestDataLen};
-        result = ringCache_->Dequeue(bufferWrap);
-        CHECK_AND_RETURN_LOG(result.ret == OPERATION_SUCCESS, "Dequeue data failed");
-        if (result.ret != OPERATION_SUCCESS) {
-            outputStream_.WriteDataToOutput(&silenceData_);
-        } else {
-            outputStream_.WriteDataToOutput(&coBufferOut_);
-        }
+        return;
+    }
+    if (ret != SUCCESS) {
+        // the frames that were available are kept, only the missing tail is silence
+        AUDIO_WARNING_LOG("Insufficient data, padding silence");
     }
+    outputStream_.WriteDataToOutput(&coBufferOut_);
 }
 
 void HpaeCoBufferNode::SetOutputClusterConnected(bool isConnect)
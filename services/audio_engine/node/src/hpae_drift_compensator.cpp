@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LOG_TAG
+#define LOG_TAG "HpaeDriftCompensator"
+#endif
+
+#include "hpae_drift_compensator.h"
+#include <algorithm>
+#include <cmath>
+#include "securec.h"
+#include "audio_errors.h"
+#include "audio_engine_log.h"
+
+namespace OHOS {
+namespace AudioStandard {
+namespace HPAE {
+static constexpr uint32_t MS_PER_SECOND = 1000;
+static constexpr double NS_PER_SECOND = 1000000000.0;
+static constexpr uint32_t DRIFT_RESAMPLE_QUALITY = 1;
+static constexpr double MAX_DRIFT_PPM = 1000.0;
+static constexpr double PPM_PER_UNIT = 1000000.0;
+// PI gains in ppm per second of fill error and ppm per second of accumulated error, damping is about 0.7
+static constexpr double DRIFT_KP = 40000.0;
+static constexpr double DRIFT_KI = 800.0;
+// smooths scheduling jitter of both threads
+static constexpr double FILL_SMOOTH_FACTOR = 0.05;
+// the resampler may consume a frame more than the ratio says and holds back half its filter taps on the first call
+static constexpr uint32_t INPUT_MARGIN_FRAMES = 16;
+
+HpaeDriftCompensator::HpaeDriftCompensator(uint32_t sampleRate, uint32_t channels, uint32_t targetLatencyMs)
+    : sampleRate_(sampleRate), channels_(channels),
+      targetFrames_(static_cast<double>(sampleRate) * targetLatencyMs / MS_PER_SECOND)
+{
+    resampler_ = ProResampler::CreateDriftResampler(sampleRate, channels, DRIFT_RESAMPLE_QUALITY);
+    CHECK_AND_RETURN_LOG(resampler_ != nullptr, "create drift resampler failed");
+    AUDIO_INFO_LOG("rate %{public}u channels %{public}u target latency %{public}u ms",
+        sampleRate, channels, targetLatencyMs);
+}
+
+void HpaeDriftCompensator::Reset()
+{
+    inFrames_ = 0;
+    isFirstFrame_ = true;
+    avgFillFrames_ = 0.0;
+    integral_ = 0.0;
+    driftPpm_ = 0.0;
+    CHECK_AND_RETURN(resampler_ != nullptr);
+    resampler_->Reset();
+    resampler_->UpdateDriftPpm(driftPpm_);
+}
+
+double HpaeDriftCompensator::GetDriftPpm() const
+{
+    return driftPpm_;
+}
+
+void HpaeDriftCompensator::OnProducerWrite(uint32_t frameLen, int64_t timeNs)
+{
+    lastWriteFrames_.store(frameLen);
+    lastWriteTimeNs_.store(timeNs);
+}
+
+double HpaeDriftCompensator::GetFillFrames(size_t bufferedFrames, int64_t timeNs)
+{
+    // The ring only changes by whole producer blocks. Spreading the newest block over the time the producer takes
+    // to deliver the next one turns that staircase into a smooth level, otherwise the controller would chase the
+    // slowly beating phase between the two threads.
+    const int64_t lastWriteTimeNs = lastWriteTimeNs_.load();
+    const uint32_t lastWriteFrames = lastWriteFrames_.load();
+    double fillFrames = static_cast<double>(bufferedFrames);
+    if (lastWriteTimeNs > 0 && timeNs >= lastWriteTimeNs) {
+        const double elapsedFrames = (timeNs - lastWriteTimeNs) * sampleRate_ / NS_PER_SECOND;
+        fillFrames -= lastWriteFrames - std::min(elapsedFrames, static_cast<double>(lastWriteFrames));
+    }
+    return fillFrames;
+}
+
+void HpaeDriftCompensator::UpdateDrift(double fillFrames, uint32_t outFrameLen)
+{
+    if (isFirstFrame_) {
+        isFirstFrame_ = false;
+        avgFillFrames_ = fillFrames;
+    } else {
+        avgFillFrames_ += FILL_SMOOTH_FACTOR * (fillFrames - avgFillFrames_);
+    }
+    // positive error: the producer runs faster than the consumer, consume more input per output frame
+    const double errorSec = (avgFillFrames_ - targetFrames_) / sampleRate_;
+    const double intervalSec = static_cast<double>(outFrameLen) / sampleRate_;
+    integral_ = std::clamp(integral_ + errorSec * intervalSec, -MAX_DRIFT_PPM / DRIFT_KI, MAX_DRIFT_PPM / DRIFT_KI);
+    driftPpm_ = std::clamp(DRIFT_KP * errorSec + DRIFT_KI * integral_, -MAX_DRIFT_PPM, MAX_DRIFT_PPM);
+    resampler_->UpdateDriftPpm(driftPpm_);
+}
+
+uint32_t HpaeDriftCompensator::FillInput(HpaeSpscRingBuffer &ring, size_t readableFrames, uint32_t outFrameLen)
+{
+    const uint32_t needFrames = static_cast<uint32_t>(std::ceil(outFrameLen * (1.0 + MAX_DRIFT_PPM / PPM_PER_UNIT))) +
+        INPUT_MARGIN_FRAMES;
+    if (inBuffer_.size() < needFrames * channels_) {
+        inBuffer_.resize(needFrames * channels_);
+    }
+    const size_t readFrames = std::min(readableFrames, static_cast<size_t>(needFrames - std::min(needFrames,
+        inFrames_)));
+    if (readFrames > 0) {
+        const size_t readLen = readFrames * channels_ * sizeof(float);
+        OptResult result = ring.Dequeue({reinterpret_cast<uint8_t *>(inBuffer_.data() + inFrames_ * channels_),
+            readLen});
+        CHECK_AND_RETURN_RET_LOG(result.ret == OPERATION_SUCCESS, inFrames_, "dequeue %{public}zu failed", readLen);
+        inFrames_ += static_cast<uint32_t>(readFrames);
+    }
+    return inFrames_;
+}
+
+int32_t HpaeDriftCompensator::Process(HpaeSpscRingBuffer &ring, float *outBuffer, uint32_t outFrameLen,
+    int64_t timeNs)
+{
+    CHECK_AND_RETURN_RET_LOG(resampler_ != nullptr && outBuffer != nullptr && outFrameLen > 0, ERR_INVALID_PARAM,
+        "invalid param");
+    const size_t frameSize = channels_ * sizeof(float);
+    OptResult result = ring.GetReadableSize();
+    const size_t readableFrames = result.ret == OPERATION_SUCCESS ? result.size / frameSize : 0;
+    UpdateDrift(GetFillFrames(readableFrames + inFrames_, timeNs), outFrameLen);
+
+    uint32_t inFrameLen = FillInput(ring, readableFrames, outFrameLen);
+    uint32_t outLen = outFrameLen;
+    int32_t ret = inFrameLen == 0 ? ERROR : resampler_->ProcessDrift(inBuffer_.data(), inFrameLen, outBuffer, outLen);
+    if (ret != SUCCESS) {
+        outLen = 0;
+        inFrameLen = 0;
+    }
+
+    // keep what the resampler did not consume for the next frame
+    inFrames_ -= inFrameLen;
+    if (inFrames_ > 0 && inFrameLen > 0) {
+        std::copy(inBuffer_.begin() + inFrameLen * channels_, inBuffer_.begin() + (inFrameLen + inFrames_) * channels_,
+            inBuffer_.begin());
+    }
+    if (outLen < outFrameLen) {
+        const size_t padLen = (outFrameLen - outLen) * frameSize;
+        memset_s(outBuffer + outLen * channels_, padLen, 0, padLen);
+        AUDIO_DEBUG_LOG("underrun, produced %{public}u of %{public}u frames", outLen, outFrameLen);
+        return ERROR;
+    }
+    return SUCCESS;
+}
+}  // namespace HPAE
+}  // namespace AudioStandard
+}  // namespace OHOS
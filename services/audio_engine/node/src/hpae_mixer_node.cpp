@@ -16,6 +16,7 @@
 #define LOG_TAG "HpaeMixerNode"
 #endif
 
+#include <algorithm>
 #include <iostream>
 #include "hpae_mixer_node.h"
 #include "hpae_pcm_buffer.h"
@@ -65,6 +66,57 @@ bool HpaeMixerNode::Reset()
     return HpaePluginNode::Reset();
 }
 
+void HpaeMixerNode::SetWorkerPool(const std::shared_ptr<HpaeWorkerPool> &workerPool)
+{
+    workerPool_ = workerPool;
+}
+
+void HpaeMixerNode::DoProcess()
+{
+    if (workerPool_ != nullptr && inputStream_.GetPreOutputNum() > 1 && CollectDisjointInputs()) {
+        PrepareInputsInParallel();
+    }
+    HpaePluginNode::DoProcess();
+}
+
+// An input may only run on a worker when this mixer is the single consumer of its output port and no other input
+// comes from the same node, otherwise two threads could process one node in the same period.
+bool HpaeMixerNode::CollectDisjointInputs()
+{
+    preOutputPorts_.clear();
+    preNodes_.clear();
+    for (const auto &preOutput : inputStream_.GetPreOutputMap()) {
+        OutputPort<HpaePcmBuffer *> *outputPort = preOutput.first;
+        HpaeNode *preNode = preOutput.second.get();
+        if (outputPort == nullptr || outputPort->GetInputNum() != 1 || outputPort->GetCoInputNum() != 0 ||
+            std::find(preNodes_.begin(), preNodes_.end(), preNode) != preNodes_.end()) {
+            AUDIO_DEBUG_LOG("input of node %{public}u is shared, pull inputs in turn", GetNodeId());
+            return false;
+        }
+        preOutputPorts_.push_back(outputPort);
+        preNodes_.push_back(preNode);
+    }
+    return true;
+}
+
+// Every input renders its period into its own output port here, the sequential pull that follows only collects
+// the cached buffers in the usual order. Status callbacks raised on a worker are queued per input and replayed
+// on the render thread in input order, the order the sequential pull would have raised them in.
+void HpaeMixerNode::PrepareInputsInParallel()
+{
+    Trace trace("HpaeMixerNode::PrepareInputsInParallel");
+    while (callbackDeferrers_.size() < preOutputPorts_.size()) {
+        callbackDeferrers_.push_back(std::make_unique<HpaeNodeCallbackDeferrer>());
+    }
+    workerPool_->Run(preOutputPorts_.size(), [this](size_t index) {
+        HpaeNodeCallbackDeferrer::Scope scope(*callbackDeferrers_[index]);
+        preOutputPorts_[index]->PrepareOutputData();
+    });
+    for (size_t i = 0; i < preOutputPorts_.size(); i++) {
+        callbackDeferrers_[i]->Replay();
+    }
+}
+
 void HpaeMixerNode::SetNodeInfo(HpaeNodeInfo& nodeInfo)
 {
     mixedOutput_.SetAudioStreamType(nodeInfo.streamType);
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LOG_TAG
+#define LOG_TAG "HpaeNodeCallbackDeferrer"
+#endif
+
+#include "hpae_node_callback_deferrer.h"
+#include <mutex>
+#include "audio_engine_log.h"
+
+namespace OHOS {
+namespace AudioStandard {
+namespace HPAE {
+namespace {
+thread_local HpaeNodeCallbackDeferrer *g_currentDeferrer = nullptr;
+std::mutex g_requestLatencyMutex;
+}
+
+class HpaeDeferredNodeCallback : public INodeCallback {
+public:
+    HpaeDeferredNodeCallback(HpaeNodeCallbackDeferrer &deferrer, const std::weak_ptr<INodeCallback> &target)
+        : deferrer_(deferrer), target_(target)
+    {}
+
+    bool IsFor(const std::weak_ptr<INodeCallback> &target) const
+    {
+        return !target_.owner_before(target) && !target.owner_before(target_);
+    }
+
+    void OnNodeStatusUpdate(uint32_t sessionId, IOperation operation) override
+    {
+        Defer([sessionId, operation](INodeCallback &target) { target.OnNodeStatusUpdate(sessionId, operation); });
+    }
+
+    void OnFadeDone(uint32_t sessionId) override
+    {
+        Defer([sessionId](INodeCallback &target) { target.OnFadeDone(sessionId); });
+    }
+
+    void OnRequestLatency(uint32_t sessionId, uint64_t &latency) override
+    {
+        // the render thread waits for the workers, so the manager state is read while nothing modifies it
+        std::lock_guard<std::mutex> lock(g_requestLatencyMutex);
+        if (auto target = target_.lock()) {
+            target->OnRequestLatency(sessionId, latency);
+        }
+    }
+
+    void OnRewindAndFlush(uint64_t rewindTime, uint64_t hdiFramePosition) override
+    {
+        Defer([rewindTime, hdiFramePosition](INodeCallback &target) {
+            target.OnRewindAndFlush(rewindTime, hdiFramePosition);
+        });
+    }
+
+    void OnNotifyQueue() override
+    {
+        Defer([](INodeCallback &target) { target.OnNotifyQueue(); });
+    }
+
+    void OnDisConnectProcessCluster(HpaeProcessorType sceneType) override
+    {
+        Defer([sceneType](INodeCallback &target) { target.OnDisConnectProcessCluster(sceneType); });
+    }
+
+    void OnNotifyDfxNodeAdmin(bool isAdd, const HpaeDfxNodeInfo &nodeInfo) override
+    {
+        Defer([isAdd, nodeInfo](INodeCallback &target) { target.OnNotifyDfxNodeAdmin(isAdd, nodeInfo); });
+    }
+
+    void OnNotifyDfxNodeInfo(bool isConnect, uint32_t parentId, uint32_t childId) override
+    {
+        Defer([isConnect, parentId, childId](INodeCallback &target) {
+            target.OnNotifyDfxNodeInfo(isConnect, parentId, childId);
+        });
+    }
+
+    void OnNotifyDfxNodeInfoChanged(uint32_t nodeId, const HpaeDfxNodeInfo &nodeInfo) override
+    {
+        Defer([nodeId, nodeInfo](INodeCallback &target) { target.OnNotifyDfxNodeInfoChanged(nodeId, nodeInfo); });
+    }
+
+private:
+    template <typename Call>
+    void Defer(Call &&call)
+    {
+        deferrer_.Post([target = target_, call = std::forward<Call>(call)]() {
+            if (auto callback = target.lock()) {
+                call(*callback);
+            }
+        });
+    }
+
+    HpaeNodeCallbackDeferrer &deferrer_;
+    std::weak_ptr<INodeCallback> target_;
+};
+
+HpaeNodeCallbackDeferrer::Scope::Scope(HpaeNodeCallbackDeferrer &deferrer) : prevDeferrer_(g_currentDeferrer)
+{
+    g_currentDeferrer = &deferrer;
+}
+
+HpaeNodeCallbackDeferrer::Scope::~Scope()
+{
+    g_currentDeferrer = prevDeferrer_;
+}
+
+HpaeNodeCallbackDeferrer::HpaeNodeCallbackDeferrer() = default;
+
+HpaeNodeCallbackDeferrer::~HpaeNodeCallbackDeferrer()
+{
+    if (!pendingCalls_.empty()) {
+        AUDIO_WARNING_LOG("drop %{public}zu node callbacks never replayed", pendingCalls_.size());
+    }
+}
+
+HpaeNodeCallbackDeferrer *HpaeNodeCallbackDeferrer::GetCurrent()
+{
+    return g_currentDeferrer;
+}
+
+std::weak_ptr<INodeCallback> HpaeNodeCallbackDeferrer::Wrap(const std::weak_ptr<INodeCallback> &callback)
+{
+    std::shared_ptr<INodeCallback> target = callback.lock();
+    if (target == nullptr) {
+        return callback;
+    }
+    // one proxy per manager, reused every period so routing a callback does not allocate
+    std::shared_ptr<HpaeDeferredNodeCallback> &proxy = proxies_[target.get()];
+    if (proxy == nullptr || !proxy->IsFor(callback)) {
+        proxy = std::make_shared<HpaeDeferredNodeCallback>(*this, callback);
+    }
+    return proxy;
+}
+
+void HpaeNodeCallbackDeferrer::Post(std::function<void()> &&call)
+{
+    pendingCalls_.push_back(std::move(call));
+}
+
+void HpaeNodeCallbackDeferrer::Replay()
+{
+    for (auto &call : pendingCalls_) {
+        call();
+    }
+    pendingCalls_.clear();
+}
+
+size_t HpaeNodeCallbackDeferrer::GetPendingNum() const
+{
+    return pendingCalls_.size();
+}
+}  // namespace HPAE
+}  // namespace AudioStandard
+}  // namespace OHOS
@@ -18,6 +18,7 @@
 
 #include "hpae_offload_sinkoutput_node.h"
 #include "audio_errors.h"
+#include <algorithm>
 #include <iostream>
 #include <cinttypes>
 
@@ -43,6 +44,7 @@ namespace {
     constexpr uint32_t OFFLOAD_HDI_CACHE_BACKGROUND_IN_MS = 7000;
     constexpr uint32_t OFFLOAD_HDI_CACHE_FRONTGROUND_IN_MS = 200;
     constexpr uint32_t OFFLOAD_HDI_CACHE_MOVIE_IN_MS = 500;
+    constexpr uint32_t OFFLOAD_BURST_MAX_IN_MS = 500; // max data rendered ahead in one write to hdi
     // hdi fallback, modify when hdi change
     constexpr uint32_t OFFLOAD_FAD_INTERVAL_IN_US = 180000;
     constexpr uint32_t OFFLOAD_SET_BUFFER_SIZE_NUM = 5;
@@ -54,7 +56,8 @@ namespace {
 }
 HpaeOffloadSinkOutputNode::HpaeOffloadSinkOutputNode(HpaeNodeInfo &nodeInfo)
     : HpaeNode(nodeInfo),
-      renderFrameData_(0)
+      renderFrameData_(0),
+      hdiBufferSizeMs_(OFFLOAD_HDI_CACHE_FRONTGROUND_IN_MS)
 {
 #ifdef ENABLE_HOOK_PCM
     outputPcmDumper_ = std::make_unique<HpaePcmDumper>(
@@ -104,7 +107,9 @@ void HpaeOffloadSinkOutputNode::DoProcess()
     }
     // if there are no enough frames in cache, read more data from pre-output
     size_t frameSize = static_cast<size_t>(GetSizeFromFormat(GetBitWidth())) * GetFrameLen() * GetChannelCount();
-    while (renderFrameData_.size() < CACHE_FRAME_COUNT * frameSize) {
+    size_t burstFrameCount = GetBurstFrameCount();
+    // data left by a partial write goes to hdi first
+    while (renderOffset_ == 0 && renderFrameData_.size() < burstFrameCount * frameSize) {
         std::vector<HpaePcmBuffer *> &outputVec = inputStream_.ReadPreOutputData();
         if (outputVec.size() && outputVec.front()->IsValid()) {
             renderFrameData_.resize(renderFrameData_.size() + frameSize);
@@ -188,6 +193,7 @@ void HpaeOffloadSinkOutputNode::OffloadReset()
     firstWriteHdi_ = true;
     isHdiFull_.store(false);
     renderFrameData_.clear();
+    renderOffset_ = 0;
     setPolicyStateTask_.flag = false; // unset the task when reset
 }
 
@@ -315,6 +321,7 @@ int32_t HpaeOffloadSinkOutputNode::RenderSinkStop(void)
 void HpaeOffloadSinkOutputNode::FlushStream()
 {
     renderFrameData_.clear();
+    renderOffset_ = 0;
 }
 
 size_t HpaeOffloadSinkOutputNode::GetPreOutNum()
@@ -352,7 +359,7 @@ void HpaeOffloadSinkOutputNode::StopStream()
     uint64_t cacheLenInHdi = CalcOffloadCacheLenInHdi();
     uint64_t fadeOutLen = static_cast<uint64_t>(OFFLOAD_FAD_INTERVAL_IN_US * speed_);
     cacheLenInHdi = cacheLenInHdi > fadeOutLen ? cacheLenInHdi - fadeOutLen : 0;
-    uint64_t rewindTime = cacheLenInHdi + ConvertDatalenToUs(renderFrameData_.size(), GetNodeInfo());
+    uint64_t rewindTime = cacheLenInHdi + ConvertDatalenToUs(renderFrameData_.size() - renderOffset_, GetNodeInfo());
     AUDIO_DEBUG_LOG("OffloadRewindAndFlush rewind time in us %{public}" PRIu64, rewindTime);
     auto callback = GetNodeInfo().statusCallback.lock();
     CHECK_AND_RETURN_LOG(callback != nullptr, "HpaeOffloadSinkOutputNode::StopStream callback is null");
@@ -382,7 +389,7 @@ void HpaeOffloadSinkOutputNode::SetPolicyState(int32_t state)
 
 uint64_t HpaeOffloadSinkOutputNode::GetLatency()
 {
-    return ConvertDatalenToUs(renderFrameData_.size(), GetNodeInfo());
+    return ConvertDatalenToUs(renderFrameData_.size() - renderOffset_, GetNodeInfo());
 }
 
 int32_t HpaeOffloadSinkOutputNode::SetTimeoutStopThd(uint32_t timeoutThdMs)
@@ -448,17 +455,29 @@ void HpaeOffloadSinkOutputNode::SetBufferSize()
         bufferSize = hdiPolicyState_ == OFFLOAD_INACTIVE_BACKGROUND ?
             OFFLOAD_HDI_CACHE_BACKGROUND_IN_MS : OFFLOAD_HDI_CACHE_FRONTGROUND_IN_MS;
     }
+    hdiBufferSizeMs_ = bufferSize;
     audioRendererSink_->SetBufferSize(bufferSize);
 }
 
+size_t HpaeOffloadSinkOutputNode::GetBurstFrameCount()
+{
+    // keep the first write short, the fade in is applied on the whole of it
+    if (firstWriteHdi_ || frameLenMs_ == 0) {
+        return CACHE_FRAME_COUNT;
+    }
+    uint64_t cacheLenInHdi = CalcOffloadCacheLenInHdi();
+    uint64_t targetLen = static_cast<uint64_t>(std::min(hdiBufferSizeMs_, OFFLOAD_BURST_MAX_IN_MS)) * TIME_US_PER_MS;
+    uint64_t freeLen = targetLen > cacheLenInHdi ? targetLen - cacheLenInHdi : 0;
+    size_t frameCount = static_cast<size_t>(freeLen / (static_cast<uint64_t>(frameLenMs_) * TIME_US_PER_MS));
+    return std::max(frameCount, static_cast<size_t>(CACHE_FRAME_COUNT));
+}
+
 int32_t HpaeOffloadSinkOutputNode::ProcessRenderFrame()
 {
-    if (renderFrameData_.empty()) {
+    if (renderFrameData_.size() <= renderOffset_) {
         return OFFLOAD_WRITE_FAILED;
     }
 
-    renderFrameDataTemp_ = renderFrameData_;
-
 #ifdef ENABLE_HOOK_PCM
     HighResolutionTimer timer;
     timer.Start();
@@ -468,12 +487,17 @@ int32_t HpaeOffloadSinkOutputNode::ProcessRenderFrame()
         sinkOutAttr_.adapterName.c_str(), interval);
 #endif
 
+    char *data = renderFrameData_.data() + renderOffset_;
+    size_t len = renderFrameData_.size() - renderOffset_;
     if (firstWriteHdi_) {
+        // fade in on a copy of the first write only, so a failed first write is retried from the original data
+        renderFrameDataTemp_.assign(data, data + len);
         AudioRawFormat format{ GetBitWidth(), GetChannelCount() };
-        ProcessVol(reinterpret_cast<uint8_t *>(renderFrameDataTemp_.data()), renderFrameData_.size(), format, 0, 1);
+        ProcessVol(reinterpret_cast<uint8_t *>(renderFrameDataTemp_.data()), len, format, 0, 1);
+        data = renderFrameDataTemp_.data();
     }
 
-    int32_t result = WriteFrameToHdi();
+    int32_t result = WriteFrameToHdi(*data, len);
     if (result != SUCCESS) {
         return result;
     }
@@ -490,24 +514,27 @@ int32_t HpaeOffloadSinkOutputNode::ProcessRenderFrame()
 #endif
 
     renderFrameData_.clear();
+    renderOffset_ = 0;
     return SUCCESS;
 }
 
-int32_t HpaeOffloadSinkOutputNode::WriteFrameToHdi()
+int32_t HpaeOffloadSinkOutputNode::WriteFrameToHdi(char &data, size_t len)
 {
     uint64_t writeLen = 0;
     auto now = std::chrono::high_resolution_clock::now();
 
-    auto ret = audioRendererSink_->RenderFrame(*renderFrameDataTemp_.data(), renderFrameData_.size(), writeLen);
+    auto ret = audioRendererSink_->RenderFrame(data, len, writeLen);
     if (ret == SUCCESS && writeLen == 0 && !firstWriteHdi_) {
         return OFFLOAD_FULL;
     }
-    if (!(ret == SUCCESS && writeLen == renderFrameData_.size())) {
+    if (ret != SUCCESS || writeLen == 0 || writeLen > len) {
         AUDIO_ERR_LOG("renderFrame failed, errCode %{public}d, writelen %{public}" PRIu64 " bytes", ret, writeLen);
         return OFFLOAD_WRITE_FAILED;
     }
 
-    writePos_ += ConvertDatalenToUs(renderFrameData_.size(), GetNodeInfo());
+    // hdi keeps what it accepted, the rest is written from this offset once hdi has room again
+    renderOffset_ += static_cast<size_t>(writeLen);
+    writePos_ += ConvertDatalenToUs(static_cast<size_t>(writeLen), GetNodeInfo());
 
     if (firstWriteHdi_) {
         firstWriteHdi_ = false;
@@ -520,7 +547,7 @@ int32_t HpaeOffloadSinkOutputNode::WriteFrameToHdi()
     }
 
     SetBufferSizeWhileRenderFrame();
-    return SUCCESS;
+    return writeLen == len ? SUCCESS : OFFLOAD_FULL;
 }
 
 int32_t HpaeOffloadSinkOutputNode::UpdatePresentationPosition()
@@ -80,6 +80,12 @@ void HpaeOutputCluster::DoProcess()
     }
 }
 
+// each scene converter pulls its own process cluster, so the scenes can be rendered side by side
+void HpaeOutputCluster::SetWorkerPool(const std::shared_ptr<HpaeWorkerPool> &workerPool)
+{
+    mixerNode_->SetWorkerPool(workerPool);
+}
+
 bool HpaeOutputCluster::Reset()
 {
     mixerNode_->Reset();
@@ -60,6 +60,7 @@ HpaeRenderEffectNode::HpaeRenderEffectNode(HpaeNodeInfo &nodeInfo) : HpaeNode(no
             collaborativeOutput_ = std::make_unique<HpaePcmBuffer>(pcmBufferInfo);
         }
     }
+    sceneTypeHandle_ = AudioEffectChainManager::GetInstance()->GetSceneTypeHandle(sceneType_);
     AUDIO_INFO_LOG("created, scene type: %{public}s", sceneType_.c_str());
 #ifdef ENABLE_HOOK_PCM
     if (sceneType_ == "SCENE_COLLABORATIVE") {
@@ -155,7 +156,7 @@ HpaePcmBuffer *HpaeRenderEffectNode::SignalProcess(const std::vector<HpaePcmBuff
         0
     );
 
-    int32_t ret = AudioEffectChainManager::GetInstance()->ApplyAudioEffectChain(sceneType_, eBufferAttr);
+    int32_t ret = AudioEffectChainManager::GetInstance()->ApplyAudioEffectChain(sceneTypeHandle_, eBufferAttr);
     CHECK_AND_RETURN_RET_LOG(ret == SUCCESS, inputs[0], "apply audio effect chain fail");
 
     effectOutput_.SetBufferState(inputs[0]->GetBufferState());
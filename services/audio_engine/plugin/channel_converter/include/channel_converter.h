@@ -35,10 +35,24 @@ public:
     void SetDownmixNormalization(bool normalizing);
     void Reset();
 private:
-    int32_t MixProcess(bool isDmix, uint32_t frameLen, float* in, float* out);
+    // one non-zero coefficient of an output channel
+    struct MixTerm {
+        uint32_t inIndex = 0;
+        float coeff = 0.0f;
+    };
+    using MixKernel = void (*)(const float *coeffs, uint32_t frameLen, const float *in, float *out);
+
+    int32_t MixProcess(uint32_t frameLen, float* in, float* out);
     void UpmixGainAttenuation();
+    void CompileMixTable();
     DownMixer downMixer_;
     float mixTable_[MAX_CHANNELS][MAX_CHANNELS] = {{0}};
+    // mixTable_ compiled when the channel info changes, dense [out][in] for the fixed channel kernels,
+    // non-zero terms of each output channel for the others
+    float mixCoeffs_[MAX_CHANNELS * MAX_CHANNELS] = {0};
+    MixTerm mixTerms_[MAX_CHANNELS][MAX_CHANNELS] = {};
+    uint32_t mixTermCount_[MAX_CHANNELS] = {0};
+    MixKernel mixKernel_ = nullptr;
     AudioChannelInfo inChannelInfo_;
     AudioChannelInfo outChannelInfo_;
     AudioSampleFormat workFormat_ = INVALID_WIDTH;  // work format, for now only supports float
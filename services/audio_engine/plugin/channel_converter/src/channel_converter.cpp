@@ -17,10 +17,104 @@
 #endif
 #include "channel_converter.h"
 #include "audio_engine_log.h"
+
+#if !defined(DISABLE_SIMD) && \
+    (defined(__aarch64__) || (defined(__arm__) && defined(__ARM_NEON__)))
+// enable arm Simd
+#include <arm_neon.h>
+#define USE_ARM_NEON 1
+#else
+// disable SIMD.
+#define USE_ARM_NEON 0
+#endif
+
 namespace OHOS {
 namespace AudioStandard {
 namespace HPAE {
 static constexpr uint32_t MAX_FRAME_LENGTH = SAMPLE_RATE_192000 * 10; // max framelength is sample rate 192000, 10s
+#if USE_ARM_NEON == 1
+static constexpr uint32_t NEON_F32_LANES = 4;
+#endif
+
+// coeffs is the dense [OUT][IN] mix table, channel counts are fixed so the compiler can fully unroll each frame
+template <uint32_t IN, uint32_t OUT>
+static void MixFixed(const float *coeffs, uint32_t frameLen, const float *in, float *out)
+{
+    for (; frameLen > 0; frameLen--) {
+        for (uint32_t i = 0; i < OUT; i++) {
+            float a = 0.0f;
+            for (uint32_t j = 0; j < IN; j++) {
+                a += in[j] * coeffs[i * IN + j];
+            }
+            out[i] = a;
+        }
+        in += IN;
+        out += OUT;
+    }
+}
+
+template <>
+void MixFixed<MONO, STEREO>(const float *coeffs, uint32_t frameLen, const float *in, float *out)
+{
+    uint32_t frameIdx = 0;
+#if USE_ARM_NEON == 1
+    float32x4_t coeffLeft = vdupq_n_f32(coeffs[0]);
+    float32x4_t coeffRight = vdupq_n_f32(coeffs[1]);
+    for (; frameIdx + NEON_F32_LANES <= frameLen; frameIdx += NEON_F32_LANES) {
+        float32x4_t src = vld1q_f32(in + frameIdx);
+        float32x4x2_t dst;
+        dst.val[0] = vmulq_f32(src, coeffLeft);
+        dst.val[1] = vmulq_f32(src, coeffRight);
+        vst2q_f32(out + frameIdx * STEREO, dst);
+    }
+#endif
+    for (; frameIdx < frameLen; frameIdx++) {
+        out[frameIdx * STEREO] = in[frameIdx] * coeffs[0];
+        out[frameIdx * STEREO + 1] = in[frameIdx] * coeffs[1];
+    }
+}
+
+template <>
+void MixFixed<STEREO, MONO>(const float *coeffs, uint32_t frameLen, const float *in, float *out)
+{
+    uint32_t frameIdx = 0;
+#if USE_ARM_NEON == 1
+    float32x4_t coeffLeft = vdupq_n_f32(coeffs[0]);
+    float32x4_t coeffRight = vdupq_n_f32(coeffs[1]);
+    for (; frameIdx + NEON_F32_LANES <= frameLen; frameIdx += NEON_F32_LANES) {
+        float32x4x2_t src = vld2q_f32(in + frameIdx * STEREO);
+        float32x4_t dst = vmulq_f32(src.val[0], coeffLeft);
+        dst = vmlaq_f32(dst, src.val[1], coeffRight);
+        vst1q_f32(out + frameIdx, dst);
+    }
+#endif
+    for (; frameIdx < frameLen; frameIdx++) {
+        out[frameIdx] = in[frameIdx * STEREO] * coeffs[0] + in[frameIdx * STEREO + 1] * coeffs[1];
+    }
+}
+
+using FixedMixKernel = void (*)(const float *coeffs, uint32_t frameLen, const float *in, float *out);
+
+// 5.1 -> 2, 7.1 -> 2, 7.1.4 -> 5.1 and mono <-> stereo
+static FixedMixKernel GetFixedMixKernel(uint32_t inChannels, uint32_t outChannels)
+{
+    if (inChannels == MONO && outChannels == STEREO) {
+        return MixFixed<MONO, STEREO>;
+    }
+    if (inChannels == STEREO && outChannels == MONO) {
+        return MixFixed<STEREO, MONO>;
+    }
+    if (inChannels == CHANNEL_6 && outChannels == STEREO) {
+        return MixFixed<CHANNEL_6, STEREO>;
+    }
+    if (inChannels == CHANNEL_8 && outChannels == STEREO) {
+        return MixFixed<CHANNEL_8, STEREO>;
+    }
+    if (inChannels == CHANNEL_12 && outChannels == CHANNEL_6) {
+        return MixFixed<CHANNEL_12, CHANNEL_6>;
+    }
+    return nullptr;
+}
 
 static uint32_t GetFormatSize(AudioSampleFormat format)
 {
@@ -75,6 +169,7 @@ int32_t ChannelConverter::SetParam(AudioChannelInfo inChannelInfo, AudioChannelI
         UpmixGainAttenuation();
     }
     isInitialized_ = (ret == MIX_ERR_SUCCESS);
+    CompileMixTable();
     return ret;
 }
 
@@ -93,6 +188,7 @@ int32_t ChannelConverter::SetInChannelInfo(AudioChannelInfo inChannelInfo)
         UpmixGainAttenuation();
     }
     isInitialized_ = (ret == MIX_ERR_SUCCESS);
+    CompileMixTable();
     return ret;
 }
  
@@ -112,6 +208,7 @@ int32_t ChannelConverter::SetOutChannelInfo(AudioChannelInfo outChannelInfo)
         UpmixGainAttenuation();
     }
     isInitialized_ = (ret == MIX_ERR_SUCCESS);
+    CompileMixTable();
     return ret;
 }
 
@@ -158,12 +255,7 @@ int32_t ChannelConverter::Process(uint32_t frameLen, float* in, uint32_t inByteS
     CHECK_AND_RETURN_RET_LOG(expectOutByteSize <= outByteSize, MIX_ERR_INVALID_ARG, "expected byte size %{public}d"
         "samller than output byte size %{public}d, cannot process", expectOutByteSize, outByteSize);
 
-    // upmix
-    if (inChannelInfo_.numChannels < outChannelInfo_.numChannels) {
-        return MixProcess(false, frameLen, in, out);
-    }
-    // downmix
-    return MixProcess(true, frameLen, in, out);
+    return MixProcess(frameLen, in, out);
 }
 
 void ChannelConverter::Reset()
@@ -171,19 +263,44 @@ void ChannelConverter::Reset()
     isInitialized_ = false;
     downMixer_.Reset();
     std::fill(&mixTable_[0][0], &mixTable_[0][0] + MAX_CHANNELS * MAX_CHANNELS, 0.0f);
+    CompileMixTable();
+}
+
+void ChannelConverter::CompileMixTable()
+{
+    uint32_t inChannels = inChannelInfo_.numChannels;
+    uint32_t outChannels = outChannelInfo_.numChannels;
+    mixKernel_ = nullptr;
+    std::fill(std::begin(mixTermCount_), std::end(mixTermCount_), 0);
+    CHECK_AND_RETURN(isInitialized_);
+
+    // if upmix, use mixTable_ in transpose because we have reverted input and output channel info
+    // when setting up mixTable_ for upmix
+    bool isDmix = inChannels >= outChannels;
+    for (uint32_t i = 0; i < outChannels; i++) {
+        for (uint32_t j = 0; j < inChannels; j++) {
+            float coeff = isDmix ? mixTable_[i][j] : mixTable_[j][i];
+            mixCoeffs_[i * inChannels + j] = coeff;
+            if (coeff != 0.0f) {
+                mixTerms_[i][mixTermCount_[i]++] = {j, coeff};
+            }
+        }
+    }
+    mixKernel_ = GetFixedMixKernel(inChannels, outChannels);
 }
 
-int32_t ChannelConverter::MixProcess(bool isDmix, uint32_t frameLen, float* in, float* out)
+int32_t ChannelConverter::MixProcess(uint32_t frameLen, float* in, float* out)
 {
+    if (mixKernel_ != nullptr) {
+        mixKernel_(mixCoeffs_, frameLen, in, out);
+        return MIX_ERR_SUCCESS;
+    }
     float a;
     for (; frameLen > 0; frameLen--) {
         for (uint32_t i = 0; i < outChannelInfo_.numChannels; i++) {
             a = 0.0f;
-            // if upmix, use mixTable_ in transpose because we have reverted input and output channel info
-            // when setting up mixTable_ for upmix
-            for (uint32_t j = 0; j < inChannelInfo_.numChannels; j++) {
-                float coeff = isDmix ? mixTable_[i][j] : mixTable_[j][i];
-                a += in[j] * coeff;
+            for (uint32_t k = 0; k < mixTermCount_[i]; k++) {
+                a += in[mixTerms_[i][k].inIndex] * mixTerms_[i][k].coeff;
             }
             *(out++) = a;
         }
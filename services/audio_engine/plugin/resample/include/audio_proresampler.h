@@ -17,6 +17,7 @@
 
 #include "resampler.h"
 #include "audio_proresampler_process.h"
+#include <memory>
 #include <vector>
 #include <string>
 namespace OHOS {
@@ -42,7 +43,16 @@ public:
     uint32_t GetOutRate() const override;
     uint32_t GetChannels() const override;
     uint32_t GetQuality() const;
+
+    // Clock drift compensation at a nominal 1:1 rate. The ratio is steered with UpdateDriftPpm while the filter
+    // and its history are kept, so it can change every frame without artifacts. ProcessDrift consumes a variable
+    // number of input frames: inFrameLen and outFrameLen are updated to the frames consumed and produced.
+    static std::unique_ptr<ProResampler> CreateDriftResampler(uint32_t sampleRate, uint32_t channels,
+        uint32_t quality);
+    int32_t UpdateDriftPpm(double ppm);
+    int32_t ProcessDrift(const float *inBuffer, uint32_t &inFrameLen, float *outBuffer, uint32_t &outFrameLen);
 private:
+    ProResampler(uint32_t sampleRate, uint32_t channels, uint32_t quality);
     int32_t Process11025SampleRate(const float *inBuffer, uint32_t inFrameSize, float *outBuffer,
         uint32_t outFrameSize);
     int32_t ProcessOtherSampleRate(const float *inBuffer, uint32_t inFrameSize, float *outBuffer,
@@ -61,6 +71,7 @@ private:
     uint32_t quality_;
     uint32_t expectedOutFrameLen_ = 0;
     uint32_t expectedInFrameLen_ = 0;
+    bool isDriftMode_ = false;
     SingleStagePolyphaseResamplerState* state_ = nullptr;
 };
 } // HPAE
@@ -108,6 +108,31 @@ extern "C" {
     int32_t SingleStagePolyphaseResamplerSetRate(SingleStagePolyphaseResamplerState* state,
         uint32_t decimateFactor, uint32_t interpolateFactor);
 
+    /**
+     * @brief Fine tune the sampling rate ratio without rebuilding the filter or clearing its memory.
+     * Only for the non-integral method whose polyphase table is already capped, so the table does not depend
+     * on the exact ratio. Factors are not reduced, keep interpolateFactor fixed for the best phase continuity.
+     *
+     * @param state Resampler state
+     * @param decimateFactor Integer decimation factor.
+     * @param interpolateFactor Integer interpolation factor.
+     * @return int32_t returns 0 if the function terminates normally.
+     */
+    int32_t SingleStagePolyphaseResamplerSetFineRate(SingleStagePolyphaseResamplerState* state,
+        uint32_t decimateFactor, uint32_t interpolateFactor);
+
+    /**
+     * @brief Shrink the capped polyphase table of the non-integral method to at most maxPolyphaseFactor phases.
+     * Fewer phases trade phase resolution for a much smaller table.
+     * The filter memory is kept, a state that does not use the capped table is left unchanged.
+     *
+     * @param state Resampler state
+     * @param maxPolyphaseFactor Maximum number of polyphase subfilters, more than 1.
+     * @return int32_t returns 0 if the function terminates normally.
+     */
+    int32_t SingleStagePolyphaseResamplerLimitPolyphase(SingleStagePolyphaseResamplerState* state,
+        uint32_t maxPolyphaseFactor);
+
     /**
      * @brief
      *
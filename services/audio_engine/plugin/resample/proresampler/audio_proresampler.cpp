@@ -16,6 +16,8 @@
 #define LOG_TAG "AudioProResampler"
 #endif
 #include "audio_proresampler.h"
+#include <algorithm>
+#include <cmath>
 #include "audio_stream_info.h"
 #include "securec.h"
 #include "audio_engine_log.h"
@@ -35,6 +37,13 @@ constexpr uint32_t MAX_SAMPLE_RATE = SAMPLE_RATE_384000;
 constexpr uint32_t MIN_SAMPLE_RATE = SAMPLE_RATE_8000;
 constexpr uint32_t MAX_FRAME_LEN = SAMPLE_RATE_384000 * 10; // max frame size, max sample rate, 10s duration
 constexpr uint32_t MAX_QUALITY = 10;
+// fixed interpolation factor in drift mode, gives a ratio resolution of about 0.5ppm
+constexpr uint32_t DRIFT_RATIO_SCALE = 1U << 21;
+constexpr double MAX_DRIFT_PPM = 1000.0;
+// the capped table holds about 1.25 MB at quality 1, 1024 phases keep the phase error within 0.1% of a
+// sample
+constexpr uint32_t DRIFT_POLYPHASE_FACTOR = 1024;
+constexpr double PPM_PER_UNIT = 1000000.0;
 // for now ProResampler accept input 20ms for other sample rates, 40ms input for 11025hz
 // 100ms input for 10Hz resolution rates that are not multiples of 50, eg. 8010, 8020, 8030, 8040...
 // however 8050, 8100, 8150... are for 20ms
@@ -69,6 +78,62 @@ ProResampler::ProResampler(uint32_t inRate, uint32_t outRate, uint32_t channels,
         "quality: %{public}d.", inRate_, outRate_, channels_, quality_);
 }
 
+ProResampler::ProResampler(uint32_t sampleRate, uint32_t channels, uint32_t quality)
+    : inRate_(sampleRate), outRate_(sampleRate), channels_(channels), quality_(quality),
+    expectedOutFrameLen_(outRate_ * FRAME_LEN_20MS / MS_PER_SECOND), isDriftMode_(true)
+{
+    CHECK_AND_RETURN_LOG((channels_ > 0) && (channels_ <= MAX_CHANNELS) && (quality_ <= MAX_QUALITY),
+        "invalid channel number %{public}u or quality %{public}u", channels_, quality_);
+    expectedInFrameLen_ = expectedOutFrameLen_;
+    // start slightly off 1:1 so the state is built for the non-integral method, then go to the exact ratio
+    int32_t errRet = RESAMPLER_ERR_SUCCESS;
+    state_ = SingleStagePolyphaseResamplerInit(channels_, DRIFT_RATIO_SCALE, DRIFT_RATIO_SCALE + 1, quality_,
+        &errRet);
+    CHECK_AND_RETURN_LOG(state_, "Init failed! failed with error %{public}s.", ErrCodeToString(errRet).c_str());
+    errRet = SingleStagePolyphaseResamplerLimitPolyphase(state_, DRIFT_POLYPHASE_FACTOR);
+    if (errRet != RESAMPLER_ERR_SUCCESS) {
+        AUDIO_ERR_LOG("limit polyphase failed with error %{public}s", ErrCodeToString(errRet).c_str());
+        SingleStagePolyphaseResamplerFree(state_);
+        state_ = nullptr;
+        return;
+    }
+    SingleStagePolyphaseResamplerSkipHalfTaps(state_);
+    UpdateDriftPpm(0.0);
+    AUDIO_INFO_LOG("Drift resampler init, rate: %{public}u, channels: %{public}u", sampleRate, channels_);
+}
+
+std::unique_ptr<ProResampler> ProResampler::CreateDriftResampler(uint32_t sampleRate, uint32_t channels,
+    uint32_t quality)
+{
+    std::unique_ptr<ProResampler> resampler(new ProResampler(sampleRate, channels, quality));
+    CHECK_AND_RETURN_RET_LOG(resampler->state_ != nullptr, nullptr, "create drift resampler failed");
+    return resampler;
+}
+
+int32_t ProResampler::UpdateDriftPpm(double ppm)
+{
+    CHECK_AND_RETURN_RET_LOG(isDriftMode_ && state_ != nullptr, RESAMPLER_ERR_INVALID_ARG, "not in drift mode");
+    ppm = std::clamp(ppm, -MAX_DRIFT_PPM, MAX_DRIFT_PPM);
+    // more input frames per output frame when ppm is positive
+    uint32_t decimateFactor = static_cast<uint32_t>(std::lround(DRIFT_RATIO_SCALE * (1.0 + ppm / PPM_PER_UNIT)));
+    return SingleStagePolyphaseResamplerSetFineRate(state_, decimateFactor, DRIFT_RATIO_SCALE);
+}
+
+int32_t ProResampler::ProcessDrift(const float *inBuffer, uint32_t &inFrameLen, float *outBuffer,
+    uint32_t &outFrameLen)
+{
+    CHECK_AND_RETURN_RET_LOG(isDriftMode_ && state_ != nullptr, RESAMPLER_ERR_INVALID_ARG, "not in drift mode");
+    CHECK_AND_RETURN_RET_LOG(inBuffer != nullptr && outBuffer != nullptr, RESAMPLER_ERR_INVALID_ARG,
+        "buffer ptr is nullptr");
+    CHECK_AND_RETURN_RET_LOG((inFrameLen <= MAX_FRAME_LEN) && (outFrameLen <= MAX_FRAME_LEN),
+        RESAMPLER_ERR_INVALID_ARG, "inFrameLen %{public}u or outFrameLen %{public}u out of valid range",
+        inFrameLen, outFrameLen);
+    int32_t ret = SingleStagePolyphaseResamplerProcess(state_, inBuffer, &inFrameLen, outBuffer, &outFrameLen);
+    CHECK_AND_RETURN_RET_LOG(ret == RESAMPLER_ERR_SUCCESS, ret, "process failed with error %{public}s",
+        ErrCodeToString(ret).c_str());
+    return ret;
+}
+
 int32_t ProResampler::Process(const float *inBuffer, uint32_t inFrameLen, float *outBuffer,
     uint32_t outFrameLen)
 {
@@ -223,6 +288,7 @@ int32_t ProResampler::Process10HzSampleRate(const float *inBuffer, uint32_t inFr
 
 int32_t ProResampler::UpdateRates(uint32_t inRate, uint32_t outRate)
 {
+    CHECK_AND_RETURN_RET_LOG(!isDriftMode_, RESAMPLER_ERR_INVALID_ARG, "rates are fixed in drift mode");
     AUDIO_INFO_LOG("ProResampler inRate update: %{public}d -> %{public}d, outRate update: %{public}d -> %{public}d",
         inRate_, inRate, outRate_, outRate);
     inRate_ = inRate;
@@ -255,6 +321,7 @@ int32_t ProResampler::UpdateRates(uint32_t inRate, uint32_t outRate)
 
 int32_t ProResampler::UpdateChannels(uint32_t channels)
 {
+    CHECK_AND_RETURN_RET_LOG(!isDriftMode_, RESAMPLER_ERR_INVALID_ARG, "channels are fixed in drift mode");
     // if update channel, the only way to update SingleStagePolyphaseResampler is to create a new one
     AUDIO_INFO_LOG("update work channel %{public}d -> %{public}d", channels_, channels);
     channels_ = channels;
@@ -281,7 +348,7 @@ int32_t ProResampler::UpdateChannels(uint32_t channels)
 ProResampler::ProResampler(ProResampler &&other) noexcept
     : inRate_(other.inRate_), outRate_(other.outRate_), channels_(other.channels_),
     quality_(other.quality_), expectedOutFrameLen_(other.expectedOutFrameLen_),
-    expectedInFrameLen_(other.expectedInFrameLen_), state_(other.state_)
+    expectedInFrameLen_(other.expectedInFrameLen_), isDriftMode_(other.isDriftMode_), state_(other.state_)
 {
     other.state_ = nullptr;
 }
@@ -297,6 +364,7 @@ ProResampler &ProResampler::operator=(ProResampler &&other) noexcept
         state_ = other.state_;
         expectedOutFrameLen_ = other.expectedOutFrameLen_;
         expectedInFrameLen_ = other.expectedInFrameLen_;
+        isDriftMode_ = other.isDriftMode_;
         other.state_ = nullptr;
     }
     return *this;
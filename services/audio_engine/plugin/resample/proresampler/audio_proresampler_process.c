@@ -55,6 +55,7 @@
 #define FOUR_STEPS 4
 #define QUALITY_LEVEL_TEN 10
 #define BUFFER_SIZE 256
+#define MAX_FINE_RATE_FACTOR (1U << 22) // keeps interpolateFactor * BUFFER_SIZE within uint32_t
 
 // WARNING: Code for support to sudden changes in sampling frequency is deprecated!
 // It is disabled because it is complex and untested.
@@ -1585,6 +1586,49 @@ int32_t SingleStagePolyphaseResamplerSetRate(SingleStagePolyphaseResamplerState*
     return RESAMPLER_ERR_SUCCESS;
 }
 
+int32_t SingleStagePolyphaseResamplerSetFineRate(SingleStagePolyphaseResamplerState* state, uint32_t decimateFactor,
+    uint32_t interpolateFactor)
+{
+    CHECK_AND_RETURN_RET_LOG(state != NULL && state->isInitialized, RESAMPLER_ERR_INVALID_ARG,
+        "resampler state is not initialized");
+    CHECK_AND_RETURN_RET_LOG(decimateFactor != 0 && decimateFactor <= MAX_FINE_RATE_FACTOR &&
+        interpolateFactor > state->polyphaseFactor && interpolateFactor <= MAX_FINE_RATE_FACTOR,
+        RESAMPLER_ERR_INVALID_ARG, "invalid fine rate %{public}u/%{public}u", decimateFactor, interpolateFactor);
+    CHECK_AND_RETURN_RET_LOG(state->gainCorrection && (state->resamplerFunction == PolyphaseResamplerMono ||
+        state->resamplerFunction == PolyphaseResamplerStereo ||
+        state->resamplerFunction == PolyphaseResamplerMultichannel), RESAMPLER_ERR_INVALID_ARG,
+        "fine rate needs the non-integral method with a capped polyphase table");
+
+    if (state->interpolateFactor != interpolateFactor) {
+        state->subfilterNum = (uint32_t)((uint64_t)state->subfilterNum * interpolateFactor /
+            state->interpolateFactor);
+        if (state->subfilterNum >= interpolateFactor) {
+            state->subfilterNum = interpolateFactor - 1;
+        }
+    }
+    state->decimateFactor = decimateFactor;
+    state->interpolateFactor = interpolateFactor;
+    state->quoSamplerateRatio = decimateFactor / interpolateFactor;
+    state->remSamplerateRatio = decimateFactor % interpolateFactor;
+    return RESAMPLER_ERR_SUCCESS;
+}
+
+int32_t SingleStagePolyphaseResamplerLimitPolyphase(SingleStagePolyphaseResamplerState* state,
+    uint32_t maxPolyphaseFactor)
+{
+    CHECK_AND_RETURN_RET_LOG(state != NULL && state->isInitialized && maxPolyphaseFactor > 1,
+        RESAMPLER_ERR_INVALID_ARG, "invalid polyphase limit %{public}u", maxPolyphaseFactor);
+    if (!state->gainCorrection || state->polyphaseFactor <= maxPolyphaseFactor) {
+        return RESAMPLER_ERR_SUCCESS;
+    }
+    state->polyphaseFactor = maxPolyphaseFactor;
+    // CalculateFilter only ever grows the table, release it so the smaller one is allocated to size
+    free(state->filterCoefficients);
+    state->filterCoefficients = NULL;
+    state->filterCoefficientsSize = 0;
+    return CalculateFilter(state);
+}
+
 int32_t SingleStagePolyphaseResamplerSkipHalfTaps(SingleStagePolyphaseResamplerState* state)
 {
     state->inputIndex = state->filterLength / TWO_STEPS;
@@ -0,0 +1,455 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "audio_errors.h"
+#include "audio_info.h"
+#include "audio_proresampler.h"
+#include "channel_converter.h"
+#include "down_mixer.h"
+#include "audio_limiter.h"
+#include "volume_tools.h"
+#include "format_converter.h"
+#include "audio_common_converter.h"
+#include "audio_channel_blend.h"
+#include "hpae_format_convert.h"
+#include "simd_utils.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::AudioStandard;
+using namespace OHOS::AudioStandard::HPAE;
+
+namespace {
+constexpr uint32_t RESAMPLE_QUALITY = 1;
+constexpr uint32_t FRAME_LEN_MS = 20;
+constexpr uint32_t MS_PER_SECOND = 1000;
+constexpr int32_t VOLUME_MAX = 65536;
+constexpr int32_t VOLUME_HALF = 32768;
+constexpr float TEST_AMPLITUDE = 0.5f;
+constexpr float TEST_PHASE_STEP = 0.01f;
+constexpr int32_t BYTES_S24 = 3;
+const std::string RESULT_FILE_ARG = "--benchmark_out=/data/audio_dsp_benchmark.json";
+const std::string RESULT_FORMAT_ARG = "--benchmark_out_format=json";
+
+const std::vector<int64_t> FRAME_SIZES = {240, 480, 960, 1920};
+const std::vector<int64_t> CHANNEL_COUNTS = {MONO, STEREO, CHANNEL_6, CHANNEL_8};
+const std::vector<int64_t> SAMPLE_FORMATS = {SAMPLE_S16LE, SAMPLE_S24LE, SAMPLE_S32LE, SAMPLE_F32LE};
+
+size_t GetFormatSize(int64_t format)
+{
+    switch (format) {
+        case SAMPLE_U8:
+            return sizeof(uint8_t);
+        case SAMPLE_S16LE:
+            return sizeof(int16_t);
+        case SAMPLE_S24LE:
+            return BYTES_S24;
+        default:
+            return sizeof(int32_t);
+    }
+}
+
+AudioChannelLayout GetDefaultLayout(uint32_t channels)
+{
+    switch (channels) {
+        case MONO:
+            return CH_LAYOUT_MONO;
+        case STEREO:
+            return CH_LAYOUT_STEREO;
+        case CHANNEL_6:
+            return CH_LAYOUT_5POINT1;
+        case CHANNEL_8:
+            return CH_LAYOUT_7POINT1;
+        case CHANNEL_12:
+            return CH_LAYOUT_7POINT1POINT4;
+        default:
+            return CH_LAYOUT_UNKNOWN;
+    }
+}
+
+void FillSine(std::vector<float> &data)
+{
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = TEST_AMPLITUDE * std::sin(TEST_PHASE_STEP * i);
+    }
+}
+
+void FillPcm(std::vector<uint8_t> &data, int64_t format)
+{
+    std::vector<float> sine(data.size() / GetFormatSize(format));
+    FillSine(sine);
+    ConvertFromFloat(static_cast<AudioSampleFormat>(format), sine.size(), sine.data(), data.data());
+}
+
+void SetThroughput(benchmark::State &state, size_t samplesPerIteration, size_t bytesPerIteration)
+{
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * samplesPerIteration));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytesPerIteration));
+}
+
+// args: format, channels, frames
+void FormatChannelFrameArgs(benchmark::internal::Benchmark *bench)
+{
+    for (int64_t format : SAMPLE_FORMATS) {
+        for (int64_t channels : CHANNEL_COUNTS) {
+            for (int64_t frames : FRAME_SIZES) {
+                bench->Args({format, channels, frames});
+            }
+        }
+    }
+}
+
+// args: channels, frames
+void ChannelFrameArgs(benchmark::internal::Benchmark *bench)
+{
+    for (int64_t channels : CHANNEL_COUNTS) {
+        for (int64_t frames : FRAME_SIZES) {
+            bench->Args({channels, frames});
+        }
+    }
+}
+
+// args: in rate, out rate, channels
+void ResampleArgs(benchmark::internal::Benchmark *bench)
+{
+    const std::vector<std::pair<int64_t, int64_t>> ratePairs = {
+        {SAMPLE_RATE_44100, SAMPLE_RATE_48000}, {SAMPLE_RATE_16000, SAMPLE_RATE_48000},
+        {SAMPLE_RATE_96000, SAMPLE_RATE_48000}, {SAMPLE_RATE_48000, SAMPLE_RATE_16000},
+    };
+    for (const auto &[inRate, outRate] : ratePairs) {
+        for (int64_t channels : {MONO, STEREO, CHANNEL_6}) {
+            bench->Args({inRate, outRate, channels});
+        }
+    }
+}
+
+// args: in channels, out channels, frames
+void ChannelConvertArgs(benchmark::internal::Benchmark *bench)
+{
+    const std::vector<std::pair<int64_t, int64_t>> channelPairs = {
+        {MONO, STEREO}, {STEREO, MONO}, {CHANNEL_6, STEREO}, {CHANNEL_8, STEREO}, {CHANNEL_12, CHANNEL_6},
+    };
+    for (const auto &[inChannels, outChannels] : channelPairs) {
+        for (int64_t frames : FRAME_SIZES) {
+            bench->Args({inChannels, outChannels, frames});
+        }
+    }
+}
+
+void BM_ProResampler(benchmark::State &state)
+{
+    uint32_t inRate = static_cast<uint32_t>(state.range(0));
+    uint32_t outRate = static_cast<uint32_t>(state.range(1));
+    uint32_t channels = static_cast<uint32_t>(state.range(2));
+    uint32_t inFrames = inRate * FRAME_LEN_MS / MS_PER_SECOND;
+    uint32_t outFrames = outRate * FRAME_LEN_MS / MS_PER_SECOND;
+    ProResampler resampler(inRate, outRate, channels, RESAMPLE_QUALITY);
+    std::vector<float> in(inFrames * channels);
+    std::vector<float> out(outFrames * channels);
+    FillSine(in);
+    for (auto _ : state) {
+        resampler.Process(in.data(), inFrames, out.data(), outFrames);
+        benchmark::DoNotOptimize(out.data());
+    }
+    SetThroughput(state, in.size(), in.size() * sizeof(float));
+}
+BENCHMARK(BM_ProResampler)->Apply(ResampleArgs);
+
+void BM_ChannelConverter(benchmark::State &state)
+{
+    uint32_t inChannels = static_cast<uint32_t>(state.range(0));
+    uint32_t outChannels = static_cast<uint32_t>(state.range(1));
+    uint32_t frames = static_cast<uint32_t>(state.range(2));
+    AudioChannelInfo inChannelInfo = {GetDefaultLayout(inChannels), inChannels};
+    AudioChannelInfo outChannelInfo = {GetDefaultLayout(outChannels), outChannels};
+    ChannelConverter converter;
+    if (converter.SetParam(inChannelInfo, outChannelInfo, SAMPLE_F32LE, true) != SUCCESS) {
+        state.SkipWithError("ChannelConverter SetParam failed.");
+        return;
+    }
+    std::vector<float> in(frames * inChannels);
+    std::vector<float> out(frames * outChannels);
+    FillSine(in);
+    uint32_t inLen = in.size() * sizeof(float);
+    uint32_t outLen = out.size() * sizeof(float);
+    for (auto _ : state) {
+        converter.Process(frames, in.data(), inLen, out.data(), outLen);
+        benchmark::DoNotOptimize(out.data());
+    }
+    SetThroughput(state, in.size(), inLen);
+}
+BENCHMARK(BM_ChannelConverter)->Apply(ChannelConvertArgs);
+
+void BM_DownMixerSetParam(benchmark::State &state)
+{
+    uint32_t inChannels = static_cast<uint32_t>(state.range(0));
+    uint32_t outChannels = static_cast<uint32_t>(state.range(1));
+    AudioChannelInfo inChannelInfo = {GetDefaultLayout(inChannels), inChannels};
+    AudioChannelInfo outChannelInfo = {GetDefaultLayout(outChannels), outChannels};
+    DownMixer downMixer;
+    for (auto _ : state) {
+        downMixer.SetParam(inChannelInfo, outChannelInfo, sizeof(float), true);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_DownMixerSetParam)->Args({CHANNEL_6, STEREO})->Args({CHANNEL_8, STEREO})->Args({CHANNEL_12, CHANNEL_6});
+
+void BM_AudioLimiter(benchmark::State &state)
+{
+    uint32_t channels = static_cast<uint32_t>(state.range(0));
+    uint32_t frames = static_cast<uint32_t>(state.range(1));
+    AudioLimiter limiter(0);
+    int32_t sampleCount = static_cast<int32_t>(frames * channels);
+    if (limiter.SetConfig(sampleCount * sizeof(float), sizeof(float), SAMPLE_RATE_48000, channels) != SUCCESS) {
+        state.SkipWithError("AudioLimiter SetConfig failed.");
+        return;
+    }
+    std::vector<float> in(sampleCount);
+    std::vector<float> out(sampleCount);
+    FillSine(in);
+    for (auto _ : state) {
+        limiter.Process(sampleCount, in.data(), out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    SetThroughput(state, in.size(), in.size() * sizeof(float));
+}
+BENCHMARK(BM_AudioLimiter)->Args({STEREO, 960})->Args({CHANNEL_6, 960})->Args({CHANNEL_8, 960});
+
+void BM_VolumeToolsProcess(benchmark::State &state)
+{
+    AudioSampleFormat format = static_cast<AudioSampleFormat>(state.range(0));
+    AudioChannel channels = static_cast<AudioChannel>(state.range(1));
+    size_t frames = static_cast<size_t>(state.range(2));
+    std::vector<uint8_t> data(frames * channels * GetFormatSize(format));
+    FillPcm(data, format);
+    BufferDesc buffer = {data.data(), data.size(), data.size()};
+    // ramp from full scale to half, the expensive path on volume changes
+    ChannelVolumes vols = VolumeTools::GetChannelVolumes(channels, VOLUME_MAX, VOLUME_HALF);
+    for (auto _ : state) {
+        VolumeTools::Process(buffer, format, vols);
+        benchmark::DoNotOptimize(data.data());
+    }
+    SetThroughput(state, frames * channels, data.size());
+}
+BENCHMARK(BM_VolumeToolsProcess)->Apply(FormatChannelFrameArgs);
+
+void BM_VolumeToolsCountVolumeLevel(benchmark::State &state)
+{
+    AudioSampleFormat format = static_cast<AudioSampleFormat>(state.range(0));
+    AudioChannel channels = static_cast<AudioChannel>(state.range(1));
+    size_t frames = static_cast<size_t>(state.range(2));
+    std::vector<uint8_t> data(frames * channels * GetFormatSize(format));
+    FillPcm(data, format);
+    BufferDesc buffer = {data.data(), data.size(), data.size()};
+    for (auto _ : state) {
+        ChannelVolumes vols = VolumeTools::CountVolumeLevel(buffer, format, channels);
+        benchmark::DoNotOptimize(vols);
+    }
+    SetThroughput(state, frames * channels, data.size());
+}
+BENCHMARK(BM_VolumeToolsCountVolumeLevel)->Apply(FormatChannelFrameArgs);
+
+void BM_FormatConverterS16StereoToF32Stereo(benchmark::State &state)
+{
+    size_t frames = static_cast<size_t>(state.range(0));
+    std::vector<uint8_t> in(frames * STEREO * sizeof(int16_t));
+    std::vector<uint8_t> out(frames * STEREO * sizeof(float));
+    FillPcm(in, SAMPLE_S16LE);
+    BufferDesc srcDesc = {in.data(), in.size(), in.size()};
+    BufferDesc dstDesc = {out.data(), out.size(), out.size()};
+    for (auto _ : state) {
+        FormatConverter::S16StereoToF32Stereo(srcDesc, dstDesc);
+        benchmark::DoNotOptimize(out.data());
+    }
+    SetThroughput(state, frames * STEREO, in.size());
+}
+BENCHMARK(BM_FormatConverterS16StereoToF32Stereo)->Arg(240)->Arg(480)->Arg(960)->Arg(1920);
+
+void BM_FormatConverterF32StereoToS16Stereo(benchmark::State &state)
+{
+    size_t frames = static_cast<size_t>(state.range(0));
+    std::vector<uint8_t> in(frames * STEREO * sizeof(float));
+    std::vector<uint8_t> out(frames * STEREO * sizeof(int16_t));
+    FillPcm(in, SAMPLE_F32LE);
+    BufferDesc srcDesc = {in.data(), in.size(), in.size()};
+    BufferDesc dstDesc = {out.data(), out.size(), out.size()};
+    for (auto _ : state) {
+        FormatConverter::F32StereoToS16Stereo(srcDesc, dstDesc);
+        benchmark::DoNotOptimize(out.data());
+    }
+    SetThroughput(state, frames * STEREO, in.size());
+}
+BENCHMARK(BM_FormatConverterF32StereoToS16Stereo)->Arg(240)->Arg(480)->Arg(960)->Arg(1920);
+
+void BM_FormatConverterS32StereoToS16Stereo(benchmark::State &state)
+{
+    size_t frames = static_cast<size_t>(state.range(0));
+    std::vector<uint8_t> in(frames * STEREO * sizeof(int32_t));
+    std::vector<uint8_t> out(frames * STEREO * sizeof(int16_t));
+    FillPcm(in, SAMPLE_S32LE);
+    BufferDesc srcDesc = {in.data(), in.size(), in.size()};
+    BufferDesc dstDesc = {out.data(), out.size(), out.size()};
+    for (auto _ : state) {
+        FormatConverter::S32StereoToS16Stereo(srcDesc, dstDesc);
+        benchmark::DoNotOptimize(out.data());
+    }
+    SetThroughput(state, frames * STEREO, in.size());
+}
+BENCHMARK(BM_FormatConverterS32StereoToS16Stereo)->Arg(240)->Arg(480)->Arg(960)->Arg(1920);
+
+void BM_AudioCommonConverterToFloat(benchmark::State &state)
+{
+    AudioSampleFormat format = static_cast<AudioSampleFormat>(state.range(0));
+    uint32_t channels = static_cast<uint32_t>(state.range(1));
+    uint32_t frames = static_cast<uint32_t>(state.range(2));
+    if (format == SAMPLE_F32LE) {
+        state.SkipWithError("AudioCommonConverter converts integer formats only.");
+        return;
+    }
+    std::vector<uint8_t> in(frames * channels * GetFormatSize(format));
+    FillPcm(in, format);
+    std::vector<float> out(frames * channels);
+    BufferBaseInfo srcBuffer;
+    srcBuffer.buffer = in.data();
+    srcBuffer.bufLength = in.size();
+    srcBuffer.frameSize = out.size();
+    srcBuffer.samplePerFrame = GetFormatSize(format);
+    srcBuffer.format = format;
+    srcBuffer.channelCount = channels;
+    srcBuffer.volumeBg = 1.0f;
+    srcBuffer.volumeEd = TEST_AMPLITUDE;
+    for (auto _ : state) {
+        AudioCommonConverter::ConvertBufferToFloat(srcBuffer, out);
+        benchmark::DoNotOptimize(out.data());
+    }
+    SetThroughput(state, out.size(), in.size());
+}
+BENCHMARK(BM_AudioCommonConverterToFloat)->Apply(FormatChannelFrameArgs);
+
+void BM_AudioCommonConverterFromFloat(benchmark::State &state)
+{
+    AudioSampleFormat format = static_cast<AudioSampleFormat>(state.range(0));
+    uint32_t channels = static_cast<uint32_t>(state.range(1));
+    uint32_t frames = static_cast<uint32_t>(state.range(2));
+    if (format == SAMPLE_F32LE) {
+        state.SkipWithError("AudioCommonConverter converts integer formats only.");
+        return;
+    }
+    std::vector<float> in(frames * channels);
+    FillSine(in);
+    std::vector<uint8_t> out(frames * channels * GetFormatSize(format));
+    for (auto _ : state) {
+        AudioCommonConverter::ConvertFloatToAudioBuffer(in, out.data(), GetFormatSize(format));
+        benchmark::DoNotOptimize(out.data());
+    }
+    SetThroughput(state, in.size(), out.size());
+}
+BENCHMARK(BM_AudioCommonConverterFromFloat)->Apply(FormatChannelFrameArgs);
+
+void BM_AudioBlend(benchmark::State &state)
+{
+    uint8_t format = static_cast<uint8_t>(state.range(0));
+    uint8_t channels = static_cast<uint8_t>(state.range(1));
+    size_t frames = static_cast<size_t>(state.range(2));
+    std::vector<uint8_t> data(frames * channels * GetFormatSize(format));
+    FillPcm(data, format);
+    AudioBlend blend(MODE_BLEND_LR, format, channels);
+    for (auto _ : state) {
+        blend.Process(data.data(), data.size());
+        benchmark::DoNotOptimize(data.data());
+    }
+    SetThroughput(state, frames * channels, data.size());
+}
+BENCHMARK(BM_AudioBlend)->Apply(FormatChannelFrameArgs);
+
+void BM_HpaeConvertToFloat(benchmark::State &state)
+{
+    AudioSampleFormat format = static_cast<AudioSampleFormat>(state.range(0));
+    uint32_t channels = static_cast<uint32_t>(state.range(1));
+    uint32_t frames = static_cast<uint32_t>(state.range(2));
+    std::vector<uint8_t> in(frames * channels * GetFormatSize(format));
+    FillPcm(in, format);
+    std::vector<float> out(frames * channels);
+    for (auto _ : state) {
+        ConvertToFloat(format, out.size(), in.data(), out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    SetThroughput(state, out.size(), in.size());
+}
+BENCHMARK(BM_HpaeConvertToFloat)->Apply(FormatChannelFrameArgs);
+
+void BM_HpaeConvertFromFloat(benchmark::State &state)
+{
+    AudioSampleFormat format = static_cast<AudioSampleFormat>(state.range(0));
+    uint32_t channels = static_cast<uint32_t>(state.range(1));
+    uint32_t frames = static_cast<uint32_t>(state.range(2));
+    std::vector<float> in(frames * channels);
+    FillSine(in);
+    std::vector<uint8_t> out(frames * channels * GetFormatSize(format));
+    for (auto _ : state) {
+        ConvertFromFloat(format, in.size(), in.data(), out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    SetThroughput(state, in.size(), out.size());
+}
+BENCHMARK(BM_HpaeConvertFromFloat)->Apply(FormatChannelFrameArgs);
+
+template <void (*SimdFunc)(size_t, const float *, const float *, float *)>
+void BM_SimdPointByPoint(benchmark::State &state)
+{
+    size_t length = static_cast<size_t>(state.range(0) * state.range(1));
+    std::vector<float> left(length);
+    std::vector<float> right(length);
+    std::vector<float> out(length);
+    FillSine(left);
+    FillSine(right);
+    for (auto _ : state) {
+        SimdFunc(length, left.data(), right.data(), out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    SetThroughput(state, length, length * sizeof(float));
+}
+BENCHMARK_TEMPLATE(BM_SimdPointByPoint, SimdPointByPointAdd)->Apply(ChannelFrameArgs);
+BENCHMARK_TEMPLATE(BM_SimdPointByPoint, SimdPointByPointSub)->Apply(ChannelFrameArgs);
+BENCHMARK_TEMPLATE(BM_SimdPointByPoint, SimdPointByPointMul)->Apply(ChannelFrameArgs);
+} // namespace
+
+// Run the benchmark, writing json results unless the caller already chose an output file
+int main(int argc, char **argv)
+{
+    std::vector<char *> args(argv, argv + argc);
+    bool hasOut = false;
+    for (int i = 1; i < argc; i++) {
+        hasOut = hasOut || (strncmp(argv[i], "--benchmark_out=", strlen("--benchmark_out=")) == 0);
+    }
+    std::string outArg = RESULT_FILE_ARG;
+    std::string formatArg = RESULT_FORMAT_ARG;
+    if (!hasOut) {
+        args.push_back(outArg.data());
+        args.push_back(formatArg.data());
+    }
+    int newArgc = static_cast<int>(args.size());
+    benchmark::Initialize(&newArgc, args.data());
+    if (benchmark::ReportUnrecognizedArguments(newArgc, args.data())) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
@@ -0,0 +1,646 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <ctime>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+#include "audio_errors.h"
+#include "test_case_common.h"
+#include "hpae_sink_input_node.h"
+#include "hpae_process_cluster.h"
+#include "hpae_output_cluster.h"
+#include "hpae_audio_format_converter_node.h"
+#include "hpae_mixer_node.h"
+#include "hpae_sink_output_node.h"
+#include "hpae_source_input_cluster.h"
+#include "hpae_source_output_node.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::AudioStandard;
+using namespace OHOS::AudioStandard::HPAE;
+
+// Counts every operator new of this benchmark binary, on all threads, so scene workers are included. The graph is
+// expected to be allocation free in steady state, any allocs_per_period above zero is a regression.
+namespace {
+std::atomic<uint64_t> g_allocCount = 0;
+
+void *CountedAlloc(size_t size)
+{
+    g_allocCount.fetch_add(1, std::memory_order_relaxed);
+    return malloc(size == 0 ? 1 : size);
+}
+}
+
+void *operator new(size_t size)
+{
+    void *ptr = CountedAlloc(size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept
+{
+    return CountedAlloc(size);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept
+{
+    return CountedAlloc(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept
+{
+    free(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept
+{
+    free(ptr);
+}
+
+namespace {
+const std::string DEVICE_CLASS = "file_io";
+const std::string DEVICE_NETWORK_ID = "LocalDevice";
+const std::string RENDER_FILE_PATH = "/data/benchmark_hpae_engine_render.pcm";
+const std::string CAPTURE_FILE_PATH = "/data/source_file_io_48000_2_s16le.pcm";
+constexpr uint32_t FRAME_LEN_MS = 20;
+constexpr uint32_t MS_PER_SECOND = 1000;
+constexpr uint64_t NS_PER_SECOND = 1000000000;
+constexpr uint64_t NS_PER_US = 1000;
+constexpr uint32_t SESSION_ID_BASE = 100000;
+constexpr int32_t TEST_SAMPLE_VALUE = 1000;
+constexpr int32_t PERCENT_50 = 50;
+constexpr int32_t PERCENT_95 = 95;
+constexpr int32_t PERCENT_99 = 99;
+constexpr int32_t PERCENT_100 = 100;
+constexpr int32_t ITERATIONS = 500;
+const std::vector<AudioSamplingRate> MIXED_RATES = {
+    SAMPLE_RATE_48000, SAMPLE_RATE_44100, SAMPLE_RATE_16000, SAMPLE_RATE_96000
+};
+const std::vector<HpaeProcessorType> SCENE_TYPES = {
+    HPAE_SCENE_MUSIC, HPAE_SCENE_GAME, HPAE_SCENE_MOVIE, HPAE_SCENE_SPEECH, HPAE_SCENE_RING, HPAE_SCENE_VOIP_DOWN
+};
+constexpr int32_t STREAMS_PER_SCENE = 2;
+
+enum RateMix : int64_t {
+    RATE_MIX_UNIFORM = 0,
+    RATE_MIX_MIXED,
+};
+
+enum LayoutType : int64_t {
+    LAYOUT_STEREO = 0,
+    LAYOUT_5POINT1,
+};
+
+uint64_t GetClockNs(clockid_t clockId)
+{
+    struct timespec ts = {};
+    clock_gettime(clockId, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * NS_PER_SECOND + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+void ApplyLayout(HpaeNodeInfo &nodeInfo, int64_t layout)
+{
+    if (layout == LAYOUT_5POINT1) {
+        nodeInfo.channels = CHANNEL_6;
+        nodeInfo.channelLayout = CH_LAYOUT_5POINT1;
+    } else {
+        nodeInfo.channels = STEREO;
+        nodeInfo.channelLayout = CH_LAYOUT_STEREO;
+    }
+}
+
+class NullReadDataCb : public ICapturerStreamCallback, public std::enable_shared_from_this<NullReadDataCb> {
+public:
+    int32_t OnStreamData(AudioCallBackCapturerStreamInfo &callBackStreamInfo) override
+    {
+        benchmark::DoNotOptimize(callBackStreamInfo.outputData);
+        return SUCCESS;
+    }
+};
+
+// Collects per period measurements and publishes them as benchmark counters.
+class PeriodStats {
+public:
+    void Reset(uint64_t periodNs, size_t capacity)
+    {
+        periodNs_ = periodNs;
+        cpuNs_.clear();
+        cpuNs_.reserve(capacity);
+        wallNs_.clear();
+        wallNs_.reserve(capacity);
+        deadlineMiss_ = 0;
+        allocs_ = 0;
+    }
+
+    void Begin()
+    {
+        allocStart_ = g_allocCount.load(std::memory_order_relaxed);
+        wallStart_ = GetClockNs(CLOCK_MONOTONIC);
+        cpuStart_ = GetClockNs(CLOCK_THREAD_CPUTIME_ID);
+    }
+
+    void End()
+    {
+        uint64_t cpuNs = GetClockNs(CLOCK_THREAD_CPUTIME_ID) - cpuStart_;
+        uint64_t wallNs = GetClockNs(CLOCK_MONOTONIC) - wallStart_;
+        allocs_ += g_allocCount.load(std::memory_order_relaxed) - allocStart_;
+        if (wallNs > periodNs_) {
+            deadlineMiss_++;
+        }
+        cpuNs_.push_back(cpuNs);
+        wallNs_.push_back(wallNs);
+    }
+
+    void Report(benchmark::State &state)
+    {
+        if (cpuNs_.empty()) {
+            return;
+        }
+        std::sort(cpuNs_.begin(), cpuNs_.end());
+        std::sort(wallNs_.begin(), wallNs_.end());
+        state.counters["cpu_p50_us"] = Percentile(cpuNs_, PERCENT_50);
+        state.counters["cpu_p95_us"] = Percentile(cpuNs_, PERCENT_95);
+        state.counters["cpu_p99_us"] = Percentile(cpuNs_, PERCENT_99);
+        state.counters["cpu_max_us"] = Percentile(cpuNs_, PERCENT_100);
+        // with scene workers part of the period runs on other threads, only wall time shows the whole period
+        state.counters["wall_p50_us"] = Percentile(wallNs_, PERCENT_50);
+        state.counters["wall_p99_us"] = Percentile(wallNs_, PERCENT_99);
+        state.counters["deadline_miss"] = deadlineMiss_;
+        state.counters["allocs_per_period"] = static_cast<double>(allocs_) / cpuNs_.size();
+    }
+
+private:
+    static double Percentile(const std::vector<uint64_t> &sortedNs, int32_t percent)
+    {
+        size_t index = (sortedNs.size() - 1) * percent / PERCENT_100;
+        return static_cast<double>(sortedNs[index]) / NS_PER_US;
+    }
+
+    std::vector<uint64_t> cpuNs_;
+    std::vector<uint64_t> wallNs_;
+    uint64_t periodNs_ = 0;
+    uint64_t wallStart_ = 0;
+    uint64_t cpuStart_ = 0;
+    uint64_t deadlineMiss_ = 0;
+    uint64_t allocStart_ = 0;
+    uint64_t allocs_ = 0;
+};
+
+// Builds the node graph HpaeRendererManager builds (sink inputs -> scene process cluster -> output stage) against
+// the file_io sink, and drives it one period per iteration without the manager thread, so the measurement only
+// contains graph processing. The output stage is wired the way HpaeOutputCluster wires it (scene converter ->
+// mixer -> sink output), which lets the limiter-off case run the same graph with the limiter left out. Streams
+// use the no effect scene, an effect scene adds no processing without an effect library loaded.
+class BenchmarkHpaeRendererTest : public benchmark::Fixture {
+public:
+    BenchmarkHpaeRendererTest()
+    {
+        Iterations(ITERATIONS);
+    }
+
+    ~BenchmarkHpaeRendererTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        int64_t streamNum = state.range(0);
+        int64_t rateMix = state.range(1);
+        int64_t layout = state.range(2);
+        bool limiterOn = state.range(3) != 0;
+
+        HpaeNodeInfo sinkNodeInfo;
+        sinkNodeInfo.nodeId = 0;
+        sinkNodeInfo.samplingRate = SAMPLE_RATE_48000;
+        sinkNodeInfo.frameLen = SAMPLE_RATE_48000 * FRAME_LEN_MS / MS_PER_SECOND;
+        sinkNodeInfo.format = SAMPLE_F32LE;
+        sinkNodeInfo.channels = STEREO;
+        sinkNodeInfo.channelLayout = CH_LAYOUT_STEREO;
+        sinkNodeInfo.sceneType = HPAE_SCENE_EFFECT_OUT;
+        sinkNodeInfo.deviceClass = DEVICE_CLASS;
+        sinkNodeInfo.deviceNetId = DEVICE_NETWORK_ID;
+
+        sinkInfo_.deviceClass = DEVICE_CLASS;
+        sinkInfo_.deviceNetId = DEVICE_NETWORK_ID;
+        sinkInfo_.samplingRate = sinkNodeInfo.samplingRate;
+        sinkInfo_.frameLen = sinkNodeInfo.frameLen;
+        sinkInfo_.format = sinkNodeInfo.format;
+        sinkInfo_.channels = sinkNodeInfo.channels;
+        sinkInfo_.filePath = RENDER_FILE_PATH;
+
+        sinkOutputNode_ = std::make_shared<HpaeSinkOutputNode>(sinkNodeInfo);
+        mixerNode_ = std::make_shared<HpaeMixerNode>(sinkNodeInfo);
+        if (limiterOn) {
+            mixerNode_->SetupAudioLimiter();
+        }
+        sinkOutputNode_->Connect(mixerNode_);
+        sinkOutputNode_->GetRenderSinkInstance(DEVICE_CLASS, DEVICE_NETWORK_ID);
+        IAudioSinkAttr attr;
+        attr.adapterName = DEVICE_CLASS;
+        attr.sampleRate = sinkInfo_.samplingRate;
+        attr.channel = sinkInfo_.channels;
+        attr.format = sinkInfo_.format;
+        attr.filePath = RENDER_FILE_PATH;
+        attr.deviceNetworkId = DEVICE_NETWORK_ID;
+        initRet_ = sinkOutputNode_->RenderSinkInit(attr);
+        sinkOutputNode_->RenderSinkStart();
+
+        for (int64_t i = 0; i < streamNum; i++) {
+            HpaeNodeInfo nodeInfo;
+            nodeInfo.nodeId = static_cast<uint32_t>(i + 1);
+            nodeInfo.sessionId = SESSION_ID_BASE + static_cast<uint32_t>(i);
+            nodeInfo.samplingRate = rateMix == RATE_MIX_MIXED ? MIXED_RATES[i % MIXED_RATES.size()] : SAMPLE_RATE_48000;
+            nodeInfo.frameLen = nodeInfo.samplingRate * FRAME_LEN_MS / MS_PER_SECOND;
+            nodeInfo.format = SAMPLE_S16LE;
+            nodeInfo.streamType = STREAM_MUSIC;
+            nodeInfo.sceneType = HPAE_SCENE_EFFECT_NONE;
+            nodeInfo.deviceClass = DEVICE_CLASS;
+            nodeInfo.deviceNetId = DEVICE_NETWORK_ID;
+            ApplyLayout(nodeInfo, layout);
+            AddStream(nodeInfo);
+        }
+        stats_.Reset(static_cast<uint64_t>(FRAME_LEN_MS) * NS_PER_SECOND / MS_PER_SECOND, ITERATIONS);
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        for (auto &sinkInputNode : sinkInputNodes_) {
+            processCluster_->DisConnect(sinkInputNode);
+        }
+        if (processCluster_ != nullptr) {
+            sceneConverterNode_->DisConnect(processCluster_);
+            mixerNode_->DisConnect(sceneConverterNode_);
+        }
+        sinkOutputNode_->DisConnect(mixerNode_);
+        sinkOutputNode_->RenderSinkStop();
+        sinkOutputNode_->RenderSinkDeInit();
+        sinkInputNodes_.clear();
+        writeCallbacks_.clear();
+        processCluster_.reset();
+        sceneConverterNode_.reset();
+        mixerNode_.reset();
+        sinkOutputNode_.reset();
+    }
+
+protected:
+    void AddStream(HpaeNodeInfo &nodeInfo)
+    {
+        auto sinkInputNode = std::make_shared<HpaeSinkInputNode>(nodeInfo);
+        auto writeCallback = std::make_shared<WriteFixedValueCb>(nodeInfo.format, TEST_SAMPLE_VALUE);
+        sinkInputNode->RegisterWriteCallback(writeCallback);
+        sinkInputNode->SetState(HPAE_SESSION_RUNNING);
+        if (processCluster_ == nullptr) {
+            processCluster_ = std::make_shared<HpaeProcessCluster>(nodeInfo, sinkInfo_);
+            ConnectProcessCluster();
+        }
+        processCluster_->CreateNodes(sinkInputNode);
+        processCluster_->Connect(sinkInputNode);
+        sinkInputNodes_.push_back(sinkInputNode);
+        writeCallbacks_.push_back(writeCallback);
+    }
+
+    // same as HpaeOutputCluster::Connect
+    void ConnectProcessCluster()
+    {
+        HpaeNodeInfo &preNodeInfo = processCluster_->GetSharedInstance()->GetNodeInfo();
+        sceneConverterNode_ = std::make_shared<HpaeAudioFormatConverterNode>(preNodeInfo, mixerNode_->GetNodeInfo());
+        sceneConverterNode_->SetDownmixNormalization(false);
+        mixerNode_->Connect(sceneConverterNode_);
+        sceneConverterNode_->Connect(processCluster_);
+    }
+
+    HpaeSinkInfo sinkInfo_;
+    std::shared_ptr<HpaeSinkOutputNode> sinkOutputNode_ = nullptr;
+    std::shared_ptr<HpaeMixerNode> mixerNode_ = nullptr;
+    std::shared_ptr<HpaeAudioFormatConverterNode> sceneConverterNode_ = nullptr;
+    std::shared_ptr<HpaeProcessCluster> processCluster_ = nullptr;
+    std::vector<std::shared_ptr<HpaeSinkInputNode>> sinkInputNodes_;
+    std::vector<std::shared_ptr<WriteFixedValueCb>> writeCallbacks_;
+    PeriodStats stats_;
+    int32_t initRet_ = ERROR;
+};
+
+// Builds the HpaeCapturerManager graph without effects (file_io source -> source input cluster ->
+// source output nodes) and drives one capture period per iteration.
+class BenchmarkHpaeCapturerTest : public benchmark::Fixture {
+public:
+    BenchmarkHpaeCapturerTest()
+    {
+        Iterations(ITERATIONS);
+    }
+
+    ~BenchmarkHpaeCapturerTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        int64_t streamNum = state.range(0);
+        int64_t rateMix = state.range(1);
+        int64_t layout = state.range(2);
+
+        HpaeNodeInfo sourceNodeInfo;
+        sourceNodeInfo.nodeId = 0;
+        sourceNodeInfo.samplingRate = SAMPLE_RATE_48000;
+        sourceNodeInfo.frameLen = SAMPLE_RATE_48000 * FRAME_LEN_MS / MS_PER_SECOND;
+        sourceNodeInfo.format = SAMPLE_S16LE;
+        sourceNodeInfo.channels = STEREO;
+        sourceNodeInfo.channelLayout = CH_LAYOUT_STEREO;
+        sourceNodeInfo.sourceType = SOURCE_TYPE_MIC;
+        sourceNodeInfo.deviceClass = DEVICE_CLASS;
+        sourceNodeInfo.deviceNetId = DEVICE_NETWORK_ID;
+        sourceNodeInfo.sourceBufferType = HPAE_SOURCE_BUFFER_TYPE_MIC;
+        sourceInputCluster_ = std::make_shared<HpaeSourceInputCluster>(sourceNodeInfo);
+        sourceInputCluster_->GetCapturerSourceInstance(DEVICE_CLASS, DEVICE_NETWORK_ID, SOURCE_TYPE_MIC, "mic");
+        IAudioSourceAttr attr;
+        attr.sampleRate = sourceNodeInfo.samplingRate;
+        attr.channel = sourceNodeInfo.channels;
+        attr.format = sourceNodeInfo.format;
+        attr.filePath = CAPTURE_FILE_PATH;
+        attr.deviceNetworkId = DEVICE_NETWORK_ID;
+        sourceInputCluster_->CapturerSourceInit(attr);
+        sourceInputCluster_->CapturerSourceStart();
+
+        for (int64_t i = 0; i < streamNum; i++) {
+            HpaeNodeInfo nodeInfo;
+            nodeInfo.nodeId = static_cast<uint32_t>(i + 1);
+            nodeInfo.sessionId = SESSION_ID_BASE + static_cast<uint32_t>(i);
+            nodeInfo.samplingRate = rateMix == RATE_MIX_MIXED ? MIXED_RATES[i % MIXED_RATES.size()] : SAMPLE_RATE_48000;
+            nodeInfo.frameLen = nodeInfo.samplingRate * FRAME_LEN_MS / MS_PER_SECOND;
+            nodeInfo.format = SAMPLE_S16LE;
+            nodeInfo.sourceType = SOURCE_TYPE_MIC;
+            nodeInfo.sceneType = HPAE_SCENE_EFFECT_NONE;
+            nodeInfo.deviceClass = DEVICE_CLASS;
+            nodeInfo.deviceNetId = DEVICE_NETWORK_ID;
+            nodeInfo.sourceBufferType = HPAE_SOURCE_BUFFER_TYPE_MIC;
+            ApplyLayout(nodeInfo, layout);
+            auto sourceOutputNode = std::make_shared<HpaeSourceOutputNode>(nodeInfo);
+            sourceOutputNode->RegisterReadCallback(readCallback_);
+            sourceOutputNode->SetState(HPAE_SESSION_RUNNING);
+            sourceOutputNode->ConnectWithInfo(sourceInputCluster_, nodeInfo);
+            sourceOutputNodes_.push_back(sourceOutputNode);
+        }
+        stats_.Reset(static_cast<uint64_t>(FRAME_LEN_MS) * NS_PER_SECOND / MS_PER_SECOND, ITERATIONS);
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        for (auto &sourceOutputNode : sourceOutputNodes_) {
+            HpaeNodeInfo nodeInfo = sourceOutputNode->GetNodeInfo();
+            sourceOutputNode->DisConnectWithInfo(sourceInputCluster_, nodeInfo);
+        }
+        sourceOutputNodes_.clear();
+        sourceInputCluster_->CapturerSourceStop();
+        sourceInputCluster_->CapturerSourceDeInit();
+        sourceInputCluster_.reset();
+    }
+
+protected:
+    std::shared_ptr<HpaeSourceInputCluster> sourceInputCluster_ = nullptr;
+    std::vector<std::shared_ptr<HpaeSourceOutputNode>> sourceOutputNodes_;
+    std::shared_ptr<NullReadDataCb> readCallback_ = std::make_shared<NullReadDataCb>();
+    PeriodStats stats_;
+};
+
+// Builds one process cluster per active scene, like HpaeRendererManager does for a multi-scene mix, all
+// feeding the output cluster. The worker count decides whether the output mixer renders the scene clusters
+// in parallel, zero keeps everything on the calling thread.
+class BenchmarkHpaeSceneTest : public benchmark::Fixture {
+public:
+    BenchmarkHpaeSceneTest()
+    {
+        Iterations(ITERATIONS);
+    }
+
+    ~BenchmarkHpaeSceneTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        int64_t sceneNum = state.range(0);
+        int64_t workerNum = state.range(1);
+
+        HpaeNodeInfo sinkNodeInfo;
+        sinkNodeInfo.nodeId = 0;
+        sinkNodeInfo.samplingRate = SAMPLE_RATE_48000;
+        sinkNodeInfo.frameLen = SAMPLE_RATE_48000 * FRAME_LEN_MS / MS_PER_SECOND;
+        sinkNodeInfo.format = SAMPLE_F32LE;
+        sinkNodeInfo.channels = STEREO;
+        sinkNodeInfo.channelLayout = CH_LAYOUT_STEREO;
+        sinkNodeInfo.sceneType = HPAE_SCENE_EFFECT_OUT;
+        sinkNodeInfo.deviceClass = DEVICE_CLASS;
+        sinkNodeInfo.deviceNetId = DEVICE_NETWORK_ID;
+
+        sinkInfo_.deviceClass = DEVICE_CLASS;
+        sinkInfo_.deviceNetId = DEVICE_NETWORK_ID;
+        sinkInfo_.samplingRate = sinkNodeInfo.samplingRate;
+        sinkInfo_.frameLen = sinkNodeInfo.frameLen;
+        sinkInfo_.format = sinkNodeInfo.format;
+        sinkInfo_.channels = sinkNodeInfo.channels;
+        sinkInfo_.filePath = RENDER_FILE_PATH;
+
+        outputCluster_ = std::make_shared<HpaeOutputCluster>(sinkNodeInfo);
+        if (workerNum > 0) {
+            outputCluster_->SetWorkerPool(std::make_shared<HpaeWorkerPool>(static_cast<uint32_t>(workerNum),
+                "BenchWorker"));
+        }
+        outputCluster_->GetInstance(DEVICE_CLASS, DEVICE_NETWORK_ID);
+        IAudioSinkAttr attr;
+        attr.adapterName = DEVICE_CLASS;
+        attr.sampleRate = sinkInfo_.samplingRate;
+        attr.channel = sinkInfo_.channels;
+        attr.format = sinkInfo_.format;
+        attr.filePath = RENDER_FILE_PATH;
+        attr.deviceNetworkId = DEVICE_NETWORK_ID;
+        initRet_ = outputCluster_->Init(attr);
+        outputCluster_->Start();
+
+        uint32_t sessionIndex = 0;
+        for (int64_t scene = 0; scene < sceneNum; scene++) {
+            std::shared_ptr<HpaeProcessCluster> processCluster = nullptr;
+            for (int32_t i = 0; i < STREAMS_PER_SCENE; i++, sessionIndex++) {
+                HpaeNodeInfo nodeInfo;
+                nodeInfo.nodeId = sessionIndex + 1;
+                nodeInfo.sessionId = SESSION_ID_BASE + sessionIndex;
+                nodeInfo.samplingRate = MIXED_RATES[sessionIndex % MIXED_RATES.size()];
+                nodeInfo.frameLen = nodeInfo.samplingRate * FRAME_LEN_MS / MS_PER_SECOND;
+                nodeInfo.format = SAMPLE_S16LE;
+                nodeInfo.streamType = STREAM_MUSIC;
+                nodeInfo.sceneType = SCENE_TYPES[scene % SCENE_TYPES.size()];
+                nodeInfo.deviceClass = DEVICE_CLASS;
+                nodeInfo.deviceNetId = DEVICE_NETWORK_ID;
+                ApplyLayout(nodeInfo, LAYOUT_5POINT1);
+                auto sinkInputNode = std::make_shared<HpaeSinkInputNode>(nodeInfo);
+                auto writeCallback = std::make_shared<WriteFixedValueCb>(nodeInfo.format, TEST_SAMPLE_VALUE);
+                sinkInputNode->RegisterWriteCallback(writeCallback);
+                sinkInputNode->SetState(HPAE_SESSION_RUNNING);
+                if (processCluster == nullptr) {
+                    processCluster = std::make_shared<HpaeProcessCluster>(nodeInfo, sinkInfo_);
+                    outputCluster_->Connect(processCluster);
+                }
+                processCluster->CreateNodes(sinkInputNode);
+                processCluster->Connect(sinkInputNode);
+                sinkInputNodes_.push_back(sinkInputNode);
+                writeCallbacks_.push_back(writeCallback);
+            }
+            processClusters_.push_back(processCluster);
+        }
+        stats_.Reset(static_cast<uint64_t>(FRAME_LEN_MS) * NS_PER_SECOND / MS_PER_SECOND, ITERATIONS);
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        for (size_t i = 0; i < sinkInputNodes_.size(); i++) {
+            processClusters_[i / STREAMS_PER_SCENE]->DisConnect(sinkInputNodes_[i]);
+        }
+        for (auto &processCluster : processClusters_) {
+            outputCluster_->DisConnect(processCluster);
+        }
+        outputCluster_->Stop();
+        outputCluster_->DeInit();
+        sinkInputNodes_.clear();
+        writeCallbacks_.clear();
+        processClusters_.clear();
+        outputCluster_.reset();
+    }
+
+protected:
+    HpaeSinkInfo sinkInfo_;
+    std::shared_ptr<HpaeOutputCluster> outputCluster_ = nullptr;
+    std::vector<std::shared_ptr<HpaeProcessCluster>> processClusters_;
+    std::vector<std::shared_ptr<HpaeSinkInputNode>> sinkInputNodes_;
+    std::vector<std::shared_ptr<WriteFixedValueCb>> writeCallbacks_;
+    PeriodStats stats_;
+    int32_t initRet_ = ERROR;
+};
+
+// args: stream count, sample rate mix, channel layout, limiter on/off
+void RendererSweepArgs(benchmark::internal::Benchmark *bench)
+{
+    for (int64_t streamNum : {1, 4, 8, 16}) {
+        for (int64_t rateMix : {RATE_MIX_UNIFORM, RATE_MIX_MIXED}) {
+            for (int64_t layout : {LAYOUT_STEREO, LAYOUT_5POINT1}) {
+                for (int64_t limiter : {0, 1}) {
+                    bench->Args({streamNum, rateMix, layout, limiter});
+                }
+            }
+        }
+    }
+}
+
+// args: active scene count, scene worker count
+void SceneSweepArgs(benchmark::internal::Benchmark *bench)
+{
+    for (int64_t sceneNum = 1; sceneNum <= static_cast<int64_t>(SCENE_TYPES.size()); sceneNum++) {
+        for (int64_t workerNum : {0, 2}) {
+            bench->Args({sceneNum, workerNum});
+        }
+    }
+}
+
+// args: stream count, sample rate mix, channel layout
+void CapturerSweepArgs(benchmark::internal::Benchmark *bench)
+{
+    for (int64_t streamNum : {1, 4, 8}) {
+        for (int64_t rateMix : {RATE_MIX_UNIFORM, RATE_MIX_MIXED}) {
+            for (int64_t layout : {LAYOUT_STEREO, LAYOUT_5POINT1}) {
+                bench->Args({streamNum, rateMix, layout});
+            }
+        }
+    }
+}
+
+BENCHMARK_DEFINE_F(BenchmarkHpaeRendererTest, RenderPeriodTestCase)(benchmark::State &state)
+{
+    if (initRet_ != SUCCESS) {
+        state.SkipWithError("RenderPeriodTestCase file sink init failed.");
+        return;
+    }
+    // warm up once so lazily sized buffers are not counted as steady state allocations
+    sinkOutputNode_->DoProcess();
+    while (state.KeepRunning()) {
+        stats_.Begin();
+        sinkOutputNode_->DoProcess();
+        stats_.End();
+    }
+    stats_.Report(state);
+}
+BENCHMARK_REGISTER_F(BenchmarkHpaeRendererTest, RenderPeriodTestCase)->Apply(RendererSweepArgs);
+
+BENCHMARK_DEFINE_F(BenchmarkHpaeSceneTest, ScenePeriodTestCase)(benchmark::State &state)
+{
+    if (initRet_ != SUCCESS) {
+        state.SkipWithError("ScenePeriodTestCase file sink init failed.");
+        return;
+    }
+    outputCluster_->DoProcess();
+    while (state.KeepRunning()) {
+        stats_.Begin();
+        outputCluster_->DoProcess();
+        stats_.End();
+    }
+    stats_.Report(state);
+}
+BENCHMARK_REGISTER_F(BenchmarkHpaeSceneTest, ScenePeriodTestCase)->Apply(SceneSweepArgs);
+
+BENCHMARK_DEFINE_F(BenchmarkHpaeCapturerTest, CapturePeriodTestCase)(benchmark::State &state)
+{
+    for (auto &sourceOutputNode : sourceOutputNodes_) {
+        sourceOutputNode->DoProcess();
+    }
+    while (state.KeepRunning()) {
+        stats_.Begin();
+        for (auto &sourceOutputNode : sourceOutputNodes_) {
+            sourceOutputNode->DoProcess();
+        }
+        stats_.End();
+    }
+    stats_.Report(state);
+}
+BENCHMARK_REGISTER_F(BenchmarkHpaeCapturerTest, CapturePeriodTestCase)->Apply(CapturerSweepArgs);
+} // namespace
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "audio_errors.h"
+#include "hpae_soft_link.h"
+#include "hpae_sink_input_node.h"
+#include "hpae_process_cluster.h"
+#include "hpae_output_cluster.h"
+#include "hpae_source_input_cluster.h"
+#include "hpae_source_output_node.h"
+
+using namespace std;
+using namespace OHOS;
+using namespace OHOS::AudioStandard;
+using namespace OHOS::AudioStandard::HPAE;
+
+namespace {
+const std::string DEVICE_CLASS = "file_io";
+const std::string DEVICE_NETWORK_ID = "LocalDevice";
+const std::string RENDER_FILE_PATH = "/data/benchmark_loopback_render.pcm";
+const std::string CAPTURE_FILE_PATH = "/data/benchmark_loopback_source.pcm";
+constexpr uint32_t SAMPLE_RATE = SAMPLE_RATE_48000;
+constexpr uint32_t CHANNEL_COUNT = STEREO;
+constexpr uint32_t MS_PER_SECOND = 1000;
+constexpr uint64_t NS_PER_MS = 1000000;
+constexpr uint64_t NS_PER_SECOND = 1000000000;
+constexpr uint32_t SESSION_ID_BASE = 100000;
+// one click every PULSE_INTERVAL_MS, far longer than any latency the link may have so every click is unambiguous
+constexpr uint32_t PULSE_INTERVAL_MS = 300;
+constexpr uint32_t PULSE_COUNT_IN_FILE = 4;
+constexpr uint32_t PULSE_WIDTH_FRAMES = 48;
+constexpr int16_t PULSE_VALUE = 16384;
+constexpr int32_t PULSE_THRESHOLD = PULSE_VALUE / 4;
+constexpr uint32_t RUN_MS = 3000;
+constexpr int32_t PERCENT_50 = 50;
+constexpr int32_t PERCENT_100 = 100;
+
+uint64_t GetMonotonicNs()
+{
+    struct timespec ts = {};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * NS_PER_SECOND + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+void SleepUntilNs(uint64_t timeNs)
+{
+    struct timespec ts = {};
+    ts.tv_sec = static_cast<time_t>(timeNs / NS_PER_SECOND);
+    ts.tv_nsec = static_cast<long>(timeNs % NS_PER_SECOND);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) != 0) {}
+}
+
+// The file source rewinds at the end, so a few periods of clicks play forever.
+bool WritePulseFile(const std::string &path)
+{
+    const uint32_t intervalFrames = SAMPLE_RATE * PULSE_INTERVAL_MS / MS_PER_SECOND;
+    std::vector<int16_t> data(static_cast<size_t>(intervalFrames) * PULSE_COUNT_IN_FILE * CHANNEL_COUNT, 0);
+    for (uint32_t pulse = 0; pulse < PULSE_COUNT_IN_FILE; pulse++) {
+        size_t start = static_cast<size_t>(pulse) * intervalFrames * CHANNEL_COUNT;
+        std::fill(data.begin() + start, data.begin() + start + PULSE_WIDTH_FRAMES * CHANNEL_COUNT, PULSE_VALUE);
+    }
+    FILE *file = fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    size_t written = fwrite(data.data(), sizeof(int16_t), data.size(), file);
+    fclose(file);
+    return written == data.size();
+}
+
+// Onset of every click in the rendered file, in frames from the start of rendering.
+std::vector<uint64_t> FindPulseOnsets(const std::string &path)
+{
+    std::vector<uint64_t> onsets;
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return onsets;
+    }
+    const uint32_t intervalFrames = SAMPLE_RATE * PULSE_INTERVAL_MS / MS_PER_SECOND;
+    int16_t frame[CHANNEL_COUNT] = {};
+    uint64_t index = 0;
+    uint64_t lastOnset = 0;
+    while (fread(frame, sizeof(int16_t), CHANNEL_COUNT, file) == CHANNEL_COUNT) {
+        // the drift resampler smears the edge by a few frames, half an interval of holdoff skips the ringing
+        if (std::abs(static_cast<int32_t>(frame[0])) > PULSE_THRESHOLD &&
+            (onsets.empty() || index - lastOnset > intervalFrames / 2)) {
+            onsets.push_back(index);
+            lastOnset = index;
+        }
+        index++;
+    }
+    fclose(file);
+    return onsets;
+}
+
+// Loops the file source back to the file sink through an HpaeSoftLink. The capture graph (source input cluster ->
+// source output node) and the render graph (sink input node -> process cluster -> output cluster) are driven on
+// two threads at the device period, like the capturer and renderer manager threads. Clicks in the source file are
+// found again in the rendered file, the distance is the latency the graphs and the link add on top of the device
+// buffers. Run with a file sink and source so the numbers do not include any hardware.
+class BenchmarkHpaeLoopbackTest : public benchmark::Fixture {
+public:
+    BenchmarkHpaeLoopbackTest()
+    {
+        Iterations(1);
+    }
+
+    ~BenchmarkHpaeLoopbackTest() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {
+        SoftLinkMode mode = static_cast<SoftLinkMode>(state.range(0));
+        periodMs_ = static_cast<uint32_t>(state.range(1));
+        frameLen_ = SAMPLE_RATE * periodMs_ / MS_PER_SECOND;
+        initRet_ = WritePulseFile(CAPTURE_FILE_PATH) ? SUCCESS : ERROR;
+
+        // the link is driven directly, the streams it would create through the manager are built below
+        softLink_ = std::make_shared<HpaeSoftLink>(0, 0, mode);
+        HpaeSinkInfo linkSinkInfo;
+        linkSinkInfo.samplingRate = static_cast<AudioSamplingRate>(SAMPLE_RATE);
+        linkSinkInfo.channels = static_cast<AudioChannel>(CHANNEL_COUNT);
+        linkSinkInfo.channelLayout = CH_LAYOUT_STEREO;
+        linkSinkInfo.format = SAMPLE_S16LE;
+        linkSinkInfo.frameLen = frameLen_;
+        HpaeSourceInfo linkSourceInfo;
+        linkSourceInfo.samplingRate = linkSinkInfo.samplingRate;
+        linkSourceInfo.channels = linkSinkInfo.channels;
+        linkSourceInfo.channelLayout = linkSinkInfo.channelLayout;
+        linkSourceInfo.format = linkSinkInfo.format;
+        linkSourceInfo.frameLen = frameLen_;
+        if (softLink_->InitBuffer(linkSinkInfo, linkSourceInfo) != SUCCESS) {
+            initRet_ = ERROR;
+        }
+
+        HpaeNodeInfo nodeInfo;
+        nodeInfo.samplingRate = static_cast<AudioSamplingRate>(SAMPLE_RATE);
+        nodeInfo.frameLen = frameLen_;
+        nodeInfo.format = SAMPLE_S16LE;
+        nodeInfo.channels = static_cast<AudioChannel>(CHANNEL_COUNT);
+        nodeInfo.channelLayout = CH_LAYOUT_STEREO;
+        nodeInfo.deviceClass = DEVICE_CLASS;
+        nodeInfo.deviceNetId = DEVICE_NETWORK_ID;
+        BuildRenderGraph(nodeInfo);
+        BuildCaptureGraph(nodeInfo);
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+        HpaeNodeInfo nodeInfo = sourceOutputNode_->GetNodeInfo();
+        sourceOutputNode_->DisConnectWithInfo(sourceInputCluster_, nodeInfo);
+        sourceInputCluster_->CapturerSourceStop();
+        sourceInputCluster_->CapturerSourceDeInit();
+        processCluster_->DisConnect(sinkInputNode_);
+        outputCluster_->DisConnect(processCluster_);
+        sourceOutputNode_.reset();
+        sourceInputCluster_.reset();
+        sinkInputNode_.reset();
+        processCluster_.reset();
+        outputCluster_.reset();
+        softLink_->Release();
+        softLink_.reset();
+    }
+
+protected:
+    void BuildRenderGraph(HpaeNodeInfo nodeInfo)
+    {
+        HpaeNodeInfo sinkNodeInfo = nodeInfo;
+        sinkNodeInfo.nodeId = 0;
+        sinkNodeInfo.sceneType = HPAE_SCENE_EFFECT_OUT;
+        HpaeSinkInfo sinkInfo;
+        sinkInfo.deviceClass = DEVICE_CLASS;
+        sinkInfo.deviceNetId = DEVICE_NETWORK_ID;
+        sinkInfo.samplingRate = sinkNodeInfo.samplingRate;
+        sinkInfo.frameLen = sinkNodeInfo.frameLen;
+        sinkInfo.format = sinkNodeInfo.format;
+        sinkInfo.channels = sinkNodeInfo.channels;
+        sinkInfo.filePath = RENDER_FILE_PATH;
+        outputCluster_ = std::make_shared<HpaeOutputCluster>(sinkNodeInfo);
+        outputCluster_->GetInstance(DEVICE_CLASS, DEVICE_NETWORK_ID);
+        IAudioSinkAttr attr;
+        attr.adapterName = DEVICE_CLASS;
+        attr.sampleRate = sinkInfo.samplingRate;
+        attr.channel = sinkInfo.channels;
+        attr.format = sinkInfo.format;
+        attr.filePath = RENDER_FILE_PATH;
+        attr.deviceNetworkId = DEVICE_NETWORK_ID;
+        if (outputCluster_->Init(attr) != SUCCESS) {
+            initRet_ = ERROR;
+        }
+
+        // no effect chain, its algorithmic delay depends on the device config and is not the link's
+        nodeInfo.nodeId = 1;
+        nodeInfo.sessionId = SESSION_ID_BASE;
+        nodeInfo.streamType = STREAM_MUSIC;
+        nodeInfo.sceneType = HPAE_SCENE_EFFECT_NONE;
+        sinkInputNode_ = std::make_shared<HpaeSinkInputNode>(nodeInfo);
+        sinkInputNode_->RegisterWriteCallback(softLink_);
+        sinkInputNode_->SetState(HPAE_SESSION_RUNNING);
+        processCluster_ = std::make_shared<HpaeProcessCluster>(nodeInfo, sinkInfo);
+        outputCluster_->Connect(processCluster_);
+        processCluster_->CreateNodes(sinkInputNode_);
+        processCluster_->Connect(sinkInputNode_);
+    }
+
+    void BuildCaptureGraph(HpaeNodeInfo nodeInfo)
+    {
+        HpaeNodeInfo sourceNodeInfo = nodeInfo;
+        sourceNodeInfo.nodeId = 0;
+        sourceNodeInfo.sourceType = SOURCE_TYPE_MIC;
+        sourceNodeInfo.sourceBufferType = HPAE_SOURCE_BUFFER_TYPE_MIC;
+        sourceInputCluster_ = std::make_shared<HpaeSourceInputCluster>(sourceNodeInfo);
+        sourceInputCluster_->GetCapturerSourceInstance(DEVICE_CLASS, DEVICE_NETWORK_ID, SOURCE_TYPE_MIC, "mic");
+        IAudioSourceAttr attr;
+        attr.sampleRate = sourceNodeInfo.samplingRate;
+        attr.channel = sourceNodeInfo.channels;
+        attr.format = sourceNodeInfo.format;
+        attr.filePath = CAPTURE_FILE_PATH;
+        attr.deviceNetworkId = DEVICE_NETWORK_ID;
+        if (sourceInputCluster_->CapturerSourceInit(attr) != SUCCESS) {
+            initRet_ = ERROR;
+        }
+
+        nodeInfo.nodeId = 2; // 2, the sink input node is 1
+        nodeInfo.sessionId = SESSION_ID_BASE + 1;
+        nodeInfo.sourceType = SOURCE_TYPE_MIC;
+        nodeInfo.sceneType = HPAE_SCENE_EFFECT_NONE;
+        nodeInfo.sourceBufferType = HPAE_SOURCE_BUFFER_TYPE_MIC;
+        sourceOutputNode_ = std::make_shared<HpaeSourceOutputNode>(nodeInfo);
+        sourceOutputNode_->RegisterReadCallback(softLink_);
+        sourceOutputNode_->SetState(HPAE_SESSION_RUNNING);
+        sourceOutputNode_->ConnectWithInfo(sourceInputCluster_, nodeInfo);
+    }
+
+    // Both threads start on the same period boundary, frame n of either side then belongs to the same instant.
+    void RunLoopback()
+    {
+        sourceInputCluster_->CapturerSourceStart();
+        outputCluster_->Start();
+        const uint64_t periodNs = static_cast<uint64_t>(periodMs_) * NS_PER_MS;
+        const uint64_t periodCount = static_cast<uint64_t>(RUN_MS) / periodMs_;
+        const uint64_t startNs = GetMonotonicNs() + periodNs;
+        std::thread captureThread([this, startNs, periodNs, periodCount] {
+            for (uint64_t i = 0; i < periodCount; i++) {
+                SleepUntilNs(startNs + i * periodNs);
+                sourceOutputNode_->DoProcess();
+            }
+        });
+        std::thread renderThread([this, startNs, periodNs, periodCount] {
+            for (uint64_t i = 0; i < periodCount; i++) {
+                SleepUntilNs(startNs + i * periodNs);
+                outputCluster_->DoProcess();
+            }
+        });
+        captureThread.join();
+        renderThread.join();
+        outputCluster_->Stop();
+    }
+
+    void Report(benchmark::State &state)
+    {
+        // DeInit closes the file so everything rendered is on disk
+        outputCluster_->DeInit();
+        std::vector<uint64_t> onsets = FindPulseOnsets(RENDER_FILE_PATH);
+        const uint32_t intervalFrames = SAMPLE_RATE * PULSE_INTERVAL_MS / MS_PER_SECOND;
+        std::vector<double> latencyMs;
+        for (uint64_t onset : onsets) {
+            // clicks sit at multiples of the interval in the source, what is left over is the latency
+            latencyMs.push_back(static_cast<double>(onset % intervalFrames) * MS_PER_SECOND / SAMPLE_RATE);
+        }
+        const uint64_t expectedPulses = static_cast<uint64_t>(RUN_MS) / PULSE_INTERVAL_MS;
+        state.counters["pulses_lost"] = expectedPulses > latencyMs.size() ? expectedPulses - latencyMs.size() : 0;
+        if (latencyMs.empty()) {
+            state.SkipWithError("no click found in the rendered file.");
+            return;
+        }
+        std::sort(latencyMs.begin(), latencyMs.end());
+        double p50 = latencyMs[(latencyMs.size() - 1) * PERCENT_50 / PERCENT_100];
+        state.counters["link_min_ms"] = latencyMs.front();
+        state.counters["link_p50_ms"] = p50;
+        state.counters["link_max_ms"] = latencyMs.back();
+        // a device holds at least one period on each side, add them for the shortest possible round trip
+        state.counters["round_trip_p50_ms"] = p50 + 2 * periodMs_; // 2 for one capture and one render period
+        state.counters["target_ms"] = softLink_->GetTargetLatencyMs();
+    }
+
+    std::shared_ptr<HpaeSoftLink> softLink_ = nullptr;
+    std::shared_ptr<HpaeOutputCluster> outputCluster_ = nullptr;
+    std::shared_ptr<HpaeProcessCluster> processCluster_ = nullptr;
+    std::shared_ptr<HpaeSinkInputNode> sinkInputNode_ = nullptr;
+    std::shared_ptr<HpaeSourceInputCluster> sourceInputCluster_ = nullptr;
+    std::shared_ptr<HpaeSourceOutputNode> sourceOutputNode_ = nullptr;
+    uint32_t periodMs_ = 0;
+    uint32_t frameLen_ = 0;
+    int32_t initRet_ = ERROR;
+};
+
+// args: soft link mode, device period in ms. Only the loopback mode follows the device period, the other modes
+// always exchange 20ms frames and are measured on a 20ms device.
+void LoopbackSweepArgs(benchmark::internal::Benchmark *bench)
+{
+    bench->Args({static_cast<int64_t>(SoftLinkMode::HEARING_AID), 20}); // 20 for the hearing aid frame length
+    for (int64_t periodMs : {5, 10, 20}) {
+        bench->Args({static_cast<int64_t>(SoftLinkMode::LOOPBACK), periodMs});
+    }
+}
+
+BENCHMARK_DEFINE_F(BenchmarkHpaeLoopbackTest, LoopbackLatencyTestCase)(benchmark::State &state)
+{
+    if (initRet_ != SUCCESS) {
+        state.SkipWithError("LoopbackLatencyTestCase file sink or source init failed.");
+        return;
+    }
+    while (state.KeepRunning()) {
+        RunLoopback();
+    }
+    Report(state);
+}
+BENCHMARK_REGISTER_F(BenchmarkHpaeLoopbackTest, LoopbackLatencyTestCase)->Apply(LoopbackSweepArgs)
+    ->UseRealTime()->Unit(benchmark::kMillisecond);
+} // namespace
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -660,6 +660,124 @@ HWTEST_F(HpaeSoftLinkTest, HpaeSoftLinkTransStreamInfoTest_003, TestSize.Level1)
     EXPECT_EQ(streamInfo.streamType, STREAM_SOURCE_VOICE_CALL);
     EXPECT_EQ(streamInfo.fadeType, NONE_FADE);
 }
+
+/*
+ * @tc.name  : Test HpaeSoftLink loopback mode
+ * @tc.type  : FUNC
+ * @tc.number: HpaeSoftLinkLoopbackTest_001
+ * @tc.desc  : Test loopback streams run at the sink period on the music scene without fade
+ */
+HWTEST_F(HpaeSoftLinkTest, HpaeSoftLinkLoopbackTest_001, TestSize.Level1)
+{
+    std::shared_ptr<HpaeSoftLink> softLink =
+        std::make_shared<HpaeSoftLink>(sinkId_, sourceId_, SoftLinkMode::LOOPBACK);
+    EXPECT_NE(softLink, nullptr);
+    EXPECT_EQ(softLink->Init(), SUCCESS);
+    HpaeSinkInfo &sinkInfo = softLink->sinkInfo_;
+    ASSERT_GT(sinkInfo.frameLen, 0);
+
+    HpaeStreamInfo streamInfo;
+    softLink->TransSinkInfoToStreamInfo(streamInfo, HPAE_STREAM_CLASS_TYPE_PLAY);
+    EXPECT_EQ(streamInfo.frameLen, sinkInfo.frameLen);
+    EXPECT_EQ(streamInfo.streamType, STREAM_MUSIC);
+    EXPECT_EQ(streamInfo.fadeType, NONE_FADE);
+    EXPECT_EQ(streamInfo.effectInfo.effectScene, SCENE_MUSIC);
+    EXPECT_EQ(streamInfo.effectInfo.streamUsage, STREAM_USAGE_MUSIC);
+
+    softLink->TransSinkInfoToStreamInfo(streamInfo, HPAE_STREAM_CLASS_TYPE_RECORD);
+    EXPECT_EQ(streamInfo.frameLen, sinkInfo.frameLen);
+    EXPECT_EQ(streamInfo.streamType, STREAM_RECORDING);
+    EXPECT_EQ(streamInfo.sourceType, SOURCE_TYPE_MIC);
+}
+
+/*
+ * @tc.name  : Test HpaeSoftLink loopback mode
+ * @tc.type  : FUNC
+ * @tc.number: HpaeSoftLinkLoopbackTest_002
+ * @tc.desc  : Test loopback buffering is sized by the sink period and smaller than the hearing aid link
+ */
+HWTEST_F(HpaeSoftLinkTest, HpaeSoftLinkLoopbackTest_002, TestSize.Level1)
+{
+    std::shared_ptr<HpaeSoftLink> loopback = std::make_shared<HpaeSoftLink>(0, 0, SoftLinkMode::LOOPBACK);
+    std::shared_ptr<HpaeSoftLink> hearingAid = std::make_shared<HpaeSoftLink>(0, 0, SoftLinkMode::HEARING_AID);
+    for (auto &softLink : {loopback, hearingAid}) {
+        softLink->sinkInfo_.samplingRate = SAMPLE_RATE_48000;
+        softLink->sinkInfo_.channels = STEREO;
+        softLink->sinkInfo_.format = SAMPLE_S16LE;
+        softLink->sinkInfo_.frameLen = 240; // 240 for 5ms at 48kHz
+        EXPECT_EQ(softLink->InitBuffer(), SUCCESS);
+        // not created through the manager, nothing to release there
+        softLink->state_ = HpaeSoftLinkState::RELEASED;
+    }
+    EXPECT_EQ(loopback->GetLinkFrameLen(), 240); // 240 for the sink period
+    EXPECT_EQ(hearingAid->GetLinkFrameLen(), 960); // 960 for 20ms at 48kHz
+    EXPECT_EQ(loopback->GetTargetLatencyMs(), 10); // 10 for the minimum loopback target
+    EXPECT_EQ(hearingAid->GetTargetLatencyMs(), 40); // 40 for the hearing aid target
+
+    OptResult loopbackSize = loopback->bufferQueue_->GetWritableSize();
+    OptResult hearingAidSize = hearingAid->bufferQueue_->GetWritableSize();
+    EXPECT_EQ(loopbackSize.size, 3 * 240 * STEREO * sizeof(float)); // 3 periods of 240 frames
+    EXPECT_LT(loopbackSize.size, hearingAidSize.size);
+
+    loopback->sinkInfo_.frameLen = 1920; // 1920 for 40ms at 48kHz
+    EXPECT_EQ(loopback->GetTargetLatencyMs(), 40); // 40, never below one period
+
+    std::shared_ptr<HpaeSoftLink> invalid = std::make_shared<HpaeSoftLink>(0, 0, SoftLinkMode::LOOPBACK);
+    EXPECT_EQ(invalid->InitBuffer(), ERR_INVALID_PARAM);
+    invalid->state_ = HpaeSoftLinkState::RELEASED;
+}
+
+/*
+ * @tc.name  : Test HpaeSoftLink loopback mode
+ * @tc.type  : FUNC
+ * @tc.number: HpaeSoftLinkLoopbackTest_003
+ * @tc.desc  : Test a loopback link runs between the file sink and source
+ */
+HWTEST_F(HpaeSoftLinkTest, HpaeSoftLinkLoopbackTest_003, TestSize.Level1)
+{
+    std::shared_ptr<IHpaeSoftLink> softLink =
+        IHpaeSoftLink::CreateSoftLink(sinkId_, sourceId_, SoftLinkMode::LOOPBACK);
+    ASSERT_NE(softLink, nullptr);
+    EXPECT_EQ(softLink->Start(), SUCCESS);
+    std::this_thread::sleep_for(std::chrono::milliseconds(500)); // 500ms for sleep
+    EXPECT_EQ(softLink->SetVolume(0.5f), SUCCESS); // 0.5 for half volume
+    EXPECT_EQ(softLink->Stop(), SUCCESS);
+    EXPECT_EQ(softLink->Release(), SUCCESS);
+}
+
+/*
+ * @tc.name  : Test HpaeSoftLink loopback mode
+ * @tc.type  : FUNC
+ * @tc.number: HpaeSoftLinkLoopbackTest_004
+ * @tc.desc  : Test loopback buffering follows the mic period when it is longer than the sink period
+ */
+HWTEST_F(HpaeSoftLinkTest, HpaeSoftLinkLoopbackTest_004, TestSize.Level1)
+{
+    HpaeSinkInfo sinkInfo;
+    sinkInfo.samplingRate = SAMPLE_RATE_48000;
+    sinkInfo.channels = STEREO;
+    sinkInfo.format = SAMPLE_S16LE;
+    sinkInfo.frameLen = 240; // 240 for 5ms at 48kHz
+    HpaeSourceInfo sourceInfo;
+    sourceInfo.samplingRate = SAMPLE_RATE_16000;
+    sourceInfo.channels = MONO;
+    sourceInfo.format = SAMPLE_S16LE;
+    sourceInfo.frameLen = 320; // 320 for 20ms at 16kHz
+    std::shared_ptr<HpaeSoftLink> loopback = std::make_shared<HpaeSoftLink>(0, 0, SoftLinkMode::LOOPBACK);
+    EXPECT_EQ(loopback->InitBuffer(sinkInfo, sourceInfo), SUCCESS);
+    EXPECT_EQ(loopback->GetLinkFrameLen(), 240); // 240, the streams still run at the sink period
+    EXPECT_EQ(loopback->GetTargetLatencyMs(), 20); // 20 for one mic period
+    OptResult ringSize = loopback->bufferQueue_->GetWritableSize();
+    EXPECT_EQ(ringSize.size, 3 * 960 * STEREO * sizeof(float)); // 3 mic periods, 960 frames each at 48kHz
+
+    sourceInfo.frameLen = 80; // 80 for 5ms at 16kHz
+    std::shared_ptr<HpaeSoftLink> shortMic = std::make_shared<HpaeSoftLink>(0, 0, SoftLinkMode::LOOPBACK);
+    EXPECT_EQ(shortMic->InitBuffer(sinkInfo, sourceInfo), SUCCESS);
+    EXPECT_EQ(shortMic->GetTargetLatencyMs(), 10); // 10 for the minimum loopback target
+    EXPECT_EQ(shortMic->bufferQueue_->GetWritableSize().size, 3 * 240 * STEREO * sizeof(float)); // 3 sink periods
+    EXPECT_EQ(loopback->Release(), SUCCESS);
+    EXPECT_EQ(shortMic->Release(), SUCCESS);
+}
 } // namespace HPAE
 } // namespace AudioStandard
 } // namespace OHOS
@@ -37,6 +37,7 @@ namespace HPAE {
 namespace {
 constexpr uint32_t TEST_FRAME_LEN = 960; // 20ms at 48kHz
 constexpr uint32_t TEST_LATENCY_MS = 280; // 280ms latency for testing
+constexpr int32_t TEST_ENQUEUE_DONE_FRAME = 10; // the enqueue that starts the latency adjustment
 HpaeNodeInfo GetTestNodeInfo()
 {
     HpaeNodeInfo nodeInfo;
@@ -142,6 +143,36 @@ HWTEST_F(HpaeCoBufferNodeUnitTest, Process_001, TestSize.Level0)
     TestRendererRenderFrame(sinkOutputNode->GetRenderFrameData(),
         nodeInfo.frameLen * nodeInfo.channels * GetSizeFromFormat(nodeInfo.format));
 }
+
+/**
+ * @tc.name  : Test Process
+ * @tc.type  : FUNC
+ * @tc.number: Process_002
+ * @tc.desc  : Test the data cached before the latency adjustment is skipped on the first output period.
+ */
+HWTEST_F(HpaeCoBufferNodeUnitTest, Process_002, TestSize.Level0)
+{
+    HpaeNodeInfo nodeInfo = GetTestNodeInfo();
+    std::shared_ptr<HpaeSinkInputNode> sinkInputNode = std::make_shared<HpaeSinkInputNode>(nodeInfo);
+    std::shared_ptr<HpaeCoBufferNode> coBufferNode = std::make_shared<HpaeCoBufferNode>();
+    coBufferNode->Connect(sinkInputNode);
+    ASSERT_NE(coBufferNode->ringCache_, nullptr);
+    PcmBufferInfo pcmBufferInfo;
+    pcmBufferInfo.ch = STEREO;
+    pcmBufferInfo.frameLen = TEST_FRAME_LEN;
+    HpaePcmBuffer pcmBuffer(pcmBufferInfo);
+    const size_t frameSize = TEST_FRAME_LEN * STEREO * sizeof(float);
+    const size_t emptySize = coBufferNode->ringCache_->GetWritableSize().size;
+    // the enqueue that starts the latency adjustment drops the frames before it and caches itself
+    for (int32_t i = 0; i < TEST_ENQUEUE_DONE_FRAME; i++) {
+        coBufferNode->Enqueue(&pcmBuffer);
+    }
+    EXPECT_EQ(coBufferNode->ringCache_->GetWritableSize().size,
+        emptySize - frameSize * TEST_ENQUEUE_DONE_FRAME);
+    coBufferNode->DoProcess();
+    EXPECT_EQ(coBufferNode->ringCache_->GetWritableSize().size, emptySize - frameSize);
+    coBufferNode->DisConnect(sinkInputNode);
+}
 }
 }
 }
\ No newline at end of file
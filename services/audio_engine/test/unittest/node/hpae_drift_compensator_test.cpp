@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "audio_errors.h"
+#include "hpae_drift_compensator.h"
+
+using namespace testing::ext;
+using namespace testing;
+
+namespace OHOS {
+namespace AudioStandard {
+namespace HPAE {
+namespace {
+constexpr uint32_t TEST_SAMPLE_RATE = 48000;
+constexpr uint32_t TEST_CHANNELS = 2;
+constexpr uint32_t TEST_FRAME_LEN = 960; // 20ms
+constexpr uint32_t TEST_RING_FRAMES = 4;
+constexpr uint32_t TEST_TARGET_LATENCY_MS = 40;
+constexpr uint32_t TEST_DURATION_FRAMES = 15000; // 5 minutes
+constexpr uint32_t TEST_SETTLED_FRAMES = 12000; // the last minute
+constexpr double TEST_CLOCK_PPM = 200.0;
+constexpr double TEST_PPM_TOLERANCE = 30.0;
+constexpr double TEST_TONE_HZ = 1000.0;
+constexpr double PPM_PER_UNIT = 1000000.0;
+constexpr double NS_PER_SECOND = 1000000000.0;
+constexpr double TWO_PI = 6.283185307179586;
+constexpr float TEST_PARTIAL_VALUE = 0.5f;
+constexpr float TEST_PARTIAL_TOLERANCE = 0.01f;
+
+// times are counted in 20ms periods, the clock starts at one period so that zero stays invalid
+int64_t ToNs(double periods)
+{
+    return static_cast<int64_t>((periods + 1.0) * TEST_FRAME_LEN / TEST_SAMPLE_RATE * NS_PER_SECOND);
+}
+
+struct DriftRunResult {
+    uint32_t overflowCount = 0;
+    uint32_t underrunCount = 0;
+    double settledPpm = 0.0;
+    float maxSecondDiff = 0.0f;
+};
+
+// Producer and consumer tick every 20ms of their own clock, which run producerPpm / consumerPpm off nominal.
+DriftRunResult RunDriftBridge(double producerPpm, double consumerPpm)
+{
+    DriftRunResult runResult;
+    const size_t frameSize = TEST_CHANNELS * sizeof(float);
+    std::unique_ptr<HpaeSpscRingBuffer> ring =
+        HpaeSpscRingBuffer::Create(TEST_RING_FRAMES * TEST_FRAME_LEN * frameSize);
+    HpaeDriftCompensator compensator(TEST_SAMPLE_RATE, TEST_CHANNELS, TEST_TARGET_LATENCY_MS);
+    std::vector<float> inFrame(TEST_FRAME_LEN * TEST_CHANNELS);
+    std::vector<float> outFrame(TEST_FRAME_LEN * TEST_CHANNELS);
+    const double producerPeriod = 1.0 / (1.0 + producerPpm / PPM_PER_UNIT);
+    const double consumerPeriod = 1.0 / (1.0 + consumerPpm / PPM_PER_UNIT);
+    uint64_t sampleIndex = 0;
+    uint32_t producedCount = 0;
+    uint32_t consumedCount = 0;
+    double ppmSum = 0.0;
+    float prev[2] = {0.0f, 0.0f};
+    const uint32_t warmUpFrames = TEST_TARGET_LATENCY_MS * TEST_SAMPLE_RATE / 1000 / TEST_FRAME_LEN;
+
+    while (consumedCount < TEST_DURATION_FRAMES) {
+        if (producedCount * producerPeriod <= consumedCount * consumerPeriod) {
+            for (uint32_t i = 0; i < TEST_FRAME_LEN; i++, sampleIndex++) {
+                float value =
+                    static_cast<float>(0.5 * std::sin(TWO_PI * TEST_TONE_HZ * sampleIndex / TEST_SAMPLE_RATE));
+                inFrame[i * TEST_CHANNELS] = value;
+                inFrame[i * TEST_CHANNELS + 1] = value;
+            }
+            if (ring->Enqueue({reinterpret_cast<uint8_t *>(inFrame.data()), inFrame.size() * sizeof(float)}).ret !=
+                OPERATION_SUCCESS) {
+                runResult.overflowCount++;
+            }
+            compensator.OnProducerWrite(TEST_FRAME_LEN, ToNs(producedCount * producerPeriod));
+            producedCount++;
+            continue;
+        }
+        // the consumer starts once the target latency is buffered, like the co-buffer silence padding
+        if (producedCount < warmUpFrames) {
+            consumedCount++;
+            continue;
+        }
+        if (compensator.Process(*ring, outFrame.data(), TEST_FRAME_LEN, ToNs(consumedCount * consumerPeriod)) !=
+            SUCCESS) {
+            runResult.underrunCount++;
+        }
+        for (uint32_t i = 0; i < TEST_FRAME_LEN; i++) {
+            float value = outFrame[i * TEST_CHANNELS];
+            if (consumedCount > warmUpFrames + 1) {
+                runResult.maxSecondDiff = std::max(runResult.maxSecondDiff, std::fabs(value - 2 * prev[1] + prev[0]));
+            }
+            prev[0] = prev[1];
+            prev[1] = value;
+        }
+        if (consumedCount >= TEST_SETTLED_FRAMES) {
+            ppmSum += compensator.GetDriftPpm();
+        }
+        consumedCount++;
+    }
+    runResult.settledPpm = ppmSum / (TEST_DURATION_FRAMES - TEST_SETTLED_FRAMES);
+    return runResult;
+}
+}
+
+class HpaeDriftCompensatorTest : public testing::Test {
+public:
+    void SetUp() override {};
+    void TearDown() override {};
+};
+
+/**
+ * @tc.name  : Test drift compensation with a fast producer clock
+ * @tc.type  : FUNC
+ * @tc.number: DriftCompensate_001
+ * @tc.desc  : Producer at +200ppm, consumer at -200ppm, bridge must neither overflow nor underrun.
+ */
+HWTEST_F(HpaeDriftCompensatorTest, DriftCompensate_001, TestSize.Level1)
+{
+    DriftRunResult result = RunDriftBridge(TEST_CLOCK_PPM, -TEST_CLOCK_PPM);
+    EXPECT_EQ(result.overflowCount, 0);
+    EXPECT_EQ(result.underrunCount, 0);
+    EXPECT_NEAR(result.settledPpm, 2 * TEST_CLOCK_PPM, TEST_PPM_TOLERANCE);
+    // a dropped or inserted sample shows up as a jump far above the tone's own curvature
+    const float toneStep = static_cast<float>(TWO_PI * TEST_TONE_HZ / TEST_SAMPLE_RATE);
+    EXPECT_LT(result.maxSecondDiff, toneStep * toneStep);
+}
+
+/**
+ * @tc.name  : Test drift compensation with a slow producer clock
+ * @tc.type  : FUNC
+ * @tc.number: DriftCompensate_002
+ * @tc.desc  : Producer at -200ppm, consumer at +200ppm, bridge must neither overflow nor underrun.
+ */
+HWTEST_F(HpaeDriftCompensatorTest, DriftCompensate_002, TestSize.Level1)
+{
+    DriftRunResult result = RunDriftBridge(-TEST_CLOCK_PPM, TEST_CLOCK_PPM);
+    EXPECT_EQ(result.overflowCount, 0);
+    EXPECT_EQ(result.underrunCount, 0);
+    EXPECT_NEAR(result.settledPpm, -2 * TEST_CLOCK_PPM, TEST_PPM_TOLERANCE);
+    const float toneStep = static_cast<float>(TWO_PI * TEST_TONE_HZ / TEST_SAMPLE_RATE);
+    EXPECT_LT(result.maxSecondDiff, toneStep * toneStep);
+}
+
+/**
+ * @tc.name  : Test drift compensation on an empty ring
+ * @tc.type  : FUNC
+ * @tc.number: DriftCompensate_003
+ * @tc.desc  : Underrun pads silence and reports an error.
+ */
+HWTEST_F(HpaeDriftCompensatorTest, DriftCompensate_003, TestSize.Level1)
+{
+    std::unique_ptr<HpaeSpscRingBuffer> ring = HpaeSpscRingBuffer::Create(TEST_FRAME_LEN * sizeof(float));
+    HpaeDriftCompensator compensator(TEST_SAMPLE_RATE, TEST_CHANNELS, TEST_TARGET_LATENCY_MS);
+    std::vector<float> outFrame(TEST_FRAME_LEN * TEST_CHANNELS, 1.0f);
+    EXPECT_NE(compensator.Process(*ring, outFrame.data(), TEST_FRAME_LEN, 0), SUCCESS);
+    for (float value : outFrame) {
+        EXPECT_EQ(value, 0.0f);
+    }
+    EXPECT_EQ(compensator.Process(*ring, nullptr, TEST_FRAME_LEN, 0), ERR_INVALID_PARAM);
+}
+
+/**
+ * @tc.name  : Test drift compensation on a partly filled ring
+ * @tc.type  : FUNC
+ * @tc.number: DriftCompensate_004
+ * @tc.desc  : Underrun keeps the frames that are available and pads only the missing tail.
+ */
+HWTEST_F(HpaeDriftCompensatorTest, DriftCompensate_004, TestSize.Level1)
+{
+    const size_t frameSize = TEST_CHANNELS * sizeof(float);
+    std::unique_ptr<HpaeSpscRingBuffer> ring = HpaeSpscRingBuffer::Create(TEST_FRAME_LEN * frameSize);
+    HpaeDriftCompensator compensator(TEST_SAMPLE_RATE, TEST_CHANNELS, TEST_TARGET_LATENCY_MS);
+    std::vector<float> inFrame(TEST_FRAME_LEN / 2 * TEST_CHANNELS, TEST_PARTIAL_VALUE);
+    ASSERT_EQ(ring->Enqueue({reinterpret_cast<uint8_t *>(inFrame.data()), inFrame.size() * sizeof(float)}).ret,
+        OPERATION_SUCCESS);
+    std::vector<float> outFrame(TEST_FRAME_LEN * TEST_CHANNELS, 1.0f);
+    EXPECT_NE(compensator.Process(*ring, outFrame.data(), TEST_FRAME_LEN, 0), SUCCESS);
+    // the middle of the available half passes through, everything from its end on is silence
+    EXPECT_NEAR(outFrame[TEST_FRAME_LEN / 4 * TEST_CHANNELS], TEST_PARTIAL_VALUE, TEST_PARTIAL_TOLERANCE);
+    for (uint32_t i = TEST_FRAME_LEN / 2 * TEST_CHANNELS; i < outFrame.size(); i++) {
+        EXPECT_EQ(outFrame[i], 0.0f);
+    }
+}
+}  // namespace HPAE
+}  // namespace AudioStandard
+}  // namespace OHOS
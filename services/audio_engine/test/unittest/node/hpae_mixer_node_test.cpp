@@ -14,9 +14,15 @@
  */
 #include <gtest/gtest.h>
 #include <cmath>
+#include <cstring>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 #include "hpae_sink_input_node.h"
 #include "hpae_mixer_node.h"
+#include "hpae_gain_node.h"
+#include "hpae_audio_format_converter_node.h"
 #include "hpae_sink_output_node.h"
 #include "hpae_source_input_cluster.h"
 #include "test_case_common.h"
@@ -32,6 +38,14 @@ static constexpr int32_t TEST_VALUE1 = 100;
 static constexpr int32_t TEST_VALUE2 = 200;
 static constexpr uint32_t TEST_ID = 1243;
 static constexpr uint32_t TEST_FRAMELEN = 960;
+static constexpr uint32_t TEST_FRAMELEN_44100 = 882;
+static constexpr uint32_t TEST_SESSION_ID = 100000;
+static constexpr uint32_t TEST_WORKER_NUM = 2;
+static constexpr int32_t TEST_INPUT_NUM = 4;
+static constexpr int32_t TEST_PERIOD_NUM = 10;
+static constexpr uint32_t TEST_LCG_MULTIPLIER = 1664525;
+static constexpr uint32_t TEST_LCG_INCREMENT = 1013904223;
+static constexpr float TEST_NOISE_OFFSET = 0.5f;
 class HpaeMixerNodeTest : public testing::Test {
 public:
     void SetUp();
@@ -46,6 +60,135 @@ void HpaeMixerNodeTest::TearDown()
 
 static int32_t g_testValue = 0;
 
+// Writes a different pseudo random signal on every input, so a reordered or repeated mix changes the output bits.
+class WriteNoiseCb : public IStreamCallback {
+public:
+    explicit WriteNoiseCb(uint32_t seed) : seed_(seed)
+    {}
+    int32_t OnStreamData(AudioCallBackStreamInfo &callBackStreamInfo) override
+    {
+        float *data = reinterpret_cast<float *>(callBackStreamInfo.inputData);
+        for (size_t i = 0; i < callBackStreamInfo.requestDataLen / sizeof(float); i++) {
+            seed_ = seed_ * TEST_LCG_MULTIPLIER + TEST_LCG_INCREMENT;
+            data[i] = static_cast<float>(seed_) / static_cast<float>(UINT32_MAX) - TEST_NOISE_OFFSET;
+        }
+        return SUCCESS;
+    }
+
+private:
+    uint32_t seed_ = 0;
+};
+
+static std::vector<float> RenderNoiseMix(const std::shared_ptr<HpaeWorkerPool> &workerPool)
+{
+    HpaeNodeInfo nodeInfo;
+    nodeInfo.nodeId = TEST_ID;
+    nodeInfo.frameLen = TEST_FRAMELEN;
+    nodeInfo.samplingRate = SAMPLE_RATE_48000;
+    nodeInfo.channels = STEREO;
+    nodeInfo.format = SAMPLE_F32LE;
+    std::shared_ptr<HpaeSinkOutputNode> hpaeSinkOutputNode = std::make_shared<HpaeSinkOutputNode>(nodeInfo);
+    std::shared_ptr<HpaeMixerNode> hpaeMixerNode = std::make_shared<HpaeMixerNode>(nodeInfo);
+    hpaeMixerNode->SetWorkerPool(workerPool);
+    std::vector<std::shared_ptr<HpaeSinkInputNode>> sinkInputNodes;
+    std::vector<std::shared_ptr<WriteNoiseCb>> writeCbs;
+    for (int32_t i = 0; i < TEST_INPUT_NUM; i++) {
+        std::shared_ptr<HpaeSinkInputNode> sinkInputNode = std::make_shared<HpaeSinkInputNode>(nodeInfo);
+        writeCbs.push_back(std::make_shared<WriteNoiseCb>(static_cast<uint32_t>(i + 1)));
+        sinkInputNode->RegisterWriteCallback(writeCbs.back());
+        hpaeMixerNode->Connect(sinkInputNode);
+        sinkInputNodes.push_back(sinkInputNode);
+    }
+    hpaeSinkOutputNode->Connect(hpaeMixerNode);
+    EXPECT_EQ(hpaeSinkOutputNode->GetRenderSinkInstance("file_io", "LocalDevice"), 0);
+    std::vector<float> output;
+    const size_t sampleNum = nodeInfo.frameLen * nodeInfo.channels;
+    for (int32_t i = 0; i < TEST_PERIOD_NUM; i++) {
+        hpaeSinkOutputNode->DoProcess();
+        const float *frame = reinterpret_cast<const float *>(hpaeSinkOutputNode->GetRenderFrameData());
+        output.insert(output.end(), frame, frame + sampleNum);
+    }
+    hpaeSinkOutputNode->DisConnect(hpaeMixerNode);
+    for (auto &sinkInputNode : sinkInputNodes) {
+        hpaeMixerNode->DisConnect(sinkInputNode);
+    }
+    return output;
+}
+
+// Records the fade callbacks together with the thread they arrive on.
+class RecordNodeCallback : public INodeCallback {
+public:
+    void OnFadeDone(uint32_t sessionId) override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        fadeDoneSessions_.push_back(sessionId);
+        callbackThreads_.push_back(std::this_thread::get_id());
+    }
+    void OnRequestLatency(uint32_t sessionId, uint64_t &latency) override
+    {
+        latency = 0;
+    }
+    std::mutex mutex_;
+    std::vector<uint32_t> fadeDoneSessions_;
+    std::vector<std::thread::id> callbackThreads_;
+};
+
+// Every input runs through a resampler and a fading gain node, the first one fades out half way through.
+static std::vector<float> RenderEffectMix(const std::shared_ptr<HpaeWorkerPool> &workerPool,
+    const std::shared_ptr<RecordNodeCallback> &nodeCallback)
+{
+    HpaeNodeInfo nodeInfo;
+    nodeInfo.nodeId = TEST_ID;
+    nodeInfo.frameLen = TEST_FRAMELEN;
+    nodeInfo.samplingRate = SAMPLE_RATE_48000;
+    nodeInfo.channels = STEREO;
+    nodeInfo.format = SAMPLE_F32LE;
+    nodeInfo.statusCallback = nodeCallback;
+    std::shared_ptr<HpaeSinkOutputNode> hpaeSinkOutputNode = std::make_shared<HpaeSinkOutputNode>(nodeInfo);
+    std::shared_ptr<HpaeMixerNode> hpaeMixerNode = std::make_shared<HpaeMixerNode>(nodeInfo);
+    hpaeMixerNode->SetWorkerPool(workerPool);
+    std::vector<std::shared_ptr<HpaeSinkInputNode>> sinkInputNodes;
+    std::vector<std::shared_ptr<HpaeAudioFormatConverterNode>> converterNodes;
+    std::vector<std::shared_ptr<HpaeGainNode>> gainNodes;
+    std::vector<std::shared_ptr<WriteNoiseCb>> writeCbs;
+    for (int32_t i = 0; i < TEST_INPUT_NUM; i++) {
+        HpaeNodeInfo streamInfo = nodeInfo;
+        streamInfo.sessionId = TEST_SESSION_ID + static_cast<uint32_t>(i);
+        streamInfo.frameLen = TEST_FRAMELEN_44100;
+        streamInfo.samplingRate = SAMPLE_RATE_44100;
+        HpaeNodeInfo gainInfo = nodeInfo;
+        gainInfo.sessionId = streamInfo.sessionId;
+        sinkInputNodes.push_back(std::make_shared<HpaeSinkInputNode>(streamInfo));
+        writeCbs.push_back(std::make_shared<WriteNoiseCb>(static_cast<uint32_t>(i + 1)));
+        sinkInputNodes.back()->RegisterWriteCallback(writeCbs.back());
+        converterNodes.push_back(std::make_shared<HpaeAudioFormatConverterNode>(streamInfo, gainInfo));
+        converterNodes.back()->Connect(sinkInputNodes.back());
+        gainNodes.push_back(std::make_shared<HpaeGainNode>(gainInfo));
+        gainNodes.back()->Connect(converterNodes.back());
+        gainNodes.back()->SetFadeState(OPERATION_STARTED);
+        hpaeMixerNode->Connect(gainNodes.back());
+    }
+    hpaeSinkOutputNode->Connect(hpaeMixerNode);
+    EXPECT_EQ(hpaeSinkOutputNode->GetRenderSinkInstance("file_io", "LocalDevice"), 0);
+    std::vector<float> output;
+    const size_t sampleNum = nodeInfo.frameLen * nodeInfo.channels;
+    for (int32_t i = 0; i < TEST_PERIOD_NUM; i++) {
+        if (i == TEST_PERIOD_NUM / 2) {
+            gainNodes[0]->SetFadeState(OPERATION_PAUSED);
+        }
+        hpaeSinkOutputNode->DoProcess();
+        const float *frame = reinterpret_cast<const float *>(hpaeSinkOutputNode->GetRenderFrameData());
+        output.insert(output.end(), frame, frame + sampleNum);
+    }
+    hpaeSinkOutputNode->DisConnect(hpaeMixerNode);
+    for (int32_t i = 0; i < TEST_INPUT_NUM; i++) {
+        hpaeMixerNode->DisConnect(gainNodes[i]);
+        gainNodes[i]->DisConnect(converterNodes[i]);
+        converterNodes[i]->DisConnect(sinkInputNodes[i]);
+    }
+    return output;
+}
+
 HWTEST_F(HpaeMixerNodeTest, constructHpaeMixerNode, TestSize.Level0)
 {
     HpaeNodeInfo nodeInfo;
@@ -140,4 +283,91 @@ HWTEST_F(HpaeMixerNodeTest, testMixerConnectWithInfo, TestSize.Level1)
     hpaeMixerNode->DisConnectWithInfo(cluster, hpaeMixerNode->GetNodeInfo());
     EXPECT_EQ(cluster->fmtConverterNodeMap_.size() == 1, true); // not delete convertnode, equal 1
 }
+HWTEST_F(HpaeMixerNodeTest, testMixerParallelInputs, TestSize.Level1)
+{
+    HpaeNodeInfo nodeInfo;
+    nodeInfo.nodeId = TEST_ID;
+    nodeInfo.frameLen = TEST_FRAMELEN;
+    nodeInfo.samplingRate = SAMPLE_RATE_48000;
+    nodeInfo.channels = STEREO;
+    nodeInfo.format = SAMPLE_F32LE;
+    std::shared_ptr<HpaeSinkOutputNode> hpaeSinkOutputNode = std::make_shared<HpaeSinkOutputNode>(nodeInfo);
+    std::shared_ptr<HpaeMixerNode> hpaeMixerNode = std::make_shared<HpaeMixerNode>(nodeInfo);
+    hpaeMixerNode->SetWorkerPool(std::make_shared<HpaeWorkerPool>(TEST_WORKER_NUM, "test"));
+    std::vector<std::shared_ptr<HpaeSinkInputNode>> sinkInputNodes;
+    // the nodes only keep a weak reference to their callbacks
+    std::vector<std::shared_ptr<WriteFixedValueCb>> writeCbs;
+    g_testValue = 0;
+    for (int32_t i = 0; i < TEST_INPUT_NUM; i++) {
+        std::shared_ptr<HpaeSinkInputNode> sinkInputNode = std::make_shared<HpaeSinkInputNode>(nodeInfo);
+        writeCbs.push_back(std::make_shared<WriteFixedValueCb>(SAMPLE_F32LE, TEST_VALUE1 * (i + 1)));
+        sinkInputNode->RegisterWriteCallback(writeCbs.back());
+        g_testValue += TEST_VALUE1 * (i + 1);
+        hpaeMixerNode->Connect(sinkInputNode);
+        sinkInputNodes.push_back(sinkInputNode);
+    }
+    hpaeSinkOutputNode->Connect(hpaeMixerNode);
+    EXPECT_EQ(hpaeSinkOutputNode->GetRenderSinkInstance("file_io", "LocalDevice"), 0);
+    for (int32_t i = 0; i < TEST_PERIOD_NUM; i++) {
+        hpaeSinkOutputNode->DoProcess();
+        TestRendererRenderFrame(hpaeSinkOutputNode->GetRenderFrameData(), nodeInfo.frameLen * nodeInfo.channels *
+            GetSizeFromFormat(nodeInfo.format));
+    }
+    hpaeSinkOutputNode->DisConnect(hpaeMixerNode);
+    for (auto &sinkInputNode : sinkInputNodes) {
+        hpaeMixerNode->DisConnect(sinkInputNode);
+    }
+    EXPECT_EQ(hpaeMixerNode->GetPreOutNum(), 0);
+}
+
+HWTEST_F(HpaeMixerNodeTest, testMixerParallelBitExact, TestSize.Level1)
+{
+    std::vector<float> sequential = RenderNoiseMix(nullptr);
+    std::vector<float> parallel = RenderNoiseMix(std::make_shared<HpaeWorkerPool>(TEST_WORKER_NUM, "test"));
+    ASSERT_EQ(sequential.size(), parallel.size());
+    ASSERT_FALSE(sequential.empty());
+    EXPECT_EQ(memcmp(sequential.data(), parallel.data(), sequential.size() * sizeof(float)), 0);
+}
+
+HWTEST_F(HpaeMixerNodeTest, testMixerParallelEffectsBitExact, TestSize.Level1)
+{
+    std::shared_ptr<RecordNodeCallback> sequentialCb = std::make_shared<RecordNodeCallback>();
+    std::vector<float> sequential = RenderEffectMix(nullptr, sequentialCb);
+    std::shared_ptr<RecordNodeCallback> parallelCb = std::make_shared<RecordNodeCallback>();
+    std::vector<float> parallel =
+        RenderEffectMix(std::make_shared<HpaeWorkerPool>(TEST_WORKER_NUM, "test"), parallelCb);
+    ASSERT_EQ(sequential.size(), parallel.size());
+    ASSERT_FALSE(sequential.empty());
+    EXPECT_EQ(memcmp(sequential.data(), parallel.data(), sequential.size() * sizeof(float)), 0);
+    EXPECT_EQ(sequentialCb->fadeDoneSessions_, std::vector<uint32_t>{TEST_SESSION_ID});
+    EXPECT_EQ(parallelCb->fadeDoneSessions_, sequentialCb->fadeDoneSessions_);
+    // fade callbacks raised on the workers reach the manager on the render thread only
+    for (const auto &threadId : parallelCb->callbackThreads_) {
+        EXPECT_EQ(threadId, std::this_thread::get_id());
+    }
+}
+
+HWTEST_F(HpaeMixerNodeTest, testMixerParallelSharedInput, TestSize.Level1)
+{
+    HpaeNodeInfo nodeInfo;
+    nodeInfo.nodeId = TEST_ID;
+    nodeInfo.frameLen = TEST_FRAMELEN;
+    nodeInfo.samplingRate = SAMPLE_RATE_48000;
+    nodeInfo.channels = STEREO;
+    nodeInfo.format = SAMPLE_F32LE;
+    std::shared_ptr<HpaeMixerNode> hpaeMixerNode = std::make_shared<HpaeMixerNode>(nodeInfo);
+    std::shared_ptr<HpaeMixerNode> otherMixerNode = std::make_shared<HpaeMixerNode>(nodeInfo);
+    std::shared_ptr<HpaeSinkInputNode> sinkInputNode = std::make_shared<HpaeSinkInputNode>(nodeInfo);
+    std::shared_ptr<HpaeSinkInputNode> sharedInputNode = std::make_shared<HpaeSinkInputNode>(nodeInfo);
+    hpaeMixerNode->Connect(sinkInputNode);
+    hpaeMixerNode->Connect(sharedInputNode);
+    EXPECT_TRUE(hpaeMixerNode->CollectDisjointInputs());
+    // a node that also feeds another consumer must not run on a worker
+    otherMixerNode->Connect(sharedInputNode);
+    EXPECT_FALSE(hpaeMixerNode->CollectDisjointInputs());
+    otherMixerNode->DisConnect(sharedInputNode);
+    EXPECT_TRUE(hpaeMixerNode->CollectDisjointInputs());
+    hpaeMixerNode->DisConnect(sinkInputNode);
+    hpaeMixerNode->DisConnect(sharedInputNode);
+}
 } // namespace
\ No newline at end of file
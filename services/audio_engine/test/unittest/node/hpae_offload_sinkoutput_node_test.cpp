@@ -14,6 +14,7 @@
 */
 
 #include "hpae_offload_sinkoutput_node.h"
+#include "hpae_node_common.h"
 #include "hpae_mocks.h"
 #include "test_case_common.h"
 #include "audio_errors.h"
@@ -29,6 +30,57 @@ constexpr int32_t OFFLOAD_FULL = -1;
 constexpr int32_t OFFLOAD_WRITE_FAILED = -2;
 constexpr size_t DATA_SIZE = 1024;
 constexpr uint32_t OFFLOAD_SET_BUFFER_SIZE_NUM = 5;
+constexpr uint64_t TIME_US_PER_MS = 1000;
+constexpr int64_t TIME_NS_PER_SEC = 1000000000;
+constexpr uint64_t TEST_AUDIO_DURATION_US = 60000000; // one minute of audio
+constexpr uint64_t TEST_LOW_WATERMARK_US = 1000000; // hdi calls back when 1s is left
+constexpr uint64_t TEST_BURST_MAX_US = 500000; // OFFLOAD_BURST_MAX_IN_MS
+
+// emulates an offload hdi on a file like sink: data is accepted until the cache is full, then it is played
+// back in simulated time down to the low watermark before the write completed callback
+struct EmulatedOffloadHdi {
+    uint64_t bufferUs = 0;
+    uint64_t cachedUs = 0;
+    uint64_t playedUs = 0;
+    uint32_t renderCount = 0;
+    uint32_t wakeupCount = 0;
+    uint64_t acceptedLen = 0;
+};
+
+class OffloadTestSourceNode : public OutputNode<HpaePcmBuffer *> {
+public:
+    explicit OffloadTestSourceNode(HpaeNodeInfo &nodeInfo)
+        : HpaeNode(nodeInfo), outputStream_(this),
+          pcmBufferInfo_(nodeInfo.channels, nodeInfo.frameLen, nodeInfo.samplingRate),
+          outputBuffer_(pcmBufferInfo_)
+    {}
+    void DoProcess() override
+    {
+        processCount++;
+        outputStream_.WriteDataToOutput(&outputBuffer_);
+    }
+    bool Reset() override
+    {
+        return true;
+    }
+    bool ResetAll() override
+    {
+        return true;
+    }
+    std::shared_ptr<HpaeNode> GetSharedInstance() override
+    {
+        return shared_from_this();
+    }
+    OutputPort<HpaePcmBuffer *> *GetOutputPort() override
+    {
+        return &outputStream_;
+    }
+    uint64_t processCount = 0;
+private:
+    OutputPort<HpaePcmBuffer *> outputStream_;
+    PcmBufferInfo pcmBufferInfo_;
+    HpaePcmBuffer outputBuffer_;
+};
 class HpaeOffloadSinkOutputNodeTest : public testing::Test {
 public:
     void SetUp() override;
@@ -196,22 +248,34 @@ HWTEST_F(HpaeOffloadSinkOutputNodeTest, ProcessRenderFrame_RenderFailure_Returns
     EXPECT_EQ(result, OFFLOAD_WRITE_FAILED);
 }
 
-// Test partial write returns failure
-HWTEST_F(HpaeOffloadSinkOutputNodeTest, ProcessRenderFrame_PartialWrite_ReturnsFailure, TestSize.Level0)
+// Test partial write keeps the rest for the next write instead of sending the accepted part again
+HWTEST_F(HpaeOffloadSinkOutputNodeTest, ProcessRenderFrame_PartialWrite_KeepsRest, TestSize.Level0)
 {
     // Set non-empty data
     offloadNode_->renderFrameData_ = std::vector<char>(DATA_SIZE, 0);
-    
-    // Mock partial write
+    offloadNode_->firstWriteHdi_ = false;
+    const char *rest = offloadNode_->renderFrameData_.data() + DATA_SIZE / 2;
+
+    // Mock partial write, then hdi takes the rest
     EXPECT_CALL(*mockSink_, RenderFrame(_, _, _))
         .WillOnce([](char &data, size_t size, uint64_t &written) {
             written = DATA_SIZE / 2; // Half data written
             return SUCCESS;
+        })
+        .WillOnce([rest](char &data, size_t size, uint64_t &written) {
+            EXPECT_EQ(&data, rest);
+            EXPECT_EQ(size, DATA_SIZE / 2);
+            written = size;
+            return SUCCESS;
         });
-    // Execute function
-    int32_t result = offloadNode_->ProcessRenderFrame();
-    // Verify failure returned
-    EXPECT_EQ(result, OFFLOAD_WRITE_FAILED);
+    // hdi is full until it plays down
+    EXPECT_EQ(offloadNode_->ProcessRenderFrame(), OFFLOAD_FULL);
+    EXPECT_EQ(offloadNode_->renderOffset_, DATA_SIZE / 2);
+    EXPECT_EQ(offloadNode_->GetLatency(), ConvertDatalenToUs(DATA_SIZE / 2, offloadNode_->GetNodeInfo()));
+    // Only the rest is written
+    EXPECT_EQ(offloadNode_->ProcessRenderFrame(), SUCCESS);
+    EXPECT_TRUE(offloadNode_->renderFrameData_.empty());
+    EXPECT_EQ(offloadNode_->renderOffset_, 0u);
 }
 
 // Test first successful write initializes state
@@ -261,6 +325,68 @@ HWTEST_F(HpaeOffloadSinkOutputNodeTest, ProcessRenderFrame_SubsequentWrite_Updat
     EXPECT_GT(offloadNode_->writePos_, 1000); // Write position increased
     EXPECT_TRUE(offloadNode_->renderFrameData_.empty()); // Data cleared
 }
+
+// Test burst rendering keeps hdi writes and thread wakeups low for one minute of background playback
+HWTEST_F(HpaeOffloadSinkOutputNodeTest, DoProcess_BurstRender_FewWakeupsPerMinute, TestSize.Level0)
+{
+    HpaeNodeInfo nodeInfo = offloadNode_->GetNodeInfo();
+    auto sourceNode = std::make_shared<OffloadTestSourceNode>(nodeInfo);
+    offloadNode_->Connect(sourceNode);
+    offloadNode_->hdiPolicyState_ = OFFLOAD_INACTIVE_BACKGROUND;
+
+    EmulatedOffloadHdi hdi;
+    ON_CALL(*mockSink_, SetBufferSize(_)).WillByDefault([&hdi](uint32_t sizeMs) {
+        hdi.bufferUs = sizeMs * TIME_US_PER_MS;
+        return SUCCESS;
+    });
+    ON_CALL(*mockSink_, RenderFrame(_, _, _)).WillByDefault(
+        [&hdi, nodeInfo](char &data, uint64_t len, uint64_t &writeLen) {
+            hdi.renderCount++;
+            uint64_t lenUs = ConvertDatalenToUs(len, nodeInfo);
+            uint64_t freeUs = hdi.cachedUs < hdi.bufferUs ? hdi.bufferUs - hdi.cachedUs : 0;
+            writeLen = len;
+            if (hdi.bufferUs != 0 && lenUs > freeUs) {
+                // takes the whole frames that fit
+                uint64_t frameSize = nodeInfo.channels * GetSizeFromFormat(nodeInfo.format);
+                writeLen = len * freeUs / lenUs / frameSize * frameSize;
+            }
+            hdi.cachedUs += ConvertDatalenToUs(writeLen, nodeInfo);
+            hdi.acceptedLen += writeLen;
+            return SUCCESS;
+        });
+    ON_CALL(*mockSink_, GetPresentationPosition(_, _, _)).WillByDefault(
+        [&hdi](uint64_t &frames, int64_t &timeSec, int64_t &timeNanoSec) {
+            auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+            frames = hdi.playedUs;
+            timeSec = now / TIME_NS_PER_SEC;
+            timeNanoSec = now % TIME_NS_PER_SEC;
+            return SUCCESS;
+        });
+
+    while (hdi.playedUs < TEST_AUDIO_DURATION_US) {
+        offloadNode_->DoProcess();
+        if (offloadNode_->isHdiFull_.load()) {
+            // manager thread is parked here until hdi plays down to the low watermark
+            uint64_t playLen = hdi.cachedUs > TEST_LOW_WATERMARK_US ? hdi.cachedUs - TEST_LOW_WATERMARK_US : 0;
+            hdi.playedUs += playLen;
+            hdi.cachedUs -= playLen;
+            hdi.wakeupCount++;
+            offloadNode_->OffloadCallback(CB_NONBLOCK_WRITE_COMPLETED);
+        }
+    }
+
+    uint64_t refillUs = hdi.bufferUs - TEST_LOW_WATERMARK_US;
+    uint64_t maxWakeups = TEST_AUDIO_DURATION_US / refillUs + 1;
+    EXPECT_LE(hdi.wakeupCount, maxWakeups);
+    // every refill takes full bursts, one partial burst and the write that finds hdi full
+    EXPECT_LE(hdi.renderCount, maxWakeups * (refillUs / TEST_BURST_MAX_US + 2));
+    // every frame read from the source reaches hdi once, or is still pending in the node
+    uint64_t frameSize = nodeInfo.frameLen * nodeInfo.channels * GetSizeFromFormat(nodeInfo.format);
+    EXPECT_EQ(hdi.acceptedLen + offloadNode_->renderFrameData_.size() - offloadNode_->renderOffset_,
+        sourceNode->processCount * frameSize);
+    offloadNode_->DisConnect(sourceNode);
+}
 } // namespace HPAE
 } // namespace AudioStandard
 } // namespace OHOS
\ No newline at end of file
@@ -25,6 +25,8 @@ namespace OHOS {
 namespace AudioStandard {
 namespace HPAE {
 constexpr uint32_t TEST_BUFFER_LEN = 10;
+constexpr uint32_t TEST_FRAME_LEN = 37; // not a multiple of the simd width
+constexpr float TEST_HALF_SCALE = 0.5f;
 constexpr bool MIX_FLE = true;
 // need full audio channel layouts to cover all cases during setting up downmix table -- first part
 constexpr static AudioChannelLayout FIRST_PART_CH_LAYOUTS = static_cast<AudioChannelLayout> (
@@ -242,6 +244,54 @@ HWTEST_F(ChannelConverterTest, ChannelConverterNormalizationTest_001, TestSize.L
     EXPECT_EQ(channelConverter.downmixNormalizing_, true);
     EXPECT_EQ(channelConverter.downMixer_.normalizing_, true);
 }
+
+/**
+ * @tc.name : Test Process API
+ * @tc.type : FUNC
+ * @tc.number : ChannelConverterProcessTest_003
+ * @tc.desc : Test Process with fixed channel kernels and sparse kernel against the dense mix table
+*/
+HWTEST_F(ChannelConverterTest, ChannelConverterProcessTest_003, TestSize.Level0)
+{
+    const std::vector<std::pair<AudioChannelLayout, AudioChannelLayout>> layoutPairs = {
+        {CH_LAYOUT_MONO, CH_LAYOUT_STEREO},
+        {CH_LAYOUT_STEREO, CH_LAYOUT_MONO},
+        {CH_LAYOUT_5POINT1, CH_LAYOUT_STEREO},
+        {CH_LAYOUT_7POINT1, CH_LAYOUT_STEREO},
+        {CH_LAYOUT_7POINT1POINT4, CH_LAYOUT_5POINT1},
+        {CH_LAYOUT_5POINT1POINT2, CH_LAYOUT_QUAD},
+        {CH_LAYOUT_STEREO, CH_LAYOUT_5POINT1},
+    };
+    for (const auto &layoutPair : layoutPairs) {
+        AudioChannelInfo inChannelInfo = {layoutPair.first, BitCounts(layoutPair.first)};
+        AudioChannelInfo outChannelInfo = {layoutPair.second, BitCounts(layoutPair.second)};
+        ChannelConverter channelConverter;
+        EXPECT_EQ(channelConverter.SetParam(inChannelInfo, outChannelInfo, SAMPLE_F32LE, MIX_FLE), MIX_ERR_SUCCESS);
+        float mixTable[MAX_CHANNELS][MAX_CHANNELS] = {{0}};
+        channelConverter.GetMixTable(mixTable);
+
+        uint32_t inChannels = inChannelInfo.numChannels;
+        uint32_t outChannels = outChannelInfo.numChannels;
+        std::vector<float> in(TEST_FRAME_LEN * inChannels);
+        for (size_t i = 0; i < in.size(); i++) {
+            in[i] = static_cast<float>(i % TEST_BUFFER_LEN) / TEST_BUFFER_LEN - TEST_HALF_SCALE;
+        }
+        std::vector<float> out(TEST_FRAME_LEN * outChannels, 0.0f);
+        EXPECT_EQ(channelConverter.Process(TEST_FRAME_LEN, in.data(), in.size() * sizeof(float), out.data(),
+            out.size() * sizeof(float)), MIX_ERR_SUCCESS);
+
+        bool isDmix = inChannels >= outChannels;
+        for (uint32_t frame = 0; frame < TEST_FRAME_LEN; frame++) {
+            for (uint32_t i = 0; i < outChannels; i++) {
+                float expect = 0.0f;
+                for (uint32_t j = 0; j < inChannels; j++) {
+                    expect += in[frame * inChannels + j] * (isDmix ? mixTable[i][j] : mixTable[j][i]);
+                }
+                EXPECT_FLOAT_EQ(out[frame * outChannels + i], expect);
+            }
+        }
+    }
+}
 }  // namespace HPAE
 }  // namespace AudioStandard
 }  // namespace OHOS
\ No newline at end of file
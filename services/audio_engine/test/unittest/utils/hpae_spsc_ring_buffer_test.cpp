@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "hpae_spsc_ring_buffer.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace testing::ext;
+using namespace testing;
+
+namespace OHOS {
+namespace AudioStandard {
+namespace HPAE {
+
+static constexpr size_t TEST_CACHE_SIZE = 16;
+static constexpr size_t TEST_DATA_SIZE = 10;
+static constexpr size_t STRESS_CACHE_SIZE = 4096;
+static constexpr size_t STRESS_FRAME_SIZE = 384; // not a divisor of the cache size, forces wrapped copies
+static constexpr uint32_t STRESS_FRAME_COUNT = 200000;
+
+class HpaeSpscRingBufferTest : public ::testing::Test {};
+
+static std::vector<uint8_t> MakeData(size_t size, uint8_t seed)
+{
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<uint8_t>(seed + i);
+    }
+    return data;
+}
+
+HWTEST_F(HpaeSpscRingBufferTest, createInvalidSize, TestSize.Level0)
+{
+    EXPECT_EQ(HpaeSpscRingBuffer::Create(0), nullptr);
+    EXPECT_NE(HpaeSpscRingBuffer::Create(TEST_CACHE_SIZE), nullptr);
+}
+
+HWTEST_F(HpaeSpscRingBufferTest, enqueueDequeueWrapAround, TestSize.Level0)
+{
+    std::unique_ptr<HpaeSpscRingBuffer> ring = HpaeSpscRingBuffer::Create(TEST_CACHE_SIZE);
+    ASSERT_NE(ring, nullptr);
+    std::vector<uint8_t> out(TEST_DATA_SIZE);
+    for (uint8_t round = 0; round < TEST_CACHE_SIZE; ++round) {
+        std::vector<uint8_t> in = MakeData(TEST_DATA_SIZE, round);
+        EXPECT_EQ(ring->Enqueue({in.data(), in.size()}).ret, OPERATION_SUCCESS);
+        EXPECT_EQ(ring->GetReadableSize().size, TEST_DATA_SIZE);
+        EXPECT_EQ(ring->GetWritableSize().size, TEST_CACHE_SIZE - TEST_DATA_SIZE);
+        EXPECT_EQ(ring->Dequeue({out.data(), out.size()}).ret, OPERATION_SUCCESS);
+        EXPECT_EQ(in, out);
+    }
+}
+
+HWTEST_F(HpaeSpscRingBufferTest, enqueueFullDequeueEmpty, TestSize.Level0)
+{
+    std::unique_ptr<HpaeSpscRingBuffer> ring = HpaeSpscRingBuffer::Create(TEST_CACHE_SIZE);
+    ASSERT_NE(ring, nullptr);
+    std::vector<uint8_t> in = MakeData(TEST_DATA_SIZE, 0);
+    EXPECT_EQ(ring->Enqueue({in.data(), in.size()}).ret, OPERATION_SUCCESS);
+    OptResult result = ring->Enqueue({in.data(), in.size()});
+    EXPECT_EQ(result.ret, INDEX_OUT_OF_RANGE);
+    EXPECT_EQ(result.size, TEST_CACHE_SIZE - TEST_DATA_SIZE);
+
+    std::vector<uint8_t> out(TEST_CACHE_SIZE);
+    result = ring->Dequeue({out.data(), out.size()});
+    EXPECT_EQ(result.ret, DATA_INSUFFICIENT);
+    EXPECT_EQ(result.size, TEST_DATA_SIZE);
+    EXPECT_EQ(ring->Dequeue({nullptr, TEST_DATA_SIZE}).ret, INVALID_PARAMS);
+}
+
+HWTEST_F(HpaeSpscRingBufferTest, resetBufferDropsQueuedData, TestSize.Level0)
+{
+    std::unique_ptr<HpaeSpscRingBuffer> ring = HpaeSpscRingBuffer::Create(TEST_CACHE_SIZE);
+    ASSERT_NE(ring, nullptr);
+    std::vector<uint8_t> in = MakeData(TEST_DATA_SIZE, 0);
+    EXPECT_EQ(ring->Enqueue({in.data(), in.size()}).ret, OPERATION_SUCCESS);
+    ring->ResetBuffer();
+    EXPECT_EQ(ring->GetReadableSize().size, 0);
+    EXPECT_EQ(ring->GetWritableSize().size, TEST_CACHE_SIZE);
+
+    std::vector<uint8_t> next = MakeData(TEST_DATA_SIZE, 1);
+    EXPECT_EQ(ring->Enqueue({next.data(), next.size()}).ret, OPERATION_SUCCESS);
+    std::vector<uint8_t> out(TEST_DATA_SIZE);
+    EXPECT_EQ(ring->Dequeue({out.data(), out.size()}).ret, OPERATION_SUCCESS);
+    EXPECT_EQ(next, out);
+}
+
+// every frame must arrive once, in order and untorn; hpae_spsc_ring_buffer_tsan_test runs it under tsan
+HWTEST_F(HpaeSpscRingBufferTest, producerConsumerStress, TestSize.Level1)
+{
+    std::unique_ptr<HpaeSpscRingBuffer> ring = HpaeSpscRingBuffer::Create(STRESS_CACHE_SIZE);
+    ASSERT_NE(ring, nullptr);
+    std::atomic<bool> corrupted = false;
+
+    std::thread producer([&ring]() {
+        std::vector<uint8_t> frame(STRESS_FRAME_SIZE);
+        for (uint32_t i = 0; i < STRESS_FRAME_COUNT;) {
+            std::fill(frame.begin(), frame.end(), static_cast<uint8_t>(i));
+            if (ring->Enqueue({frame.data(), frame.size()}).ret == OPERATION_SUCCESS) {
+                ++i;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+    std::thread consumer([&ring, &corrupted]() {
+        std::vector<uint8_t> frame(STRESS_FRAME_SIZE);
+        for (uint32_t i = 0; i < STRESS_FRAME_COUNT;) {
+            if (ring->Dequeue({frame.data(), frame.size()}).ret != OPERATION_SUCCESS) {
+                std::this_thread::yield();
+                continue;
+            }
+            for (uint8_t value : frame) {
+                if (value != static_cast<uint8_t>(i)) {
+                    corrupted = true;
+                }
+            }
+            ++i;
+        }
+    });
+    producer.join();
+    consumer.join();
+
+    EXPECT_FALSE(corrupted.load());
+    EXPECT_EQ(ring->GetReadableSize().size, 0);
+}
+}  // namespace HPAE
+}  // namespace AudioStandard
+}  // namespace OHOS
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "hpae_worker_pool.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace testing::ext;
+using namespace testing;
+
+namespace OHOS {
+namespace AudioStandard {
+namespace HPAE {
+
+static constexpr uint32_t TEST_WORKER_NUM = 3;
+static constexpr size_t TEST_TASK_NUM = 6;
+static constexpr uint32_t STRESS_ROUND_NUM = 10000;
+
+class HpaeWorkerPoolTest : public ::testing::Test {};
+
+HWTEST_F(HpaeWorkerPoolTest, runAllTasksOnce, TestSize.Level0)
+{
+    HpaeWorkerPool pool(TEST_WORKER_NUM, "test");
+    EXPECT_EQ(pool.GetWorkerNum(), TEST_WORKER_NUM);
+    std::vector<std::atomic<uint32_t>> runCount(TEST_TASK_NUM);
+    pool.Run(TEST_TASK_NUM, [&runCount](size_t index) {
+        runCount[index].fetch_add(1);
+    });
+    for (size_t i = 0; i < TEST_TASK_NUM; ++i) {
+        EXPECT_EQ(runCount[i].load(), 1);
+    }
+}
+
+HWTEST_F(HpaeWorkerPoolTest, runWithoutWorkers, TestSize.Level0)
+{
+    HpaeWorkerPool pool(0, "test");
+    std::vector<size_t> order;
+    pool.Run(TEST_TASK_NUM, [&order](size_t index) {
+        order.push_back(index);
+    });
+    ASSERT_EQ(order.size(), TEST_TASK_NUM);
+    for (size_t i = 0; i < TEST_TASK_NUM; ++i) {
+        EXPECT_EQ(order[i], i);
+    }
+    pool.Run(0, [&order](size_t index) {
+        order.push_back(index);
+    });
+    EXPECT_EQ(order.size(), TEST_TASK_NUM);
+}
+
+HWTEST_F(HpaeWorkerPoolTest, runUsesWorkers, TestSize.Level1)
+{
+    HpaeWorkerPool pool(TEST_WORKER_NUM, "test");
+    std::atomic<uint32_t> arrived = 0;
+    std::thread::id caller = std::this_thread::get_id();
+    std::atomic<bool> ranOnWorker = false;
+    // every task waits for all others, this only finishes if they really run side by side
+    pool.Run(TEST_WORKER_NUM + 1, [&](size_t index) {
+        arrived.fetch_add(1);
+        while (arrived.load() < TEST_WORKER_NUM + 1) {
+            std::this_thread::yield();
+        }
+        if (std::this_thread::get_id() != caller) {
+            ranOnWorker.store(true);
+        }
+    });
+    EXPECT_TRUE(ranOnWorker.load());
+}
+
+HWTEST_F(HpaeWorkerPoolTest, stressRepeatedRun, TestSize.Level1)
+{
+    HpaeWorkerPool pool(TEST_WORKER_NUM, "test");
+    std::vector<uint32_t> slots(TEST_TASK_NUM, 0);
+    for (uint32_t round = 0; round < STRESS_ROUND_NUM; ++round) {
+        // the task is a fresh closure every round, a late worker must never call a stale one
+        uint32_t expect = round + 1;
+        pool.Run(TEST_TASK_NUM, [&slots, expect](size_t index) {
+            slots[index] = expect;
+        });
+        for (size_t i = 0; i < TEST_TASK_NUM; ++i) {
+            ASSERT_EQ(slots[i], expect);
+        }
+    }
+}
+}  // namespace HPAE
+}  // namespace AudioStandard
+}  // namespace OHOS
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LOG_TAG
+#define LOG_TAG "HpaeSpscRingBuffer"
+#endif
+
+#include "hpae_spsc_ring_buffer.h"
+#include <algorithm>
+#include "securec.h"
+#include "audio_engine_log.h"
+
+namespace OHOS {
+namespace AudioStandard {
+namespace HPAE {
+static constexpr size_t MAX_CACHE_SIZE = 16 * 1024 * 1024; // 16M
+
+std::unique_ptr<HpaeSpscRingBuffer> HpaeSpscRingBuffer::Create(size_t cacheSize)
+{
+    CHECK_AND_RETURN_RET_LOG(cacheSize > 0 && cacheSize <= MAX_CACHE_SIZE, nullptr,
+        "Create failed: invalid size:%{public}zu", cacheSize);
+    std::unique_ptr<HpaeSpscRingBuffer> ringBuffer = std::make_unique<HpaeSpscRingBuffer>(cacheSize);
+    CHECK_AND_RETURN_RET_LOG(ringBuffer->basePtr_ != nullptr, nullptr, "Create failed: no memory");
+    return ringBuffer;
+}
+
+HpaeSpscRingBuffer::HpaeSpscRingBuffer(size_t cacheSize)
+    : basePtr_(std::make_unique<uint8_t[]>(cacheSize)), cacheSize_(cacheSize)
+{
+    AUDIO_INFO_LOG("HpaeSpscRingBuffer() with cacheSize:%{public}zu", cacheSize);
+}
+
+size_t HpaeSpscRingBuffer::GetCacheSize() const
+{
+    return cacheSize_;
+}
+
+OptResult HpaeSpscRingBuffer::GetWritableSize()
+{
+    // the producer owns writeIndex_, only readIndex_ needs to be synchronized
+    const uint64_t writeIndex = writeIndex_.load(std::memory_order_relaxed);
+    const uint64_t readIndex = readIndex_.load(std::memory_order_acquire);
+    return {OPERATION_SUCCESS, cacheSize_ - static_cast<size_t>(writeIndex - readIndex)};
+}
+
+OptResult HpaeSpscRingBuffer::Enqueue(const BufferWrap &buffer)
+{
+    CHECK_AND_RETURN_RET_LOG(buffer.dataPtr != nullptr && buffer.dataSize > 0 && buffer.dataSize <= cacheSize_,
+        OptResult({INVALID_PARAMS, 0}), "Enqueue failed: invalid buffer, size %{public}zu", buffer.dataSize);
+    OptResult result = GetWritableSize();
+    if (buffer.dataSize > result.size) {
+        return {INDEX_OUT_OF_RANGE, result.size};
+    }
+
+    const uint64_t writeIndex = writeIndex_.load(std::memory_order_relaxed);
+    const size_t offset = static_cast<size_t>(writeIndex % cacheSize_);
+    const size_t headSize = std::min(buffer.dataSize, cacheSize_ - offset);
+    const size_t tailSize = buffer.dataSize - headSize;
+    CHECK_AND_RETURN_RET_LOG(memcpy_s(basePtr_.get() + offset, cacheSize_ - offset, buffer.dataPtr, headSize) == EOK,
+        OptResult({OPERATION_FAILED, result.size}), "Enqueue memcpy_s failed");
+    if (tailSize > 0) {
+        CHECK_AND_RETURN_RET_LOG(memcpy_s(basePtr_.get(), cacheSize_, buffer.dataPtr + headSize, tailSize) == EOK,
+            OptResult({OPERATION_FAILED, result.size}), "Enqueue memcpy_s failed");
+    }
+    // publish the data to the consumer
+    writeIndex_.store(writeIndex + buffer.dataSize, std::memory_order_release);
+    return {OPERATION_SUCCESS, buffer.dataSize};
+}
+
+void HpaeSpscRingBuffer::ResetBuffer()
+{
+    // the consumer owns readIndex_, so only mark the position it has to skip to
+    dropIndex_.store(writeIndex_.load(std::memory_order_relaxed), std::memory_order_release);
+}
+
+uint64_t HpaeSpscRingBuffer::SkipDroppedData()
+{
+    uint64_t readIndex = readIndex_.load(std::memory_order_relaxed);
+    const uint64_t dropIndex = dropIndex_.load(std::memory_order_acquire);
+    if (dropIndex > readIndex) {
+        readIndex = dropIndex;
+        readIndex_.store(readIndex, std::memory_order_release);
+    }
+    return readIndex;
+}
+
+OptResult HpaeSpscRingBuffer::GetReadableSize()
+{
+    const uint64_t readIndex = SkipDroppedData();
+    const uint64_t writeIndex = writeIndex_.load(std::memory_order_acquire);
+    return {OPERATION_SUCCESS, static_cast<size_t>(writeIndex - readIndex)};
+}
+
+OptResult HpaeSpscRingBuffer::Dequeue(const BufferWrap &buffer)
+{
+    CHECK_AND_RETURN_RET_LOG(buffer.dataPtr != nullptr && buffer.dataSize > 0 && buffer.dataSize <= cacheSize_,
+        OptResult({INVALID_PARAMS, 0}), "Dequeue failed: invalid buffer, size %{public}zu", buffer.dataSize);
+    OptResult result = GetReadableSize();
+    if (buffer.dataSize > result.size) {
+        return {DATA_INSUFFICIENT, result.size};
+    }
+
+    const uint64_t readIndex = readIndex_.load(std::memory_order_relaxed);
+    const size_t offset = static_cast<size_t>(readIndex % cacheSize_);
+    const size_t headSize = std::min(buffer.dataSize, cacheSize_ - offset);
+    const size_t tailSize = buffer.dataSize - headSize;
+    CHECK_AND_RETURN_RET_LOG(memcpy_s(buffer.dataPtr, buffer.dataSize, basePtr_.get() + offset, headSize) == EOK,
+        OptResult({OPERATION_FAILED, result.size}), "Dequeue memcpy_s failed");
+    if (tailSize > 0) {
+        CHECK_AND_RETURN_RET_LOG(memcpy_s(buffer.dataPtr + headSize, tailSize, basePtr_.get(), tailSize) == EOK,
+            OptResult({OPERATION_FAILED, result.size}), "Dequeue memcpy_s failed");
+    }
+    // hand the space back to the producer
+    readIndex_.store(readIndex + buffer.dataSize, std::memory_order_release);
+    return {OPERATION_SUCCESS, buffer.dataSize};
+}
+}  // namespace HPAE
+}  // namespace AudioStandard
+}  // namespace OHOS
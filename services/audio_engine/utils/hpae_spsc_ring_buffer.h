@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef HPAE_SPSC_RING_BUFFER_H
+#define HPAE_SPSC_RING_BUFFER_H
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include "audio_ring_cache.h"
+
+namespace OHOS {
+namespace AudioStandard {
+namespace HPAE {
+constexpr size_t HPAE_CACHE_LINE_SIZE = 64;
+
+/**
+ * Wait-free byte ring for exactly one producer thread and one consumer thread.
+ * Interface follows AudioRingCache so it can stand in for it on links between two manager threads.
+ * Producer side: GetWritableSize, Enqueue, ResetBuffer. Consumer side: GetReadableSize, Dequeue.
+ * Read and write indexes grow monotonically and live on separate cache lines, no lock is taken.
+ */
+class HpaeSpscRingBuffer {
+public:
+    static std::unique_ptr<HpaeSpscRingBuffer> Create(size_t cacheSize);
+    explicit HpaeSpscRingBuffer(size_t cacheSize);
+    ~HpaeSpscRingBuffer() = default;
+
+    size_t GetCacheSize() const;
+
+    // Writable size seen by the producer, data dropped by ResetBuffer counts until the consumer skips it.
+    OptResult GetWritableSize();
+
+    // Writes the whole buffer or nothing.
+    OptResult Enqueue(const BufferWrap &buffer);
+
+    // Drops everything enqueued so far, the consumer skips it on its next call.
+    void ResetBuffer();
+
+    OptResult GetReadableSize();
+
+    // Reads exactly buffer.dataSize bytes or nothing.
+    OptResult Dequeue(const BufferWrap &buffer);
+
+private:
+    uint64_t SkipDroppedData();
+
+    std::unique_ptr<uint8_t[]> basePtr_ = nullptr;
+    size_t cacheSize_ = 0;
+    alignas(HPAE_CACHE_LINE_SIZE) std::atomic<uint64_t> writeIndex_ = 0;
+    alignas(HPAE_CACHE_LINE_SIZE) std::atomic<uint64_t> readIndex_ = 0;
+    alignas(HPAE_CACHE_LINE_SIZE) std::atomic<uint64_t> dropIndex_ = 0;
+};
+}  // namespace HPAE
+}  // namespace AudioStandard
+}  // namespace OHOS
+#endif
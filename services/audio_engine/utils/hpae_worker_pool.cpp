@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LOG_TAG
+#define LOG_TAG "HpaeWorkerPool"
+#endif
+
+#include "hpae_worker_pool.h"
+#include <pthread.h>
+#include "audio_engine_log.h"
+
+namespace OHOS {
+namespace AudioStandard {
+namespace HPAE {
+HpaeWorkerPool::HpaeWorkerPool(uint32_t workerNum, const std::string &name, ThreadInitFunc threadInit)
+{
+    workers_.reserve(workerNum);
+    for (uint32_t i = 0; i < workerNum; i++) {
+        workers_.emplace_back([this, threadInit]() { WorkerLoop(threadInit); });
+        std::string threadName = name + std::to_string(i);
+        pthread_setname_np(workers_.back().native_handle(), threadName.c_str());
+    }
+    AUDIO_INFO_LOG("%{public}s created with %{public}u workers", name.c_str(), workerNum);
+}
+
+HpaeWorkerPool::~HpaeWorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    workCv_.notify_all();
+    for (std::thread &worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+uint32_t HpaeWorkerPool::GetWorkerNum() const
+{
+    return static_cast<uint32_t>(workers_.size());
+}
+
+void HpaeWorkerPool::Run(size_t taskCount, const TaskFunc &task)
+{
+    if (workers_.empty() || taskCount <= 1) {
+        for (size_t i = 0; i < taskCount; i++) {
+            task(i);
+        }
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &task;
+        taskCount_ = taskCount;
+        nextTask_.store(0);
+        generation_++;
+    }
+    workCv_.notify_all();
+    RunTasks(task, taskCount);
+
+    // every task is claimed once the caller runs dry, wait for the workers still inside one
+    std::unique_lock<std::mutex> lock(mutex_);
+    doneCv_.wait(lock, [this] { return activeWorkers_ == 0; });
+    // a worker waking up late must not pick up a task that is about to go out of scope
+    task_ = nullptr;
+}
+
+void HpaeWorkerPool::RunTasks(const TaskFunc &task, size_t taskCount)
+{
+    for (size_t i = nextTask_.fetch_add(1); i < taskCount; i = nextTask_.fetch_add(1)) {
+        task(i);
+    }
+}
+
+void HpaeWorkerPool::WorkerLoop(const ThreadInitFunc &threadInit)
+{
+    if (threadInit != nullptr) {
+        threadInit();
+    }
+    uint64_t seenGeneration = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        workCv_.wait(lock, [this, seenGeneration] {
+            return !running_ || (task_ != nullptr && generation_ != seenGeneration);
+        });
+        if (!running_) {
+            break;
+        }
+        seenGeneration = generation_;
+        const TaskFunc *task = task_;
+        size_t taskCount = taskCount_;
+        activeWorkers_++;
+        lock.unlock();
+        RunTasks(*task, taskCount);
+        lock.lock();
+        if (--activeWorkers_ == 0) {
+            doneCv_.notify_one();
+        }
+    }
+}
+}  // namespace HPAE
+}  // namespace AudioStandard
+}  // namespace OHOS
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPAE_WORKER_POOL_H
+#define HPAE_WORKER_POOL_H
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace OHOS {
+namespace AudioStandard {
+namespace HPAE {
+/**
+ * Small fixed pool that lets the render thread fan out independent per-period work. The calling thread takes
+ * part in the work and Run returns only after every task finished, so results are joined before the caller
+ * continues and no task outlives the period it was issued in.
+ */
+class HpaeWorkerPool {
+public:
+    using ThreadInitFunc = std::function<void()>;
+    using TaskFunc = std::function<void(size_t)>;
+
+    // threadInit runs once on every worker before it takes tasks, e.g. to raise its qos to the caller's level
+    HpaeWorkerPool(uint32_t workerNum, const std::string &name, ThreadInitFunc threadInit = nullptr);
+    ~HpaeWorkerPool();
+    HpaeWorkerPool(const HpaeWorkerPool &) = delete;
+    HpaeWorkerPool &operator=(const HpaeWorkerPool &) = delete;
+
+    // Runs task(0) .. task(taskCount - 1) and blocks until all are done. Not reentrant, one caller at a time.
+    void Run(size_t taskCount, const TaskFunc &task);
+    uint32_t GetWorkerNum() const;
+
+private:
+    void WorkerLoop(const ThreadInitFunc &threadInit);
+    void RunTasks(const TaskFunc &task, size_t taskCount);
+
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable workCv_;
+    std::condition_variable doneCv_;
+    const TaskFunc *task_ = nullptr;
+    size_t taskCount_ = 0;
+    std::atomic<size_t> nextTask_ = 0;
+    uint64_t generation_ = 0;
+    uint32_t activeWorkers_ = 0;
+    bool running_ = true;
+};
+}  // namespace HPAE
+}  // namespace AudioStandard
+}  // namespace OHOS
+#endif
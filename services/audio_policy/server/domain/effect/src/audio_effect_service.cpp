@@ -21,6 +21,7 @@
 
 #include "audio_device_type.h"
 #include "audio_effect_map.h"
+#include "audio_config_preloader.h"
 
 namespace OHOS {
 namespace AudioStandard {
@@ -73,9 +74,12 @@ AudioEffectService::~AudioEffectService()
 void AudioEffectService::EffectServiceInit()
 {
     AUDIO_INFO_LOG("In");
-    // load XML
-    std::unique_ptr<AudioEffectConfigParser> effectConfigParser = std::make_unique<AudioEffectConfigParser>();
-    int32_t ret = effectConfigParser->LoadEffectConfig(oriEffectConfig_);
+    // load XML, unless it was already parsed at policy server start
+    int32_t ret = ERROR;
+    if (!AudioConfigPreloader::GetInstance().TakeEffectConfig(oriEffectConfig_, ret)) {
+        std::unique_ptr<AudioEffectConfigParser> effectConfigParser = std::make_unique<AudioEffectConfigParser>();
+        ret = effectConfigParser->LoadEffectConfigWithCache(oriEffectConfig_);
+    }
     CHECK_AND_RETURN_LOG(ret == 0, "AudioEffectService->effectConfigParser failed: %{public}d", ret);
     AUDIO_INFO_LOG("Out");
 }
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ST_AUDIO_FOCUS_MATRIX_H
+#define ST_AUDIO_FOCUS_MATRIX_H
+
+#include <map>
+#include <vector>
+
+#include "audio_interrupt_info.h"
+
+namespace OHOS {
+namespace AudioStandard {
+
+/**
+ * Dense form of the focus config map. Every focus type found in the config gets a small index, and the entries
+ * are stored in a square table indexed by (existing, incoming), so a lookup costs two array reads instead of a
+ * tree search on a pair of focus types. Like the map, a focus type is identified by stream type and source type.
+ */
+class AudioFocusMatrix {
+public:
+    void Build(const std::map<std::pair<AudioFocusType, AudioFocusType>, AudioFocusEntry> &focusMap);
+    // Returns false when the config has no entry for the pair.
+    bool Find(const AudioFocusType &existing, const AudioFocusType &incoming, AudioFocusEntry &focusEntry) const;
+    bool IsBuilt() const;
+    size_t GetTypeNum() const;
+
+private:
+    static int32_t GetTypeKey(const AudioFocusType &focusType);
+    int32_t GetTypeIndex(const AudioFocusType &focusType) const;
+
+    bool isBuilt_ = false;
+    size_t typeNum_ = 0;
+    std::vector<int16_t> typeIndex_; // type key to dense index, -1 when the type is not in the config
+    std::vector<AudioFocusEntry> entries_;
+    std::vector<bool> hasEntry_;
+    // pairs with a stream or source type outside the enum range, kept as is
+    std::map<std::pair<AudioFocusType, AudioFocusType>, AudioFocusEntry> outOfRangeMap_;
+};
+} // namespace AudioStandard
+} // namespace OHOS
+
+#endif // ST_AUDIO_FOCUS_MATRIX_H
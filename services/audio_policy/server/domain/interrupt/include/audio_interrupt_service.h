@@ -33,6 +33,7 @@
 #include "audio_interrupt_dfx_collector.h"
 #include "audio_zone_info.h"
 #include "audio_interrupt_zone.h"
+#include "audio_focus_matrix.h"
 #include "audio_info.h"
 #include "istandard_audio_service.h"
 
@@ -223,6 +224,7 @@ private:
         AudioFocusEntry &focusEntry);
     void UpdateMuteAudioFocusStrategy(const AudioInterrupt &currentInterrupt, const AudioInterrupt &incomingInterrupt,
         AudioFocusEntry &focusEntry);
+    bool GetFocusEntry(const AudioFocusType &existing, const AudioFocusType &incoming, AudioFocusEntry &focusEntry);
     bool FocusEntryContinue(std::list<std::pair<AudioInterrupt, AudioFocuState>>::iterator &iterActive,
         AudioFocusEntry &focusEntry, const AudioInterrupt &incomingInterrupt);
     int32_t ProcessFocusEntry(const int32_t zoneId, const AudioInterrupt &incomingInterrupt);
@@ -360,7 +362,8 @@ private:
     friend class AudioInterruptZoneManager;
     AudioInterruptZoneManager zoneManager_;
 
-    std::map<std::pair<AudioFocusType, AudioFocusType>, AudioFocusEntry> focusCfgMap_ = {};
+    // the parsed focus config, only kept in matrix form
+    AudioFocusMatrix focusMatrix_;
     std::unordered_map<int32_t, std::shared_ptr<AudioInterruptZone>> zonesMap_;
 
     std::map<int32_t, std::shared_ptr<AudioInterruptClient>> interruptClients_;
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LOG_TAG
+#define LOG_TAG "AudioFocusMatrix"
+#endif
+
+#include "audio_focus_matrix.h"
+
+#include "audio_log.h"
+
+namespace OHOS {
+namespace AudioStandard {
+namespace {
+// both enums start at -1 for "not set"
+constexpr int32_t STREAM_TYPE_NUM = STREAM_TYPE_MAX + 2;
+constexpr int32_t SOURCE_TYPE_NUM = SOURCE_TYPE_MAX + 2;
+constexpr int32_t TYPE_KEY_NUM = STREAM_TYPE_NUM * SOURCE_TYPE_NUM;
+constexpr int32_t INVALID_INDEX = -1;
+}
+
+int32_t AudioFocusMatrix::GetTypeKey(const AudioFocusType &focusType)
+{
+    int32_t stream = static_cast<int32_t>(focusType.streamType) + 1;
+    int32_t source = static_cast<int32_t>(focusType.sourceType) + 1;
+    if (stream < 0 || stream >= STREAM_TYPE_NUM || source < 0 || source >= SOURCE_TYPE_NUM) {
+        return INVALID_INDEX;
+    }
+    return stream * SOURCE_TYPE_NUM + source;
+}
+
+int32_t AudioFocusMatrix::GetTypeIndex(const AudioFocusType &focusType) const
+{
+    int32_t key = GetTypeKey(focusType);
+    return key == INVALID_INDEX ? INVALID_INDEX : typeIndex_[key];
+}
+
+void AudioFocusMatrix::Build(const std::map<std::pair<AudioFocusType, AudioFocusType>, AudioFocusEntry> &focusMap)
+{
+    typeIndex_.assign(TYPE_KEY_NUM, INVALID_INDEX);
+    outOfRangeMap_.clear();
+    typeNum_ = 0;
+    for (const auto &[focusPair, focusEntry] : focusMap) {
+        int32_t existingKey = GetTypeKey(focusPair.first);
+        int32_t incomingKey = GetTypeKey(focusPair.second);
+        if (existingKey == INVALID_INDEX || incomingKey == INVALID_INDEX) {
+            outOfRangeMap_.emplace(focusPair, focusEntry);
+            continue;
+        }
+        for (int32_t key : {existingKey, incomingKey}) {
+            if (typeIndex_[key] == INVALID_INDEX) {
+                typeIndex_[key] = static_cast<int16_t>(typeNum_++);
+            }
+        }
+    }
+
+    entries_.assign(typeNum_ * typeNum_, AudioFocusEntry {});
+    hasEntry_.assign(typeNum_ * typeNum_, false);
+    for (const auto &[focusPair, focusEntry] : focusMap) {
+        int32_t existing = GetTypeIndex(focusPair.first);
+        int32_t incoming = GetTypeIndex(focusPair.second);
+        if (existing == INVALID_INDEX || incoming == INVALID_INDEX) {
+            continue;
+        }
+        size_t pos = static_cast<size_t>(existing) * typeNum_ + static_cast<size_t>(incoming);
+        entries_[pos] = focusEntry;
+        hasEntry_[pos] = true;
+    }
+    isBuilt_ = true;
+    AUDIO_INFO_LOG("focus types: %{public}zu, out of range pairs: %{public}zu", typeNum_, outOfRangeMap_.size());
+}
+
+bool AudioFocusMatrix::Find(const AudioFocusType &existing, const AudioFocusType &incoming,
+    AudioFocusEntry &focusEntry) const
+{
+    if (!isBuilt_) {
+        return false;
+    }
+    int32_t existingIndex = GetTypeIndex(existing);
+    int32_t incomingIndex = GetTypeIndex(incoming);
+    if (existingIndex != INVALID_INDEX && incomingIndex != INVALID_INDEX) {
+        size_t pos = static_cast<size_t>(existingIndex) * typeNum_ + static_cast<size_t>(incomingIndex);
+        if (!hasEntry_[pos]) {
+            return false;
+        }
+        focusEntry = entries_[pos];
+        return true;
+    }
+    if (outOfRangeMap_.empty()) {
+        return false;
+    }
+    auto it = outOfRangeMap_.find(std::make_pair(existing, incoming));
+    if (it == outOfRangeMap_.end()) {
+        return false;
+    }
+    focusEntry = it->second;
+    return true;
+}
+
+bool AudioFocusMatrix::IsBuilt() const
+{
+    return isBuilt_;
+}
+
+size_t AudioFocusMatrix::GetTypeNum() const
+{
+    return typeNum_;
+}
+} // namespace AudioStandard
+} // namespace OHOS
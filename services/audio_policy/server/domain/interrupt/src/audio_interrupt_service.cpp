@@ -19,6 +19,7 @@
 #include "audio_interrupt_service.h"
 
 #include "audio_focus_parser.h"
+#include "audio_config_preloader.h"
 #include "audio_utils_c.h"
 #include "standard_audio_policy_manager_listener_proxy.h"
 #include "audio_policy_manager_listener_stub_impl.h"
@@ -158,14 +159,19 @@ void AudioInterruptService::Init(sptr<AudioPolicyServer> server)
     std::lock_guard<std::mutex> lock(mutex_);
 
     // load configuration
-    std::unique_ptr<AudioFocusParser> parser = make_unique<AudioFocusParser>();
-    int32_t ret = parser->LoadConfig(focusCfgMap_);
+    int32_t ret = ERROR;
+    FocusConfigMap focusCfgMap;
+    if (!AudioConfigPreloader::GetInstance().TakeFocusConfig(focusCfgMap, ret)) {
+        std::unique_ptr<AudioFocusParser> parser = make_unique<AudioFocusParser>();
+        ret = parser->LoadConfigWithCache(focusCfgMap);
+    }
     if (ret != SUCCESS) {
         WriteServiceStartupError();
     }
     CHECK_AND_RETURN_LOG(!ret, "load fail");
 
-    AUDIO_DEBUG_LOG("configuration loaded. mapSize: %{public}zu", focusCfgMap_.size());
+    AUDIO_DEBUG_LOG("configuration loaded. mapSize: %{public}zu", focusCfgMap.size());
+    focusMatrix_.Build(focusCfgMap);
 
     policyServer_ = server;
     clientOnFocus_ = 0;
@@ -336,11 +342,8 @@ void AudioInterruptService::AddActiveInterruptToSession(const int32_t callerPid)
 
     int32_t zoneId = zoneManager_.FindZoneByPid(callerPid);
     auto itZone = zonesMap_.find(zoneId);
-    CHECK_AND_RETURN_LOG(itZone != zonesMap_.end(), "can not find zoneid");
-    std::list<std::pair<AudioInterrupt, AudioFocuState>> audioFocusInfoList {};
-    if (itZone != zonesMap_.end() && itZone->second != nullptr) {
-        audioFocusInfoList = itZone->second->audioFocusInfoList;
-    }
+    CHECK_AND_RETURN_LOG(itZone != zonesMap_.end() && itZone->second != nullptr, "can not find zoneid");
+    const auto &audioFocusInfoList = itZone->second->audioFocusInfoList;
     for (auto iterActive = audioFocusInfoList.begin(); iterActive != audioFocusInfoList.end(); ++iterActive) {
         if ((iterActive->first).pid == callerPid) {
             sessionService_.AddStreamInfo(iterActive->first);
@@ -488,7 +491,7 @@ bool AudioInterruptService::HasAudioSessionFakeInterrupt(const int32_t zoneId, c
 {
     auto itZone = zonesMap_.find(zoneId);
     CHECK_AND_RETURN_RET_LOG((itZone != zonesMap_.end()) && (itZone->second != nullptr), false, "can not find zone");
-    std::list<std::pair<AudioInterrupt, AudioFocuState>> audioFocusInfoList = itZone->second->audioFocusInfoList;
+    const auto &audioFocusInfoList = itZone->second->audioFocusInfoList;
 
     auto isPresent = [callerPid] (const std::pair<AudioInterrupt, AudioFocuState> &pair) {
         return pair.first.pid == callerPid && pair.first.isAudioSessionInterrupt;
@@ -866,12 +869,11 @@ int32_t AudioInterruptService::UnsetAudioInterruptCallback(const int32_t zoneId,
 bool AudioInterruptService::AudioInterruptIsActiveInFocusList(const int32_t zoneId, const uint32_t incomingStreamId)
 {
     auto itZone = zonesMap_.find(zoneId);
-    if (itZone == zonesMap_.end()) {
+    if (itZone == zonesMap_.end() || itZone->second == nullptr) {
         AUDIO_ERR_LOG("Can not find zoneid");
         return false;
     }
-    std::list<std::pair<AudioInterrupt, AudioFocuState>> audioFocusInfoList {};
-    audioFocusInfoList = itZone->second->audioFocusInfoList;
+    const auto &audioFocusInfoList = itZone->second->audioFocusInfoList;
     auto isPresent = [incomingStreamId] (const std::pair<AudioInterrupt, AudioFocuState> &pair) {
         // If the stream id has been active or ducked, no need to activate audio interrupt again.
         return pair.first.streamId == incomingStreamId && (pair.second == ACTIVE || pair.second == DUCK);
@@ -1006,9 +1008,8 @@ void AudioInterruptService::PrintLogsOfFocusStrategyBaseMusic(const AudioInterru
 
     AudioFocusType audioFocusType;
     audioFocusType.streamType = AudioStreamType::STREAM_MUSIC;
-    std::pair<AudioFocusType, AudioFocusType> focusPair = std::make_pair(audioFocusType, audioInterrupt.audioFocusType);
-    CHECK_AND_RETURN_LOG(focusCfgMap_.find(focusPair) != focusCfgMap_.end(), "no focus cfg");
-    AudioFocusEntry focusEntry = focusCfgMap_[focusPair];
+    AudioFocusEntry focusEntry;
+    CHECK_AND_RETURN_LOG(GetFocusEntry(audioFocusType, audioInterrupt.audioFocusType, focusEntry), "no focus cfg");
     if (focusEntry.actionOn != CURRENT) {
         AUDIO_WARNING_LOG("The audio focus strategy based on music: forceType: %{public}d, hintType: %{public}d, " \
             "actionOn: %{public}d. Caller info: pid [%{public}d], uid [%{public}d], bundleName [%{public}s].",
@@ -1372,14 +1373,13 @@ int32_t AudioInterruptService::GetSessionInfoInFocus(AudioInterrupt &audioInterr
 
     std::unique_lock<std::mutex> lock(mutex_);
     auto itZone = zonesMap_.find(zoneId);
-    std::list<std::pair<AudioInterrupt, AudioFocuState>> audioFocusInfoList {};
-    if (itZone != zonesMap_.end() && itZone->second != nullptr) {
-        audioFocusInfoList = itZone->second->audioFocusInfoList;
+    if (itZone == zonesMap_.end() || itZone->second == nullptr) {
+        return SUCCESS;
     }
 
-    for (auto iter = audioFocusInfoList.begin(); iter != audioFocusInfoList.end(); ++iter) {
-        if (iter->second == ACTIVE) {
-            audioInterrupt = iter->first;
+    for (const auto &[interrupt, focusState] : itZone->second->audioFocusInfoList) {
+        if (focusState == ACTIVE) {
+            audioInterrupt = interrupt;
         }
     }
 
@@ -1690,8 +1690,8 @@ void AudioInterruptService::ProcessActiveInterrupt(const int32_t zoneId, const A
     std::list<int32_t> removeFocusInfoPidList = {};
     InterruptDfxBuilder dfxBuilder;
     for (auto iterActive = tmpFocusInfoList.begin(); iterActive != tmpFocusInfoList.end();) {
-        AudioFocusEntry focusEntry =
-            focusCfgMap_[std::make_pair((iterActive->first).audioFocusType, incomingInterrupt.audioFocusType)];
+        AudioFocusEntry focusEntry {};
+        GetFocusEntry((iterActive->first).audioFocusType, incomingInterrupt.audioFocusType, focusEntry);
         UpdateAudioFocusStrategy(iterActive->first, incomingInterrupt, focusEntry);
         if (focusEntry.actionOn != CURRENT || IsSameAppInShareMode(incomingInterrupt, iterActive->first) ||
             iterActive->second == PLACEHOLDER || CanMixForSession(incomingInterrupt, iterActive->first, focusEntry) ||
@@ -2036,9 +2036,9 @@ int32_t AudioInterruptService::ProcessFocusEntry(const int32_t zoneId, const Aud
     AudioFocuState incomingState = ACTIVE;
     InterruptEventInternal interruptEvent {INTERRUPT_TYPE_BEGIN, INTERRUPT_FORCE, INTERRUPT_HINT_NONE, 1.0f};
     auto itZone = zonesMap_.find(zoneId);
-    CHECK_AND_RETURN_RET_LOG(itZone != zonesMap_.end(), ERROR, "can not find zoneid");
-    std::list<std::pair<AudioInterrupt, AudioFocuState>> audioFocusInfoList {};
-    if (itZone != zonesMap_.end()) { audioFocusInfoList = itZone->second->audioFocusInfoList; }
+    CHECK_AND_RETURN_RET_LOG(itZone != zonesMap_.end() && itZone->second != nullptr, ERROR, "can not find zoneid");
+    // only read here, the list is updated below once the incoming state is known
+    auto &audioFocusInfoList = itZone->second->audioFocusInfoList;
 
     std::list<std::pair<AudioInterrupt, AudioFocuState>>::iterator activeInterrupt = audioFocusInfoList.end();
     int32_t res = ProcessActiveStreamFocus(audioFocusInfoList, incomingInterrupt, incomingState, activeInterrupt);
@@ -2305,11 +2305,10 @@ AudioScene AudioInterruptService::GetHighestPriorityAudioScene(const int32_t zon
     AudioScene audioScene = AUDIO_SCENE_DEFAULT;
 
     auto itZone = zonesMap_.find(zoneId);
-    std::list<std::pair<AudioInterrupt, AudioFocuState>> audioFocusInfoList {};
-    if (itZone != zonesMap_.end() && itZone->second != nullptr) {
-        audioFocusInfoList = itZone->second->audioFocusInfoList;
+    if (itZone == zonesMap_.end() || itZone->second == nullptr) {
+        return audioScene;
     }
-    for (const auto &[interrupt, focuState] : audioFocusInfoList) {
+    for (const auto &[interrupt, focuState] : itZone->second->audioFocusInfoList) {
         if (interrupt.isAudioSessionInterrupt) {
             audioScene = GetHighestPriorityAudioSceneFromAudioSession(interrupt, audioScene);
             continue;
@@ -2523,13 +2522,12 @@ std::list<std::pair<AudioInterrupt, AudioFocuState>> AudioInterruptService::Simu
         for (auto iter = newAudioFocuInfoList.begin(); iter != newAudioFocuInfoList.end(); ++iter) {
             AudioInterrupt inprocessing = iter->first;
             if (IsSameAppInShareMode(incoming, inprocessing) || iter->second == PLACEHOLDER) { continue; }
-            auto audioFocusTypePair = std::make_pair(inprocessing.audioFocusType, incoming.audioFocusType);
-            if (focusCfgMap_.find(audioFocusTypePair) == focusCfgMap_.end()) {
+            AudioFocusEntry focusEntry;
+            if (!GetFocusEntry(inprocessing.audioFocusType, incoming.audioFocusType, focusEntry)) {
                 AUDIO_WARNING_LOG("focus type is invalid");
                 incomingState = iterActive->second;
                 break;
             }
-            AudioFocusEntry focusEntry = focusCfgMap_[audioFocusTypePair];
             UpdateAudioFocusStrategy(inprocessing, incoming, focusEntry);
             SourceType existSourceType = inprocessing.audioFocusType.sourceType;
             std::vector<SourceType> existConcurrentSources = inprocessing.currencySources.sourcesTypes;
@@ -3052,11 +3050,8 @@ void AudioInterruptService::WriteSessionTimeoutDfxEvent(const int32_t pid)
 {
     CHECK_AND_RETURN_LOG(dfxCollector_ != nullptr, "dfxCollector is null");
     auto itZone = zonesMap_.find(ZONEID_DEFAULT);
-    CHECK_AND_RETURN_LOG(itZone != zonesMap_.end(), "can not find zoneid");
-    std::list<std::pair<AudioInterrupt, AudioFocuState>> audioFocusInfoList{};
-    if (itZone != zonesMap_.end() && itZone->second != nullptr) {
-        audioFocusInfoList = itZone->second->audioFocusInfoList;
-    }
+    CHECK_AND_RETURN_LOG(itZone != zonesMap_.end() && itZone->second != nullptr, "can not find zoneid");
+    const auto &audioFocusInfoList = itZone->second->audioFocusInfoList;
 
     auto iter = std::find_if(audioFocusInfoList.begin(), audioFocusInfoList.end(), [pid](const auto &item) {
         return pid == item.first.pid;
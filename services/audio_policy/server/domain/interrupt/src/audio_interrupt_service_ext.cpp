@@ -174,6 +174,13 @@ void AudioInterruptService::UpdateMuteAudioFocusStrategy(const AudioInterrupt &c
     focusEntry.hintType = INTERRUPT_HINT_MUTE;
 }
 
+bool AudioInterruptService::GetFocusEntry(const AudioFocusType &existing, const AudioFocusType &incoming,
+    AudioFocusEntry &focusEntry)
+{
+    // no entry matches until Init has loaded the config
+    return focusMatrix_.Find(existing, incoming, focusEntry);
+}
+
 int32_t AudioInterruptService::ProcessActiveStreamFocus(
     std::list<std::pair<AudioInterrupt, AudioFocuState>> &audioFocusInfoList,
     const AudioInterrupt &incomingInterrupt, AudioFocuState &incomingState,
@@ -193,14 +200,12 @@ int32_t AudioInterruptService::ProcessActiveStreamFocus(
             break;
         }
 
-        std::pair<AudioFocusType, AudioFocusType> focusPair =
-            std::make_pair((iterActive->first).audioFocusType, incomingInterrupt.audioFocusType);
-        CHECK_AND_RETURN_RET_LOG(focusCfgMap_.find(focusPair) != focusCfgMap_.end(),
-            ERR_INVALID_PARAM,
+        AudioFocusEntry focusEntry;
+        CHECK_AND_RETURN_RET_LOG(GetFocusEntry((iterActive->first).audioFocusType, incomingInterrupt.audioFocusType,
+            focusEntry), ERR_INVALID_PARAM,
             "no focus cfg, active stream type = %{public}d, incoming stream type = %{public}d",
-            static_cast<int32_t>(focusPair.first.streamType),
-            static_cast<int32_t>(focusPair.second.streamType));
-        AudioFocusEntry focusEntry = focusCfgMap_[focusPair];
+            static_cast<int32_t>((iterActive->first).audioFocusType.streamType),
+            static_cast<int32_t>(incomingInterrupt.audioFocusType.streamType));
         UpdateAudioFocusStrategy(iterActive->first, incomingInterrupt, focusEntry);
         CheckIncommingFoucsValidity(focusEntry, incomingInterrupt, incomingInterrupt.currencySources.sourcesTypes);
         if (FocusEntryContinue(iterActive, focusEntry, incomingInterrupt)) { continue; }
@@ -262,12 +267,12 @@ bool AudioInterruptService::IsCapturerFocusAvailable(const int32_t zoneId, const
     incomingInterrupt.audioFocusType.sourceType = capturerInfo.sourceType;
     incomingInterrupt.audioFocusType.isPlay = false;
     AudioFocuState incomingState = ACTIVE;
+    std::lock_guard<std::mutex> lock(mutex_);
     auto itZone = zonesMap_.find(zoneId);
     CHECK_AND_RETURN_RET_LOG(itZone != zonesMap_.end(), false, "can not find zoneid");
-    std::list<std::pair<AudioInterrupt, AudioFocuState>> audioFocusInfoList;
-    if (itZone->second != nullptr) {
-        audioFocusInfoList = itZone->second->audioFocusInfoList;
-    }
+    AudioFocusList emptyFocusList;
+    AudioFocusList &audioFocusInfoList = itZone->second != nullptr ? itZone->second->audioFocusInfoList :
+        emptyFocusList;
     std::list<std::pair<AudioInterrupt, AudioFocuState>>::iterator activeInterrupt = audioFocusInfoList.end();
     int32_t res = ProcessActiveStreamFocus(audioFocusInfoList, incomingInterrupt, incomingState, activeInterrupt);
     return res == SUCCESS && incomingState < PAUSE;
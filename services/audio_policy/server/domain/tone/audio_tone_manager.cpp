@@ -25,6 +25,7 @@
 #include "audio_policy_log.h"
 #include "audio_inner_call.h"
 #include "audio_tone_parser.h"
+#include "audio_config_preloader.h"
 #include "audio_utils.h"
 #include "media_monitor_manager.h"
 
@@ -37,13 +38,17 @@ namespace AudioStandard {
 bool AudioToneManager::LoadToneDtmfConfig()
 {
     AUDIO_INFO_LOG("Enter");
-    std::unique_ptr<AudioToneParser> audioToneParser = std::make_unique<AudioToneParser>();
-    if (audioToneParser == nullptr) {
-        AudioPolicyUtils::GetInstance().WriteServiceStartupError("Audio Tone Load Configuration failed");
+    int32_t ret = ERROR;
+    if (!AudioConfigPreloader::GetInstance().TakeToneConfig(toneDescriptorMap_, customToneDescriptorMap_, ret)) {
+        std::unique_ptr<AudioToneParser> audioToneParser = std::make_unique<AudioToneParser>();
+        if (audioToneParser == nullptr) {
+            AudioPolicyUtils::GetInstance().WriteServiceStartupError("Audio Tone Load Configuration failed");
+        }
+        CHECK_AND_RETURN_RET_LOG(audioToneParser != nullptr, false, "Failed to create AudioToneParser");
+        ret = audioToneParser->LoadNewConfigWithCache(AudioToneParser::AUDIO_TONE_CONFIG_FILE, toneDescriptorMap_,
+            customToneDescriptorMap_);
     }
-    CHECK_AND_RETURN_RET_LOG(audioToneParser != nullptr, false, "Failed to create AudioToneParser");
-    if (audioToneParser->LoadNewConfig(AudioToneParser::AUDIO_TONE_CONFIG_FILE, toneDescriptorMap_,
-        customToneDescriptorMap_)) {
+    if (ret) {
         Trace trace("SYSEVENT FAULT EVENT LOAD_CONFIG_ERROR, CATEGORY: "
             + std::to_string(Media::MediaMonitor::AUDIO_TONE_DTMF_CONFIG));
         std::shared_ptr<Media::MediaMonitor::EventBean> bean = std::make_shared<Media::MediaMonitor::EventBean>(
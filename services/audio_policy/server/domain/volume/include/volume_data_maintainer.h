@@ -19,6 +19,9 @@
 #include <unordered_map>
 #include <mutex>
 #include <cinttypes>
+#include <chrono>
+#include <condition_variable>
+#include <thread>
 #include "errors.h"
 #include "ipc_skeleton.h"
 #include "ffrt.h"
@@ -36,6 +39,14 @@
 namespace OHOS {
 namespace AudioStandard {
 
+// Target of the batched volume writes, the setting datashare unless replaced for test.
+class VolumeDbWriter {
+public:
+    virtual ~VolumeDbWriter() = default;
+    virtual ErrCode PutIntValues(std::vector<IntValueInfo> &infos, const std::string &tableType) = 0;
+    virtual ErrCode PutBoolValues(std::vector<BoolValueInfo> &infos, const std::string &tableType) = 0;
+};
+
 class VolumeDataMaintainer {
 public:
     enum VolumeDataMaintainerStreamType {  // define with Dual framework
@@ -93,6 +104,7 @@ public:
     }
     ~VolumeDataMaintainer()
     {
+        StopDbFlushThread();
         AUDIO_INFO_LOG("VolumeDataMaintainer Destroy");
     };
 
@@ -160,7 +172,25 @@ public:
     void SaveVolumeDegreeToMap(std::shared_ptr<AudioDeviceDescriptor> device,
         AudioStreamType streamType, int32_t volumeDegree);
 
+    // Write-behind variants for frequent changes such as a volume slider drag. Only the latest value of each key
+    // is kept, all pending keys are written in one batch once the changes settle, or by FlushPendingDbWrites.
+    // Loads from the database, including the device volume and mute maps, return pending values over stored ones.
+    // Safe volume state, ringer mode and the other settings change rarely and are still written straight through.
+    int32_t SaveVolumeToDbDeferred(std::shared_ptr<AudioDeviceDescriptor> device,
+        AudioStreamType streamType, int32_t volumeLevel);
+    int32_t SaveVolumeDegreeToDbDeferred(std::shared_ptr<AudioDeviceDescriptor> device,
+        AudioStreamType streamType, int32_t volumeDegree);
+    int32_t SaveMuteToDbDeferred(std::shared_ptr<AudioDeviceDescriptor> device,
+        AudioStreamType streamType, bool muteStatus);
+    void FlushPendingDbWrites();
+    void SetDbWriter(std::shared_ptr<VolumeDbWriter> dbWriter);
+
 private:
+    struct PendingDbValue {
+        bool isBool = false;
+        int32_t value = 0;
+    };
+
     static std::string GetVolumeKeyForDataShare(DeviceType deviceType, AudioStreamType streamType,
         std::string networkId = LOCAL_NETWORK_ID);
     static std::string GetMuteKeyForDataShare(DeviceType deviceType, AudioStreamType streamType,
@@ -174,6 +204,13 @@ private:
 
     void WriteVolumeDbAccessExceptionEvent(int32_t errorCase, int32_t errorMsg);
 
+    bool IsDbWritable(std::shared_ptr<AudioDeviceDescriptor> device);
+    void SavePendingDbValue(const std::string &key, PendingDbValue pendingValue);
+    bool LoadPendingDbValue(const std::string &key, int32_t &value);
+    void ErasePendingDbValue(const std::string &key);
+    void DbFlushLoop();
+    void StopDbFlushThread();
+
     ffrt::mutex volumeMutex_;
     ffrt::mutex volumeForDbMutex_;
     ffrt::mutex volumeForMapMutex_;
@@ -197,6 +234,17 @@ private:
         std::unordered_map<AudioStreamType, int32_t>> volumeDegreeMap_;
     bool isSettingsCloneHaveStarted_ = false;
     std::unordered_map<DeviceType, std::unordered_map<AudioStreamType, int32_t>> deviceTypeToSystemVolumeForEffectMap_;
+
+    // lock order: volumeForDbMutex_ before pendingDbMutex_
+    std::mutex pendingDbMutex_;
+    std::condition_variable pendingDbCv_;
+    std::unordered_map<std::string, PendingDbValue> pendingDbValues_;
+    std::chrono::steady_clock::time_point firstPendingTime_;
+    std::chrono::steady_clock::time_point lastPendingTime_;
+    std::thread dbFlushThread_;
+    bool isDbFlushThreadRunning_ = false;
+    bool isDbFlushStopping_ = false;
+    std::shared_ptr<VolumeDbWriter> dbWriter_ = nullptr;
 };
 } // namespace AudioStandard
 } // namespace OHOS
@@ -24,6 +24,7 @@
 
 #include "audio_policy_service.h"
 #include "audio_volume_parser.h"
+#include "audio_config_preloader.h"
 #include "audio_policy_server.h"
 #include "audio_volume.h"
 #include "audio_utils.h"
@@ -92,9 +93,12 @@ bool AudioAdapterManager::Init()
         testModeOn_ = true;
     }
 
-    std::unique_ptr<AudioVolumeParser> audiovolumeParser = make_unique<AudioVolumeParser>();
-    CHECK_AND_RETURN_RET_LOG(audiovolumeParser, false, "audiovolumeParser is null");
-    auto lret = audiovolumeParser->LoadConfig(streamVolumeInfos_);
+    int32_t lret = ERROR;
+    if (!AudioConfigPreloader::GetInstance().TakeVolumeConfig(streamVolumeInfos_, lret)) {
+        std::unique_ptr<AudioVolumeParser> audiovolumeParser = make_unique<AudioVolumeParser>();
+        CHECK_AND_RETURN_RET_LOG(audiovolumeParser, false, "audiovolumeParser is null");
+        lret = audiovolumeParser->LoadConfigWithCache(streamVolumeInfos_);
+    }
     AudioVolumeUtils::GetInstance().LoadConfig();
     defaultVolumeTypeList_ = (VolumeUtils::IsPCVolumeEnable()) ? PC_VOLUME_TYPE_LIST : BASE_VOLUME_TYPE_LIST;
     volumeDataMaintainer_.SetVolumeList(defaultVolumeTypeList_);
@@ -262,6 +266,7 @@ void AudioAdapterManager::Deinit(void)
 {
     CHECK_AND_RETURN_LOG(audioServiceAdapter_, "Deinit audio adapter null");
 
+    volumeDataMaintainer_.FlushPendingDbWrites();
     if (handler_ != nullptr) {
         AUDIO_INFO_LOG("release handler");
         handler_->ReleaseEventRunner();
@@ -3415,25 +3420,19 @@ void AudioAdapterManager::UpdateVolumeWhenDeviceDisconnect(std::shared_ptr<Audio
 void AudioAdapterManager::SaveVolumeToDbAsync(std::shared_ptr<AudioDeviceDescriptor> desc,
     AudioStreamType streamType, int32_t volumeLevel)
 {
-    std::thread([this, desc, streamType, volumeLevel]() {
-        volumeDataMaintainer_.SaveVolumeToDb(desc, streamType, volumeLevel);
-    }).detach();
+    volumeDataMaintainer_.SaveVolumeToDbDeferred(desc, streamType, volumeLevel);
 }
 
 void AudioAdapterManager::SaveVolumeDegreeToDbAsync(std::shared_ptr<AudioDeviceDescriptor> desc,
     AudioStreamType streamType, int32_t volumeDegree)
 {
-    std::thread([=]() {
-        volumeDataMaintainer_.SaveVolumeDegreeToDb(desc, streamType, volumeDegree);
-    }).detach();
+    volumeDataMaintainer_.SaveVolumeDegreeToDbDeferred(desc, streamType, volumeDegree);
 }
 
 void AudioAdapterManager::SaveMuteToDbAsync(std::shared_ptr<AudioDeviceDescriptor> desc,
     AudioStreamType streamType, bool mute)
 {
-    std::thread([this, desc, streamType, mute]() {
-        volumeDataMaintainer_.SaveMuteToDb(desc, streamType, mute);
-    }).detach();
+    volumeDataMaintainer_.SaveMuteToDbDeferred(desc, streamType, mute);
 }
 
 bool AudioAdapterManager::IsChannelLayoutSupportedForDspEffect(AudioChannelLayout channelLayout)
@@ -37,7 +37,7 @@ bool AudioVolumeUtils::LoadConfig()
 {
     std::unique_ptr<AudioVolumeParser> parser = std::make_unique<AudioVolumeParser>();
     CHECK_AND_RETURN_RET_LOG(parser != nullptr, false, "parser is null");
-    return parser->LoadConfig(streamVolumeInfos_);
+    return parser->LoadConfigWithCache(streamVolumeInfos_);
 }
 
 int32_t AudioVolumeUtils::GetDefaultVolumeLevel(const std::shared_ptr<AudioDeviceDescriptor> &desc,
@@ -17,6 +17,7 @@
 #endif
 
 #include "volume_data_maintainer.h"
+#include <algorithm>
 #include "system_ability_definition.h"
 #include "audio_policy_manager_factory.h"
 #include "media_monitor_manager.h"
@@ -41,6 +42,9 @@ constexpr int32_t MAX_SAFE_STATUS = 2;
 constexpr int32_t DEFAULT_SYSTEM_VOLUME_FOR_EFFECT = 5;
 static constexpr int32_t DEFAULT_VOLUME_LEVEL = 7;
 static constexpr int32_t DEFAULT_VOLUME_DEGREE = 50;
+// pending writes go out once no new change came for the debounce time, and at most max delay after the first one
+static constexpr std::chrono::milliseconds DB_FLUSH_DEBOUNCE_TIME(300);
+static constexpr std::chrono::milliseconds DB_FLUSH_MAX_DELAY(1000);
 
 static const std::vector<VolumeDataMaintainer::VolumeDataMaintainerStreamType> VOLUME_MUTE_STREAM_TYPE = {
     // all volume types except STREAM_ALL
@@ -841,6 +845,9 @@ void VolumeDataMaintainer::LoadDeviceVolumeMapFromDb(std::shared_ptr<AudioDevice
         std::lock_guard<ffrt::mutex> lock(volumeForDbMutex_);
         AudioSettingProvider& audioSettingProvider = AudioSettingProvider::GetInstance(AUDIO_POLICY_SERVICE_ID);
         audioSettingProvider.GetIntValues(infos, "system");
+        for (auto &info : infos) {
+            LoadPendingDbValue(info.key, info.value);
+        }
     }
     for (size_t i = 0; i < volumeList.size(); i++) {
         SaveVolumeToMap(device, volumeList[i], infos[i].value);
@@ -873,6 +880,7 @@ int32_t VolumeDataMaintainer::SaveVolumeToDb(std::shared_ptr<AudioDeviceDescript
 
     {
         std::lock_guard<ffrt::mutex> lock(volumeForDbMutex_);
+        ErasePendingDbValue(volumeKey);
         AudioSettingProvider& audioSettingProvider = AudioSettingProvider::GetInstance(AUDIO_POLICY_SERVICE_ID);
         ErrCode ret = audioSettingProvider.PutIntValue(volumeKey, volumeLevel, "system");
         if (ret != SUCCESS) {
@@ -952,7 +960,7 @@ void VolumeDataMaintainer::LoadDeviceMuteMapFromDb(std::shared_ptr<AudioDeviceDe
     }
     for (auto stream : volumeList) {
         BoolValueInfo info {
-            .key = GetVolumeKey(device, stream),
+            .key = GetMuteKey(device, stream),
             .defaultValue = false,
             .value = false
         };
@@ -972,6 +980,12 @@ void VolumeDataMaintainer::LoadDeviceMuteMapFromDb(std::shared_ptr<AudioDeviceDe
         std::lock_guard<ffrt::mutex> lock(volumeForDbMutex_);
         AudioSettingProvider& audioSettingProvider = AudioSettingProvider::GetInstance(AUDIO_POLICY_SERVICE_ID);
         audioSettingProvider.GetBoolValues(infos, "system");
+        for (auto &info : infos) {
+            int32_t pendingMute = 0;
+            if (LoadPendingDbValue(info.key, pendingMute)) {
+                info.value = pendingMute != 0;
+            }
+        }
     }
     for (size_t i = 0; i < volumeList.size(); i++) {
         SaveMuteToMap(device, volumeList[i], infos[i].value);
@@ -1001,6 +1015,7 @@ int32_t VolumeDataMaintainer::SaveMuteToDb(std::shared_ptr<AudioDeviceDescriptor
     }
 
     std::lock_guard<ffrt::mutex> lock(volumeForDbMutex_);
+    ErasePendingDbValue(muteKey);
     AudioSettingProvider& audioSettingProvider = AudioSettingProvider::GetInstance(AUDIO_POLICY_SERVICE_ID);
     ErrCode ret = audioSettingProvider.PutBoolValue(muteKey, muteStatus, "system");
     AUDIO_INFO_LOG("muteKey:%{public}s, muteStatus:%{public}d, res: %{public}d",
@@ -1053,6 +1068,9 @@ int32_t VolumeDataMaintainer::LoadVolumeFromDb(std::shared_ptr<AudioDeviceDescri
             "datashare", device->GetName().c_str(), streamType);
         return volumeLevel;
     }
+    if (LoadPendingDbValue(volumeKey, volumeLevel)) {
+        return volumeLevel;
+    }
 
     AudioSettingProvider& audioSettingProvider = AudioSettingProvider::GetInstance(AUDIO_POLICY_SERVICE_ID);
     ErrCode ret = audioSettingProvider.GetIntValue(volumeKey, volumeLevel, "system");
@@ -1123,6 +1141,7 @@ int32_t VolumeDataMaintainer::SaveVolumeDegreeToDb(std::shared_ptr<AudioDeviceDe
 
     {
         std::lock_guard<ffrt::mutex> lock(volumeForDbMutex_);
+        ErasePendingDbValue(volumeKey);
         AudioSettingProvider& audioSettingProvider = AudioSettingProvider::GetInstance(AUDIO_POLICY_SERVICE_ID);
         ErrCode ret = audioSettingProvider.PutIntValue(volumeKey, volumeDegree, "system");
         if (ret != SUCCESS) {
@@ -1150,6 +1169,9 @@ int32_t VolumeDataMaintainer::LoadVolumeDegreeFromDb(std::shared_ptr<AudioDevice
         return volumeDegree;
     }
     volumeKey += "_degree";
+    if (LoadPendingDbValue(volumeKey, volumeDegree)) {
+        return volumeDegree;
+    }
 
     AudioSettingProvider& audioSettingProvider = AudioSettingProvider::GetInstance(AUDIO_POLICY_SERVICE_ID);
     ErrCode ret = audioSettingProvider.GetIntValue(volumeKey, volumeDegree, "system");
@@ -1162,5 +1184,194 @@ int32_t VolumeDataMaintainer::LoadVolumeDegreeFromDb(std::shared_ptr<AudioDevice
     return volumeDegree;
 }
 
+namespace {
+class VolumeSettingDbWriter : public VolumeDbWriter {
+public:
+    ErrCode PutIntValues(std::vector<IntValueInfo> &infos, const std::string &tableType) override
+    {
+        return AudioSettingProvider::GetInstance(AUDIO_POLICY_SERVICE_ID).PutIntValues(infos, tableType);
+    }
+
+    ErrCode PutBoolValues(std::vector<BoolValueInfo> &infos, const std::string &tableType) override
+    {
+        return AudioSettingProvider::GetInstance(AUDIO_POLICY_SERVICE_ID).PutBoolValues(infos, tableType);
+    }
+};
+}
+
+bool VolumeDataMaintainer::IsDbWritable(std::shared_ptr<AudioDeviceDescriptor> device)
+{
+    if (AudioVolumeUtils::GetInstance().IsDistributedDevice(device)) {
+        return device->volumeBehavior_.isReady && device->volumeBehavior_.databaseVolumeName != "";
+    }
+    return true;
+}
+
+int32_t VolumeDataMaintainer::SaveVolumeToDbDeferred(std::shared_ptr<AudioDeviceDescriptor> device,
+    AudioStreamType streamType, int32_t volumeLevel)
+{
+    CHECK_AND_RETURN_RET_LOG(device != nullptr, ERROR, "device is null");
+    CHECK_AND_RETURN_RET(IsDbWritable(device), SUCCESS);
+    std::string volumeKey = GetVolumeKey(device, streamType);
+    if (volumeKey.empty()) {
+        WriteVolumeDbAccessExceptionEvent(static_cast<int32_t>(VolumeDbAccessExceptionFuncId::SAVE_VOLUME_INTERNA_A),
+            ERR_READ_FAILED);
+        AUDIO_ERR_LOG("[device %{public}s, streamType %{public}d] is not supported for datashare",
+            device->GetName().c_str(), streamType);
+        return ERROR;
+    }
+    SavePendingDbValue(volumeKey, {false, volumeLevel});
+    return SUCCESS;
+}
+
+int32_t VolumeDataMaintainer::SaveVolumeDegreeToDbDeferred(std::shared_ptr<AudioDeviceDescriptor> device,
+    AudioStreamType streamType, int32_t volumeDegree)
+{
+    CHECK_AND_RETURN_RET_LOG(device != nullptr, ERROR, "device is null");
+    CHECK_AND_RETURN_RET(IsDbWritable(device), SUCCESS);
+    std::string volumeKey = GetVolumeKey(device, streamType);
+    if (volumeKey.empty()) {
+        AUDIO_ERR_LOG("[device %{public}s, streamType %{public}d] is not supported",
+            device->GetName().c_str(), streamType);
+        return ERROR;
+    }
+    SavePendingDbValue(volumeKey + "_degree", {false, volumeDegree});
+    return SUCCESS;
+}
+
+int32_t VolumeDataMaintainer::SaveMuteToDbDeferred(std::shared_ptr<AudioDeviceDescriptor> device,
+    AudioStreamType streamType, bool muteStatus)
+{
+    CHECK_AND_RETURN_RET_LOG(device != nullptr, ERROR, "device is null");
+    CHECK_AND_RETURN_RET(IsDbWritable(device), SUCCESS);
+    std::string muteKey = GetMuteKey(device, streamType);
+    if (muteKey.empty()) {
+        WriteVolumeDbAccessExceptionEvent(static_cast<int32_t>(
+            VolumeDbAccessExceptionFuncId::SAVE_MUTE_STATUS_INTERNAL), ERR_READ_FAILED);
+        AUDIO_ERR_LOG("[device %{public}s, streamType %{public}d] is not supported for datashare",
+            device->GetName().c_str(), streamType);
+        return ERROR;
+    }
+    SavePendingDbValue(muteKey, {true, muteStatus ? 1 : 0});
+    return SUCCESS;
+}
+
+void VolumeDataMaintainer::SavePendingDbValue(const std::string &key, PendingDbValue pendingValue)
+{
+    std::lock_guard<std::mutex> lock(pendingDbMutex_);
+    auto now = std::chrono::steady_clock::now();
+    if (pendingDbValues_.empty()) {
+        firstPendingTime_ = now;
+    }
+    lastPendingTime_ = now;
+    pendingDbValues_[key] = pendingValue;
+    if (isDbFlushThreadRunning_ || isDbFlushStopping_) {
+        return;
+    }
+    // the last flush thread has already left its loop once the flag is cleared
+    if (dbFlushThread_.joinable()) {
+        dbFlushThread_.join();
+    }
+    isDbFlushThreadRunning_ = true;
+    dbFlushThread_ = std::thread([this] { DbFlushLoop(); });
+}
+
+bool VolumeDataMaintainer::LoadPendingDbValue(const std::string &key, int32_t &value)
+{
+    std::lock_guard<std::mutex> lock(pendingDbMutex_);
+    auto it = pendingDbValues_.find(key);
+    if (it == pendingDbValues_.end()) {
+        return false;
+    }
+    value = it->second.value;
+    return true;
+}
+
+void VolumeDataMaintainer::ErasePendingDbValue(const std::string &key)
+{
+    std::lock_guard<std::mutex> lock(pendingDbMutex_);
+    pendingDbValues_.erase(key);
+}
+
+void VolumeDataMaintainer::DbFlushLoop()
+{
+    std::unique_lock<std::mutex> lock(pendingDbMutex_);
+    while (!pendingDbValues_.empty()) {
+        auto deadline = std::min(lastPendingTime_ + DB_FLUSH_DEBOUNCE_TIME, firstPendingTime_ + DB_FLUSH_MAX_DELAY);
+        if (!isDbFlushStopping_ && std::chrono::steady_clock::now() < deadline) {
+            pendingDbCv_.wait_until(lock, deadline);
+            continue;
+        }
+        lock.unlock();
+        FlushPendingDbWrites();
+        lock.lock();
+    }
+    isDbFlushThreadRunning_ = false;
+}
+
+void VolumeDataMaintainer::FlushPendingDbWrites()
+{
+    // held across the batch so that a load never falls between the pending map and the database
+    std::lock_guard<ffrt::mutex> dbLock(volumeForDbMutex_);
+    std::unordered_map<std::string, PendingDbValue> pendingValues;
+    std::shared_ptr<VolumeDbWriter> dbWriter;
+    {
+        std::lock_guard<std::mutex> lock(pendingDbMutex_);
+        pendingValues.swap(pendingDbValues_);
+        dbWriter = dbWriter_;
+    }
+    CHECK_AND_RETURN(!pendingValues.empty());
+    if (dbWriter == nullptr) {
+        static std::shared_ptr<VolumeDbWriter> settingDbWriter = std::make_shared<VolumeSettingDbWriter>();
+        dbWriter = settingDbWriter;
+    }
+
+    std::vector<IntValueInfo> intInfos;
+    std::vector<BoolValueInfo> boolInfos;
+    for (const auto &[key, pendingValue] : pendingValues) {
+        if (pendingValue.isBool) {
+            bool status = pendingValue.value != 0;
+            boolInfos.push_back({key, status, status});
+        } else {
+            intInfos.push_back({key, pendingValue.value, pendingValue.value, pendingValue.value});
+        }
+    }
+    if (!intInfos.empty()) {
+        ErrCode ret = dbWriter->PutIntValues(intInfos, "system");
+        if (ret != SUCCESS) {
+            WriteVolumeDbAccessExceptionEvent(static_cast<int32_t>(
+                VolumeDbAccessExceptionFuncId::SAVE_VOLUME_INTERNA_B), static_cast<int32_t>(ret));
+            AUDIO_ERR_LOG("Save %{public}zu volume values to datashare failed, ret %{public}d", intInfos.size(), ret);
+        }
+    }
+    if (!boolInfos.empty()) {
+        ErrCode ret = dbWriter->PutBoolValues(boolInfos, "system");
+        if (ret != SUCCESS) {
+            WriteVolumeDbAccessExceptionEvent(static_cast<int32_t>(
+                VolumeDbAccessExceptionFuncId::SAVE_MUTE_STATUS_INTERNAL), static_cast<int32_t>(ret));
+            AUDIO_ERR_LOG("Save %{public}zu mute values to datashare failed, ret %{public}d", boolInfos.size(), ret);
+        }
+    }
+    AUDIO_INFO_LOG("Flush %{public}zu volume and %{public}zu mute values", intInfos.size(), boolInfos.size());
+}
+
+void VolumeDataMaintainer::SetDbWriter(std::shared_ptr<VolumeDbWriter> dbWriter)
+{
+    std::lock_guard<std::mutex> lock(pendingDbMutex_);
+    dbWriter_ = dbWriter;
+}
+
+void VolumeDataMaintainer::StopDbFlushThread()
+{
+    {
+        std::lock_guard<std::mutex> lock(pendingDbMutex_);
+        isDbFlushStopping_ = true;
+    }
+    pendingDbCv_.notify_all();
+    if (dbFlushThread_.joinable()) {
+        dbFlushThread_.join();
+    }
+    FlushPendingDbWrites();
+}
 } // namespace AudioStandard
 } // namespace OHOS
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AUDIO_CONFIG_CACHE_H
+#define AUDIO_CONFIG_CACHE_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace OHOS {
+namespace AudioStandard {
+
+class AudioConfigCacheWriter {
+public:
+    void WriteInt32(int32_t value);
+    void WriteUint32(uint32_t value);
+    void WriteBool(bool value);
+    void WriteString(const std::string &value);
+    const std::vector<uint8_t> &GetData() const;
+
+private:
+    void WriteRaw(const void *data, size_t size);
+
+    std::vector<uint8_t> data_;
+};
+
+// Every read fails once the payload is exhausted, so a truncated blob is detected instead of read past its end.
+class AudioConfigCacheReader {
+public:
+    AudioConfigCacheReader(const uint8_t *data, size_t size);
+    bool ReadInt32(int32_t &value);
+    bool ReadUint32(uint32_t &value);
+    bool ReadBool(bool &value);
+    bool ReadString(std::string &value);
+    bool IsEnd() const;
+
+private:
+    bool ReadRaw(void *data, size_t size);
+
+    const uint8_t *data_ = nullptr;
+    size_t size_ = 0;
+    size_t pos_ = 0;
+};
+
+/**
+ * Binary copy of a parsed XML config. The blob records the hash and size of the XML it was made from and is only
+ * used while they still match, so an updated config is parsed again and replaces the blob. The payload layout is
+ * owned by each parser; bump CACHE_VERSION whenever one of them changes.
+ *
+ * On a miss the caller parses GetSource(), the XML bytes Load hashed, so Store keys the blob on exactly the bytes
+ * the payload was made from even if the file is replaced meanwhile.
+ */
+class AudioConfigCache {
+public:
+    static constexpr uint32_t CACHE_VERSION = 2;
+
+    AudioConfigCache(const std::string &name, const std::string &sourcePath,
+        const std::string &cacheDir = DEFAULT_CACHE_DIR);
+
+    // Maps the blob and hands its payload to parsePayload. False when the blob is missing, stale or corrupt.
+    bool Load(const std::function<bool(AudioConfigCacheReader &reader)> &parsePayload);
+    // Stores the payload under the source last read by Load, reads it first when there is none.
+    bool Store(const AudioConfigCacheWriter &writer);
+    // False when Load could not read the source.
+    bool HasSource() const;
+    const std::string &GetSource() const;
+    std::string GetCachePath() const;
+
+    static uint64_t Hash(const uint8_t *data, size_t size, uint64_t hash = HASH_OFFSET_BASIS);
+
+private:
+    static constexpr char DEFAULT_CACHE_DIR[] = "/data/service/el1/public/audio_policy/config_cache";
+    static constexpr uint64_t HASH_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+
+    bool ReadSource();
+
+    std::string sourcePath_;
+    std::string cacheDir_;
+    std::string cachePath_;
+    std::string source_;
+    uint64_t sourceHash_ = 0;
+    bool isSourceRead_ = false;
+};
+} // namespace AudioStandard
+} // namespace OHOS
+#endif // AUDIO_CONFIG_CACHE_H
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AUDIO_CONFIG_PRELOADER_H
+#define AUDIO_CONFIG_PRELOADER_H
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "audio_errors.h"
+#include "audio_effect_config_parser.h"
+#include "audio_focus_parser.h"
+#include "audio_tone_parser.h"
+#include "audio_volume_parser.h"
+
+namespace OHOS {
+namespace AudioStandard {
+using FocusConfigMap = std::map<std::pair<AudioFocusType, AudioFocusType>, AudioFocusEntry>;
+
+/**
+ * Parses the xml configs that do not depend on each other on a small pool of threads during policy server start.
+ * Preload returns after every parser finished, the owners then take their result instead of parsing the xml
+ * again. A result can be taken once; a Take call that returns false leaves the owner to parse it serially.
+ */
+class AudioConfigPreloader {
+public:
+    static AudioConfigPreloader &GetInstance();
+
+    AudioConfigPreloader() = default;
+    ~AudioConfigPreloader() = default;
+
+    void Preload();
+
+    bool TakeFocusConfig(FocusConfigMap &focusMap, int32_t &ret);
+    bool TakeVolumeConfig(StreamVolumeInfoMap &streamVolumeInfoMap, int32_t &ret);
+    bool TakeEffectConfig(OriginalEffectConfig &effectConfig, int32_t &ret);
+#ifdef FEATURE_DTMF_TONE
+    bool TakeToneConfig(ToneInfoMap &toneDescriptorMap,
+        std::unordered_map<std::string, ToneInfoMap> &customToneDescriptorMap, int32_t &ret);
+#endif
+
+private:
+    static constexpr size_t MAX_PRELOAD_THREAD_NUM = 3;
+
+    template <typename T>
+    struct PreloadResult {
+        bool isReady = false;
+        int32_t ret = ERROR;
+        T config;
+    };
+
+    template <typename T>
+    bool TakeResult(PreloadResult<T> &result, T &config, int32_t &ret);
+    void RunTasks(const std::vector<std::function<void()>> &tasks);
+
+    std::mutex mutex_;
+    PreloadResult<FocusConfigMap> focusResult_;
+    PreloadResult<StreamVolumeInfoMap> volumeResult_;
+    PreloadResult<OriginalEffectConfig> effectResult_;
+#ifdef FEATURE_DTMF_TONE
+    struct ToneConfig {
+        ToneInfoMap toneDescriptorMap;
+        std::unordered_map<std::string, ToneInfoMap> customToneDescriptorMap;
+    };
+    PreloadResult<ToneConfig> toneResult_;
+#endif
+};
+} // namespace AudioStandard
+} // namespace OHOS
+#endif // AUDIO_CONFIG_PRELOADER_H
@@ -23,6 +23,7 @@
 #include <cstdio>
 #include "audio_policy_log.h"
 #include "audio_effect.h"
+#include "audio_config_cache.h"
 
 namespace OHOS {
 namespace AudioStandard {
@@ -48,6 +49,14 @@ public:
     explicit AudioEffectConfigParser();
     ~AudioEffectConfigParser();
     int32_t LoadEffectConfig(OriginalEffectConfig &result);
+    // Same result as LoadEffectConfig, taken from the binary config cache while the xml is unchanged.
+    int32_t LoadEffectConfigWithCache(OriginalEffectConfig &result);
+
+private:
+    static constexpr char AUDIO_EFFECT_CACHE_NAME[] = "audio_effect_config";
+
+    static void WriteEffectConfig(const OriginalEffectConfig &config, AudioConfigCacheWriter &writer);
+    static bool ReadEffectConfig(AudioConfigCacheReader &reader, OriginalEffectConfig &config);
 };
 } // namespace AudioStandard
 } // namespace OHOS
@@ -21,6 +21,7 @@
 #include "audio_info.h"
 #include "audio_policy_log.h"
 #include "audio_xml_parser.h"
+#include "audio_config_cache.h"
 
 namespace OHOS {
 namespace AudioStandard {
@@ -30,6 +31,8 @@ public:
     AudioFocusParser();
     virtual ~AudioFocusParser();
     int32_t LoadConfig(std::map<std::pair<AudioFocusType, AudioFocusType>, AudioFocusEntry> &focusMap);
+    // Same result as LoadConfig, taken from the binary config cache while the xml is unchanged.
+    int32_t LoadConfigWithCache(std::map<std::pair<AudioFocusType, AudioFocusType>, AudioFocusEntry> &focusMap);
 
 private:
     #ifdef USE_CONFIG_POLICY
@@ -41,8 +44,15 @@ private:
     static std::map<std::string, InterruptHint> actionMap;
     static std::map<std::string, ActionTarget> targetMap;
     static std::map<std::string, InterruptForceType> forceMap;
+    static constexpr char AUDIO_FOCUS_CACHE_NAME[] = "audio_interrupt_policy_config";
     std::shared_ptr<AudioXmlNode> curNode_ = nullptr;
 
+    std::string GetConfigFilePath();
+    int32_t ParseFocusConfig(std::map<std::pair<AudioFocusType, AudioFocusType>, AudioFocusEntry> &focusMap);
+    static void WriteFocusMap(const std::map<std::pair<AudioFocusType, AudioFocusType>, AudioFocusEntry> &focusMap,
+        AudioConfigCacheWriter &writer);
+    static bool ReadFocusMap(AudioConfigCacheReader &reader,
+        std::map<std::pair<AudioFocusType, AudioFocusType>, AudioFocusEntry> &focusMap);
     void LoadDefaultConfig(std::map<std::pair<AudioFocusType, AudioFocusType>, AudioFocusEntry> &focusMap);
     void ParseFocusChildrenMap(std::shared_ptr<AudioXmlNode> curNode, const std::string &curStream,
         std::map<std::pair<AudioFocusType, AudioFocusType>, AudioFocusEntry> &focusMap);
@@ -25,6 +25,7 @@
 #include "audio_info.h"
 #include "audio_policy_log.h"
 #include "audio_xml_parser.h"
+#include "audio_config_cache.h"
 
 namespace OHOS {
 namespace AudioStandard {
@@ -37,8 +38,19 @@ public:
     int32_t LoadConfig(ToneInfoMap &toneDescriptorMap);
     int32_t LoadNewConfig(const std::string &configPath, ToneInfoMap &toneDescriptorMap,
         std::unordered_map<std::string, ToneInfoMap> &customToneDescriptorMap);
+    // Same result as LoadNewConfig, taken from the binary config cache while the xml is unchanged.
+    int32_t LoadNewConfigWithCache(const std::string &configPath, ToneInfoMap &toneDescriptorMap,
+        std::unordered_map<std::string, ToneInfoMap> &customToneDescriptorMap);
 
 private:
+    static constexpr char AUDIO_TONE_CACHE_NAME[] = "audio_tone_dtmf_config";
+
+    int32_t ParseNewConfig(std::shared_ptr<AudioXmlNode> curNode, const std::string &configPath,
+        ToneInfoMap &toneDescriptorMap, std::unordered_map<std::string, ToneInfoMap> &customToneDescriptorMap);
+    static void WriteToneConfig(const ToneInfoMap &toneDescriptorMap,
+        const std::unordered_map<std::string, ToneInfoMap> &customToneDescriptorMap, AudioConfigCacheWriter &writer);
+    static bool ReadToneConfig(AudioConfigCacheReader &reader, ToneInfoMap &toneDescriptorMap,
+        std::unordered_map<std::string, ToneInfoMap> &customToneDescriptorMap);
     void ParseSegment(std::shared_ptr<AudioXmlNode> curNode, int32_t segInx, std::shared_ptr<ToneInfo> ltoneDesc);
     void ParseToneInfoAttribute(std::shared_ptr<AudioXmlNode>, std::shared_ptr<ToneInfo> ltoneDesc);
     void ParseToneInfo(std::shared_ptr<AudioXmlNode>, std::vector<ToneInfoMap*> &toneDescriptorMaps);
@@ -24,6 +24,7 @@
 #include "audio_policy_log.h"
 #include "audio_volume_config.h"
 #include "audio_xml_parser.h"
+#include "audio_config_cache.h"
 
 namespace OHOS {
 namespace AudioStandard {
@@ -33,12 +34,15 @@ public:
     AudioVolumeParser();
     virtual ~AudioVolumeParser();
     int32_t LoadConfig(StreamVolumeInfoMap &streamVolumeInfoMap);
+    // Same result as LoadConfig, taken from the binary config cache while the xml is unchanged.
+    int32_t LoadConfigWithCache(StreamVolumeInfoMap &streamVolumeInfoMap);
 private:
     #ifdef USE_CONFIG_POLICY
     static constexpr char AUDIO_VOLUME_CONFIG_FILE[] = "etc/audio/audio_volume_config.xml";
     #else
     static constexpr char AUDIO_VOLUME_CONFIG_FILE[] = "system/etc/audio/audio_volume_config.xml";
     #endif
+    static constexpr char AUDIO_VOLUME_CACHE_NAME[] = "audio_volume_config";
     std::map<std::string, AudioVolumeType> audioStreamMap_;
     std::map<std::string, DeviceVolumeType> audioDeviceMap_;
 
@@ -50,8 +54,15 @@ private:
         std::shared_ptr<StreamVolumeInfo> &streamVolInfo);
     void ParseVolumePoints(std::shared_ptr<AudioXmlNode> curNode, std::shared_ptr<DeviceVolumeInfo> &deviceVolInfo);
     int32_t ParseVolumeConfig(const char *path, StreamVolumeInfoMap &streamVolumeInfoMap);
+    int32_t ParseVolumeConfigData(const std::string &data, const char *path, StreamVolumeInfoMap &streamVolumeInfoMap);
+    int32_t ParseVolumeConfigRoot(std::shared_ptr<AudioXmlNode> curNode, const char *path,
+        StreamVolumeInfoMap &streamVolumeInfoMap);
     void WriteVolumeConfigErrorEvent();
     int32_t UseVoiceAssistantFixedVolumeConfig(StreamVolumeInfoMap &streamVolumeInfoMap);
+    std::string GetConfigFilePath();
+    static void WriteStreamVolumeInfos(const StreamVolumeInfoMap &streamVolumeInfoMap, AudioConfigCacheWriter &writer);
+    static bool ReadStreamVolumeInfos(AudioConfigCacheReader &reader, StreamVolumeInfoMap &streamVolumeInfoMap);
+    static bool ReadDeviceVolumeInfo(AudioConfigCacheReader &reader, std::shared_ptr<DeviceVolumeInfo> &deviceVolInfo);
 };
 } // namespace AudioStandard
 } // namespace OHOS
@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LOG_TAG
+#define LOG_TAG "AudioConfigCache"
+#endif
+
+#include "audio_config_cache.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "securec.h"
+#include "audio_policy_log.h"
+
+namespace OHOS {
+namespace AudioStandard {
+namespace {
+constexpr uint32_t CACHE_MAGIC = 0x47464341; // "ACFG"
+constexpr uint64_t HASH_PRIME = 0x100000001b3ULL;
+constexpr size_t READ_CHUNK_SIZE = 4096;
+constexpr mode_t CACHE_DIR_MODE = 0750;
+constexpr mode_t CACHE_FILE_MODE = 0640;
+constexpr char CACHE_TMP_SUFFIX[] = ".XXXXXX";
+
+struct CacheHeader {
+    uint32_t magic = CACHE_MAGIC;
+    uint32_t version = AudioConfigCache::CACHE_VERSION;
+    uint64_t sourceHash = 0;
+    uint64_t sourceSize = 0;
+    uint64_t payloadHash = 0;
+    uint64_t payloadSize = 0;
+};
+
+bool WriteAll(int fd, const void *data, size_t size)
+{
+    const uint8_t *pos = static_cast<const uint8_t *>(data);
+    while (size > 0) {
+        ssize_t len = write(fd, pos, size);
+        if (len < 0 && errno == EINTR) {
+            continue;
+        }
+        CHECK_AND_RETURN_RET_LOG(len > 0, false, "write failed, errno %{public}d", errno);
+        pos += len;
+        size -= static_cast<size_t>(len);
+    }
+    return true;
+}
+}
+
+void AudioConfigCacheWriter::WriteRaw(const void *data, size_t size)
+{
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    data_.insert(data_.end(), bytes, bytes + size);
+}
+
+void AudioConfigCacheWriter::WriteInt32(int32_t value)
+{
+    WriteRaw(&value, sizeof(value));
+}
+
+void AudioConfigCacheWriter::WriteUint32(uint32_t value)
+{
+    WriteRaw(&value, sizeof(value));
+}
+
+void AudioConfigCacheWriter::WriteBool(bool value)
+{
+    uint8_t byte = value ? 1 : 0;
+    WriteRaw(&byte, sizeof(byte));
+}
+
+void AudioConfigCacheWriter::WriteString(const std::string &value)
+{
+    WriteUint32(static_cast<uint32_t>(value.size()));
+    WriteRaw(value.data(), value.size());
+}
+
+const std::vector<uint8_t> &AudioConfigCacheWriter::GetData() const
+{
+    return data_;
+}
+
+AudioConfigCacheReader::AudioConfigCacheReader(const uint8_t *data, size_t size) : data_(data), size_(size)
+{
+}
+
+bool AudioConfigCacheReader::ReadRaw(void *data, size_t size)
+{
+    if (size > size_ - pos_) {
+        return false;
+    }
+    if (size > 0) {
+        CHECK_AND_RETURN_RET(memcpy_s(data, size, data_ + pos_, size) == EOK, false);
+    }
+    pos_ += size;
+    return true;
+}
+
+bool AudioConfigCacheReader::ReadInt32(int32_t &value)
+{
+    return ReadRaw(&value, sizeof(value));
+}
+
+bool AudioConfigCacheReader::ReadUint32(uint32_t &value)
+{
+    return ReadRaw(&value, sizeof(value));
+}
+
+bool AudioConfigCacheReader::ReadBool(bool &value)
+{
+    uint8_t byte = 0;
+    CHECK_AND_RETURN_RET(ReadRaw(&byte, sizeof(byte)) && byte <= 1, false);
+    value = byte == 1;
+    return true;
+}
+
+bool AudioConfigCacheReader::ReadString(std::string &value)
+{
+    uint32_t len = 0;
+    CHECK_AND_RETURN_RET(ReadUint32(len) && len <= size_ - pos_, false);
+    value.assign(reinterpret_cast<const char *>(data_ + pos_), len);
+    pos_ += len;
+    return true;
+}
+
+bool AudioConfigCacheReader::IsEnd() const
+{
+    return pos_ == size_;
+}
+
+AudioConfigCache::AudioConfigCache(const std::string &name, const std::string &sourcePath,
+    const std::string &cacheDir)
+    : sourcePath_(sourcePath), cacheDir_(cacheDir), cachePath_(cacheDir + "/" + name + ".bin")
+{
+}
+
+std::string AudioConfigCache::GetCachePath() const
+{
+    return cachePath_;
+}
+
+uint64_t AudioConfigCache::Hash(const uint8_t *data, size_t size, uint64_t hash)
+{
+    // FNV-1a
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= HASH_PRIME;
+    }
+    return hash;
+}
+
+bool AudioConfigCache::ReadSource()
+{
+    isSourceRead_ = false;
+    source_.clear();
+    int fd = open(sourcePath_.c_str(), O_RDONLY | O_CLOEXEC);
+    CHECK_AND_RETURN_RET_LOG(fd >= 0, false, "open %{public}s failed, errno %{public}d", sourcePath_.c_str(), errno);
+    char buffer[READ_CHUNK_SIZE];
+    ssize_t len = 0;
+    while ((len = read(fd, buffer, sizeof(buffer))) != 0) {
+        if (len < 0 && errno == EINTR) {
+            continue;
+        }
+        if (len < 0) {
+            AUDIO_ERR_LOG("read %{public}s failed, errno %{public}d", sourcePath_.c_str(), errno);
+            close(fd);
+            source_.clear();
+            return false;
+        }
+        source_.append(buffer, static_cast<size_t>(len));
+    }
+    close(fd);
+    sourceHash_ = Hash(reinterpret_cast<const uint8_t *>(source_.data()), source_.size());
+    isSourceRead_ = true;
+    return true;
+}
+
+bool AudioConfigCache::HasSource() const
+{
+    return isSourceRead_;
+}
+
+const std::string &AudioConfigCache::GetSource() const
+{
+    return source_;
+}
+
+bool AudioConfigCache::Load(const std::function<bool(AudioConfigCacheReader &reader)> &parsePayload)
+{
+    CHECK_AND_RETURN_RET(ReadSource(), false);
+    uint64_t sourceHash = sourceHash_;
+    uint64_t sourceSize = static_cast<uint64_t>(source_.size());
+
+    int fd = open(cachePath_.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        AUDIO_INFO_LOG("no cache for %{public}s", sourcePath_.c_str());
+        return false;
+    }
+    struct stat fileStat = {};
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size < static_cast<off_t>(sizeof(CacheHeader))) {
+        AUDIO_WARNING_LOG("invalid cache %{public}s", cachePath_.c_str());
+        close(fd);
+        return false;
+    }
+    size_t fileSize = static_cast<size_t>(fileStat.st_size);
+    void *addr = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    CHECK_AND_RETURN_RET_LOG(addr != MAP_FAILED, false, "mmap %{public}s failed", cachePath_.c_str());
+
+    const uint8_t *blob = static_cast<const uint8_t *>(addr);
+    CacheHeader header;
+    bool ret = memcpy_s(&header, sizeof(header), blob, sizeof(header)) == EOK;
+    const uint8_t *payload = blob + sizeof(CacheHeader);
+    size_t payloadSize = fileSize - sizeof(CacheHeader);
+    if (ret && (header.magic != CACHE_MAGIC || header.version != CACHE_VERSION || header.sourceHash != sourceHash ||
+        header.sourceSize != sourceSize)) {
+        AUDIO_INFO_LOG("stale cache %{public}s", cachePath_.c_str());
+        ret = false;
+    } else if (ret && (header.payloadSize != payloadSize || header.payloadHash != Hash(payload, payloadSize))) {
+        AUDIO_WARNING_LOG("corrupt cache %{public}s", cachePath_.c_str());
+        ret = false;
+    }
+    if (ret) {
+        AudioConfigCacheReader reader(payload, payloadSize);
+        ret = parsePayload(reader) && reader.IsEnd();
+        if (!ret) {
+            AUDIO_WARNING_LOG("parse cache %{public}s failed", cachePath_.c_str());
+        }
+    }
+    munmap(addr, fileSize);
+    return ret;
+}
+
+bool AudioConfigCache::Store(const AudioConfigCacheWriter &writer)
+{
+    CHECK_AND_RETURN_RET(isSourceRead_ || ReadSource(), false);
+    CacheHeader header;
+    header.sourceHash = sourceHash_;
+    header.sourceSize = static_cast<uint64_t>(source_.size());
+    const std::vector<uint8_t> &payload = writer.GetData();
+    header.payloadSize = payload.size();
+    header.payloadHash = Hash(payload.data(), payload.size());
+
+    if (mkdir(cacheDir_.c_str(), CACHE_DIR_MODE) != 0 && errno != EEXIST) {
+        AUDIO_ERR_LOG("mkdir %{public}s failed, errno %{public}d", cacheDir_.c_str(), errno);
+        return false;
+    }
+    // write aside and rename, a reader never sees a half written blob. Each store gets its own temp file so two
+    // stores of the same config cannot interleave their writes, the last rename wins with a complete blob.
+    std::string tmpPath = cachePath_ + CACHE_TMP_SUFFIX;
+    int fd = mkostemp(&tmpPath[0], O_CLOEXEC);
+    CHECK_AND_RETURN_RET_LOG(fd >= 0, false, "create %{public}s failed, errno %{public}d", tmpPath.c_str(), errno);
+    bool ret = fchmod(fd, CACHE_FILE_MODE) == 0 && WriteAll(fd, &header, sizeof(header)) &&
+        WriteAll(fd, payload.data(), payload.size()) && fsync(fd) == 0;
+    close(fd);
+    if (!ret || rename(tmpPath.c_str(), cachePath_.c_str()) != 0) {
+        AUDIO_ERR_LOG("store %{public}s failed, errno %{public}d", cachePath_.c_str(), errno);
+        unlink(tmpPath.c_str());
+        return false;
+    }
+    AUDIO_INFO_LOG("stored %{public}s, payload %{public}zu bytes", cachePath_.c_str(), payload.size());
+    return true;
+}
+} // namespace AudioStandard
+} // namespace OHOS
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LOG_TAG
+#define LOG_TAG "AudioConfigPreloader"
+#endif
+
+#include "audio_config_preloader.h"
+
+#include <algorithm>
+#include <atomic>
+#include <pthread.h>
+#include <thread>
+
+#include "audio_utils.h"
+#include "audio_xml_parser.h"
+
+namespace OHOS {
+namespace AudioStandard {
+AudioConfigPreloader &AudioConfigPreloader::GetInstance()
+{
+    static AudioConfigPreloader instance;
+    return instance;
+}
+
+void AudioConfigPreloader::Preload()
+{
+    Trace trace("AudioConfigPreloader::Preload");
+    std::lock_guard<std::mutex> lock(mutex_);
+    // every task only writes its own result, the join in RunTasks publishes them to the caller. The parsers add
+    // to what they are given, so a result that was never taken is cleared first.
+    std::vector<std::function<void()>> tasks = {
+        [this] {
+            AudioEffectConfigParser parser;
+            effectResult_.config = {};
+            effectResult_.ret = parser.LoadEffectConfigWithCache(effectResult_.config);
+        },
+        [this] {
+            AudioFocusParser parser;
+            focusResult_.config = {};
+            focusResult_.ret = parser.LoadConfigWithCache(focusResult_.config);
+        },
+        [this] {
+            AudioVolumeParser parser;
+            volumeResult_.config = {};
+            volumeResult_.ret = parser.LoadConfigWithCache(volumeResult_.config);
+        },
+#ifdef FEATURE_DTMF_TONE
+        [this] {
+            AudioToneParser parser;
+            toneResult_.config = {};
+            toneResult_.ret = parser.LoadNewConfigWithCache(AudioToneParser::AUDIO_TONE_CONFIG_FILE,
+                toneResult_.config.toneDescriptorMap, toneResult_.config.customToneDescriptorMap);
+        },
+#endif
+    };
+    // hold libxml2 for the whole preload: the first reference opens it and sets the parser up on this thread
+    // before the workers parse concurrently, and a parser that finishes early cannot drop the last reference,
+    // which would clean libxml2 up and close it under the parsers still running
+    bool isXmlOpened = DlopenUtils::Init();
+    RunTasks(tasks);
+    if (isXmlOpened) {
+        DlopenUtils::DeInit();
+    }
+
+    effectResult_.isReady = true;
+    focusResult_.isReady = true;
+    volumeResult_.isReady = true;
+#ifdef FEATURE_DTMF_TONE
+    toneResult_.isReady = true;
+#endif
+    AUDIO_INFO_LOG("preloaded %{public}zu configs", tasks.size());
+}
+
+void AudioConfigPreloader::RunTasks(const std::vector<std::function<void()>> &tasks)
+{
+    std::atomic<size_t> nextTask{0};
+    auto worker = [&tasks, &nextTask] {
+        for (size_t i = nextTask.fetch_add(1); i < tasks.size(); i = nextTask.fetch_add(1)) {
+            tasks[i]();
+        }
+    };
+    // the calling thread is one of the workers
+    size_t threadNum = std::min(tasks.size(), MAX_PRELOAD_THREAD_NUM);
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < threadNum; i++) {
+        threads.emplace_back(worker);
+        pthread_setname_np(threads.back().native_handle(), "APConfigLoad");
+    }
+    worker();
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+
+template <typename T>
+bool AudioConfigPreloader::TakeResult(PreloadResult<T> &result, T &config, int32_t &ret)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    CHECK_AND_RETURN_RET(result.isReady, false);
+    result.isReady = false;
+    ret = result.ret;
+    config = std::move(result.config);
+    result.config = T();
+    return true;
+}
+
+bool AudioConfigPreloader::TakeFocusConfig(FocusConfigMap &focusMap, int32_t &ret)
+{
+    return TakeResult(focusResult_, focusMap, ret);
+}
+
+bool AudioConfigPreloader::TakeVolumeConfig(StreamVolumeInfoMap &streamVolumeInfoMap, int32_t &ret)
+{
+    return TakeResult(volumeResult_, streamVolumeInfoMap, ret);
+}
+
+bool AudioConfigPreloader::TakeEffectConfig(OriginalEffectConfig &effectConfig, int32_t &ret)
+{
+    return TakeResult(effectResult_, effectConfig, ret);
+}
+
+#ifdef FEATURE_DTMF_TONE
+bool AudioConfigPreloader::TakeToneConfig(ToneInfoMap &toneDescriptorMap,
+    std::unordered_map<std::string, ToneInfoMap> &customToneDescriptorMap, int32_t &ret)
+{
+    ToneConfig toneConfig;
+    CHECK_AND_RETURN_RET(TakeResult(toneResult_, toneConfig, ret), false);
+    toneDescriptorMap = std::move(toneConfig.toneDescriptorMap);
+    customToneDescriptorMap = std::move(toneConfig.customToneDescriptorMap);
+    return true;
+}
+#endif
+} // namespace AudioStandard
+} // namespace OHOS
@@ -45,10 +45,8 @@ static constexpr int32_t AUDIO_EFFECT_COUNT_FIRST_NODE_UPPER_LIMIT = 1;
 static constexpr int32_t AUDIO_EFFECT_COUNT_POST_SECOND_NODE_UPPER_LIMIT = 1;
 static constexpr int32_t AUDIO_EFFECT_COUNT_PRE_SECOND_NODE_UPPER_LIMIT = 1;
 constexpr int32_t AUDIO_EFFECT_COUNT_STREAM_USAGE_UPPER_LIMIT = 200;
-#ifdef USE_CONFIG_POLICY
 static constexpr uint32_t XML_PARSE_NOERROR = 1 << 5;
 static constexpr uint32_t XML_PARSE_NOWARNING = 1 << 6;
-#endif
 
 AudioEffectConfigParser::AudioEffectConfigParser()
 {
@@ -59,26 +57,40 @@ AudioEffectConfigParser::~AudioEffectConfigParser()
 {
 }
 
-static int32_t ParseEffectConfigFile(std::shared_ptr<AudioXmlNode> curNode)
+static std::string GetEffectConfigFilePath()
 {
-    int32_t ret = 0;
 #ifdef USE_CONFIG_POLICY
     char buf[MAX_PATH_LEN];
     char *path = GetOneCfgFile(AUDIO_EFFECT_CONFIG_FILE, buf, MAX_PATH_LEN);
     if (path != nullptr && *path != '\0') {
         AUDIO_INFO_LOG("effect config file path: %{public}s", path);
-        ret = curNode->Config(path, nullptr, XML_PARSE_NOERROR | XML_PARSE_NOWARNING);
+        return path;
     }
 #endif
+    return "";
+}
+
+static void WriteEffectConfigErrorEvent()
+{
+    AUDIO_ERR_LOG("error: could not parse audio_effect_config.xml!");
+    Trace trace("SYSEVENT FAULT EVENT LOAD_CONFIG_ERROR, CATEGORY: "
+        + std::to_string(Media::MediaMonitor::AUDIO_EFFECT_CONFIG));
+    std::shared_ptr<Media::MediaMonitor::EventBean> bean = std::make_shared<Media::MediaMonitor::EventBean>(
+        Media::MediaMonitor::AUDIO, Media::MediaMonitor::LOAD_CONFIG_ERROR,
+        Media::MediaMonitor::FAULT_EVENT);
+    bean->Add("CATEGORY", Media::MediaMonitor::AUDIO_EFFECT_CONFIG);
+    Media::MediaMonitor::MediaMonitorManager::GetInstance().WriteLogMsg(bean);
+}
+
+static int32_t ParseEffectConfigFile(std::shared_ptr<AudioXmlNode> curNode)
+{
+    int32_t ret = 0;
+    std::string path = GetEffectConfigFilePath();
+    if (!path.empty()) {
+        ret = curNode->Config(path.c_str(), nullptr, XML_PARSE_NOERROR | XML_PARSE_NOWARNING);
+    }
     if (ret != SUCCESS) {
-        AUDIO_ERR_LOG("error: could not parse audio_effect_config.xml!");
-        Trace trace("SYSEVENT FAULT EVENT LOAD_CONFIG_ERROR, CATEGORY: "
-            + std::to_string(Media::MediaMonitor::AUDIO_EFFECT_CONFIG));
-        std::shared_ptr<Media::MediaMonitor::EventBean> bean = std::make_shared<Media::MediaMonitor::EventBean>(
-            Media::MediaMonitor::AUDIO, Media::MediaMonitor::LOAD_CONFIG_ERROR,
-            Media::MediaMonitor::FAULT_EVENT);
-        bean->Add("CATEGORY", Media::MediaMonitor::AUDIO_EFFECT_CONFIG);
-        Media::MediaMonitor::MediaMonitorManager::GetInstance().WriteLogMsg(bean);
+        WriteEffectConfigErrorEvent();
         return FILE_PARSE_ERROR;
     }
     return 0;
@@ -757,14 +769,9 @@ static void LoadEffectConfigException(OriginalEffectConfig &result, std::shared_
     }
 }
 
-int32_t AudioEffectConfigParser::LoadEffectConfig(OriginalEffectConfig &result)
+static int32_t ParseEffectConfig(OriginalEffectConfig &result, std::shared_ptr<AudioXmlNode> curNode)
 {
     int32_t countFirstNode[NODE_SIZE] = {0};
-    std::shared_ptr<AudioXmlNode> curNode = AudioXmlNode::Create();
-
-    int32_t ret = ParseEffectConfigFile(curNode);
-    CHECK_AND_RETURN_RET_LOG(ret == 0, ret, "error: could not parse audio effect config file");
-
     if (LoadConfigCheck(curNode->GetCopyNode()) == 0) {
         curNode->GetProp("version", result.version);
         curNode->MoveToChildren();
@@ -800,8 +807,186 @@ int32_t AudioEffectConfigParser::LoadEffectConfig(OriginalEffectConfig &result)
         }
     }
 
-    curNode = nullptr;
     return 0;
 }
+
+int32_t AudioEffectConfigParser::LoadEffectConfig(OriginalEffectConfig &result)
+{
+    std::shared_ptr<AudioXmlNode> curNode = AudioXmlNode::Create();
+
+    int32_t ret = ParseEffectConfigFile(curNode);
+    CHECK_AND_RETURN_RET_LOG(ret == 0, ret, "error: could not parse audio effect config file");
+    return ParseEffectConfig(result, curNode);
+}
+
+int32_t AudioEffectConfigParser::LoadEffectConfigWithCache(OriginalEffectConfig &result)
+{
+    std::string path = GetEffectConfigFilePath();
+    if (path.empty()) {
+        return LoadEffectConfig(result);
+    }
+    AudioConfigCache cache(AUDIO_EFFECT_CACHE_NAME, path);
+    if (cache.Load([&result](AudioConfigCacheReader &reader) { return ReadEffectConfig(reader, result); })) {
+        AUDIO_INFO_LOG("effect config loaded from cache, %{public}zu effects", result.effects.size());
+        return SUCCESS;
+    }
+    result = OriginalEffectConfig();
+    if (!cache.HasSource()) {
+        return LoadEffectConfig(result);
+    }
+    // parse the bytes the cache hashed, so the blob never describes a different xml than its key
+    const std::string &source = cache.GetSource();
+    std::shared_ptr<AudioXmlNode> curNode = AudioXmlNode::Create();
+    if (curNode->ConfigMemory(source.data(), static_cast<int32_t>(source.size()), nullptr,
+        XML_PARSE_NOERROR | XML_PARSE_NOWARNING) != SUCCESS) {
+        WriteEffectConfigErrorEvent();
+        return FILE_PARSE_ERROR;
+    }
+    int32_t ret = ParseEffectConfig(result, curNode);
+    CHECK_AND_RETURN_RET(ret == 0, ret);
+    AudioConfigCacheWriter writer;
+    WriteEffectConfig(result, writer);
+    cache.Store(writer);
+    return SUCCESS;
+}
+
+static void WriteStrings(const std::vector<std::string> &values, AudioConfigCacheWriter &writer)
+{
+    writer.WriteUint32(static_cast<uint32_t>(values.size()));
+    for (const auto &value : values) {
+        writer.WriteString(value);
+    }
+}
+
+static bool ReadStrings(AudioConfigCacheReader &reader, std::vector<std::string> &values)
+{
+    uint32_t num = 0;
+    CHECK_AND_RETURN_RET(reader.ReadUint32(num), false);
+    for (uint32_t i = 0; i < num; i++) {
+        std::string value;
+        CHECK_AND_RETURN_RET(reader.ReadString(value), false);
+        values.push_back(std::move(value));
+    }
+    return true;
+}
+
+// PreStreamScene and PostStreamScene only differ in type
+template <typename StreamScene>
+static void WriteStreamScenes(const std::vector<StreamScene> &scenes, AudioConfigCacheWriter &writer)
+{
+    writer.WriteUint32(static_cast<uint32_t>(scenes.size()));
+    for (const auto &scene : scenes) {
+        writer.WriteString(scene.stream);
+        WriteStrings(scene.mode, writer);
+        writer.WriteUint32(static_cast<uint32_t>(scene.device.size()));
+        for (const auto &devices : scene.device) {
+            writer.WriteUint32(static_cast<uint32_t>(devices.size()));
+            for (const auto &device : devices) {
+                writer.WriteString(device.type);
+                writer.WriteString(device.chain);
+            }
+        }
+    }
+}
+
+template <typename StreamScene>
+static bool ReadStreamScenes(AudioConfigCacheReader &reader, std::vector<StreamScene> &scenes)
+{
+    uint32_t sceneNum = 0;
+    CHECK_AND_RETURN_RET(reader.ReadUint32(sceneNum), false);
+    for (uint32_t i = 0; i < sceneNum; i++) {
+        StreamScene scene;
+        uint32_t deviceListNum = 0;
+        CHECK_AND_RETURN_RET(reader.ReadString(scene.stream) && ReadStrings(reader, scene.mode) &&
+            reader.ReadUint32(deviceListNum), false);
+        for (uint32_t j = 0; j < deviceListNum; j++) {
+            std::vector<Device> devices;
+            uint32_t deviceNum = 0;
+            CHECK_AND_RETURN_RET(reader.ReadUint32(deviceNum), false);
+            for (uint32_t k = 0; k < deviceNum; k++) {
+                Device device;
+                CHECK_AND_RETURN_RET(reader.ReadString(device.type) && reader.ReadString(device.chain), false);
+                devices.push_back(std::move(device));
+            }
+            scene.device.push_back(std::move(devices));
+        }
+        scenes.push_back(std::move(scene));
+    }
+    return true;
+}
+
+void AudioEffectConfigParser::WriteEffectConfig(const OriginalEffectConfig &config, AudioConfigCacheWriter &writer)
+{
+    writer.WriteString(config.version);
+    writer.WriteUint32(static_cast<uint32_t>(config.libraries.size()));
+    for (const auto &library : config.libraries) {
+        writer.WriteString(library.name);
+        writer.WriteString(library.path);
+    }
+    writer.WriteUint32(static_cast<uint32_t>(config.effects.size()));
+    for (const auto &effect : config.effects) {
+        writer.WriteString(effect.name);
+        writer.WriteString(effect.libraryName);
+        WriteStrings(effect.effectProperty, writer);
+    }
+    writer.WriteUint32(static_cast<uint32_t>(config.effectChains.size()));
+    for (const auto &effectChain : config.effectChains) {
+        writer.WriteString(effectChain.name);
+        WriteStrings(effectChain.apply, writer);
+        writer.WriteString(effectChain.label);
+    }
+    writer.WriteUint32(config.preProcess.maxExtSceneNum);
+    WriteStreamScenes(config.preProcess.defaultScenes, writer);
+    WriteStreamScenes(config.preProcess.priorScenes, writer);
+    WriteStreamScenes(config.preProcess.normalScenes, writer);
+    writer.WriteUint32(config.postProcess.maxExtSceneNum);
+    WriteStreamScenes(config.postProcess.defaultScenes, writer);
+    WriteStreamScenes(config.postProcess.priorScenes, writer);
+    WriteStreamScenes(config.postProcess.normalScenes, writer);
+    writer.WriteUint32(static_cast<uint32_t>(config.postProcess.sceneMap.size()));
+    for (const auto &item : config.postProcess.sceneMap) {
+        writer.WriteString(item.name);
+        writer.WriteString(item.sceneType);
+    }
+}
+
+bool AudioEffectConfigParser::ReadEffectConfig(AudioConfigCacheReader &reader, OriginalEffectConfig &config)
+{
+    uint32_t num = 0;
+    CHECK_AND_RETURN_RET(reader.ReadString(config.version) && reader.ReadUint32(num), false);
+    for (uint32_t i = 0; i < num; i++) {
+        Library library;
+        CHECK_AND_RETURN_RET(reader.ReadString(library.name) && reader.ReadString(library.path), false);
+        config.libraries.push_back(std::move(library));
+    }
+    CHECK_AND_RETURN_RET(reader.ReadUint32(num), false);
+    for (uint32_t i = 0; i < num; i++) {
+        Effect effect;
+        CHECK_AND_RETURN_RET(reader.ReadString(effect.name) && reader.ReadString(effect.libraryName) &&
+            ReadStrings(reader, effect.effectProperty), false);
+        config.effects.push_back(std::move(effect));
+    }
+    CHECK_AND_RETURN_RET(reader.ReadUint32(num), false);
+    for (uint32_t i = 0; i < num; i++) {
+        EffectChain effectChain;
+        CHECK_AND_RETURN_RET(reader.ReadString(effectChain.name) && ReadStrings(reader, effectChain.apply) &&
+            reader.ReadString(effectChain.label), false);
+        config.effectChains.push_back(std::move(effectChain));
+    }
+    CHECK_AND_RETURN_RET(reader.ReadUint32(config.preProcess.maxExtSceneNum) &&
+        ReadStreamScenes(reader, config.preProcess.defaultScenes) &&
+        ReadStreamScenes(reader, config.preProcess.priorScenes) &&
+        ReadStreamScenes(reader, config.preProcess.normalScenes), false);
+    CHECK_AND_RETURN_RET(reader.ReadUint32(config.postProcess.maxExtSceneNum) &&
+        ReadStreamScenes(reader, config.postProcess.defaultScenes) &&
+        ReadStreamScenes(reader, config.postProcess.priorScenes) &&
+        ReadStreamScenes(reader, config.postProcess.normalScenes) && reader.ReadUint32(num), false);
+    for (uint32_t i = 0; i < num; i++) {
+        SceneMappingItem item;
+        CHECK_AND_RETURN_RET(reader.ReadString(item.name) && reader.ReadString(item.sceneType), false);
+        config.postProcess.sceneMap.push_back(std::move(item));
+    }
+    return true;
+}
 } // namespace AudioStandard
 } // namespace OHOS
\ No newline at end of file
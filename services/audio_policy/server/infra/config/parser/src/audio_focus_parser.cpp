@@ -139,8 +139,7 @@ void AudioFocusParser::LoadDefaultConfig(std::map<std::pair<AudioFocusType, Audi
 {
 }
 
-int32_t AudioFocusParser::LoadConfig(std::map<std::pair<AudioFocusType, AudioFocusType>,
-    AudioFocusEntry> &focusMap)
+std::string AudioFocusParser::GetConfigFilePath()
 {
 #ifdef USE_CONFIG_POLICY
     char buf[MAX_PATH_LEN];
@@ -148,13 +147,26 @@ int32_t AudioFocusParser::LoadConfig(std::map<std::pair<AudioFocusType, AudioFoc
 #else
     const char *path = AUDIO_FOCUS_CONFIG_FILE;
 #endif
-    CHECK_AND_RETURN_RET_LOG(path != nullptr && *path != '\0', ERROR, "invalid path!");
-    if (curNode_->Config(path, nullptr, 0) != SUCCESS) {
-        AUDIO_ERR_LOG("load path: %{public}s fail!", path);
+    return path == nullptr ? "" : path;
+}
+
+int32_t AudioFocusParser::LoadConfig(std::map<std::pair<AudioFocusType, AudioFocusType>,
+    AudioFocusEntry> &focusMap)
+{
+    std::string path = GetConfigFilePath();
+    CHECK_AND_RETURN_RET_LOG(!path.empty(), ERROR, "invalid path!");
+    if (curNode_->Config(path.c_str(), nullptr, 0) != SUCCESS) {
+        AUDIO_ERR_LOG("load path: %{public}s fail!", path.c_str());
         LoadDefaultConfig(focusMap);
         WriteConfigErrorEvent();
         return ERROR;
     }
+    return ParseFocusConfig(focusMap);
+}
+
+int32_t AudioFocusParser::ParseFocusConfig(std::map<std::pair<AudioFocusType, AudioFocusType>,
+    AudioFocusEntry> &focusMap)
+{
     CHECK_AND_RETURN_RET_LOG(curNode_->IsNodeValid(), ERROR, "root element is null");
 
     if (!curNode_->CompareName("audio_focus_policy")) {
@@ -179,6 +191,86 @@ int32_t AudioFocusParser::LoadConfig(std::map<std::pair<AudioFocusType, AudioFoc
     return SUCCESS;
 }
 
+int32_t AudioFocusParser::LoadConfigWithCache(std::map<std::pair<AudioFocusType, AudioFocusType>,
+    AudioFocusEntry> &focusMap)
+{
+    std::string path = GetConfigFilePath();
+    CHECK_AND_RETURN_RET_LOG(!path.empty(), ERROR, "invalid path!");
+    AudioConfigCache cache(AUDIO_FOCUS_CACHE_NAME, path);
+    if (cache.Load([&focusMap](AudioConfigCacheReader &reader) { return ReadFocusMap(reader, focusMap); })) {
+        AUDIO_INFO_LOG("focus config loaded from cache, size %{public}zu", focusMap.size());
+        return SUCCESS;
+    }
+    focusMap.clear();
+    if (!cache.HasSource()) {
+        return LoadConfig(focusMap);
+    }
+    // parse the bytes the cache hashed, so the blob never describes a different xml than its key
+    const std::string &source = cache.GetSource();
+    if (curNode_->ConfigMemory(source.data(), static_cast<int32_t>(source.size()), nullptr, 0) != SUCCESS) {
+        AUDIO_ERR_LOG("load path: %{public}s fail!", path.c_str());
+        LoadDefaultConfig(focusMap);
+        WriteConfigErrorEvent();
+        return ERROR;
+    }
+    int32_t ret = ParseFocusConfig(focusMap);
+    CHECK_AND_RETURN_RET(ret == SUCCESS, ret);
+    AudioConfigCacheWriter writer;
+    WriteFocusMap(focusMap, writer);
+    cache.Store(writer);
+    return SUCCESS;
+}
+
+void AudioFocusParser::WriteFocusMap(const std::map<std::pair<AudioFocusType, AudioFocusType>,
+    AudioFocusEntry> &focusMap, AudioConfigCacheWriter &writer)
+{
+    auto writeFocusType = [&writer](const AudioFocusType &focusType) {
+        writer.WriteInt32(focusType.streamType);
+        writer.WriteInt32(focusType.sourceType);
+        writer.WriteBool(focusType.isPlay);
+    };
+    writer.WriteUint32(static_cast<uint32_t>(focusMap.size()));
+    for (const auto &[focusPair, focusEntry] : focusMap) {
+        writeFocusType(focusPair.first);
+        writeFocusType(focusPair.second);
+        writer.WriteInt32(focusEntry.forceType);
+        writer.WriteInt32(focusEntry.hintType);
+        writer.WriteInt32(focusEntry.actionOn);
+        writer.WriteBool(focusEntry.isReject);
+    }
+}
+
+bool AudioFocusParser::ReadFocusMap(AudioConfigCacheReader &reader,
+    std::map<std::pair<AudioFocusType, AudioFocusType>, AudioFocusEntry> &focusMap)
+{
+    auto readFocusType = [&reader](AudioFocusType &focusType) {
+        int32_t streamType = 0;
+        int32_t sourceType = 0;
+        CHECK_AND_RETURN_RET(reader.ReadInt32(streamType) && reader.ReadInt32(sourceType) &&
+            reader.ReadBool(focusType.isPlay), false);
+        focusType.streamType = static_cast<AudioStreamType>(streamType);
+        focusType.sourceType = static_cast<SourceType>(sourceType);
+        return true;
+    };
+    uint32_t count = 0;
+    CHECK_AND_RETURN_RET(reader.ReadUint32(count), false);
+    for (uint32_t i = 0; i < count; i++) {
+        std::pair<AudioFocusType, AudioFocusType> focusPair;
+        AudioFocusEntry focusEntry;
+        int32_t forceType = 0;
+        int32_t hintType = 0;
+        int32_t actionOn = 0;
+        CHECK_AND_RETURN_RET(readFocusType(focusPair.first) && readFocusType(focusPair.second) &&
+            reader.ReadInt32(forceType) && reader.ReadInt32(hintType) && reader.ReadInt32(actionOn) &&
+            reader.ReadBool(focusEntry.isReject), false);
+        focusEntry.forceType = static_cast<InterruptForceType>(forceType);
+        focusEntry.hintType = static_cast<InterruptHint>(hintType);
+        focusEntry.actionOn = static_cast<ActionTarget>(actionOn);
+        focusMap.emplace(focusPair, focusEntry);
+    }
+    return true;
+}
+
 void AudioFocusParser::WriteConfigErrorEvent()
 {
     Trace trace("SYSEVENT FAULT EVENT LOAD_CONFIG_ERROR, CATEGORY: "
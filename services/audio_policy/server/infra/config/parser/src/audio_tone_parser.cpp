@@ -73,7 +73,41 @@ int32_t AudioToneParser::LoadNewConfig(const std::string &configPath, ToneInfoMa
     std::shared_ptr<AudioXmlNode> curNode = AudioXmlNode::Create();
     CHECK_AND_RETURN_RET_LOG(curNode->Config(configPath.c_str(), nullptr, 0) == SUCCESS, ERROR,
         "error: could not parse file %{public}s", configPath.c_str());
+    return ParseNewConfig(curNode, configPath, toneDescriptorMap, customToneDescriptorMap);
+}
+
+int32_t AudioToneParser::LoadNewConfigWithCache(const std::string &configPath, ToneInfoMap &toneDescriptorMap,
+    std::unordered_map<std::string, ToneInfoMap> &customToneDescriptorMap)
+{
+    AudioConfigCache cache(AUDIO_TONE_CACHE_NAME, configPath);
+    if (cache.Load([&toneDescriptorMap, &customToneDescriptorMap](AudioConfigCacheReader &reader) {
+        return ReadToneConfig(reader, toneDescriptorMap, customToneDescriptorMap);
+    })) {
+        AUDIO_INFO_LOG("tone config loaded from cache, %{public}zu tones, %{public}zu countries",
+            toneDescriptorMap.size(), customToneDescriptorMap.size());
+        return SUCCESS;
+    }
+    toneDescriptorMap.clear();
+    customToneDescriptorMap.clear();
+    if (!cache.HasSource()) {
+        return LoadNewConfig(configPath, toneDescriptorMap, customToneDescriptorMap);
+    }
+    // parse the bytes the cache hashed, so the blob never describes a different xml than its key
+    const std::string &source = cache.GetSource();
+    std::shared_ptr<AudioXmlNode> curNode = AudioXmlNode::Create();
+    CHECK_AND_RETURN_RET_LOG(curNode->ConfigMemory(source.data(), static_cast<int32_t>(source.size()), nullptr, 0) ==
+        SUCCESS, ERROR, "error: could not parse file %{public}s", configPath.c_str());
+    int32_t ret = ParseNewConfig(curNode, configPath, toneDescriptorMap, customToneDescriptorMap);
+    CHECK_AND_RETURN_RET(ret == SUCCESS, ret);
+    AudioConfigCacheWriter writer;
+    WriteToneConfig(toneDescriptorMap, customToneDescriptorMap, writer);
+    cache.Store(writer);
+    return SUCCESS;
+}
 
+int32_t AudioToneParser::ParseNewConfig(std::shared_ptr<AudioXmlNode> curNode, const std::string &configPath,
+    ToneInfoMap &toneDescriptorMap, std::unordered_map<std::string, ToneInfoMap> &customToneDescriptorMap)
+{
     if (!curNode->CompareName("DTMF")) {
         AUDIO_ERR_LOG("Missing tag - DTMF: %{public}s", configPath.c_str());
         curNode = nullptr;
@@ -105,6 +139,106 @@ int32_t AudioToneParser::LoadNewConfig(const std::string &configPath, ToneInfoMa
     return SUCCESS;
 }
 
+void AudioToneParser::WriteToneConfig(const ToneInfoMap &toneDescriptorMap,
+    const std::unordered_map<std::string, ToneInfoMap> &customToneDescriptorMap, AudioConfigCacheWriter &writer)
+{
+    // a tone shared by several countries is written once and referenced by index, so it stays shared on reload
+    std::unordered_map<const ToneInfo *, uint32_t> toneIndexes;
+    std::vector<const ToneInfo *> tones;
+    auto collectTones = [&toneIndexes, &tones](const ToneInfoMap &toneMap) {
+        for (const auto &[toneType, toneInfo] : toneMap) {
+            if (toneInfo != nullptr && toneIndexes.emplace(toneInfo.get(), tones.size()).second) {
+                tones.push_back(toneInfo.get());
+            }
+        }
+    };
+    collectTones(toneDescriptorMap);
+    for (const auto &[countryName, toneMap] : customToneDescriptorMap) {
+        collectTones(toneMap);
+    }
+
+    writer.WriteUint32(static_cast<uint32_t>(tones.size()));
+    for (const ToneInfo *toneInfo : tones) {
+        writer.WriteUint32(toneInfo->segmentCnt);
+        writer.WriteUint32(toneInfo->repeatCnt);
+        writer.WriteUint32(toneInfo->repeatSegment);
+        // every slot, not only the first segmentCnt, so the reloaded tone is identical to the parsed one
+        for (const ToneSegment &segment : toneInfo->segments) {
+            writer.WriteUint32(segment.duration);
+            for (uint16_t waveFreq : segment.waveFreq) {
+                writer.WriteUint32(waveFreq);
+            }
+            writer.WriteUint32(segment.loopCnt);
+            writer.WriteUint32(segment.loopIndx);
+        }
+    }
+    auto writeToneMap = [&toneIndexes, &writer](const ToneInfoMap &toneMap) {
+        writer.WriteUint32(static_cast<uint32_t>(toneMap.size()));
+        for (const auto &[toneType, toneInfo] : toneMap) {
+            writer.WriteInt32(toneType);
+            writer.WriteBool(toneInfo != nullptr);
+            if (toneInfo != nullptr) {
+                writer.WriteUint32(toneIndexes[toneInfo.get()]);
+            }
+        }
+    };
+    writeToneMap(toneDescriptorMap);
+    writer.WriteUint32(static_cast<uint32_t>(customToneDescriptorMap.size()));
+    for (const auto &[countryName, toneMap] : customToneDescriptorMap) {
+        writer.WriteString(countryName);
+        writeToneMap(toneMap);
+    }
+}
+
+bool AudioToneParser::ReadToneConfig(AudioConfigCacheReader &reader, ToneInfoMap &toneDescriptorMap,
+    std::unordered_map<std::string, ToneInfoMap> &customToneDescriptorMap)
+{
+    auto readUint16 = [&reader](uint16_t &value) {
+        uint32_t rawValue = 0;
+        CHECK_AND_RETURN_RET(reader.ReadUint32(rawValue) && rawValue <= UINT16_MAX, false);
+        value = static_cast<uint16_t>(rawValue);
+        return true;
+    };
+    uint32_t toneNum = 0;
+    CHECK_AND_RETURN_RET(reader.ReadUint32(toneNum), false);
+    std::vector<std::shared_ptr<ToneInfo>> tones;
+    for (uint32_t i = 0; i < toneNum; i++) {
+        std::shared_ptr<ToneInfo> toneInfo = std::make_shared<ToneInfo>();
+        CHECK_AND_RETURN_RET(reader.ReadUint32(toneInfo->segmentCnt) && reader.ReadUint32(toneInfo->repeatCnt) &&
+            reader.ReadUint32(toneInfo->repeatSegment), false);
+        for (ToneSegment &segment : toneInfo->segments) {
+            CHECK_AND_RETURN_RET(reader.ReadUint32(segment.duration), false);
+            for (uint16_t &waveFreq : segment.waveFreq) {
+                CHECK_AND_RETURN_RET(readUint16(waveFreq), false);
+            }
+            CHECK_AND_RETURN_RET(readUint16(segment.loopCnt) && readUint16(segment.loopIndx), false);
+        }
+        tones.push_back(toneInfo);
+    }
+    auto readToneMap = [&reader, &tones](ToneInfoMap &toneMap) {
+        uint32_t entryNum = 0;
+        CHECK_AND_RETURN_RET(reader.ReadUint32(entryNum), false);
+        for (uint32_t i = 0; i < entryNum; i++) {
+            int32_t toneType = 0;
+            bool isValid = false;
+            uint32_t toneIndex = 0;
+            CHECK_AND_RETURN_RET(reader.ReadInt32(toneType) && reader.ReadBool(isValid), false);
+            CHECK_AND_RETURN_RET(!isValid || (reader.ReadUint32(toneIndex) && toneIndex < tones.size()), false);
+            toneMap[toneType] = isValid ? tones[toneIndex] : nullptr;
+        }
+        return true;
+    };
+    CHECK_AND_RETURN_RET(readToneMap(toneDescriptorMap), false);
+    uint32_t countryNum = 0;
+    CHECK_AND_RETURN_RET(reader.ReadUint32(countryNum), false);
+    for (uint32_t i = 0; i < countryNum; i++) {
+        std::string countryName;
+        CHECK_AND_RETURN_RET(reader.ReadString(countryName) && readToneMap(customToneDescriptorMap[countryName]),
+            false);
+    }
+    return true;
+}
+
 void AudioToneParser::ParseCustom(std::shared_ptr<AudioXmlNode> curNode,
     std::unordered_map<std::string, ToneInfoMap> &customToneDescriptorMap)
 {
@@ -60,7 +60,24 @@ int32_t AudioVolumeParser::ParseVolumeConfig(const char *path, StreamVolumeInfoM
         WriteVolumeConfigErrorEvent();
         return ERROR;
     }
+    return ParseVolumeConfigRoot(curNode, path, streamVolumeInfoMap);
+}
+
+int32_t AudioVolumeParser::ParseVolumeConfigData(const std::string &data, const char *path,
+    StreamVolumeInfoMap &streamVolumeInfoMap)
+{
+    std::shared_ptr<AudioXmlNode> curNode = AudioXmlNode::Create();
+    int32_t ret = curNode->ConfigMemory(data.data(), static_cast<int32_t>(data.size()), nullptr, 0);
+    if (ret != SUCCESS) {
+        WriteVolumeConfigErrorEvent();
+        return ERROR;
+    }
+    return ParseVolumeConfigRoot(curNode, path, streamVolumeInfoMap);
+}
 
+int32_t AudioVolumeParser::ParseVolumeConfigRoot(std::shared_ptr<AudioXmlNode> curNode, const char *path,
+    StreamVolumeInfoMap &streamVolumeInfoMap)
+{
     if (!curNode->CompareName("audio_volume_config")) {
         AUDIO_ERR_LOG("Missing tag - audio_volume_config in : %s", path);
         WriteVolumeConfigErrorEvent();
@@ -170,6 +187,151 @@ int32_t AudioVolumeParser::LoadConfig(StreamVolumeInfoMap &streamVolumeInfoMap)
     return ret;
 }
 
+std::string AudioVolumeParser::GetConfigFilePath()
+{
+    std::string path;
+#ifdef USE_CONFIG_POLICY
+    CfgFiles *cfgFiles = GetCfgFiles(AUDIO_VOLUME_CONFIG_FILE);
+    CHECK_AND_RETURN_RET_LOG(cfgFiles != nullptr, path, "Not found audio_volume_config.xml!");
+    for (int32_t i = MAX_CFG_POLICY_DIRS_CNT - 1; i >= 0; i--) {
+        if (cfgFiles->paths[i] && *(cfgFiles->paths[i]) != '\0') {
+            path = cfgFiles->paths[i];
+            break;
+        }
+    }
+    FreeCfgFiles(cfgFiles);
+#else
+    path = AUDIO_VOLUME_CONFIG_FILE;
+#endif
+    return path;
+}
+
+int32_t AudioVolumeParser::LoadConfigWithCache(StreamVolumeInfoMap &streamVolumeInfoMap)
+{
+    std::string path = GetConfigFilePath();
+    if (path.empty()) {
+        return LoadConfig(streamVolumeInfoMap);
+    }
+    AudioConfigCache cache(AUDIO_VOLUME_CACHE_NAME, path);
+    bool isVolumeFixEnable = false;
+    bool isPCVolumeEnable = false;
+    if (cache.Load([&streamVolumeInfoMap, &isVolumeFixEnable, &isPCVolumeEnable](AudioConfigCacheReader &reader) {
+        return reader.ReadBool(isVolumeFixEnable) && reader.ReadBool(isPCVolumeEnable) &&
+            ReadStreamVolumeInfos(reader, streamVolumeInfoMap);
+    })) {
+        // the volume_fix and VOICE_PC nodes set global flags instead of filling the map
+        if (isVolumeFixEnable) {
+            VolumeUtils::SetVolumeFixEnable(true);
+        }
+        if (isPCVolumeEnable) {
+            VolumeUtils::SetPCVolumeEnable(true);
+        }
+        AUDIO_INFO_LOG("volume config loaded from cache, size %{public}zu", streamVolumeInfoMap.size());
+        return SUCCESS;
+    }
+    streamVolumeInfoMap.clear();
+    if (!cache.HasSource()) {
+        return LoadConfig(streamVolumeInfoMap);
+    }
+    int32_t ret = ParseVolumeConfigData(cache.GetSource(), path.c_str(), streamVolumeInfoMap);
+    CHECK_AND_RETURN_RET(ret == SUCCESS, ret);
+    AudioConfigCacheWriter writer;
+    writer.WriteBool(VolumeUtils::IsVolumeFixEnable());
+    writer.WriteBool(VolumeUtils::IsPCVolumeEnable());
+    WriteStreamVolumeInfos(streamVolumeInfoMap, writer);
+    cache.Store(writer);
+    return SUCCESS;
+}
+
+void AudioVolumeParser::WriteStreamVolumeInfos(const StreamVolumeInfoMap &streamVolumeInfoMap,
+    AudioConfigCacheWriter &writer)
+{
+    writer.WriteUint32(static_cast<uint32_t>(streamVolumeInfoMap.size()));
+    for (const auto &[streamType, streamVolInfo] : streamVolumeInfoMap) {
+        writer.WriteInt32(streamType);
+        writer.WriteBool(streamVolInfo != nullptr);
+        if (streamVolInfo == nullptr) {
+            continue;
+        }
+        writer.WriteInt32(streamVolInfo->streamType);
+        writer.WriteInt32(streamVolInfo->minLevel);
+        writer.WriteInt32(streamVolInfo->maxLevel);
+        writer.WriteInt32(streamVolInfo->defaultLevel);
+        writer.WriteUint32(static_cast<uint32_t>(streamVolInfo->deviceVolumeInfos.size()));
+        for (const auto &[deviceType, deviceVolInfo] : streamVolInfo->deviceVolumeInfos) {
+            writer.WriteInt32(deviceType);
+            writer.WriteBool(deviceVolInfo != nullptr);
+            if (deviceVolInfo == nullptr) {
+                continue;
+            }
+            writer.WriteInt32(deviceVolInfo->deviceType);
+            writer.WriteInt32(deviceVolInfo->minLevel);
+            writer.WriteInt32(deviceVolInfo->maxLevel);
+            writer.WriteInt32(deviceVolInfo->defaultLevel);
+            writer.WriteUint32(static_cast<uint32_t>(deviceVolInfo->volumePoints.size()));
+            for (const auto &volumePoint : deviceVolInfo->volumePoints) {
+                writer.WriteUint32(volumePoint.index);
+                writer.WriteInt32(volumePoint.dbValue);
+            }
+        }
+    }
+}
+
+bool AudioVolumeParser::ReadDeviceVolumeInfo(AudioConfigCacheReader &reader,
+    std::shared_ptr<DeviceVolumeInfo> &deviceVolInfo)
+{
+    bool isValid = false;
+    CHECK_AND_RETURN_RET(reader.ReadBool(isValid), false);
+    if (!isValid) {
+        deviceVolInfo = nullptr;
+        return true;
+    }
+    deviceVolInfo = std::make_shared<DeviceVolumeInfo>();
+    int32_t deviceType = 0;
+    uint32_t pointNum = 0;
+    CHECK_AND_RETURN_RET(reader.ReadInt32(deviceType) && reader.ReadInt32(deviceVolInfo->minLevel) &&
+        reader.ReadInt32(deviceVolInfo->maxLevel) && reader.ReadInt32(deviceVolInfo->defaultLevel) &&
+        reader.ReadUint32(pointNum), false);
+    deviceVolInfo->deviceType = static_cast<DeviceVolumeType>(deviceType);
+    for (uint32_t i = 0; i < pointNum; i++) {
+        VolumePoint volumePoint;
+        CHECK_AND_RETURN_RET(reader.ReadUint32(volumePoint.index) && reader.ReadInt32(volumePoint.dbValue), false);
+        deviceVolInfo->volumePoints.push_back(volumePoint);
+    }
+    return true;
+}
+
+bool AudioVolumeParser::ReadStreamVolumeInfos(AudioConfigCacheReader &reader,
+    StreamVolumeInfoMap &streamVolumeInfoMap)
+{
+    uint32_t streamNum = 0;
+    CHECK_AND_RETURN_RET(reader.ReadUint32(streamNum), false);
+    for (uint32_t i = 0; i < streamNum; i++) {
+        int32_t streamKey = 0;
+        bool isValid = false;
+        CHECK_AND_RETURN_RET(reader.ReadInt32(streamKey) && reader.ReadBool(isValid), false);
+        std::shared_ptr<StreamVolumeInfo> streamVolInfo = nullptr;
+        if (isValid) {
+            streamVolInfo = std::make_shared<StreamVolumeInfo>();
+            int32_t streamType = 0;
+            uint32_t deviceNum = 0;
+            CHECK_AND_RETURN_RET(reader.ReadInt32(streamType) && reader.ReadInt32(streamVolInfo->minLevel) &&
+                reader.ReadInt32(streamVolInfo->maxLevel) && reader.ReadInt32(streamVolInfo->defaultLevel) &&
+                reader.ReadUint32(deviceNum), false);
+            streamVolInfo->streamType = static_cast<AudioVolumeType>(streamType);
+            for (uint32_t j = 0; j < deviceNum; j++) {
+                int32_t deviceKey = 0;
+                std::shared_ptr<DeviceVolumeInfo> deviceVolInfo = nullptr;
+                CHECK_AND_RETURN_RET(reader.ReadInt32(deviceKey) && ReadDeviceVolumeInfo(reader, deviceVolInfo),
+                    false);
+                streamVolInfo->deviceVolumeInfos[static_cast<DeviceVolumeType>(deviceKey)] = deviceVolInfo;
+            }
+        }
+        streamVolumeInfoMap[static_cast<AudioVolumeType>(streamKey)] = streamVolInfo;
+    }
+    return true;
+}
+
 void AudioVolumeParser::ParseStreamInfos(std::shared_ptr<AudioXmlNode> curNode,
     StreamVolumeInfoMap &streamVolumeInfoMap)
 {
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LOG_TAG
+#define LOG_TAG "BenchmarkAudioConfigParserTest"
+#endif
+
+#include <benchmark/benchmark.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "audio_config_cache.h"
+#include "audio_errors.h"
+#include "audio_focus_parser.h"
+#include "audio_volume_parser.h"
+
+using namespace OHOS::AudioStandard;
+
+namespace {
+// the service cache directory is left alone, the benchmark keeps its blobs here
+const std::string BENCHMARK_CACHE_DIR = "/data/local/tmp/audio_config_cache_benchmark";
+
+using FocusMap = std::map<std::pair<AudioFocusType, AudioFocusType>, AudioFocusEntry>;
+
+class BenchmarkAudioConfigParserTest : public benchmark::Fixture {
+public:
+    void SetUp(const ::benchmark::State &state) override
+    {
+        mkdir(BENCHMARK_CACHE_DIR.c_str(), S_IRWXU);
+    }
+
+    void TearDown(const ::benchmark::State &state) override
+    {
+    }
+};
+
+// cold: libxml DOM walk of the focus config, as on a boot without a valid cache
+BENCHMARK_F(BenchmarkAudioConfigParserTest, FocusColdParseTestCase)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        FocusMap focusMap;
+        AudioFocusParser parser;
+        if (parser.LoadConfig(focusMap) != SUCCESS) {
+            state.SkipWithError("focus config not found");
+            break;
+        }
+        benchmark::DoNotOptimize(focusMap);
+    }
+}
+
+// warm: source hash check plus decoding the mapped blob
+BENCHMARK_F(BenchmarkAudioConfigParserTest, FocusWarmLoadTestCase)(benchmark::State &state)
+{
+    AudioFocusParser parser;
+    FocusMap focusMap;
+    AudioConfigCache cache(AudioFocusParser::AUDIO_FOCUS_CACHE_NAME, parser.GetConfigFilePath(),
+        BENCHMARK_CACHE_DIR);
+    AudioConfigCacheWriter writer;
+    if (parser.LoadConfig(focusMap) != SUCCESS) {
+        state.SkipWithError("focus config not found");
+        return;
+    }
+    AudioFocusParser::WriteFocusMap(focusMap, writer);
+    if (!cache.Store(writer)) {
+        state.SkipWithError("store cache failed");
+        return;
+    }
+    for (auto _ : state) {
+        FocusMap cachedMap;
+        if (!cache.Load([&cachedMap](AudioConfigCacheReader &reader) {
+            return AudioFocusParser::ReadFocusMap(reader, cachedMap);
+        })) {
+            state.SkipWithError("load cache failed");
+            break;
+        }
+        benchmark::DoNotOptimize(cachedMap);
+    }
+    unlink(cache.GetCachePath().c_str());
+}
+
+BENCHMARK_F(BenchmarkAudioConfigParserTest, VolumeColdParseTestCase)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        StreamVolumeInfoMap streamVolumeInfoMap;
+        AudioVolumeParser parser;
+        if (parser.LoadConfig(streamVolumeInfoMap) != SUCCESS) {
+            state.SkipWithError("volume config not found");
+            break;
+        }
+        benchmark::DoNotOptimize(streamVolumeInfoMap);
+    }
+}
+
+BENCHMARK_F(BenchmarkAudioConfigParserTest, VolumeWarmLoadTestCase)(benchmark::State &state)
+{
+    AudioVolumeParser parser;
+    StreamVolumeInfoMap streamVolumeInfoMap;
+    AudioConfigCache cache(AudioVolumeParser::AUDIO_VOLUME_CACHE_NAME, parser.GetConfigFilePath(),
+        BENCHMARK_CACHE_DIR);
+    AudioConfigCacheWriter writer;
+    if (parser.LoadConfig(streamVolumeInfoMap) != SUCCESS) {
+        state.SkipWithError("volume config not found");
+        return;
+    }
+    writer.WriteBool(false);
+    AudioVolumeParser::WriteStreamVolumeInfos(streamVolumeInfoMap, writer);
+    if (!cache.Store(writer)) {
+        state.SkipWithError("store cache failed");
+        return;
+    }
+    for (auto _ : state) {
+        StreamVolumeInfoMap cachedMap;
+        bool isVolumeFixEnable = false;
+        if (!cache.Load([&cachedMap, &isVolumeFixEnable](AudioConfigCacheReader &reader) {
+            return reader.ReadBool(isVolumeFixEnable) && AudioVolumeParser::ReadStreamVolumeInfos(reader, cachedMap);
+        })) {
+            state.SkipWithError("load cache failed");
+            break;
+        }
+        benchmark::DoNotOptimize(cachedMap);
+    }
+    unlink(cache.GetCachePath().c_str());
+}
+}
+
+BENCHMARK_MAIN();
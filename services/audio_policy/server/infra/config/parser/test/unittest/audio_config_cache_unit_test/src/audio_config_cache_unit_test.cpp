@@ -0,0 +1,487 @@
+/*
+* Copyright (c) 2025 Huawei Device Co., Ltd.
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "audio_config_cache_unit_test.h"
+
+#include <dirent.h>
+#include <fstream>
+#include <sstream>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+
+#include "audio_effect_config_parser.h"
+#include "audio_focus_parser.h"
+#include "audio_tone_parser.h"
+#include "audio_volume_parser.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace AudioStandard {
+namespace {
+const std::string TEST_DIR = "/data/local/tmp/audio_config_cache_test";
+const std::string TEST_SOURCE_PATH = TEST_DIR + "/test_config.xml";
+const std::string TEST_SOURCE = "<audio_test_config><item value=\"1\"/></audio_test_config>";
+const std::string TEST_CACHE_NAME = "test_config";
+constexpr int32_t TEST_INT_VALUE = -27;
+constexpr uint32_t TEST_UINT_VALUE = 100;
+const std::string TEST_STRING_VALUE = "STREAM_MUSIC";
+constexpr int32_t TEST_STORE_THREAD_NUM = 8;
+constexpr int32_t TEST_TONE_DIAL_0 = 0;
+constexpr int32_t TEST_TONE_DIAL_1 = 1;
+constexpr int32_t TEST_TONE_BUSY = 101;
+
+AudioConfigCacheWriter MakeTestPayload()
+{
+    AudioConfigCacheWriter writer;
+    writer.WriteInt32(TEST_INT_VALUE);
+    writer.WriteUint32(TEST_UINT_VALUE);
+    writer.WriteBool(true);
+    writer.WriteString(TEST_STRING_VALUE);
+    return writer;
+}
+
+bool ReadTestPayload(AudioConfigCacheReader &reader)
+{
+    int32_t intValue = 0;
+    uint32_t uintValue = 0;
+    bool boolValue = false;
+    std::string stringValue;
+    return reader.ReadInt32(intValue) && intValue == TEST_INT_VALUE && reader.ReadUint32(uintValue) &&
+        uintValue == TEST_UINT_VALUE && reader.ReadBool(boolValue) && boolValue &&
+        reader.ReadString(stringValue) && stringValue == TEST_STRING_VALUE;
+}
+
+size_t CountDirEntries(const std::string &path)
+{
+    DIR *dir = opendir(path.c_str());
+    if (dir == nullptr) {
+        return 0;
+    }
+    size_t count = 0;
+    for (struct dirent *entry = readdir(dir); entry != nullptr; entry = readdir(dir)) {
+        if (std::string(entry->d_name) != "." && std::string(entry->d_name) != "..") {
+            count++;
+        }
+    }
+    closedir(dir);
+    return count;
+}
+}
+
+void AudioConfigCacheUnitTest::SetUpTestCase(void)
+{
+    mkdir(TEST_DIR.c_str(), S_IRWXU);
+}
+
+void AudioConfigCacheUnitTest::TearDownTestCase(void)
+{
+    rmdir(TEST_DIR.c_str());
+}
+
+void AudioConfigCacheUnitTest::SetUp(void)
+{
+    WriteFile(TEST_SOURCE_PATH, TEST_SOURCE);
+}
+
+void AudioConfigCacheUnitTest::TearDown(void)
+{
+    AudioConfigCache cache(TEST_CACHE_NAME, TEST_SOURCE_PATH, TEST_DIR);
+    unlink(cache.GetCachePath().c_str());
+    unlink(TEST_SOURCE_PATH.c_str());
+}
+
+void AudioConfigCacheUnitTest::WriteFile(const std::string &path, const std::string &content)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << content;
+}
+
+std::string AudioConfigCacheUnitTest::ReadFile(const std::string &path)
+{
+    std::ifstream file(path, std::ios::binary);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+/**
+ * @tc.name  : Test AudioConfigCache.
+ * @tc.number: AudioConfigCacheUnitTest_001
+ * @tc.desc  : A stored payload reads back while the source is unchanged.
+ */
+HWTEST_F(AudioConfigCacheUnitTest, AudioConfigCacheUnitTest_001, TestSize.Level1)
+{
+    AudioConfigCache cache(TEST_CACHE_NAME, TEST_SOURCE_PATH, TEST_DIR);
+    EXPECT_FALSE(cache.Load(ReadTestPayload));
+    EXPECT_TRUE(cache.Store(MakeTestPayload()));
+    EXPECT_TRUE(cache.Load(ReadTestPayload));
+
+    // a parser that leaves bytes unread does not accept the blob
+    EXPECT_FALSE(cache.Load([](AudioConfigCacheReader &reader) {
+        int32_t value = 0;
+        return reader.ReadInt32(value);
+    }));
+}
+
+/**
+ * @tc.name  : Test AudioConfigCache.
+ * @tc.number: AudioConfigCacheUnitTest_002
+ * @tc.desc  : A changed source, a corrupt blob and a truncated blob are all rejected.
+ */
+HWTEST_F(AudioConfigCacheUnitTest, AudioConfigCacheUnitTest_002, TestSize.Level1)
+{
+    AudioConfigCache cache(TEST_CACHE_NAME, TEST_SOURCE_PATH, TEST_DIR);
+    ASSERT_TRUE(cache.Store(MakeTestPayload()));
+    std::string blob = ReadFile(cache.GetCachePath());
+    ASSERT_FALSE(blob.empty());
+
+    WriteFile(TEST_SOURCE_PATH, TEST_SOURCE + " ");
+    EXPECT_FALSE(cache.Load(ReadTestPayload));
+    WriteFile(TEST_SOURCE_PATH, TEST_SOURCE);
+    EXPECT_TRUE(cache.Load(ReadTestPayload));
+
+    std::string corruptBlob = blob;
+    corruptBlob.back() ^= 1;
+    WriteFile(cache.GetCachePath(), corruptBlob);
+    EXPECT_FALSE(cache.Load(ReadTestPayload));
+
+    WriteFile(cache.GetCachePath(), blob.substr(0, blob.size() - 1));
+    EXPECT_FALSE(cache.Load(ReadTestPayload));
+
+    WriteFile(cache.GetCachePath(), blob);
+    EXPECT_TRUE(cache.Load(ReadTestPayload));
+
+    AudioConfigCache missingSource(TEST_CACHE_NAME, TEST_DIR + "/missing.xml", TEST_DIR);
+    EXPECT_FALSE(missingSource.Load(ReadTestPayload));
+    EXPECT_FALSE(missingSource.Store(MakeTestPayload()));
+}
+
+/**
+ * @tc.name  : Test AudioConfigCacheReader.
+ * @tc.number: AudioConfigCacheUnitTest_003
+ * @tc.desc  : Reads never go past the end of the payload.
+ */
+HWTEST_F(AudioConfigCacheUnitTest, AudioConfigCacheUnitTest_003, TestSize.Level1)
+{
+    AudioConfigCacheWriter writer;
+    writer.WriteUint32(TEST_UINT_VALUE); // read back as the length of a string that is not there
+    AudioConfigCacheReader reader(writer.GetData().data(), writer.GetData().size());
+    std::string value;
+    EXPECT_FALSE(reader.ReadString(value));
+
+    AudioConfigCacheReader emptyReader(nullptr, 0);
+    int32_t intValue = 0;
+    bool boolValue = false;
+    EXPECT_TRUE(emptyReader.IsEnd());
+    EXPECT_FALSE(emptyReader.ReadInt32(intValue));
+    EXPECT_FALSE(emptyReader.ReadBool(boolValue));
+}
+
+/**
+ * @tc.name  : Test AudioFocusParser cache payload.
+ * @tc.number: AudioConfigCacheUnitTest_004
+ * @tc.desc  : The focus map reads back unchanged.
+ */
+HWTEST_F(AudioConfigCacheUnitTest, AudioConfigCacheUnitTest_004, TestSize.Level1)
+{
+    std::map<std::pair<AudioFocusType, AudioFocusType>, AudioFocusEntry> focusMap;
+    AudioFocusType music = {STREAM_MUSIC, SOURCE_TYPE_INVALID, true};
+    AudioFocusType ring = {STREAM_RING, SOURCE_TYPE_INVALID, true};
+    AudioFocusType mic = {STREAM_DEFAULT, SOURCE_TYPE_MIC, false};
+    focusMap[std::make_pair(music, ring)] = {INTERRUPT_SHARE, INTERRUPT_HINT_DUCK, CURRENT, false};
+    focusMap[std::make_pair(mic, music)] = {INTERRUPT_FORCE, INTERRUPT_HINT_STOP, INCOMING, true};
+
+    AudioConfigCacheWriter writer;
+    AudioFocusParser::WriteFocusMap(focusMap, writer);
+    AudioConfigCacheReader reader(writer.GetData().data(), writer.GetData().size());
+    std::map<std::pair<AudioFocusType, AudioFocusType>, AudioFocusEntry> cachedMap;
+    ASSERT_TRUE(AudioFocusParser::ReadFocusMap(reader, cachedMap));
+    EXPECT_TRUE(reader.IsEnd());
+    ASSERT_EQ(cachedMap.size(), focusMap.size());
+    for (const auto &[focusPair, focusEntry] : focusMap) {
+        auto it = cachedMap.find(focusPair);
+        ASSERT_NE(it, cachedMap.end());
+        EXPECT_TRUE(it->first.first == focusPair.first && it->first.second == focusPair.second);
+        EXPECT_EQ(it->second.forceType, focusEntry.forceType);
+        EXPECT_EQ(it->second.hintType, focusEntry.hintType);
+        EXPECT_EQ(it->second.actionOn, focusEntry.actionOn);
+        EXPECT_EQ(it->second.isReject, focusEntry.isReject);
+    }
+}
+
+/**
+ * @tc.name  : Test AudioVolumeParser cache payload.
+ * @tc.number: AudioConfigCacheUnitTest_005
+ * @tc.desc  : The stream volume infos read back unchanged, including empty entries.
+ */
+HWTEST_F(AudioConfigCacheUnitTest, AudioConfigCacheUnitTest_005, TestSize.Level1)
+{
+    std::shared_ptr<DeviceVolumeInfo> speakerInfo = std::make_shared<DeviceVolumeInfo>();
+    speakerInfo->deviceType = SPEAKER_VOLUME_TYPE;
+    speakerInfo->minLevel = 0;
+    speakerInfo->maxLevel = 15;
+    speakerInfo->defaultLevel = 5;
+    speakerInfo->volumePoints = {{1, -4000}, {33, -2000}, {100, 0}};
+    std::shared_ptr<StreamVolumeInfo> musicInfo = std::make_shared<StreamVolumeInfo>();
+    musicInfo->streamType = STREAM_MUSIC;
+    musicInfo->minLevel = 0;
+    musicInfo->maxLevel = 15;
+    musicInfo->defaultLevel = 5;
+    musicInfo->deviceVolumeInfos[SPEAKER_VOLUME_TYPE] = speakerInfo;
+    musicInfo->deviceVolumeInfos[EARPIECE_VOLUME_TYPE] = nullptr;
+    StreamVolumeInfoMap streamVolumeInfoMap;
+    streamVolumeInfoMap[STREAM_MUSIC] = musicInfo;
+    streamVolumeInfoMap[STREAM_RING] = nullptr;
+
+    AudioConfigCacheWriter writer;
+    AudioVolumeParser::WriteStreamVolumeInfos(streamVolumeInfoMap, writer);
+    AudioConfigCacheReader reader(writer.GetData().data(), writer.GetData().size());
+    StreamVolumeInfoMap cachedMap;
+    ASSERT_TRUE(AudioVolumeParser::ReadStreamVolumeInfos(reader, cachedMap));
+    EXPECT_TRUE(reader.IsEnd());
+
+    ASSERT_EQ(cachedMap.size(), streamVolumeInfoMap.size());
+    EXPECT_EQ(cachedMap[STREAM_RING], nullptr);
+    std::shared_ptr<StreamVolumeInfo> cachedMusic = cachedMap[STREAM_MUSIC];
+    ASSERT_NE(cachedMusic, nullptr);
+    EXPECT_EQ(cachedMusic->streamType, musicInfo->streamType);
+    EXPECT_EQ(cachedMusic->maxLevel, musicInfo->maxLevel);
+    EXPECT_EQ(cachedMusic->defaultLevel, musicInfo->defaultLevel);
+    ASSERT_EQ(cachedMusic->deviceVolumeInfos.size(), musicInfo->deviceVolumeInfos.size());
+    EXPECT_EQ(cachedMusic->deviceVolumeInfos[EARPIECE_VOLUME_TYPE], nullptr);
+    std::shared_ptr<DeviceVolumeInfo> cachedSpeaker = cachedMusic->deviceVolumeInfos[SPEAKER_VOLUME_TYPE];
+    ASSERT_NE(cachedSpeaker, nullptr);
+    EXPECT_EQ(cachedSpeaker->deviceType, speakerInfo->deviceType);
+    EXPECT_EQ(cachedSpeaker->minLevel, speakerInfo->minLevel);
+    EXPECT_EQ(cachedSpeaker->maxLevel, speakerInfo->maxLevel);
+    EXPECT_EQ(cachedSpeaker->defaultLevel, speakerInfo->defaultLevel);
+    ASSERT_EQ(cachedSpeaker->volumePoints.size(), speakerInfo->volumePoints.size());
+    for (size_t i = 0; i < speakerInfo->volumePoints.size(); i++) {
+        EXPECT_EQ(cachedSpeaker->volumePoints[i].index, speakerInfo->volumePoints[i].index);
+        EXPECT_EQ(cachedSpeaker->volumePoints[i].dbValue, speakerInfo->volumePoints[i].dbValue);
+    }
+
+    // a payload cut short is rejected
+    const std::vector<uint8_t> &data = writer.GetData();
+    AudioConfigCacheReader truncatedReader(data.data(), data.size() - sizeof(int32_t));
+    StreamVolumeInfoMap truncatedMap;
+    EXPECT_FALSE(AudioVolumeParser::ReadStreamVolumeInfos(truncatedReader, truncatedMap));
+}
+
+/**
+ * @tc.name  : Test AudioConfigCache.
+ * @tc.number: AudioConfigCacheUnitTest_006
+ * @tc.desc  : The blob is keyed on the source bytes read by Load, not on a source replaced before Store.
+ */
+HWTEST_F(AudioConfigCacheUnitTest, AudioConfigCacheUnitTest_006, TestSize.Level1)
+{
+    AudioConfigCache cache(TEST_CACHE_NAME, TEST_SOURCE_PATH, TEST_DIR);
+    EXPECT_FALSE(cache.Load(ReadTestPayload));
+    ASSERT_TRUE(cache.HasSource());
+    EXPECT_EQ(cache.GetSource(), TEST_SOURCE);
+
+    // the xml is replaced while the payload made from the old bytes is being built
+    WriteFile(TEST_SOURCE_PATH, TEST_SOURCE + " ");
+    EXPECT_TRUE(cache.Store(MakeTestPayload()));
+    EXPECT_FALSE(cache.Load(ReadTestPayload));
+    WriteFile(TEST_SOURCE_PATH, TEST_SOURCE);
+    EXPECT_TRUE(cache.Load(ReadTestPayload));
+
+    AudioConfigCache missingSource(TEST_CACHE_NAME, TEST_DIR + "/missing.xml", TEST_DIR);
+    EXPECT_FALSE(missingSource.Load(ReadTestPayload));
+    EXPECT_FALSE(missingSource.HasSource());
+}
+
+/**
+ * @tc.name  : Test AudioEffectConfigParser cache payload.
+ * @tc.number: AudioConfigCacheUnitTest_007
+ * @tc.desc  : The effect config reads back unchanged, pre and post process scenes included.
+ */
+HWTEST_F(AudioConfigCacheUnitTest, AudioConfigCacheUnitTest_007, TestSize.Level1)
+{
+    OriginalEffectConfig config;
+    config.version = "2.0";
+    Library library;
+    library.name = "bundle";
+    library.path = "libbundle.z.so";
+    config.libraries.push_back(library);
+    Effect effect;
+    effect.name = "eq";
+    effect.libraryName = "bundle";
+    effect.effectProperty = {"music", "movie"};
+    config.effects.push_back(effect);
+    EffectChain effectChain;
+    effectChain.name = "EFFECTCHAIN_SPK_MUSIC";
+    effectChain.apply = {"eq"};
+    effectChain.label = "spk";
+    config.effectChains.push_back(effectChain);
+    config.preProcess.maxExtSceneNum = 1;
+    PreStreamScene preScene;
+    preScene.stream = "SCENE_VOIP_UP";
+    preScene.mode = {"ENHANCEMENT_DEFAULT"};
+    preScene.device = {{{"DEVICE_TYPE_MIC", "EFFECTCHAIN_VOIP_UP"}}};
+    config.preProcess.normalScenes.push_back(preScene);
+    config.postProcess.maxExtSceneNum = 2;
+    PostStreamScene postScene;
+    postScene.stream = "SCENE_MUSIC";
+    postScene.mode = {"EFFECT_DEFAULT", "EFFECT_NONE"};
+    postScene.device = {{{"DEVICE_TYPE_SPEAKER", "EFFECTCHAIN_SPK_MUSIC"}, {"DEVICE_TYPE_DEFAULT", ""}}, {}};
+    config.postProcess.priorScenes.push_back(postScene);
+    config.postProcess.sceneMap.push_back({"STREAM_USAGE_MUSIC", "SCENE_MUSIC"});
+
+    AudioConfigCacheWriter writer;
+    AudioEffectConfigParser::WriteEffectConfig(config, writer);
+    AudioConfigCacheReader reader(writer.GetData().data(), writer.GetData().size());
+    OriginalEffectConfig cachedConfig;
+    ASSERT_TRUE(AudioEffectConfigParser::ReadEffectConfig(reader, cachedConfig));
+    EXPECT_TRUE(reader.IsEnd());
+
+    EXPECT_EQ(cachedConfig.version, config.version);
+    ASSERT_EQ(cachedConfig.libraries.size(), 1);
+    EXPECT_EQ(cachedConfig.libraries[0].name, library.name);
+    EXPECT_EQ(cachedConfig.libraries[0].path, library.path);
+    ASSERT_EQ(cachedConfig.effects.size(), 1);
+    EXPECT_EQ(cachedConfig.effects[0].name, effect.name);
+    EXPECT_EQ(cachedConfig.effects[0].libraryName, effect.libraryName);
+    EXPECT_EQ(cachedConfig.effects[0].effectProperty, effect.effectProperty);
+    ASSERT_EQ(cachedConfig.effectChains.size(), 1);
+    EXPECT_EQ(cachedConfig.effectChains[0].name, effectChain.name);
+    EXPECT_EQ(cachedConfig.effectChains[0].apply, effectChain.apply);
+    EXPECT_EQ(cachedConfig.effectChains[0].label, effectChain.label);
+    EXPECT_EQ(cachedConfig.preProcess.maxExtSceneNum, config.preProcess.maxExtSceneNum);
+    EXPECT_TRUE(cachedConfig.preProcess.defaultScenes.empty());
+    ASSERT_EQ(cachedConfig.preProcess.normalScenes.size(), 1);
+    EXPECT_EQ(cachedConfig.preProcess.normalScenes[0].stream, preScene.stream);
+    EXPECT_EQ(cachedConfig.preProcess.normalScenes[0].mode, preScene.mode);
+    ASSERT_EQ(cachedConfig.preProcess.normalScenes[0].device.size(), 1);
+    ASSERT_EQ(cachedConfig.preProcess.normalScenes[0].device[0].size(), 1);
+    EXPECT_EQ(cachedConfig.preProcess.normalScenes[0].device[0][0].chain, "EFFECTCHAIN_VOIP_UP");
+    EXPECT_EQ(cachedConfig.postProcess.maxExtSceneNum, config.postProcess.maxExtSceneNum);
+    ASSERT_EQ(cachedConfig.postProcess.priorScenes.size(), 1);
+    const PostStreamScene &cachedScene = cachedConfig.postProcess.priorScenes[0];
+    EXPECT_EQ(cachedScene.stream, postScene.stream);
+    EXPECT_EQ(cachedScene.mode, postScene.mode);
+    ASSERT_EQ(cachedScene.device.size(), postScene.device.size());
+    ASSERT_EQ(cachedScene.device[0].size(), postScene.device[0].size());
+    EXPECT_EQ(cachedScene.device[0][1].type, "DEVICE_TYPE_DEFAULT");
+    EXPECT_TRUE(cachedScene.device[1].empty());
+    ASSERT_EQ(cachedConfig.postProcess.sceneMap.size(), 1);
+    EXPECT_EQ(cachedConfig.postProcess.sceneMap[0].name, "STREAM_USAGE_MUSIC");
+    EXPECT_EQ(cachedConfig.postProcess.sceneMap[0].sceneType, "SCENE_MUSIC");
+
+    // a payload cut short is rejected
+    const std::vector<uint8_t> &data = writer.GetData();
+    AudioConfigCacheReader truncatedReader(data.data(), data.size() - sizeof(uint32_t));
+    OriginalEffectConfig truncatedConfig;
+    EXPECT_FALSE(AudioEffectConfigParser::ReadEffectConfig(truncatedReader, truncatedConfig));
+}
+
+/**
+ * @tc.name  : Test AudioToneParser cache payload.
+ * @tc.number: AudioConfigCacheUnitTest_008
+ * @tc.desc  : The tone maps read back unchanged and a tone shared by several countries stays shared.
+ */
+HWTEST_F(AudioConfigCacheUnitTest, AudioConfigCacheUnitTest_008, TestSize.Level1)
+{
+    std::shared_ptr<ToneInfo> dialTone = std::make_shared<ToneInfo>();
+    dialTone->segmentCnt = 2;
+    dialTone->repeatCnt = TONEINFO_INF;
+    dialTone->repeatSegment = 1;
+    dialTone->segments[0].duration = 500;
+    dialTone->segments[0].waveFreq[0] = 425;
+    dialTone->segments[0].loopCnt = 3;
+    dialTone->segments[1].duration = TONEINFO_INF;
+    dialTone->segments[1].loopIndx = 1;
+    std::shared_ptr<ToneInfo> busyTone = std::make_shared<ToneInfo>();
+    busyTone->segmentCnt = 1;
+    busyTone->segments[0].waveFreq[1] = UINT16_MAX;
+
+    ToneInfoMap toneDescriptorMap;
+    toneDescriptorMap[TEST_TONE_DIAL_0] = dialTone;
+    toneDescriptorMap[TEST_TONE_DIAL_1] = nullptr;
+    std::unordered_map<std::string, ToneInfoMap> customToneDescriptorMap;
+    customToneDescriptorMap["CN"][TEST_TONE_BUSY] = busyTone;
+    customToneDescriptorMap["HK"][TEST_TONE_BUSY] = busyTone;
+    customToneDescriptorMap["HK"][TEST_TONE_DIAL_0] = dialTone;
+
+    AudioConfigCacheWriter writer;
+    AudioToneParser::WriteToneConfig(toneDescriptorMap, customToneDescriptorMap, writer);
+    AudioConfigCacheReader reader(writer.GetData().data(), writer.GetData().size());
+    ToneInfoMap cachedMap;
+    std::unordered_map<std::string, ToneInfoMap> cachedCustomMap;
+    ASSERT_TRUE(AudioToneParser::ReadToneConfig(reader, cachedMap, cachedCustomMap));
+    EXPECT_TRUE(reader.IsEnd());
+
+    ASSERT_EQ(cachedMap.size(), toneDescriptorMap.size());
+    EXPECT_EQ(cachedMap[TEST_TONE_DIAL_1], nullptr);
+    std::shared_ptr<ToneInfo> cachedDial = cachedMap[TEST_TONE_DIAL_0];
+    ASSERT_NE(cachedDial, nullptr);
+    EXPECT_EQ(cachedDial->segmentCnt, dialTone->segmentCnt);
+    EXPECT_EQ(cachedDial->repeatCnt, dialTone->repeatCnt);
+    EXPECT_EQ(cachedDial->repeatSegment, dialTone->repeatSegment);
+    for (uint32_t i = 0; i < TONEINFO_MAX_SEGMENTS + 1; i++) {
+        EXPECT_EQ(cachedDial->segments[i].duration, dialTone->segments[i].duration);
+        EXPECT_EQ(cachedDial->segments[i].loopCnt, dialTone->segments[i].loopCnt);
+        EXPECT_EQ(cachedDial->segments[i].loopIndx, dialTone->segments[i].loopIndx);
+        for (uint32_t j = 0; j < TONEINFO_MAX_WAVES + 1; j++) {
+            EXPECT_EQ(cachedDial->segments[i].waveFreq[j], dialTone->segments[i].waveFreq[j]);
+        }
+    }
+    ASSERT_EQ(cachedCustomMap.size(), customToneDescriptorMap.size());
+    std::shared_ptr<ToneInfo> cachedBusy = cachedCustomMap["CN"][TEST_TONE_BUSY];
+    ASSERT_NE(cachedBusy, nullptr);
+    EXPECT_EQ(cachedBusy->segments[0].waveFreq[1], UINT16_MAX);
+    EXPECT_EQ(cachedCustomMap["HK"][TEST_TONE_BUSY], cachedBusy);
+    EXPECT_EQ(cachedCustomMap["HK"][TEST_TONE_DIAL_0], cachedDial);
+
+    // a payload cut short is rejected
+    const std::vector<uint8_t> &data = writer.GetData();
+    AudioConfigCacheReader truncatedReader(data.data(), data.size() - sizeof(uint32_t));
+    ToneInfoMap truncatedMap;
+    std::unordered_map<std::string, ToneInfoMap> truncatedCustomMap;
+    EXPECT_FALSE(AudioToneParser::ReadToneConfig(truncatedReader, truncatedMap, truncatedCustomMap));
+}
+
+/**
+ * @tc.name  : Test AudioConfigCache.
+ * @tc.number: AudioConfigCacheUnitTest_009
+ * @tc.desc  : Concurrent stores of one config leave a complete blob and no temp file behind.
+ */
+HWTEST_F(AudioConfigCacheUnitTest, AudioConfigCacheUnitTest_009, TestSize.Level1)
+{
+    std::vector<std::thread> threads;
+    std::vector<bool> results(TEST_STORE_THREAD_NUM, false);
+    for (int32_t i = 0; i < TEST_STORE_THREAD_NUM; i++) {
+        threads.emplace_back([&results, i] {
+            AudioConfigCache cache(TEST_CACHE_NAME, TEST_SOURCE_PATH, TEST_DIR);
+            results[i] = cache.Store(MakeTestPayload());
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (int32_t i = 0; i < TEST_STORE_THREAD_NUM; i++) {
+        EXPECT_TRUE(results[i]);
+    }
+
+    AudioConfigCache cache(TEST_CACHE_NAME, TEST_SOURCE_PATH, TEST_DIR);
+    EXPECT_TRUE(cache.Load(ReadTestPayload));
+    // the source and the blob
+    EXPECT_EQ(CountDirEntries(TEST_DIR), 2);
+}
+} // namespace AudioStandard
+} // namespace OHOS
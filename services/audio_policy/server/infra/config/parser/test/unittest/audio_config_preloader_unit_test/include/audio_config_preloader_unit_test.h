@@ -0,0 +1,39 @@
+/*
+* Copyright (c) 2025 Huawei Device Co., Ltd.
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef AUDIO_CONFIG_PRELOADER_UNIT_TEST_H
+#define AUDIO_CONFIG_PRELOADER_UNIT_TEST_H
+
+#include <string>
+#include "gtest/gtest.h"
+#include "audio_config_preloader.h"
+
+namespace OHOS {
+namespace AudioStandard {
+
+class AudioConfigPreloaderUnitTest : public testing::Test {
+public:
+    // SetUpTestCase: Called before all test cases
+    static void SetUpTestCase(void);
+    // TearDownTestCase: Called after all test case
+    static void TearDownTestCase(void);
+    // SetUp: Called before each test cases
+    void SetUp(void);
+    // TearDown: Called after each test cases
+    void TearDown(void);
+};
+} // namespace AudioStandard
+} // namespace OHOS
+#endif // AUDIO_CONFIG_PRELOADER_UNIT_TEST_H
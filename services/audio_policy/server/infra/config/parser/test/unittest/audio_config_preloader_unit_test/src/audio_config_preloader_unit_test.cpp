@@ -0,0 +1,243 @@
+/*
+* Copyright (c) 2025 Huawei Device Co., Ltd.
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "audio_config_preloader_unit_test.h"
+
+#include <map>
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace AudioStandard {
+namespace {
+// the config structs have no operator==, both sides are flattened the same way and compared byte by byte
+void WriteStrings(const std::vector<std::string> &values, AudioConfigCacheWriter &writer)
+{
+    writer.WriteUint32(static_cast<uint32_t>(values.size()));
+    for (const auto &value : values) {
+        writer.WriteString(value);
+    }
+}
+
+template <typename T>
+void WriteScenes(const std::vector<T> &scenes, AudioConfigCacheWriter &writer)
+{
+    writer.WriteUint32(static_cast<uint32_t>(scenes.size()));
+    for (const auto &scene : scenes) {
+        writer.WriteString(scene.stream);
+        WriteStrings(scene.mode, writer);
+        writer.WriteUint32(static_cast<uint32_t>(scene.device.size()));
+        for (const auto &devices : scene.device) {
+            writer.WriteUint32(static_cast<uint32_t>(devices.size()));
+            for (const auto &device : devices) {
+                writer.WriteString(device.type);
+                writer.WriteString(device.chain);
+            }
+        }
+    }
+}
+
+std::vector<uint8_t> FlattenEffectConfig(int32_t ret, const OriginalEffectConfig &config)
+{
+    AudioConfigCacheWriter writer;
+    writer.WriteInt32(ret);
+    writer.WriteString(config.version);
+    writer.WriteUint32(static_cast<uint32_t>(config.libraries.size()));
+    for (const auto &library : config.libraries) {
+        writer.WriteString(library.name);
+        writer.WriteString(library.path);
+    }
+    writer.WriteUint32(static_cast<uint32_t>(config.effects.size()));
+    for (const auto &effect : config.effects) {
+        writer.WriteString(effect.name);
+        writer.WriteString(effect.libraryName);
+        WriteStrings(effect.effectProperty, writer);
+    }
+    writer.WriteUint32(static_cast<uint32_t>(config.effectChains.size()));
+    for (const auto &effectChain : config.effectChains) {
+        writer.WriteString(effectChain.name);
+        WriteStrings(effectChain.apply, writer);
+        writer.WriteString(effectChain.label);
+    }
+    writer.WriteUint32(config.preProcess.maxExtSceneNum);
+    WriteScenes(config.preProcess.defaultScenes, writer);
+    WriteScenes(config.preProcess.priorScenes, writer);
+    WriteScenes(config.preProcess.normalScenes, writer);
+    writer.WriteUint32(config.postProcess.maxExtSceneNum);
+    WriteScenes(config.postProcess.defaultScenes, writer);
+    WriteScenes(config.postProcess.priorScenes, writer);
+    WriteScenes(config.postProcess.normalScenes, writer);
+    writer.WriteUint32(static_cast<uint32_t>(config.postProcess.sceneMap.size()));
+    for (const auto &item : config.postProcess.sceneMap) {
+        writer.WriteString(item.name);
+        writer.WriteString(item.sceneType);
+    }
+    return writer.GetData();
+}
+
+std::vector<uint8_t> FlattenFocusConfig(int32_t ret, const FocusConfigMap &focusMap)
+{
+    AudioConfigCacheWriter writer;
+    writer.WriteInt32(ret);
+    AudioFocusParser::WriteFocusMap(focusMap, writer);
+    return writer.GetData();
+}
+
+std::vector<uint8_t> FlattenVolumeConfig(int32_t ret, const StreamVolumeInfoMap &streamVolumeInfoMap)
+{
+    AudioConfigCacheWriter writer;
+    writer.WriteInt32(ret);
+    AudioVolumeParser::WriteStreamVolumeInfos(streamVolumeInfoMap, writer);
+    return writer.GetData();
+}
+
+void WriteToneInfoMap(const ToneInfoMap &toneInfoMap, AudioConfigCacheWriter &writer)
+{
+    // unordered, so walk it in key order
+    std::map<int32_t, std::shared_ptr<ToneInfo>> sortedMap(toneInfoMap.begin(), toneInfoMap.end());
+    writer.WriteUint32(static_cast<uint32_t>(sortedMap.size()));
+    for (const auto &[toneType, toneInfo] : sortedMap) {
+        writer.WriteInt32(toneType);
+        writer.WriteBool(toneInfo != nullptr);
+        if (toneInfo == nullptr) {
+            continue;
+        }
+        writer.WriteUint32(toneInfo->segmentCnt);
+        writer.WriteUint32(toneInfo->repeatCnt);
+        writer.WriteUint32(toneInfo->repeatSegment);
+        for (uint32_t i = 0; i < toneInfo->segmentCnt && i <= TONEINFO_MAX_SEGMENTS; i++) {
+            const ToneSegment &segment = toneInfo->segments[i];
+            writer.WriteUint32(segment.duration);
+            for (uint32_t j = 0; j <= TONEINFO_MAX_WAVES; j++) {
+                writer.WriteUint32(segment.waveFreq[j]);
+            }
+            writer.WriteUint32(segment.loopCnt);
+            writer.WriteUint32(segment.loopIndx);
+        }
+    }
+}
+
+std::vector<uint8_t> FlattenToneConfig(int32_t ret, const ToneInfoMap &toneDescriptorMap,
+    const std::unordered_map<std::string, ToneInfoMap> &customToneDescriptorMap)
+{
+    AudioConfigCacheWriter writer;
+    writer.WriteInt32(ret);
+    WriteToneInfoMap(toneDescriptorMap, writer);
+    std::map<std::string, ToneInfoMap> sortedMap(customToneDescriptorMap.begin(), customToneDescriptorMap.end());
+    writer.WriteUint32(static_cast<uint32_t>(sortedMap.size()));
+    for (const auto &[countryCode, toneInfoMap] : sortedMap) {
+        writer.WriteString(countryCode);
+        WriteToneInfoMap(toneInfoMap, writer);
+    }
+    return writer.GetData();
+}
+}
+
+void AudioConfigPreloaderUnitTest::SetUpTestCase(void) {}
+void AudioConfigPreloaderUnitTest::TearDownTestCase(void) {}
+void AudioConfigPreloaderUnitTest::SetUp(void) {}
+void AudioConfigPreloaderUnitTest::TearDown(void) {}
+
+/**
+* @tc.name  : Test AudioConfigPreloader
+* @tc.number: AudioConfigPreloader_001
+* @tc.desc  : Configs parsed on the preload pool are byte identical to parsing them one after another.
+*/
+HWTEST_F(AudioConfigPreloaderUnitTest, AudioConfigPreloader_001, TestSize.Level1)
+{
+    OriginalEffectConfig serialEffect {};
+    int32_t serialEffectRet = AudioEffectConfigParser().LoadEffectConfig(serialEffect);
+    FocusConfigMap serialFocus;
+    int32_t serialFocusRet = AudioFocusParser().LoadConfigWithCache(serialFocus);
+    StreamVolumeInfoMap serialVolume;
+    int32_t serialVolumeRet = AudioVolumeParser().LoadConfigWithCache(serialVolume);
+    ToneInfoMap serialTone;
+    std::unordered_map<std::string, ToneInfoMap> serialCustomTone;
+    int32_t serialToneRet = AudioToneParser().LoadNewConfig(AudioToneParser::AUDIO_TONE_CONFIG_FILE, serialTone,
+        serialCustomTone);
+
+    AudioConfigPreloader preloader;
+    preloader.Preload();
+
+    OriginalEffectConfig effect {};
+    int32_t ret = ERROR;
+    ASSERT_TRUE(preloader.TakeEffectConfig(effect, ret));
+    EXPECT_EQ(FlattenEffectConfig(ret, effect), FlattenEffectConfig(serialEffectRet, serialEffect));
+
+    FocusConfigMap focus;
+    ASSERT_TRUE(preloader.TakeFocusConfig(focus, ret));
+    EXPECT_FALSE(focus.empty());
+    EXPECT_EQ(FlattenFocusConfig(ret, focus), FlattenFocusConfig(serialFocusRet, serialFocus));
+
+    StreamVolumeInfoMap volume;
+    ASSERT_TRUE(preloader.TakeVolumeConfig(volume, ret));
+    EXPECT_EQ(FlattenVolumeConfig(ret, volume), FlattenVolumeConfig(serialVolumeRet, serialVolume));
+
+    ToneInfoMap tone;
+    std::unordered_map<std::string, ToneInfoMap> customTone;
+    ASSERT_TRUE(preloader.TakeToneConfig(tone, customTone, ret));
+    EXPECT_EQ(FlattenToneConfig(ret, tone, customTone), FlattenToneConfig(serialToneRet, serialTone, serialCustomTone));
+}
+
+/**
+* @tc.name  : Test AudioConfigPreloader
+* @tc.number: AudioConfigPreloader_002
+* @tc.desc  : Nothing to take before Preload, and each result can be taken only once.
+*/
+HWTEST_F(AudioConfigPreloaderUnitTest, AudioConfigPreloader_002, TestSize.Level1)
+{
+    AudioConfigPreloader preloader;
+    FocusConfigMap focus;
+    StreamVolumeInfoMap volume;
+    int32_t ret = SUCCESS;
+    EXPECT_FALSE(preloader.TakeFocusConfig(focus, ret));
+    EXPECT_EQ(ret, SUCCESS);
+
+    preloader.Preload();
+    EXPECT_TRUE(preloader.TakeFocusConfig(focus, ret));
+    EXPECT_FALSE(preloader.TakeFocusConfig(focus, ret));
+    EXPECT_TRUE(preloader.TakeVolumeConfig(volume, ret));
+    EXPECT_FALSE(preloader.TakeVolumeConfig(volume, ret));
+    EXPECT_TRUE(preloader.focusResult_.config.empty());
+
+    // preloading again refills every result
+    preloader.Preload();
+    FocusConfigMap focusAgain;
+    EXPECT_TRUE(preloader.TakeFocusConfig(focusAgain, ret));
+    EXPECT_EQ(FlattenFocusConfig(ret, focusAgain), FlattenFocusConfig(ret, focus));
+}
+
+/**
+* @tc.name  : Test AudioConfigPreloader
+* @tc.number: AudioConfigPreloader_003
+* @tc.desc  : The libxml2 reference held across the preload is released once the configs are parsed.
+*/
+HWTEST_F(AudioConfigPreloaderUnitTest, AudioConfigPreloader_003, TestSize.Level1)
+{
+    int32_t refCount = DlopenUtils::refCount_.load();
+    AudioConfigPreloader preloader;
+    preloader.Preload();
+    EXPECT_EQ(DlopenUtils::refCount_.load(), refCount);
+
+    // libxml2 opens again for a parse after the preload
+    FocusConfigMap focus;
+    int32_t ret = ERROR;
+    EXPECT_TRUE(preloader.TakeFocusConfig(focus, ret));
+    FocusConfigMap serialFocus;
+    int32_t serialRet = AudioFocusParser().LoadConfig(serialFocus);
+    EXPECT_EQ(FlattenFocusConfig(ret, focus), FlattenFocusConfig(serialRet, serialFocus));
+}
+} // namespace AudioStandard
+} // namespace OHOS
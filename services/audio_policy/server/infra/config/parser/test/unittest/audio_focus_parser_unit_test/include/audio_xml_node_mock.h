@@ -28,6 +28,7 @@ public:
     MOCK_METHOD(std::shared_ptr<AudioXmlNode>, GetChildrenNode, (), ());
     MOCK_METHOD(std::shared_ptr<AudioXmlNode>, GetCopyNode, (), ());
     MOCK_METHOD(int32_t, Config, (const char *fileName, const char *encoding, int32_t options), ());
+    MOCK_METHOD(int32_t, ConfigMemory, (const char *buffer, int32_t size, const char *encoding, int32_t options), ());
     MOCK_METHOD(void, MoveToNext, (), ());
     MOCK_METHOD(void, MoveToChildren, (), ());
     MOCK_METHOD(bool, IsNodeValid, (), ());
@@ -100,6 +100,7 @@ public:
     void GetIntValues(std::vector<IntValueInfo> &infos, std::string tableType);
     ErrCode PutIntValues(std::vector<IntValueInfo>& infos, std::string tableType);
     void GetBoolValues(std::vector<BoolValueInfo> &infos, std::string tableType);
+    ErrCode PutBoolValues(std::vector<BoolValueInfo> &infos, std::string tableType);
 private:
     void GetIntValuesInner(std::vector<IntValueInfo> &infos, std::string tableType);
     void GetBoolValuesInner(std::vector<BoolValueInfo> &infos, std::string tableType);
@@ -109,6 +110,7 @@ private:
         std::string key, std::string tableType, bool &res);
 
     ErrCode PutIntValuesInner(std::vector<IntValueInfo> &infos, std::string tableType);
+    ErrCode PutBoolValuesInner(std::vector<BoolValueInfo> &infos, std::string tableType);
     ErrCode PutIntValueInner(std::shared_ptr<DataShare::DataShareHelper> helper,
         std::string key, std::string value, std::string tableType);
 
@@ -664,6 +664,25 @@ ErrCode AudioSettingProvider::PutIntValuesInner(std::vector<IntValueInfo> &infos
     return SUCCESS;
 }
 
+ErrCode AudioSettingProvider::PutBoolValues(std::vector<BoolValueInfo> &infos, std::string tableType)
+{
+    std::string callingIdentity = IPCSkeleton::ResetCallingIdentity();
+    int32_t ret = PutBoolValuesInner(infos, tableType);
+    IPCSkeleton::SetCallingIdentity(callingIdentity);
+    return ret;
+}
+
+ErrCode AudioSettingProvider::PutBoolValuesInner(std::vector<BoolValueInfo> &infos, std::string tableType)
+{
+    auto helper =  CreateDataShareHelper(tableType);
+    CHECK_AND_RETURN_RET_LOG(helper != nullptr, ERR_NO_INIT, "helper is null");
+    for (auto &info : infos) {
+        PutIntValueInner(helper, info.key, info.value ? "true" : "false", tableType);
+    }
+    ReleaseDataShareHelper(helper);
+    return SUCCESS;
+}
+
 ErrCode AudioSettingProvider::PutIntValueInner(std::shared_ptr<DataShare::DataShareHelper> helper,
     std::string key, std::string value, std::string tableType)
 {
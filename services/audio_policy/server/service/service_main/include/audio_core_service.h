@@ -571,6 +571,8 @@ private:
     int32_t CheckModuleForHearingAid(uint32_t &paIndex);
     void CheckCloseHearingAidCall(const bool isModemCallRunning, const DeviceType type);
     void CheckOpenHearingAidCall(const bool isModemCallRunning, const DeviceType type);
+    void CheckOpenLoopbackSoftLink(std::shared_ptr<AudioStreamDescriptor> streamDesc);
+    void CheckCloseLoopbackSoftLink(uint32_t sessionId);
     std::shared_ptr<AudioDeviceDescriptor> GetCaptureClientDevice(
         std::shared_ptr<AudioStreamDescriptor> streamDesc, uint32_t sessionId);
     int32_t PlayBackToInjection(uint32_t sessionId);
@@ -616,6 +618,9 @@ private:
 
     bool hearingAidCallFlag_ = false;
     std::shared_ptr<HPAE::IHpaeSoftLink> softLink_ = nullptr;
+    // links the software loopback capturer to its renderer, keyed by the renderer and capturer session
+    std::shared_ptr<HPAE::IHpaeSoftLink> loopbackSoftLink_ = nullptr;
+    std::pair<uint32_t, uint32_t> loopbackSessionIds_ = {0, 0};
 
     // select device history
     std::mutex hisQueueMutex_;
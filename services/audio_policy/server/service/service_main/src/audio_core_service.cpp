@@ -598,12 +598,14 @@ int32_t AudioCoreService::StartClient(uint32_t sessionId)
     sleAudioDeviceManager_.UpdateSleStreamTypeCount(streamDesc, false);
 
     CheckForRemoteDeviceState(deviceDesc);
+    CheckOpenLoopbackSoftLink(streamDesc);
     return SUCCESS;
 }
 
 int32_t AudioCoreService::PauseClient(uint32_t sessionId)
 {
     pipeManager_->PauseClient(sessionId);
+    CheckCloseLoopbackSoftLink(sessionId);
     std::shared_ptr<AudioStreamDescriptor> streamDesc = pipeManager_->GetStreamDescById(sessionId);
     if (streamDesc != nullptr && streamDesc->audioMode_ == AUDIO_MODE_RECORD) {
         RecordDeviceInfo info {.uid_ = GetRealUid(streamDesc)};
@@ -616,6 +618,7 @@ int32_t AudioCoreService::PauseClient(uint32_t sessionId)
 int32_t AudioCoreService::StopClient(uint32_t sessionId)
 {
     pipeManager_->StopClient(sessionId);
+    CheckCloseLoopbackSoftLink(sessionId);
     std::shared_ptr<AudioStreamDescriptor> streamDesc = pipeManager_->GetStreamDescById(sessionId);
     if (streamDesc != nullptr && streamDesc->audioMode_ == AUDIO_MODE_RECORD) {
         RecordDeviceInfo info {.uid_ = GetRealUid(streamDesc)};
@@ -634,6 +637,7 @@ int32_t AudioCoreService::ReleaseClient(uint32_t sessionId, SessionOperationMsg
         pipeManager_->RemoveModemCommunicationId(sessionId);
         return SUCCESS;
     }
+    CheckCloseLoopbackSoftLink(sessionId);
     std::shared_ptr<AudioStreamDescriptor> streamDesc = pipeManager_->GetStreamDescById(sessionId);
     if (streamDesc != nullptr && streamDesc->audioMode_ == AUDIO_MODE_RECORD) {
         RecordDeviceInfo info {.uid_ = GetRealUid(streamDesc)};
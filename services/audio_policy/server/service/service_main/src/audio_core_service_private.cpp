@@ -515,6 +515,65 @@ void AudioCoreService::CheckAndUpdateHearingAidCall(const DeviceType type)
     CheckOpenHearingAidCall(isModemCallRunning, type);
 }
 
+static bool IsLoopbackSoftLinkStream(const std::shared_ptr<AudioStreamDescriptor> &streamDesc)
+{
+    CHECK_AND_RETURN_RET(streamDesc != nullptr, false);
+    return streamDesc->IsPlayback() ?
+        (streamDesc->rendererInfo_.isLoopback && streamDesc->rendererInfo_.loopbackMode == LOOPBACK_SOFTWARE) :
+        (streamDesc->capturerInfo_.isLoopback && streamDesc->capturerInfo_.loopbackMode == LOOPBACK_SOFTWARE);
+}
+
+void AudioCoreService::CheckOpenLoopbackSoftLink(std::shared_ptr<AudioStreamDescriptor> streamDesc)
+{
+    CHECK_AND_RETURN(loopbackSoftLink_ == nullptr && IsLoopbackSoftLinkStream(streamDesc));
+    // the link needs the ports of both streams, so it is created when the second one of the pair starts
+    std::vector<std::shared_ptr<AudioStreamDescriptor>> peerDescs = streamDesc->IsPlayback() ?
+        pipeManager_->GetAllInputStreamDescs() : pipeManager_->GetAllOutputStreamDescs();
+    std::shared_ptr<AudioStreamDescriptor> peerDesc = nullptr;
+    for (auto &desc : peerDescs) {
+        if (IsLoopbackSoftLinkStream(desc) && desc->IsRunning() && desc->callerPid_ == streamDesc->callerPid_) {
+            peerDesc = desc;
+            break;
+        }
+    }
+    CHECK_AND_RETURN(peerDesc != nullptr);
+    uint32_t rendererId = streamDesc->IsPlayback() ? streamDesc->sessionId_ : peerDesc->sessionId_;
+    uint32_t capturerId = streamDesc->IsPlayback() ? peerDesc->sessionId_ : streamDesc->sessionId_;
+    std::vector<std::shared_ptr<AudioPipeInfo>> pipeList = pipeManager_->GetPipeList();
+    std::shared_ptr<AudioPipeInfo> sinkPipe = pipeManager_->FindPipeBySessionId(pipeList, rendererId);
+    std::shared_ptr<AudioPipeInfo> sourcePipe = pipeManager_->FindPipeBySessionId(pipeList, capturerId);
+    CHECK_AND_RETURN_LOG(sinkPipe != nullptr && sourcePipe != nullptr, "Can not find pipe of loopback streams");
+
+    loopbackSoftLink_ = HPAE::IHpaeSoftLink::CreateSoftLink(sinkPipe->paIndex_, sourcePipe->paIndex_,
+        HPAE::SoftLinkMode::LOOPBACK);
+    CHECK_AND_RETURN_LOG(loopbackSoftLink_ != nullptr, "CreateSoftLink failed");
+    int32_t ret = loopbackSoftLink_->Start();
+    if (ret != SUCCESS) {
+        AUDIO_ERR_LOG("Start loopback softLink failed %{public}d", ret);
+        loopbackSoftLink_->Release();
+        loopbackSoftLink_ = nullptr;
+        return;
+    }
+    loopbackSessionIds_ = {rendererId, capturerId};
+    AUDIO_INFO_LOG("loopback softLink started, renderer %{public}u capturer %{public}u", rendererId, capturerId);
+}
+
+void AudioCoreService::CheckCloseLoopbackSoftLink(uint32_t sessionId)
+{
+    CHECK_AND_RETURN(loopbackSoftLink_ != nullptr);
+    CHECK_AND_RETURN(sessionId == loopbackSessionIds_.first || sessionId == loopbackSessionIds_.second);
+    AUDIO_INFO_LOG("loopback softLink stops with session %{public}u", sessionId);
+    // the link is dropped even if the engine refuses, a later start of the pair creates a fresh one
+    if (loopbackSoftLink_->Stop() != SUCCESS) {
+        AUDIO_ERR_LOG("Stop loopback softLink failed");
+    }
+    if (loopbackSoftLink_->Release() != SUCCESS) {
+        AUDIO_ERR_LOG("Release loopback softLink failed");
+    }
+    loopbackSoftLink_ = nullptr;
+    loopbackSessionIds_ = {0, 0};
+}
+
 void AudioCoreService::HandleAudioCaptureState(AudioMode &mode, AudioStreamChangeInfo &streamChangeInfo)
 {
     if (mode == AUDIO_MODE_RECORD &&
@@ -32,6 +32,7 @@
 #include "media_monitor_manager.h"
 #include "client_type_manager.h"
 #include "dfx_msg_manager.h"
+#include "audio_config_preloader.h"
 #ifdef USB_ENABLE
 #include "audio_usb_manager.h"
 #endif
@@ -240,6 +241,8 @@ void AudioPolicyServer::OnDump()
 
 void AudioPolicyServer::Init()
 {
+    // effect, focus, volume and tone configs are independent, parse them together before their owners init
+    AudioConfigPreloader::GetInstance().Preload();
 #ifdef FEATURE_MULTIMODALINPUT_INPUT
     if (loudVolumeModeEnable_) {
         loudVolumeManager_ = std::make_shared<LoudVolumeManager>();
@@ -5353,6 +5356,11 @@ int32_t AudioPolicyServer::SetKaraokeParameters(const std::string &parameters, b
 int32_t AudioPolicyServer::IsAudioLoopbackSupported(int32_t modeIn, bool &ret)
 {
     AudioLoopbackMode mode = static_cast<AudioLoopbackMode>(modeIn);
+    if (mode == LOOPBACK_SOFTWARE) {
+        // the soft link only stands in for a missing hardware loop, and only the hpae engine can run it
+        ret = GetEngineFlag() == 1 && !AudioServerProxy::GetInstance().IsAudioLoopbackSupported(LOOPBACK_HARDWARE);
+        return SUCCESS;
+    }
     ret = AudioServerProxy::GetInstance().IsAudioLoopbackSupported(mode);
     return SUCCESS;
 }
@@ -3335,6 +3335,46 @@ HWTEST_F(AudioCoreServicePrivateTest, CheckAndUpdateHearingAidCall_001, TestSize
     ASSERT_EQ(ret, nullptr);
 }
 
+/**
+ * @tc.name  : Test AudioCoreService.
+ * @tc.number: CheckOpenLoopbackSoftLink_001
+ * @tc.desc  : Test AudioCoreService::CheckOpenLoopbackSoftLink without a running peer stream
+ */
+HWTEST_F(AudioCoreServicePrivateTest, CheckOpenLoopbackSoftLink_001, TestSize.Level1)
+{
+    auto audioCoreService = std::make_shared<AudioCoreService>();
+    auto streamDesc = std::make_shared<AudioStreamDescriptor>();
+    streamDesc->audioMode_ = AUDIO_MODE_PLAYBACK;
+    streamDesc->sessionId_ = 100001;
+    streamDesc->rendererInfo_.isLoopback = true;
+    streamDesc->rendererInfo_.loopbackMode = LOOPBACK_SOFTWARE;
+    audioCoreService->CheckOpenLoopbackSoftLink(streamDesc);
+    EXPECT_EQ(audioCoreService->loopbackSoftLink_, nullptr);
+
+    streamDesc->rendererInfo_.loopbackMode = LOOPBACK_HARDWARE;
+    audioCoreService->CheckOpenLoopbackSoftLink(streamDesc);
+    EXPECT_EQ(audioCoreService->loopbackSoftLink_, nullptr);
+    audioCoreService->CheckOpenLoopbackSoftLink(nullptr);
+    EXPECT_EQ(audioCoreService->loopbackSoftLink_, nullptr);
+}
+
+/**
+ * @tc.name  : Test AudioCoreService.
+ * @tc.number: CheckCloseLoopbackSoftLink_001
+ * @tc.desc  : Test AudioCoreService::CheckCloseLoopbackSoftLink only reacts to the linked sessions
+ */
+HWTEST_F(AudioCoreServicePrivateTest, CheckCloseLoopbackSoftLink_001, TestSize.Level1)
+{
+    auto audioCoreService = std::make_shared<AudioCoreService>();
+    audioCoreService->CheckCloseLoopbackSoftLink(100001);
+    EXPECT_EQ(audioCoreService->loopbackSoftLink_, nullptr);
+
+    audioCoreService->loopbackSessionIds_ = {100001, 100002};
+    audioCoreService->CheckCloseLoopbackSoftLink(100003);
+    EXPECT_EQ(audioCoreService->loopbackSessionIds_.first, 100001);
+    EXPECT_EQ(audioCoreService->loopbackSessionIds_.second, 100002);
+}
+
 /**
  * @tc.name  : Test AudioCoreService.
  * @tc.number: ActivateOutputDevice_001
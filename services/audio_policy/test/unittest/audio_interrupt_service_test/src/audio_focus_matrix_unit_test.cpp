@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "audio_errors.h"
+#include "audio_focus_matrix.h"
+#include "audio_focus_parser.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace AudioStandard {
+namespace {
+using FocusMap = std::map<std::pair<AudioFocusType, AudioFocusType>, AudioFocusEntry>;
+
+AudioFocusType MakePlayType(AudioStreamType streamType)
+{
+    return {streamType, SOURCE_TYPE_INVALID, true};
+}
+
+AudioFocusType MakeRecordType(SourceType sourceType)
+{
+    return {STREAM_DEFAULT, sourceType, false};
+}
+
+bool IsSameEntry(const AudioFocusEntry &left, const AudioFocusEntry &right)
+{
+    return left.forceType == right.forceType && left.hintType == right.hintType &&
+        left.actionOn == right.actionOn && left.isReject == right.isReject;
+}
+}
+
+class AudioFocusMatrixUnitTest : public testing::Test {
+public:
+    void SetUp() override {};
+    void TearDown() override {};
+};
+
+/**
+* @tc.name  : Test AudioFocusMatrix
+* @tc.number: AudioFocusMatrix_001
+* @tc.desc  : Every pair of configured focus types resolves exactly like the focus config map.
+*/
+HWTEST_F(AudioFocusMatrixUnitTest, AudioFocusMatrix_001, TestSize.Level1)
+{
+    FocusMap focusMap;
+    AudioFocusParser parser;
+    parser.LoadConfig(focusMap);
+    ASSERT_FALSE(focusMap.empty());
+
+    AudioFocusMatrix focusMatrix;
+    focusMatrix.Build(focusMap);
+    EXPECT_TRUE(focusMatrix.IsBuilt());
+    for (const auto &[existingName, existing] : AudioFocusParser::audioFocusMap) {
+        for (const auto &[incomingName, incoming] : AudioFocusParser::audioFocusMap) {
+            AudioFocusEntry focusEntry {};
+            auto it = focusMap.find(std::make_pair(existing, incoming));
+            bool found = focusMatrix.Find(existing, incoming, focusEntry);
+            ASSERT_EQ(found, it != focusMap.end()) << existingName << " -> " << incomingName;
+            if (found) {
+                EXPECT_TRUE(IsSameEntry(focusEntry, it->second)) << existingName << " -> " << incomingName;
+            }
+        }
+    }
+}
+
+/**
+* @tc.name  : Test AudioFocusMatrix
+* @tc.number: AudioFocusMatrix_002
+* @tc.desc  : Missing pairs, unknown types and out of range types.
+*/
+HWTEST_F(AudioFocusMatrixUnitTest, AudioFocusMatrix_002, TestSize.Level1)
+{
+    AudioFocusEntry musicOnRing = {INTERRUPT_SHARE, INTERRUPT_HINT_DUCK, CURRENT, false};
+    AudioFocusEntry micOnMusic = {INTERRUPT_FORCE, INTERRUPT_HINT_STOP, INCOMING, true};
+    AudioFocusEntry outOfRange = {INTERRUPT_FORCE, INTERRUPT_HINT_PAUSE, CURRENT, false};
+    AudioFocusType invalidType = MakePlayType(static_cast<AudioStreamType>(STREAM_TYPE_MAX + 1));
+    FocusMap focusMap;
+    focusMap[std::make_pair(MakePlayType(STREAM_MUSIC), MakePlayType(STREAM_RING))] = musicOnRing;
+    focusMap[std::make_pair(MakeRecordType(SOURCE_TYPE_MIC), MakePlayType(STREAM_MUSIC))] = micOnMusic;
+    focusMap[std::make_pair(invalidType, MakePlayType(STREAM_MUSIC))] = outOfRange;
+
+    AudioFocusMatrix focusMatrix;
+    AudioFocusEntry focusEntry {};
+    EXPECT_FALSE(focusMatrix.Find(MakePlayType(STREAM_MUSIC), MakePlayType(STREAM_RING), focusEntry));
+    focusMatrix.Build(focusMap);
+    EXPECT_EQ(focusMatrix.GetTypeNum(), 3);
+
+    EXPECT_TRUE(focusMatrix.Find(MakePlayType(STREAM_MUSIC), MakePlayType(STREAM_RING), focusEntry));
+    EXPECT_TRUE(IsSameEntry(focusEntry, musicOnRing));
+    EXPECT_TRUE(focusMatrix.Find(MakeRecordType(SOURCE_TYPE_MIC), MakePlayType(STREAM_MUSIC), focusEntry));
+    EXPECT_TRUE(IsSameEntry(focusEntry, micOnMusic));
+    EXPECT_TRUE(focusMatrix.Find(invalidType, MakePlayType(STREAM_MUSIC), focusEntry));
+    EXPECT_TRUE(IsSameEntry(focusEntry, outOfRange));
+
+    // known types without an entry, a type the config never mentions, and isPlay is not part of the key
+    EXPECT_FALSE(focusMatrix.Find(MakePlayType(STREAM_RING), MakePlayType(STREAM_MUSIC), focusEntry));
+    EXPECT_FALSE(focusMatrix.Find(MakePlayType(STREAM_ALARM), MakePlayType(STREAM_MUSIC), focusEntry));
+    EXPECT_FALSE(focusMatrix.Find(MakePlayType(STREAM_MUSIC), invalidType, focusEntry));
+    AudioFocusType ringAsRecord = {STREAM_RING, SOURCE_TYPE_INVALID, false};
+    EXPECT_TRUE(focusMatrix.Find(MakePlayType(STREAM_MUSIC), ringAsRecord, focusEntry));
+}
+} // namespace AudioStandard
+} // namespace OHOS
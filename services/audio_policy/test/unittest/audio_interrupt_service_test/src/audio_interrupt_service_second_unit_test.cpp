@@ -25,6 +25,14 @@ void AudioInterruptServiceSecondUnitTest::TearDownTestCase(void) {}
 void AudioInterruptServiceSecondUnitTest::SetUp(void) {}
 void AudioInterruptServiceSecondUnitTest::TearDown(void) {}
 
+static InterruptHint GetConfiguredHint(const std::shared_ptr<AudioInterruptService> &audioInterruptService,
+    const std::pair<AudioFocusType, AudioFocusType> &focusPair)
+{
+    AudioFocusEntry focusEntry;
+    EXPECT_TRUE(audioInterruptService->GetFocusEntry(focusPair.first, focusPair.second, focusEntry));
+    return focusEntry.hintType;
+}
+
 class RemoteObjectTestStub : public IRemoteObject {
 public:
     RemoteObjectTestStub() : IRemoteObject(u"IRemoteObject") {}
@@ -310,7 +318,7 @@ HWTEST(AudioInterruptServiceSecondUnitTest, AudioInterruptService_010, TestSize.
         std::make_pair(audioFocusType, audioInterrupt.audioFocusType);
     AudioFocusEntry focusEntry;
     focusEntry.actionOn = INCOMING;
-    audioInterruptService->focusCfgMap_[focusPair] = focusEntry;
+    audioInterruptService->focusMatrix_.Build({{focusPair, focusEntry}});
     audioInterruptService->PrintLogsOfFocusStrategyBaseMusic(audioInterrupt);
 }
 
@@ -332,7 +340,7 @@ HWTEST(AudioInterruptServiceSecondUnitTest, AudioInterruptService_011, TestSize.
         std::make_pair(audioFocusType, audioInterrupt.audioFocusType);
     AudioFocusEntry focusEntry;
     focusEntry.actionOn = CURRENT;
-    audioInterruptService->focusCfgMap_[focusPair] = focusEntry;
+    audioInterruptService->focusMatrix_.Build({{focusPair, focusEntry}});
 
     int ret =
         audioInterruptService->sessionService_.SetAudioSessionScene(audioInterrupt.pid, AudioSessionScene::MEDIA);
@@ -365,33 +373,33 @@ HWTEST(AudioInterruptServiceSecondUnitTest, AudioInterruptService_012, TestSize.
         std::make_pair(audioFocusType, audioInterrupt.audioFocusType);
     AudioFocusEntry focusEntry;
     focusEntry.actionOn = CURRENT;
-    audioInterruptService->focusCfgMap_[focusPair] = focusEntry;
+    audioInterruptService->focusMatrix_.Build({{focusPair, focusEntry}});
     audioInterrupt.sessionStrategy.concurrencyMode = AudioConcurrencyMode::MIX_WITH_OTHERS;
     audioInterruptService->PrintLogsOfFocusStrategyBaseMusic(audioInterrupt);
 
     focusEntry.hintType = INTERRUPT_HINT_DUCK;
-    audioInterruptService->focusCfgMap_[focusPair] = focusEntry;
+    audioInterruptService->focusMatrix_.Build({{focusPair, focusEntry}});
     audioInterrupt.sessionStrategy.concurrencyMode = AudioConcurrencyMode::SILENT;
     audioInterruptService->PrintLogsOfFocusStrategyBaseMusic(audioInterrupt);
-    EXPECT_EQ(INTERRUPT_HINT_DUCK, audioInterruptService->focusCfgMap_[focusPair].hintType);
+    EXPECT_EQ(INTERRUPT_HINT_DUCK, GetConfiguredHint(audioInterruptService, focusPair));
 
     focusEntry.hintType = INTERRUPT_HINT_PAUSE;
-    audioInterruptService->focusCfgMap_[focusPair] = focusEntry;
+    audioInterruptService->focusMatrix_.Build({{focusPair, focusEntry}});
     audioInterrupt.sessionStrategy.concurrencyMode = AudioConcurrencyMode::SILENT;
     audioInterruptService->PrintLogsOfFocusStrategyBaseMusic(audioInterrupt);
-    EXPECT_EQ(INTERRUPT_HINT_PAUSE, audioInterruptService->focusCfgMap_[focusPair].hintType);
+    EXPECT_EQ(INTERRUPT_HINT_PAUSE, GetConfiguredHint(audioInterruptService, focusPair));
 
     focusEntry.hintType = INTERRUPT_HINT_STOP;
-    audioInterruptService->focusCfgMap_[focusPair] = focusEntry;
+    audioInterruptService->focusMatrix_.Build({{focusPair, focusEntry}});
     audioInterrupt.sessionStrategy.concurrencyMode = AudioConcurrencyMode::SILENT;
     audioInterruptService->PrintLogsOfFocusStrategyBaseMusic(audioInterrupt);
-    EXPECT_EQ(INTERRUPT_HINT_STOP, audioInterruptService->focusCfgMap_[focusPair].hintType);
+    EXPECT_EQ(INTERRUPT_HINT_STOP, GetConfiguredHint(audioInterruptService, focusPair));
 
     focusEntry.hintType = INTERRUPT_HINT_MUTE;
-    audioInterruptService->focusCfgMap_[focusPair] = focusEntry;
+    audioInterruptService->focusMatrix_.Build({{focusPair, focusEntry}});
     audioInterrupt.sessionStrategy.concurrencyMode = AudioConcurrencyMode::SILENT;
     audioInterruptService->PrintLogsOfFocusStrategyBaseMusic(audioInterrupt);
-    EXPECT_EQ(INTERRUPT_HINT_MUTE, audioInterruptService->focusCfgMap_[focusPair].hintType);
+    EXPECT_EQ(INTERRUPT_HINT_MUTE, GetConfiguredHint(audioInterruptService, focusPair));
 }
 
 /**
@@ -411,29 +419,29 @@ HWTEST(AudioInterruptServiceSecondUnitTest, AudioInterruptService_013, TestSize.
         std::make_pair(audioFocusType, audioInterrupt.audioFocusType);
     AudioFocusEntry focusEntry;
     focusEntry.actionOn = CURRENT;
-    audioInterruptService->focusCfgMap_[focusPair] = focusEntry;
+    audioInterruptService->focusMatrix_.Build({{focusPair, focusEntry}});
     audioInterrupt.sessionStrategy.concurrencyMode = AudioConcurrencyMode::DUCK_OTHERS;
     audioInterruptService->PrintLogsOfFocusStrategyBaseMusic(audioInterrupt);
 
     focusEntry.hintType = INTERRUPT_HINT_DUCK;
-    audioInterruptService->focusCfgMap_[focusPair] = focusEntry;
+    audioInterruptService->focusMatrix_.Build({{focusPair, focusEntry}});
     audioInterruptService->PrintLogsOfFocusStrategyBaseMusic(audioInterrupt);
-    EXPECT_EQ(INTERRUPT_HINT_DUCK, audioInterruptService->focusCfgMap_[focusPair].hintType);
+    EXPECT_EQ(INTERRUPT_HINT_DUCK, GetConfiguredHint(audioInterruptService, focusPair));
 
     focusEntry.hintType = INTERRUPT_HINT_PAUSE;
-    audioInterruptService->focusCfgMap_[focusPair] = focusEntry;
+    audioInterruptService->focusMatrix_.Build({{focusPair, focusEntry}});
     audioInterruptService->PrintLogsOfFocusStrategyBaseMusic(audioInterrupt);
-    EXPECT_EQ(INTERRUPT_HINT_PAUSE, audioInterruptService->focusCfgMap_[focusPair].hintType);
+    EXPECT_EQ(INTERRUPT_HINT_PAUSE, GetConfiguredHint(audioInterruptService, focusPair));
 
     focusEntry.hintType = INTERRUPT_HINT_STOP;
-    audioInterruptService->focusCfgMap_[focusPair] = focusEntry;
+    audioInterruptService->focusMatrix_.Build({{focusPair, focusEntry}});
     audioInterruptService->PrintLogsOfFocusStrategyBaseMusic(audioInterrupt);
-    EXPECT_EQ(INTERRUPT_HINT_STOP, audioInterruptService->focusCfgMap_[focusPair].hintType);
+    EXPECT_EQ(INTERRUPT_HINT_STOP, GetConfiguredHint(audioInterruptService, focusPair));
 
     focusEntry.hintType = INTERRUPT_HINT_MUTE;
-    audioInterruptService->focusCfgMap_[focusPair] = focusEntry;
+    audioInterruptService->focusMatrix_.Build({{focusPair, focusEntry}});
     audioInterruptService->PrintLogsOfFocusStrategyBaseMusic(audioInterrupt);
-    EXPECT_EQ(INTERRUPT_HINT_MUTE, audioInterruptService->focusCfgMap_[focusPair].hintType);
+    EXPECT_EQ(INTERRUPT_HINT_MUTE, GetConfiguredHint(audioInterruptService, focusPair));
 }
 
 /**
@@ -453,24 +461,24 @@ HWTEST(AudioInterruptServiceSecondUnitTest, AudioInterruptService_014, TestSize.
         std::make_pair(audioFocusType, audioInterrupt.audioFocusType);
     AudioFocusEntry focusEntry;
     focusEntry.actionOn = CURRENT;
-    audioInterruptService->focusCfgMap_[focusPair] = focusEntry;
+    audioInterruptService->focusMatrix_.Build({{focusPair, focusEntry}});
     audioInterrupt.sessionStrategy.concurrencyMode = AudioConcurrencyMode::PAUSE_OTHERS;
     audioInterruptService->PrintLogsOfFocusStrategyBaseMusic(audioInterrupt);
 
     focusEntry.hintType = INTERRUPT_HINT_PAUSE;
-    audioInterruptService->focusCfgMap_[focusPair] = focusEntry;
+    audioInterruptService->focusMatrix_.Build({{focusPair, focusEntry}});
     audioInterruptService->PrintLogsOfFocusStrategyBaseMusic(audioInterrupt);
-    EXPECT_EQ(INTERRUPT_HINT_PAUSE, audioInterruptService->focusCfgMap_[focusPair].hintType);
+    EXPECT_EQ(INTERRUPT_HINT_PAUSE, GetConfiguredHint(audioInterruptService, focusPair));
 
     focusEntry.hintType = INTERRUPT_HINT_STOP;
-    audioInterruptService->focusCfgMap_[focusPair] = focusEntry;
+    audioInterruptService->focusMatrix_.Build({{focusPair, focusEntry}});
     audioInterruptService->PrintLogsOfFocusStrategyBaseMusic(audioInterrupt);
-    EXPECT_EQ(INTERRUPT_HINT_STOP, audioInterruptService->focusCfgMap_[focusPair].hintType);
+    EXPECT_EQ(INTERRUPT_HINT_STOP, GetConfiguredHint(audioInterruptService, focusPair));
 
     focusEntry.hintType = INTERRUPT_HINT_MUTE;
-    audioInterruptService->focusCfgMap_[focusPair] = focusEntry;
+    audioInterruptService->focusMatrix_.Build({{focusPair, focusEntry}});
     audioInterruptService->PrintLogsOfFocusStrategyBaseMusic(audioInterrupt);
-    EXPECT_EQ(INTERRUPT_HINT_MUTE, audioInterruptService->focusCfgMap_[focusPair].hintType);
+    EXPECT_EQ(INTERRUPT_HINT_MUTE, GetConfiguredHint(audioInterruptService, focusPair));
 }
 
 /**
@@ -2626,13 +2626,13 @@ HWTEST_F(AudioInterruptUnitTest, AudioInterruptService_SimulateFocusEntry_004, T
         interruptServiceTest->zonesMap_.find(0)->second->audioFocusInfoList.begin()->first.audioFocusType,
         interruptServiceTest->zonesMap_.find(0)->second->audioFocusInfoList.begin()->first.audioFocusType
     );
-    interruptServiceTest->focusCfgMap_[audioFocusTypePair] = {};
+    interruptServiceTest->focusMatrix_.Build({{audioFocusTypePair, AudioFocusEntry {}}});
 
     interruptServiceTest->SimulateFocusEntry(0);
     EXPECT_FALSE(interruptServiceTest->zonesMap_.find(0)->second == nullptr);
 
     interruptServiceTest->zonesMap_.clear();
-    interruptServiceTest->focusCfgMap_.clear();
+    interruptServiceTest->focusMatrix_.Build({});
 }
 
 /**
@@ -3114,7 +3114,7 @@ HWTEST_F(AudioInterruptUnitTest, AudioInterruptService_SimulateFocusEntry_022, T
 {
     auto interruptServiceTest = GetTnterruptServiceTest();
     interruptServiceTest->zonesMap_.clear();
-    interruptServiceTest->focusCfgMap_.clear();
+    interruptServiceTest->focusMatrix_.Build({});
 
 
     AudioInterrupt interruptTest;
@@ -3133,7 +3133,7 @@ HWTEST_F(AudioInterruptUnitTest, AudioInterruptService_SimulateFocusEntry_022, T
     FocusEntryTest.hintType = static_cast<InterruptHint>(INTERRUPT_HINT_ERROR);
     focusTypePair.first.streamType = STREAM_VOICE_CALL;
     focusTypePair.second.streamType = STREAM_MUSIC;
-    interruptServiceTest->focusCfgMap_[focusTypePair] = FocusEntryTest;
+    interruptServiceTest->focusMatrix_.Build({{focusTypePair, FocusEntryTest}});
     audioFocusTypePair.first.pid = 1;
     audioFocusTypePair.second = PAUSE;
     audioFocusTypePair.first.audioFocusType.streamType = STREAM_VOICE_CALL;
@@ -3157,7 +3157,7 @@ HWTEST_F(AudioInterruptUnitTest, AudioInterruptService_SimulateFocusEntry_023, T
 {
     auto interruptServiceTest = GetTnterruptServiceTest();
     interruptServiceTest->zonesMap_.clear();
-    interruptServiceTest->focusCfgMap_.clear();
+    interruptServiceTest->focusMatrix_.Build({});
 
     AudioInterrupt interruptTest;
     interruptTest.mode = SHARE_MODE;
@@ -3175,7 +3175,7 @@ HWTEST_F(AudioInterruptUnitTest, AudioInterruptService_SimulateFocusEntry_023, T
     FocusEntryTest.hintType = static_cast<InterruptHint>(INTERRUPT_HINT_ERROR);
     focusTypePair.first.streamType = STREAM_VOICE_CALL;
     focusTypePair.second.streamType = STREAM_MUSIC;
-    interruptServiceTest->focusCfgMap_[focusTypePair] = FocusEntryTest;
+    interruptServiceTest->focusMatrix_.Build({{focusTypePair, FocusEntryTest}});
     audioFocusTypePair.first.pid = 1;
     audioFocusTypePair.second = ACTIVE;
     audioFocusTypePair.first.audioFocusType.streamType = STREAM_VOICE_CALL;
@@ -3201,7 +3201,7 @@ HWTEST_F(AudioInterruptUnitTest, AudioInterruptService_SimulateFocusEntry_024, T
 {
     auto interruptServiceTest = GetTnterruptServiceTest();
     interruptServiceTest->zonesMap_.clear();
-    interruptServiceTest->focusCfgMap_.clear();
+    interruptServiceTest->focusMatrix_.Build({});
 
 
     AudioInterrupt interruptTest;
@@ -3220,7 +3220,7 @@ HWTEST_F(AudioInterruptUnitTest, AudioInterruptService_SimulateFocusEntry_024, T
     FocusEntryTest.hintType = static_cast<InterruptHint>(INTERRUPT_HINT_ERROR);
     focusTypePair.first.streamType = STREAM_VOICE_CALL;
     focusTypePair.second.streamType = STREAM_MUSIC;
-    interruptServiceTest->focusCfgMap_[focusTypePair] = FocusEntryTest;
+    interruptServiceTest->focusMatrix_.Build({{focusTypePair, FocusEntryTest}});
     audioFocusTypePair.first.pid = 1;
     audioFocusTypePair.second = PLACEHOLDER;
     audioFocusTypePair.first.audioFocusType.streamType = STREAM_VOICE_CALL;
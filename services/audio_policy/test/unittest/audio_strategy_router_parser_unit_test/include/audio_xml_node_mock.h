@@ -28,6 +28,8 @@ public:
     MOCK_METHOD(std::shared_ptr<AudioXmlNode>, GetChildrenNode, (), (override));
     MOCK_METHOD(std::shared_ptr<AudioXmlNode>, GetCopyNode, (), (override));
     MOCK_METHOD(int32_t, Config, (const char *fileName, const char *encoding, int32_t options), (override));
+    MOCK_METHOD(int32_t, ConfigMemory, (const char *buffer, int32_t size, const char *encoding, int32_t options),
+        (override));
     MOCK_METHOD(void, MoveToNext, (), (override));
     MOCK_METHOD(void, MoveToChildren, (), (override));
     MOCK_METHOD(bool, IsNodeValid, (), (override));
@@ -15,6 +15,9 @@
 
 #include "volume_data_maintainer_unit_test.h"
 
+#include <condition_variable>
+#include <mutex>
+
 #include "system_ability_definition.h"
 #include "audio_errors.h"
 #include "audio_utils.h"
@@ -23,6 +26,49 @@ using namespace testing::ext;
 
 namespace OHOS {
 namespace AudioStandard {
+namespace {
+// generous bound for the flush thread, the wait returns as soon as the write is seen
+constexpr std::chrono::seconds DB_WRITE_WAIT_TIMEOUT(5);
+
+class MockVolumeDbWriter : public VolumeDbWriter {
+public:
+    ErrCode PutIntValues(std::vector<IntValueInfo> &infos, const std::string &tableType) override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto &info : infos) {
+            intValues_[info.key] = info.value;
+        }
+        intWriteCount_++;
+        cv_.notify_all();
+        return SUCCESS;
+    }
+
+    ErrCode PutBoolValues(std::vector<BoolValueInfo> &infos, const std::string &tableType) override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto &info : infos) {
+            boolValues_[info.key] = info.value;
+        }
+        boolWriteCount_++;
+        cv_.notify_all();
+        return SUCCESS;
+    }
+
+    bool WaitIntWriteCount(int32_t count)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, DB_WRITE_WAIT_TIMEOUT, [this, count] { return intWriteCount_.load() >= count; });
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+
+    std::atomic<int32_t> intWriteCount_ = 0;
+    std::atomic<int32_t> boolWriteCount_ = 0;
+    std::map<std::string, int32_t> intValues_;
+    std::map<std::string, bool> boolValues_;
+};
+}
 
 void VolumeDataMaintainerUnitTest::SetUpTestCase(void) {}
 void VolumeDataMaintainerUnitTest::TearDownTestCase(void) {}
@@ -827,5 +873,87 @@ HWTEST(VolumeDataMaintainerUnitTest, SaveMuteToDb, TestSize.Level4)
     EXPECT_EQ(vd->SaveMuteToDb(desc, STREAM_MUSIC, true), SUCCESS);
 }
 
+/**
+ * @tc.name  : Test VolumeDataMaintainer.
+ * @tc.number: SaveVolumeToDbDeferred_001.
+ * @tc.desc  : A volume drag is coalesced into one batched write holding the last value of each key.
+ */
+HWTEST(VolumeDataMaintainerUnitTest, SaveVolumeToDbDeferred_001, TestSize.Level1)
+{
+    std::shared_ptr<VolumeDataMaintainer> vd = std::make_shared<VolumeDataMaintainer>();
+    std::shared_ptr<MockVolumeDbWriter> dbWriter = std::make_shared<MockVolumeDbWriter>();
+    vd->SetDbWriter(dbWriter);
+    std::shared_ptr<AudioDeviceDescriptor> desc = std::make_shared<AudioDeviceDescriptor>();
+    desc->deviceType_ = DEVICE_TYPE_SPEAKER;
+
+    const int32_t dragSteps = 100;
+    const int32_t maxVolumeLevel = 15;
+    for (int32_t i = 0; i < dragSteps; i++) {
+        EXPECT_EQ(vd->SaveVolumeToDbDeferred(desc, STREAM_MUSIC, i % (maxVolumeLevel + 1)), SUCCESS);
+        EXPECT_EQ(vd->SaveVolumeDegreeToDbDeferred(desc, STREAM_MUSIC, i), SUCCESS);
+    }
+    EXPECT_EQ(vd->SaveMuteToDbDeferred(desc, STREAM_MUSIC, true), SUCCESS);
+    EXPECT_EQ(vd->SaveMuteToDbDeferred(desc, STREAM_MUSIC, false), SUCCESS);
+
+    // reads are served from the pending values
+    EXPECT_EQ(vd->LoadVolumeFromDb(desc, STREAM_MUSIC), (dragSteps - 1) % (maxVolumeLevel + 1));
+    EXPECT_EQ(vd->LoadVolumeDegreeFromDb(desc, STREAM_MUSIC), dragSteps - 1);
+    EXPECT_EQ(vd->SaveMuteToDbDeferred(desc, STREAM_MUSIC, true), SUCCESS);
+    vd->SetVolumeList({STREAM_MUSIC});
+    vd->LoadDeviceMuteMapFromDb(desc);
+    EXPECT_TRUE(vd->LoadMuteFromMap(desc, STREAM_MUSIC));
+    EXPECT_EQ(vd->SaveMuteToDbDeferred(desc, STREAM_MUSIC, false), SUCCESS);
+
+    vd->FlushPendingDbWrites();
+    EXPECT_EQ(dbWriter->intWriteCount_.load(), 1);
+    EXPECT_EQ(dbWriter->boolWriteCount_.load(), 1);
+    std::string volumeKey = vd->GetVolumeKey(desc, STREAM_MUSIC);
+    ASSERT_EQ(dbWriter->intValues_.size(), 2);
+    EXPECT_EQ(dbWriter->intValues_[volumeKey], (dragSteps - 1) % (maxVolumeLevel + 1));
+    EXPECT_EQ(dbWriter->intValues_[volumeKey + "_degree"], dragSteps - 1);
+    ASSERT_EQ(dbWriter->boolValues_.size(), 1);
+    EXPECT_EQ(dbWriter->boolValues_[vd->GetMuteKey(desc, STREAM_MUSIC)], false);
+
+    // nothing left to write
+    vd->FlushPendingDbWrites();
+    EXPECT_EQ(dbWriter->intWriteCount_.load(), 1);
+    EXPECT_EQ(dbWriter->boolWriteCount_.load(), 1);
+}
+
+/**
+ * @tc.name  : Test VolumeDataMaintainer.
+ * @tc.number: SaveVolumeToDbDeferred_002.
+ * @tc.desc  : Pending values are written by the debounce timer without an explicit flush.
+ */
+HWTEST(VolumeDataMaintainerUnitTest, SaveVolumeToDbDeferred_002, TestSize.Level1)
+{
+    std::shared_ptr<VolumeDataMaintainer> vd = std::make_shared<VolumeDataMaintainer>();
+    std::shared_ptr<MockVolumeDbWriter> dbWriter = std::make_shared<MockVolumeDbWriter>();
+    vd->SetDbWriter(dbWriter);
+    std::shared_ptr<AudioDeviceDescriptor> desc = std::make_shared<AudioDeviceDescriptor>();
+    desc->deviceType_ = DEVICE_TYPE_SPEAKER;
+
+    const int32_t volumeLevel = 5;
+    EXPECT_EQ(vd->SaveVolumeToDbDeferred(desc, STREAM_MUSIC, volumeLevel - 1), SUCCESS);
+    EXPECT_EQ(vd->SaveVolumeToDbDeferred(desc, STREAM_MUSIC, volumeLevel), SUCCESS);
+    EXPECT_EQ(dbWriter->intWriteCount_.load(), 0);
+
+    ASSERT_TRUE(dbWriter->WaitIntWriteCount(1));
+    EXPECT_EQ(dbWriter->intWriteCount_.load(), 1);
+    {
+        std::lock_guard<std::mutex> lock(dbWriter->mutex_);
+        EXPECT_EQ(dbWriter->intValues_[vd->GetVolumeKey(desc, STREAM_MUSIC)], volumeLevel);
+    }
+
+    // a distributed device that is not ready is skipped, a device without a key is rejected
+    desc->deviceType_ = DEVICE_TYPE_REMOTE_CAST;
+    EXPECT_EQ(vd->SaveVolumeToDbDeferred(desc, STREAM_MUSIC, volumeLevel), SUCCESS);
+    std::shared_ptr<AudioDeviceDescriptor> noneDesc = std::make_shared<AudioDeviceDescriptor>();
+    EXPECT_EQ(vd->SaveVolumeToDbDeferred(noneDesc, STREAM_MUSIC, volumeLevel), ERROR);
+    EXPECT_EQ(vd->SaveVolumeToDbDeferred(nullptr, STREAM_MUSIC, volumeLevel), ERROR);
+    vd->FlushPendingDbWrites();
+    EXPECT_EQ(dbWriter->intWriteCount_.load(), 1);
+}
+
 } // AudioStandardnamespace
 } // OHOSnamespace
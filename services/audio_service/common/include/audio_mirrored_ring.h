@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef AUDIO_MIRRORED_RING_H
+#define AUDIO_MIRRORED_RING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace OHOS {
+namespace AudioStandard {
+/**
+ * Maps the first size bytes of a shared memory fd twice, back to back. Byte i of the ring is visible at both
+ * base + i and base + size + i, so up to size bytes starting at any ring position can be accessed with one
+ * contiguous copy and no split at the wrap. size must be a multiple of the page size.
+ */
+class AudioMirroredRing {
+public:
+    // the fd stays owned by the caller and may be closed after this returns
+    static std::unique_ptr<AudioMirroredRing> CreateFromFd(int fd, size_t size);
+    // backed by a memfd owned by the ring, for rings that are not handed to another process
+    static std::unique_ptr<AudioMirroredRing> CreateFromMemfd(size_t size, const std::string &name);
+
+    static size_t GetPageSize();
+    static bool IsSizeAligned(size_t size);
+    static size_t RoundUpSize(size_t size);
+
+    ~AudioMirroredRing();
+
+    AudioMirroredRing(const AudioMirroredRing &) = delete;
+    AudioMirroredRing &operator=(const AudioMirroredRing &) = delete;
+
+    uint8_t *GetBase() const
+    {
+        return base_;
+    }
+
+    size_t GetSize() const
+    {
+        return size_;
+    }
+
+    // [GetSpan(pos), GetSpan(pos) + GetSize()) is contiguous for any pos
+    uint8_t *GetSpan(uint64_t pos) const
+    {
+        return base_ + pos % size_;
+    }
+
+private:
+    AudioMirroredRing(uint8_t *base, size_t size, int ownedFd);
+
+    static uint8_t *MapMirrored(int fd, size_t size);
+
+    uint8_t *base_ = nullptr;
+    size_t size_ = 0;
+    int ownedFd_ = -1;
+};
+} // namespace AudioStandard
+} // namespace OHOS
+#endif // AUDIO_MIRRORED_RING_H
@@ -72,7 +72,12 @@ private:
     void MonitorCheckFrameAction(CheckerParam &para, int64_t abnormalFrameNum, float badFrameRatio);
     void CalculateFrameAfterStandby(CheckerParam &para, int64_t &abnormalFrameNum);
     void CheckVolume();
+    void CollectFrameCount();
     std::vector<CheckerParam> checkParaVector_;
+    // recorded on the data path without checkLock_, moved into every CheckerParam by CollectFrameCount
+    std::atomic<int64_t> muteFrameNum_ = 0;
+    std::atomic<int64_t> noDataFrameNum_ = 0;
+    std::atomic<int64_t> normalFrameCount_ = 0;
     bool monitorSwitch_ = false;
     bool isBackground_ = false;
     std::recursive_mutex checkLock_;
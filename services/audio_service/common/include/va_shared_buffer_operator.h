@@ -24,6 +24,8 @@
 #include <string>
 
 #include "va_shared_buffer.h"
+#include "audio_mirrored_ring.h"
+#include "ring_buffer_wrapper.h"
 
 #include "futex_tool.h"
 #include "audio_utils.h"
@@ -56,6 +58,17 @@ public:
 
     size_t Write(uint8_t *data, size_t dataSize);
 
+    // Zero copy access for one producer and one consumer. The span covers all writable (readable) bytes and
+    // stays valid until the matching CommitWrite (ReleaseRead), which advances the position under the futex
+    // like Write (Read) does. The span has one segment when the ring is mirrored, otherwise it may wrap.
+    int32_t AcquireWrite(RingBufferWrapper &span);
+
+    int32_t CommitWrite(size_t size);
+
+    int32_t AcquireRead(RingBufferWrapper &span);
+
+    int32_t ReleaseRead(size_t size);
+
     void GetVASharedMemInfo(VASharedMemInfo &memInfo);
 private:
     VASharedBuffer buffer_;
@@ -64,6 +77,11 @@ private:
     
     sptr<Ashmem> dataAshmem_;
 
+    uint8_t *dataBase_ = nullptr;
+
+    // set when the data ashmem could be mapped twice, transfers across the wrap then need no split
+    std::unique_ptr<AudioMirroredRing> mirroredRing_;
+
     size_t minReadSize_ = 1;
     
     uint64_t timeoutInNano_ = 100000000;
@@ -81,6 +99,12 @@ private:
     void WakeFutexIfNeed();
 
     bool HasEnoughReadableData();
+
+    bool CopyFromRing(uint8_t *data, size_t dataSize, size_t readSize);
+
+    bool CopyToRing(const uint8_t *data, size_t writeSize);
+
+    void GetRingSpan(size_t pos, size_t length, RingBufferWrapper &span);
 };
 
 }  // namespace AudioStandard
@@ -26,6 +26,22 @@ static inline bool IsVolumeSame(const float& x, const float& y, const float& eps
     return (std::abs((x) - (y)) <= std::abs(epsilon));
 }
 
+// Statistics gathered by one pass over a buffer. Filled by the DfxOperation and CalcMuteFrame overloads so the
+// caller can reuse them (e.g. max amplitude) instead of scanning the same buffer again.
+struct VolumeStats {
+    ChannelVolumes volumes = {}; // mean absolute level of each channel, same scale as CountVolumeLevel
+    float peak = 0.0f; // max absolute sample of all channels, 1.0f is full scale
+    size_t frameCount = 0; // frames visited
+    size_t maxZeroRun = 0; // longest run of frames with every channel silent
+    size_t clipCount = 0; // samples at full scale
+    size_t zeroRun = 0; // silent frames at the end of the visited data, to continue the run across chunks
+
+    bool IsAllZero() const
+    {
+        return frameCount > 0 && maxZeroRun == frameCount;
+    }
+};
+
 class VolumeTools {
 public:
     static double GetVolDb(AudioSampleFormat format, int32_t vol);
@@ -41,15 +57,26 @@ public:
     // There will be significant sound quality loss when process uint8_t samples.
     static int32_t Process(const BufferDesc &buffer, AudioSampleFormat format, ChannelVolumes vols);
     static int32_t Process(const RingBufferWrapper& ringBufferDesc, AudioSampleFormat format, ChannelVolumes vols);
+    // Equal-power fade of the whole buffer: the gain follows a quarter sine (fade in) or cosine (fade out) and is
+    // 1.0 (fade in) or 0.0 (fade out) on the last frame.
+    static int32_t ProcessFade(const BufferDesc &bufferDesc, AudioSampleFormat format, AudioChannel channel,
+        bool isFadeOut);
 
     // will count volume for each channel, vol sum will be kept in volStart
     static ChannelVolumes CountVolumeLevel(const BufferDesc &buffer, AudioSampleFormat format, AudioChannel channel,
         size_t split = 1);
+    // same as CountVolumeLevel, peak, silence and clipping are accumulated into stats in the same pass
+    static ChannelVolumes CountVolumeLevel(const BufferDesc &buffer, AudioSampleFormat format, AudioChannel channel,
+        VolumeStats &stats, size_t split = 1);
     static void DfxOperation(const BufferDesc &buffer, AudioStreamInfo streamInfo, std::string logTag,
         int64_t &volumeDataCount, size_t split = 1);
+    static void DfxOperation(const BufferDesc &buffer, AudioStreamInfo streamInfo, std::string logTag,
+        int64_t &volumeDataCount, VolumeStats &stats, size_t split = 1);
 
     static void CalcMuteFrame(BufferDesc &buffer, AudioStreamInfo streamInfo, std::string logTag,
         int64_t &volumeDataCount, int64_t &muteFrameCnt, size_t split = 1);
+    static void CalcMuteFrame(BufferDesc &buffer, AudioStreamInfo streamInfo, std::string logTag,
+        int64_t &volumeDataCount, int64_t &muteFrameCnt, VolumeStats &stats, size_t split = 1);
     static bool IsZeroVolume(float volume);
 };
 } // namespace AudioStandard
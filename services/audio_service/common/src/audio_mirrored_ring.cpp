@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef LOG_TAG
+#define LOG_TAG "AudioMirroredRing"
+#endif
+
+#include "audio_mirrored_ring.h"
+
+#include <cerrno>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "audio_service_log.h"
+
+namespace OHOS {
+namespace AudioStandard {
+namespace {
+constexpr size_t MAX_MIRRORED_RING_SIZE = 10 * 1024 * 1024;
+constexpr size_t MIRROR_COUNT = 2;
+}
+
+AudioMirroredRing::AudioMirroredRing(uint8_t *base, size_t size, int ownedFd)
+    : base_(base), size_(size), ownedFd_(ownedFd)
+{
+}
+
+AudioMirroredRing::~AudioMirroredRing()
+{
+    if (base_ != nullptr) {
+        (void)munmap(base_, size_ * MIRROR_COUNT);
+        base_ = nullptr;
+    }
+    if (ownedFd_ >= 0) {
+        (void)close(ownedFd_);
+        ownedFd_ = -1;
+    }
+}
+
+size_t AudioMirroredRing::GetPageSize()
+{
+    static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return pageSize;
+}
+
+bool AudioMirroredRing::IsSizeAligned(size_t size)
+{
+    return size > 0 && size % GetPageSize() == 0;
+}
+
+size_t AudioMirroredRing::RoundUpSize(size_t size)
+{
+    size_t pageSize = GetPageSize();
+    return (size + pageSize - 1) / pageSize * pageSize;
+}
+
+uint8_t *AudioMirroredRing::MapMirrored(int fd, size_t size)
+{
+    // reserve the whole range first so nothing else can land between the two views
+    void *reserved = mmap(nullptr, size * MIRROR_COUNT, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    CHECK_AND_RETURN_RET_LOG(reserved != MAP_FAILED, nullptr, "reserve %{public}zu bytes failed, errno %{public}d",
+        size * MIRROR_COUNT, errno);
+    uint8_t *base = static_cast<uint8_t *>(reserved);
+    for (size_t i = 0; i < MIRROR_COUNT; i++) {
+        void *view = mmap(base + i * size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+        if (view != base + i * size) {
+            AUDIO_ERR_LOG("map view %{public}zu of fd %{public}d failed, errno %{public}d", i, fd, errno);
+            (void)munmap(reserved, size * MIRROR_COUNT);
+            return nullptr;
+        }
+    }
+    return base;
+}
+
+std::unique_ptr<AudioMirroredRing> AudioMirroredRing::CreateFromFd(int fd, size_t size)
+{
+    CHECK_AND_RETURN_RET_LOG(fd >= 0, nullptr, "invalid fd: %{public}d", fd);
+    CHECK_AND_RETURN_RET_LOG(IsSizeAligned(size) && size <= MAX_MIRRORED_RING_SIZE, nullptr,
+        "invalid size: %{public}zu", size);
+    uint8_t *base = MapMirrored(fd, size);
+    CHECK_AND_RETURN_RET(base != nullptr, nullptr);
+    return std::unique_ptr<AudioMirroredRing>(new AudioMirroredRing(base, size, -1));
+}
+
+std::unique_ptr<AudioMirroredRing> AudioMirroredRing::CreateFromMemfd(size_t size, const std::string &name)
+{
+    CHECK_AND_RETURN_RET_LOG(IsSizeAligned(size) && size <= MAX_MIRRORED_RING_SIZE, nullptr,
+        "invalid size: %{public}zu", size);
+    int fd = memfd_create(name.c_str(), MFD_CLOEXEC);
+    CHECK_AND_RETURN_RET_LOG(fd >= 0, nullptr, "memfd_create %{public}s failed, errno %{public}d", name.c_str(),
+        errno);
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        AUDIO_ERR_LOG("ftruncate %{public}s to %{public}zu failed, errno %{public}d", name.c_str(), size, errno);
+        (void)close(fd);
+        return nullptr;
+    }
+    uint8_t *base = MapMirrored(fd, size);
+    if (base == nullptr) {
+        (void)close(fd);
+        return nullptr;
+    }
+    return std::unique_ptr<AudioMirroredRing>(new AudioMirroredRing(base, size, fd));
+}
+} // namespace AudioStandard
+} // namespace OHOS
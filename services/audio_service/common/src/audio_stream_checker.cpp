@@ -52,6 +52,8 @@ void AudioStreamChecker::InitChecker(DataTransferMonitorParam para, const int32_
             return;
         }
     }
+    // frames recorded before this callback registered are not counted for it
+    CollectFrameCount();
     CheckerParam checkPara;
     checkPara.pid = pid;
     checkPara.callbackId = callbackId;
@@ -156,11 +158,25 @@ void AudioStreamChecker::MonitorCheckFrame()
         return;
     }
     std::lock_guard<std::recursive_mutex> lock(checkLock_);
+    CollectFrameCount();
     for (int32_t index = 0; index < checkParaVector_.size(); index++) {
         MonitorCheckFrameSub(checkParaVector_[index]);
     }
 }
 
+void AudioStreamChecker::CollectFrameCount()
+{
+    // every para counts the same frames, each counter is independent so relaxed order is enough
+    int64_t muteFrameNum = muteFrameNum_.exchange(0, std::memory_order_relaxed);
+    int64_t noDataFrameNum = noDataFrameNum_.exchange(0, std::memory_order_relaxed);
+    int64_t normalFrameCount = normalFrameCount_.exchange(0, std::memory_order_relaxed);
+    for (auto &para : checkParaVector_) {
+        para.muteFrameNum += muteFrameNum;
+        para.noDataFrameNum += noDataFrameNum;
+        para.normalFrameCount += normalFrameCount;
+    }
+}
+
 void AudioStreamChecker::MonitorCheckFrameAction(CheckerParam &para, int64_t abnormalFrameNum,
     float badFrameRatio)
 {
@@ -240,6 +256,7 @@ void AudioStreamChecker::CleanRecordData(CheckerParam &para)
 void AudioStreamChecker::MonitorOnAllCallback(DataTransferStateChangeType type, bool isStandby)
 {
     std::lock_guard<std::recursive_mutex> lock(checkLock_);
+    CollectFrameCount();
     if (!monitorSwitch_) {
         AUDIO_ERR_LOG("Not register monitor callback");
         return;
@@ -337,34 +354,20 @@ int32_t AudioStreamChecker::GetAppUid()
     return streamConfig_.appInfo.appUid;
 }
 
+// called once per period on the data path, never waits for the checker thread
 void AudioStreamChecker::RecordMuteFrame()
 {
-    std::lock_guard<std::recursive_mutex> lock(checkLock_);
-    for (size_t index = 0; index < checkParaVector_.size(); index++) {
-        checkParaVector_[index].muteFrameNum++;
-        AUDIO_DEBUG_LOG("Mute frame num = %{public}" PRId64", callbackId = %{public}d",
-            checkParaVector_[index].muteFrameNum, checkParaVector_[index].callbackId);
-    }
+    muteFrameNum_.fetch_add(1, std::memory_order_relaxed);
 }
 
 void AudioStreamChecker::RecordNodataFrame()
 {
-    std::lock_guard<std::recursive_mutex> lock(checkLock_);
-    for (size_t index = 0; index < checkParaVector_.size(); index++) {
-        checkParaVector_[index].noDataFrameNum++;
-        AUDIO_DEBUG_LOG("No data frame num = %{public}" PRId64", callbackId = %{public}d",
-            checkParaVector_[index].noDataFrameNum, checkParaVector_[index].callbackId);
-    }
+    noDataFrameNum_.fetch_add(1, std::memory_order_relaxed);
 }
 
 void AudioStreamChecker::RecordNormalFrame()
 {
-    std::lock_guard<std::recursive_mutex> lock(checkLock_);
-    for (size_t index = 0; index < checkParaVector_.size(); index++) {
-        checkParaVector_[index].normalFrameCount++;
-        AUDIO_DEBUG_LOG("Normal frame num = %{public}" PRId64", callbackId = %{public}d",
-            checkParaVector_[index].normalFrameCount, checkParaVector_[index].callbackId);
-    }
+    normalFrameCount_.fetch_add(1, std::memory_order_relaxed);
 }
 
 void AudioStreamChecker::UpdateAppState(bool isBackground)
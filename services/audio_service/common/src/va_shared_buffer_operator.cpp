@@ -28,6 +28,11 @@ VASharedBufferOperator::VASharedBufferOperator(const VASharedBuffer &buffer) : b
     dataAshmem_ = buffer_.GetDataAshmem();
     CHECK_AND_RETURN_LOG(dataAshmem_ != nullptr, "dataAshmem_ is nullptr");
     capacity = buffer_.GetDataSize();
+    dataBase_ = buffer_.GetDataBase();
+    if (AudioMirroredRing::IsSizeAligned(capacity)) {
+        mirroredRing_ = AudioMirroredRing::CreateFromFd(dataAshmem_->GetAshmemFd(), capacity);
+    }
+    AUDIO_INFO_LOG("capacity: %{public}zu mirrored: %{public}d", capacity, mirroredRing_ != nullptr);
     InitVASharedStatusInfo();
 }
 
@@ -102,33 +107,9 @@ size_t VASharedBufferOperator::Read(uint8_t *data, size_t dataSize)
         return 0;
     }
 
-    int ret;
-    size_t readIndex = statusInfo_->readPos % capacity;
-    if (readIndex + readSize <= capacity) {
-        const void *read_ptr = dataAshmem_->ReadFromAshmem(readSize, readIndex);
-        ret = memcpy_s(data, dataSize, read_ptr, readSize);
-        if (ret) {
-            AUDIO_INFO_LOG("[1] Read failed");
-            WakeFutex();
-            return 0;
-        }
-    } else {
-        size_t firstReadSize = capacity - readIndex;
-        const void *first_read_ptr = dataAshmem_->ReadFromAshmem(firstReadSize, readIndex);
-        ret = memcpy_s(data, dataSize, first_read_ptr, firstReadSize);
-        if (ret) {
-            AUDIO_INFO_LOG("[2] Read failed");
-            WakeFutex();
-            return 0;
-        }
-        size_t secondReadSize = readSize - firstReadSize;
-        const void *second_read_ptr = dataAshmem_->ReadFromAshmem(secondReadSize, 0);
-        ret = memcpy_s(data + firstReadSize, dataSize - firstReadSize, second_read_ptr, secondReadSize);
-        if (ret) {
-            AUDIO_INFO_LOG("[3] Read failed");
-            WakeFutex();
-            return 0;
-        }
+    if (!CopyFromRing(data, dataSize, readSize)) {
+        WakeFutex();
+        return 0;
     }
     statusInfo_->readPos += readSize;
 
@@ -157,31 +138,9 @@ size_t VASharedBufferOperator::Write(uint8_t *data, size_t dataSize)
 
     AUDIO_INFO_LOG("Write dataSize: %{public}zu. Actual writeSize: %{public}zu", dataSize, writeSize);
 
-    bool success;
-    size_t writeIndex = statusInfo_->writePos % capacity;
-
-    if (writeIndex + writeSize <= capacity) {
-        success = dataAshmem_->WriteToAshmem(data, writeSize, writeIndex);
-        if (!success) {
-            AUDIO_INFO_LOG("[1] Write failed");
-            WakeFutex();
-            return 0;
-        }
-    } else {
-        size_t firstWriteSize = capacity - writeIndex;
-        success = dataAshmem_->WriteToAshmem(data, firstWriteSize, writeIndex);
-        if (!success) {
-            AUDIO_INFO_LOG("[2] Write failed");
-            WakeFutex();
-            return 0;
-        }
-        size_t secondWriteSize = writeSize - firstWriteSize;
-        success = dataAshmem_->WriteToAshmem(data + firstWriteSize, secondWriteSize, 0);
-        if (!success) {
-            AUDIO_INFO_LOG("[3] Write failed");
-            WakeFutex();
-            return 0;
-        }
+    if (!CopyToRing(data, writeSize)) {
+        WakeFutex();
+        return 0;
     }
     statusInfo_->writePos += writeSize;
 
@@ -190,6 +149,70 @@ size_t VASharedBufferOperator::Write(uint8_t *data, size_t dataSize)
     return writeSize;
 }
 
+int32_t VASharedBufferOperator::AcquireWrite(RingBufferWrapper &span)
+{
+    span.Reset();
+    CHECK_AND_RETURN_RET_LOG(statusInfo_ != nullptr, ERR_ILLEGAL_STATE, "statusInfo_ is nullptr");
+    CHECK_AND_RETURN_RET_LOG(dataBase_ != nullptr, ERR_ILLEGAL_STATE, "dataBase_ is nullptr");
+
+    FutexCode retCode = WaitForFutex(timeoutInNano_, []() { return true; });
+    CHECK_AND_RETURN_RET_LOG(retCode == FUTEX_SUCCESS, ERR_OPERATION_FAILED, "wait futex failed");
+    size_t writePos = statusInfo_->writePos;
+    size_t writableSize = GetWritableSizeNoLock();
+    WakeFutex();
+
+    GetRingSpan(writePos, writableSize, span);
+    return SUCCESS;
+}
+
+int32_t VASharedBufferOperator::CommitWrite(size_t size)
+{
+    CHECK_AND_RETURN_RET_LOG(statusInfo_ != nullptr, ERR_ILLEGAL_STATE, "statusInfo_ is nullptr");
+
+    FutexCode retCode = WaitForFutex(timeoutInNano_, []() { return true; });
+    CHECK_AND_RETURN_RET_LOG(retCode == FUTEX_SUCCESS, ERR_OPERATION_FAILED, "wait futex failed");
+    if (size > GetWritableSizeNoLock()) {
+        AUDIO_ERR_LOG("commit size %{public}zu over writable size", size);
+        WakeFutex();
+        return ERR_INVALID_PARAM;
+    }
+    statusInfo_->writePos += size;
+    WakeFutex();
+    return SUCCESS;
+}
+
+int32_t VASharedBufferOperator::AcquireRead(RingBufferWrapper &span)
+{
+    span.Reset();
+    CHECK_AND_RETURN_RET_LOG(statusInfo_ != nullptr, ERR_ILLEGAL_STATE, "statusInfo_ is nullptr");
+    CHECK_AND_RETURN_RET_LOG(dataBase_ != nullptr, ERR_ILLEGAL_STATE, "dataBase_ is nullptr");
+
+    FutexCode retCode = WaitForFutex(timeoutInNano_, [this]() { return HasEnoughReadableData(); });
+    CHECK_AND_RETURN_RET_LOG(retCode == FUTEX_SUCCESS, ERR_OPERATION_FAILED, "wait futex failed");
+    size_t readPos = statusInfo_->readPos;
+    size_t readableSize = GetReadableSizeNoLock();
+    WakeFutex();
+
+    GetRingSpan(readPos, readableSize, span);
+    return SUCCESS;
+}
+
+int32_t VASharedBufferOperator::ReleaseRead(size_t size)
+{
+    CHECK_AND_RETURN_RET_LOG(statusInfo_ != nullptr, ERR_ILLEGAL_STATE, "statusInfo_ is nullptr");
+
+    FutexCode retCode = WaitForFutex(timeoutInNano_, []() { return true; });
+    CHECK_AND_RETURN_RET_LOG(retCode == FUTEX_SUCCESS, ERR_OPERATION_FAILED, "wait futex failed");
+    if (size > GetReadableSizeNoLock()) {
+        AUDIO_ERR_LOG("release size %{public}zu over readable size", size);
+        WakeFutex();
+        return ERR_INVALID_PARAM;
+    }
+    statusInfo_->readPos += size;
+    WakeFutex();
+    return SUCCESS;
+}
+
 void VASharedBufferOperator::GetVASharedMemInfo(VASharedMemInfo &memInfo)
 {
     buffer_.GetVASharedMemInfo(memInfo);
@@ -240,5 +263,77 @@ bool VASharedBufferOperator::HasEnoughReadableData()
 {
     return GetReadableSizeNoLock() > minReadSize_;
 }
+
+bool VASharedBufferOperator::CopyFromRing(uint8_t *data, size_t dataSize, size_t readSize)
+{
+    if (mirroredRing_ != nullptr) {
+        int32_t ret = memcpy_s(data, dataSize, mirroredRing_->GetSpan(statusInfo_->readPos), readSize);
+        CHECK_AND_RETURN_RET_LOG(ret == EOK, false, "[0] Read failed");
+        return true;
+    }
+
+    int ret;
+    size_t readIndex = statusInfo_->readPos % capacity;
+    if (readIndex + readSize <= capacity) {
+        const void *read_ptr = dataAshmem_->ReadFromAshmem(readSize, readIndex);
+        ret = memcpy_s(data, dataSize, read_ptr, readSize);
+        CHECK_AND_RETURN_RET_LOG(ret == EOK, false, "[1] Read failed");
+    } else {
+        size_t firstReadSize = capacity - readIndex;
+        const void *first_read_ptr = dataAshmem_->ReadFromAshmem(firstReadSize, readIndex);
+        ret = memcpy_s(data, dataSize, first_read_ptr, firstReadSize);
+        CHECK_AND_RETURN_RET_LOG(ret == EOK, false, "[2] Read failed");
+        size_t secondReadSize = readSize - firstReadSize;
+        const void *second_read_ptr = dataAshmem_->ReadFromAshmem(secondReadSize, 0);
+        ret = memcpy_s(data + firstReadSize, dataSize - firstReadSize, second_read_ptr, secondReadSize);
+        CHECK_AND_RETURN_RET_LOG(ret == EOK, false, "[3] Read failed");
+    }
+    return true;
+}
+
+bool VASharedBufferOperator::CopyToRing(const uint8_t *data, size_t writeSize)
+{
+    if (mirroredRing_ != nullptr) {
+        int32_t ret = memcpy_s(mirroredRing_->GetSpan(statusInfo_->writePos), capacity, data, writeSize);
+        CHECK_AND_RETURN_RET_LOG(ret == EOK, false, "[0] Write failed");
+        return true;
+    }
+
+    bool success;
+    size_t writeIndex = statusInfo_->writePos % capacity;
+    if (writeIndex + writeSize <= capacity) {
+        success = dataAshmem_->WriteToAshmem(data, writeSize, writeIndex);
+        CHECK_AND_RETURN_RET_LOG(success, false, "[1] Write failed");
+    } else {
+        size_t firstWriteSize = capacity - writeIndex;
+        success = dataAshmem_->WriteToAshmem(data, firstWriteSize, writeIndex);
+        CHECK_AND_RETURN_RET_LOG(success, false, "[2] Write failed");
+        size_t secondWriteSize = writeSize - firstWriteSize;
+        success = dataAshmem_->WriteToAshmem(data + firstWriteSize, secondWriteSize, 0);
+        CHECK_AND_RETURN_RET_LOG(success, false, "[3] Write failed");
+    }
+    return true;
+}
+
+void VASharedBufferOperator::GetRingSpan(size_t pos, size_t length, RingBufferWrapper &span)
+{
+    span.Reset();
+    CHECK_AND_RETURN(length > 0 && length <= capacity);
+    span.dataLength = length;
+    if (mirroredRing_ != nullptr) {
+        span.basicBufferDescs[0].buffer = mirroredRing_->GetSpan(pos);
+        span.basicBufferDescs[0].bufLength = length;
+        return;
+    }
+
+    size_t offset = pos % capacity;
+    size_t lengthToEnd = capacity - offset;
+    span.basicBufferDescs[0].buffer = dataBase_ + offset;
+    span.basicBufferDescs[0].bufLength = std::min(lengthToEnd, length);
+    if (length > lengthToEnd) {
+        span.basicBufferDescs[1].buffer = dataBase_;
+        span.basicBufferDescs[1].bufLength = length - lengthToEnd;
+    }
+}
 }  // namespace AudioStandard
 }  // namespace OHOS
\ No newline at end of file
@@ -16,6 +16,8 @@
 #define LOG_TAG "VolumeTools"
 #endif
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 
 #include "volume_tools.h"
@@ -24,12 +26,21 @@
 #include "audio_service_log.h"
 #include "audio_utils.h"
 
+#if !defined(DISABLE_SIMD) && \
+    (defined(__aarch64__) || (defined(__arm__) && defined(__ARM_NEON__)))
+// enable arm Simd
+#include <arm_neon.h>
+#define USE_ARM_NEON 1
+#else
+// disable SIMD.
+#define USE_ARM_NEON 0
+#endif
+
 namespace {
 static const int32_t UINT8_SHIFT = 0x80;
 static const int32_t INT24_SHIFT = 8;
 static const int32_t INT24_MAX_VALUE = 8388607;
 static const uint32_t SHIFT_EIGHT = 8;
-static const int32_t RIGHT_SHIFT_8 = 256;
 static const uint32_t SHIFT_SIXTEEN = 16;
 static const uint32_t ARRAY_INDEX_TWO = 2;
 static const size_t MIN_FRAME_SIZE = 1;
@@ -39,6 +50,13 @@ static const int32_t HALF_FACTOR = 2;
 static const int32_t INT32_VOLUME_MIN = 0; // 0, min volume
 static const uint32_t VOLUME_SHIFT = 16;
 static constexpr int32_t INT32_VOLUME_MAX = 1 << VOLUME_SHIFT; // 1 << 16 = 65536, max volume
+static constexpr size_t FADE_TABLE_SIZE = 256; // segments of the quarter sine
+static constexpr size_t FADE_BLOCK_FRAMES = 64;
+#if USE_ARM_NEON == 1
+static constexpr size_t NEON_S16_LANES = 8;
+static constexpr size_t NEON_S32_LANES = 4;
+static constexpr size_t NEON_F32_LANES = 4;
+#endif
 }
 namespace OHOS {
 namespace AudioStandard {
@@ -151,41 +169,272 @@ inline int32_t VolumeFlatten(int32_t vol)
     return vol < INT32_VOLUME_MIN ? 0 : (vol > INT32_VOLUME_MAX ? INT32_VOLUME_MAX : vol);
 }
 
-void ProcessOneFrame(uint8_t *ptr, AudioSampleFormat format, int32_t vol)
+// Volume of one Process call, in the same Q16 fixed point as ChannelVolumes. The value applied to a sample is
+// VolumeFlatten(volStep * frameIndex + volStart), so per-segment kernels only need the frame offset.
+struct VolumeRamp {
+    size_t channel = 0;
+    int32_t volStart[CHANNEL_MAX] = {};
+    float volStep[CHANNEL_MAX] = {};
+    bool isUniform = false; // no ramp and the same volume on every channel
+};
+
+template <AudioSampleFormat format>
+struct VolumeKernel;
+
+template <>
+struct VolumeKernel<SAMPLE_U8> {
+    static constexpr size_t SAMPLE_SIZE = sizeof(uint8_t);
+
+    static inline void Apply(uint8_t *ptr, int32_t vol)
+    {
+        int64_t temp = static_cast<int64_t>(*ptr) - UINT8_SHIFT;
+        temp = (temp * vol) >> VOLUME_SHIFT;
+        temp = temp < INT8_MIN ? INT8_MIN : (temp > INT8_MAX ? INT8_MAX : temp);
+        *ptr = static_cast<uint8_t>(temp + UINT8_SHIFT);
+    }
+
+    static void ApplyFlat(uint8_t *ptr, size_t sampleCount, int32_t vol)
+    {
+        for (size_t i = 0; i < sampleCount; i++) {
+            Apply(ptr + i, vol);
+        }
+    }
+
+    static void ApplyGains(uint8_t *ptr, size_t sampleCount, const int32_t *gains)
+    {
+        for (size_t i = 0; i < sampleCount; i++) {
+            Apply(ptr + i, gains[i]);
+        }
+    }
+};
+
+template <>
+struct VolumeKernel<SAMPLE_S16LE> {
+    static constexpr size_t SAMPLE_SIZE = sizeof(int16_t);
+
+    static inline void Apply(uint8_t *ptr, int32_t vol)
+    {
+        int16_t *raw16 = reinterpret_cast<int16_t *>(ptr);
+        int64_t temp = (*raw16 * static_cast<int64_t>(vol)) >> VOLUME_SHIFT;
+        *raw16 = temp > INT16_MAX ? INT16_MAX : (temp < INT16_MIN ? INT16_MIN : temp);
+    }
+
+    static void ApplyFlat(uint8_t *ptr, size_t sampleCount, int32_t vol)
+    {
+        int16_t *raw16 = reinterpret_cast<int16_t *>(ptr);
+        size_t index = 0;
+#if USE_ARM_NEON == 1
+        // int16 * Q16 volume (<= 1 << 16) always fits in int32, so widen once and narrow with saturation
+        int32x4_t vol32x4 = vdupq_n_s32(vol);
+        for (; index + NEON_S16_LANES <= sampleCount; index += NEON_S16_LANES) {
+            int16x8_t in16x8 = vld1q_s16(raw16 + index);
+            int32x4_t low = vmulq_s32(vmovl_s16(vget_low_s16(in16x8)), vol32x4);
+            int32x4_t high = vmulq_s32(vmovl_s16(vget_high_s16(in16x8)), vol32x4);
+            int16x8_t out16x8 = vcombine_s16(vqmovn_s32(vshrq_n_s32(low, VOLUME_SHIFT)),
+                vqmovn_s32(vshrq_n_s32(high, VOLUME_SHIFT)));
+            vst1q_s16(raw16 + index, out16x8);
+        }
+#endif
+        for (; index < sampleCount; index++) {
+            Apply(reinterpret_cast<uint8_t *>(raw16 + index), vol);
+        }
+    }
+
+    static void ApplyGains(uint8_t *ptr, size_t sampleCount, const int32_t *gains)
+    {
+        int16_t *raw16 = reinterpret_cast<int16_t *>(ptr);
+        size_t index = 0;
+#if USE_ARM_NEON == 1
+        for (; index + NEON_S16_LANES <= sampleCount; index += NEON_S16_LANES) {
+            int16x8_t in16x8 = vld1q_s16(raw16 + index);
+            int32x4_t low = vmulq_s32(vmovl_s16(vget_low_s16(in16x8)), vld1q_s32(gains + index));
+            int32x4_t high = vmulq_s32(vmovl_s16(vget_high_s16(in16x8)), vld1q_s32(gains + index + NEON_S32_LANES));
+            int16x8_t out16x8 = vcombine_s16(vqmovn_s32(vshrq_n_s32(low, VOLUME_SHIFT)),
+                vqmovn_s32(vshrq_n_s32(high, VOLUME_SHIFT)));
+            vst1q_s16(raw16 + index, out16x8);
+        }
+#endif
+        for (; index < sampleCount; index++) {
+            Apply(reinterpret_cast<uint8_t *>(raw16 + index), gains[index]);
+        }
+    }
+};
+
+template <>
+struct VolumeKernel<SAMPLE_S24LE> {
+    static constexpr size_t SAMPLE_SIZE = 3; // packed 24 bit
+
+    static inline void Apply(uint8_t *ptr, int32_t vol)
+    {
+        int64_t temp = static_cast<int32_t>(ReadInt24LE(ptr) << INT24_SHIFT) * static_cast<int64_t>(vol) >>
+            VOLUME_SHIFT;
+        WriteInt24LE(ptr, (static_cast<uint32_t>(temp) >> INT24_SHIFT));
+    }
+
+    static void ApplyFlat(uint8_t *ptr, size_t sampleCount, int32_t vol)
+    {
+        for (size_t i = 0; i < sampleCount; i++) {
+            Apply(ptr + i * SAMPLE_SIZE, vol);
+        }
+    }
+
+    static void ApplyGains(uint8_t *ptr, size_t sampleCount, const int32_t *gains)
+    {
+        for (size_t i = 0; i < sampleCount; i++) {
+            Apply(ptr + i * SAMPLE_SIZE, gains[i]);
+        }
+    }
+};
+
+template <>
+struct VolumeKernel<SAMPLE_S32LE> {
+    static constexpr size_t SAMPLE_SIZE = sizeof(int32_t);
+
+    static inline void Apply(uint8_t *ptr, int32_t vol)
+    {
+        int32_t *raw32 = reinterpret_cast<int32_t *>(ptr);
+        // int32_t * int16_t, max result is int48_t
+        int64_t temp = (*raw32 * static_cast<int64_t>(vol)) >> VOLUME_SHIFT;
+        *raw32 = temp > INT32_MAX ? INT32_MAX : (temp < INT32_MIN ? INT32_MIN : temp);
+    }
+
+    static void ApplyFlat(uint8_t *ptr, size_t sampleCount, int32_t vol)
+    {
+        int32_t *raw32 = reinterpret_cast<int32_t *>(ptr);
+        size_t index = 0;
+#if USE_ARM_NEON == 1
+        int32x2_t vol32x2 = vdup_n_s32(vol);
+        for (; index + NEON_S32_LANES <= sampleCount; index += NEON_S32_LANES) {
+            int32x4_t in32x4 = vld1q_s32(raw32 + index);
+            int64x2_t low = vshrq_n_s64(vmull_s32(vget_low_s32(in32x4), vol32x2), VOLUME_SHIFT);
+            int64x2_t high = vshrq_n_s64(vmull_s32(vget_high_s32(in32x4), vol32x2), VOLUME_SHIFT);
+            vst1q_s32(raw32 + index, vcombine_s32(vqmovn_s64(low), vqmovn_s64(high)));
+        }
+#endif
+        for (; index < sampleCount; index++) {
+            Apply(reinterpret_cast<uint8_t *>(raw32 + index), vol);
+        }
+    }
+
+    static void ApplyGains(uint8_t *ptr, size_t sampleCount, const int32_t *gains)
+    {
+        int32_t *raw32 = reinterpret_cast<int32_t *>(ptr);
+        size_t index = 0;
+#if USE_ARM_NEON == 1
+        for (; index + NEON_S32_LANES <= sampleCount; index += NEON_S32_LANES) {
+            int32x4_t in32x4 = vld1q_s32(raw32 + index);
+            int32x4_t gain32x4 = vld1q_s32(gains + index);
+            int64x2_t low = vshrq_n_s64(vmull_s32(vget_low_s32(in32x4), vget_low_s32(gain32x4)), VOLUME_SHIFT);
+            int64x2_t high = vshrq_n_s64(vmull_s32(vget_high_s32(in32x4), vget_high_s32(gain32x4)), VOLUME_SHIFT);
+            vst1q_s32(raw32 + index, vcombine_s32(vqmovn_s64(low), vqmovn_s64(high)));
+        }
+#endif
+        for (; index < sampleCount; index++) {
+            Apply(reinterpret_cast<uint8_t *>(raw32 + index), gains[index]);
+        }
+    }
+};
+
+template <>
+struct VolumeKernel<SAMPLE_F32LE> {
+    static constexpr size_t SAMPLE_SIZE = sizeof(float);
+
+    static inline void Apply(uint8_t *ptr, int32_t vol)
+    {
+        float *rawFloat = reinterpret_cast<float *>(ptr);
+        *rawFloat = *rawFloat * (static_cast<float>(vol) / INT32_VOLUME_MAX);
+    }
+
+    static void ApplyFlat(uint8_t *ptr, size_t sampleCount, int32_t vol)
+    {
+        float *rawFloat = reinterpret_cast<float *>(ptr);
+        float gain = static_cast<float>(vol) / INT32_VOLUME_MAX;
+        size_t index = 0;
+#if USE_ARM_NEON == 1
+        for (; index + NEON_F32_LANES <= sampleCount; index += NEON_F32_LANES) {
+            vst1q_f32(rawFloat + index, vmulq_n_f32(vld1q_f32(rawFloat + index), gain));
+        }
+#endif
+        for (; index < sampleCount; index++) {
+            rawFloat[index] = rawFloat[index] * gain;
+        }
+    }
+
+    static void ApplyGains(uint8_t *ptr, size_t sampleCount, const int32_t *gains)
+    {
+        float *rawFloat = reinterpret_cast<float *>(ptr);
+        size_t index = 0;
+#if USE_ARM_NEON == 1
+        for (; index + NEON_F32_LANES <= sampleCount; index += NEON_F32_LANES) {
+            float32x4_t gain = vmulq_n_f32(vcvtq_f32_s32(vld1q_s32(gains + index)), 1.0f / INT32_VOLUME_MAX);
+            vst1q_f32(rawFloat + index, vmulq_f32(vld1q_f32(rawFloat + index), gain));
+        }
+#endif
+        for (; index < sampleCount; index++) {
+            Apply(reinterpret_cast<uint8_t *>(rawFloat + index), gains[index]);
+        }
+    }
+};
+
+// Process frameCount contiguous frames starting at frame frameOffset of the whole buffer.
+template <AudioSampleFormat format>
+static void ProcessSegment(uint8_t *ptr, size_t frameCount, size_t frameOffset, const VolumeRamp &ramp)
+{
+    using Kernel = VolumeKernel<format>;
+    if (ramp.isUniform) {
+        Kernel::ApplyFlat(ptr, frameCount * ramp.channel, ramp.volStart[0]);
+        return;
+    }
+    for (size_t frameIndex = frameOffset; frameIndex < frameOffset + frameCount; frameIndex++) {
+        for (size_t channelIdx = 0; channelIdx < ramp.channel; channelIdx++) {
+            int32_t vol = ramp.volStep[channelIdx] * frameIndex + ramp.volStart[channelIdx];
+            Kernel::Apply(ptr, VolumeFlatten(vol));
+            ptr += Kernel::SAMPLE_SIZE;
+        }
+    }
+}
+
+using ProcessSegmentFunc = void (*)(uint8_t *ptr, size_t frameCount, size_t frameOffset, const VolumeRamp &ramp);
+
+static ProcessSegmentFunc GetProcessSegmentFunc(AudioSampleFormat format)
 {
-    int64_t temp = 0;
-    int16_t *raw16 = nullptr;
-    int32_t *raw32 = nullptr;
-    float *rawFloat = nullptr;
     switch (format) {
         case SAMPLE_U8:
-            temp = *ptr - UINT8_SHIFT;
-            temp = (temp * vol) >> VOLUME_SHIFT;
-            temp = temp < INT8_MIN ? INT8_MIN : (temp > INT8_MAX ? INT8_MAX : temp);
-            *ptr = static_cast<uint8_t>(temp + UINT8_SHIFT);
-            break;
+            return ProcessSegment<SAMPLE_U8>;
         case SAMPLE_S16LE:
-            raw16 = reinterpret_cast<int16_t *>(ptr);
-            temp = (*raw16 * static_cast<int64_t>(vol)) >> VOLUME_SHIFT;
-            *raw16 = temp > INT16_MAX ? INT16_MAX : (temp < INT16_MIN ? INT16_MIN : temp);
-            break;
+            return ProcessSegment<SAMPLE_S16LE>;
         case SAMPLE_S24LE:
-            temp = static_cast<int32_t>(ReadInt24LE(ptr) << INT24_SHIFT) * static_cast<int64_t>(vol) >> VOLUME_SHIFT;
-            WriteInt24LE(ptr, (static_cast<uint32_t>(temp) >> INT24_SHIFT));
-            break;
+            return ProcessSegment<SAMPLE_S24LE>;
         case SAMPLE_S32LE:
-            raw32 = reinterpret_cast<int32_t *>(ptr);
-            // int32_t * int16_t, max result is int48_t
-            temp = (*raw32 * static_cast<int64_t>(vol)) >> VOLUME_SHIFT;
-            *raw32 = temp > INT32_MAX ? INT32_MAX : (temp < INT32_MIN ? INT32_MIN : temp);
-            break;
+            return ProcessSegment<SAMPLE_S32LE>;
         case SAMPLE_F32LE:
-            rawFloat = reinterpret_cast<float *>(ptr);
-            *rawFloat = *rawFloat * (static_cast<float>(vol) / INT32_VOLUME_MAX);
-            break;
+            return ProcessSegment<SAMPLE_F32LE>;
         default:
-            AUDIO_ERR_LOG("ProcessOneFrame with invalid format");
-            break;
+            return nullptr;
+    }
+}
+
+static void InitVolumeRamp(const ChannelVolumes &vols, size_t frameSize, VolumeRamp &ramp)
+{
+    ramp.channel = vols.channel;
+    bool isFlat = true;
+    for (size_t channelIdx = 0; channelIdx < vols.channel; channelIdx++) {
+        ramp.volStart[channelIdx] = vols.volStart[channelIdx];
+        if (vols.volEnd[channelIdx] == vols.volStart[channelIdx] || frameSize == MIN_FRAME_SIZE) {
+            ramp.volStep[channelIdx] = 0.0;
+        } else {
+            ramp.volStep[channelIdx] = (static_cast<float>(vols.volEnd[channelIdx] - vols.volStart[channelIdx])) /
+                (frameSize - MIN_FRAME_SIZE);
+            isFlat = false;
+        }
+    }
+    bool isSameVol = true;
+    for (size_t channelIdx = 1; channelIdx < vols.channel; channelIdx++) {
+        isSameVol = isSameVol && (vols.volStart[channelIdx] == vols.volStart[0]);
+    }
+    ramp.isUniform = isFlat && isSameVol;
+    if (ramp.isUniform) {
+        ramp.volStart[0] = VolumeFlatten(ramp.volStart[0]);
     }
 }
 
@@ -212,29 +461,25 @@ int32_t VolumeTools::Process(const RingBufferWrapper& ringBufferDesc, AudioSampl
         return ERR_INVALID_PARAM;
     }
 
-    float volStep[CHANNEL_MAX] = {};
-    for (size_t channelIdx = 0; channelIdx < vols.channel; channelIdx++) {
-        if (vols.volEnd[channelIdx] == vols.volStart[channelIdx] || frameSize == MIN_FRAME_SIZE) {
-            volStep[channelIdx] = 0.0;
-        } else {
-            volStep[channelIdx] = (static_cast<float>(vols.volEnd[channelIdx] - vols.volStart[channelIdx])) /
-                (frameSize - MIN_FRAME_SIZE);
-        }
-    }
+    VolumeRamp ramp;
+    InitVolumeRamp(vols, frameSize, ramp);
+    ProcessSegmentFunc processSegment = GetProcessSegmentFunc(format);
+    CHECK_AND_RETURN_RET_LOG(processSegment != nullptr, ERR_INVALID_PARAM, "invalid format %{public}d", format);
 
-    RingBufferWrapper srcBuffer = ringBufferDesc;
-    for (size_t frameIndex = 0; frameIndex < frameSize; frameIndex++) {
-        for (size_t channelIdx = 0; channelIdx < vols.channel; channelIdx++) {
-            int32_t vol = volStep[channelIdx] * frameIndex + vols.volStart[channelIdx];
-            vol = VolumeFlatten(vol);
-            uint8_t *samplePtr = srcBuffer.basicBufferDescs[0].buffer + channelIdx * byteSizePerData;
-            ProcessOneFrame(samplePtr, format, vol);
-        }
-        if (srcBuffer.SeekFromStart(byteSizePerFrame) != SUCCESS) {
-            // This branch should never be executed under any valid conditions. Consider let it crash?
-            AUDIO_ERR_LOG("Seek err");
-            return ERR_INVALID_PARAM;
+    // the first segment always ends on a frame boundary, so each segment is processed in one linear pass
+    size_t frameOffset = 0;
+    for (const auto &[buffer, bufLength] : ringBufferDesc.basicBufferDescs) {
+        size_t segmentFrames = std::min(bufLength / byteSizePerFrame, frameSize - frameOffset);
+        if (segmentFrames == 0 || buffer == nullptr) {
+            continue;
         }
+        processSegment(buffer, segmentFrames, frameOffset, ramp);
+        frameOffset += segmentFrames;
+    }
+    if (frameOffset != frameSize) {
+        // This branch should never be executed under any valid conditions. Consider let it crash?
+        AUDIO_ERR_LOG("Seek err");
+        return ERR_INVALID_PARAM;
     }
 
     return SUCCESS;
@@ -254,6 +499,88 @@ int32_t VolumeTools::Process(const BufferDesc &bufferDesc, AudioSampleFormat for
     return Process(ringBufferDesc, format, vols);
 }
 
+// Q16 gains of a quarter sine, sampled at FADE_TABLE_SIZE + 1 points. A fade out reads it backwards as a cosine.
+static const std::array<int32_t, FADE_TABLE_SIZE + 1> &GetFadeTable()
+{
+    static const std::array<int32_t, FADE_TABLE_SIZE + 1> fadeTable = [] {
+        std::array<int32_t, FADE_TABLE_SIZE + 1> table = {};
+        for (size_t i = 0; i <= FADE_TABLE_SIZE; i++) {
+            table[i] = static_cast<int32_t>(std::lround(std::sin(M_PI_2 * i / FADE_TABLE_SIZE) * INT32_VOLUME_MAX));
+        }
+        return table;
+    }();
+    return fadeTable;
+}
+
+// The first frame already gets one step, so a fade in ends on exactly 1.0 and a fade out on exactly 0.0.
+static int32_t GetFadeGain(const std::array<int32_t, FADE_TABLE_SIZE + 1> &table, size_t frameIndex,
+    size_t frameCount, bool isFadeOut)
+{
+    // position on the table in Q16, linear interpolation between the two nearest points
+    uint64_t pos = ((static_cast<uint64_t>(frameIndex) + 1) * FADE_TABLE_SIZE << VOLUME_SHIFT) / frameCount;
+    if (isFadeOut) {
+        pos = (static_cast<uint64_t>(FADE_TABLE_SIZE) << VOLUME_SHIFT) - pos;
+    }
+    size_t index = static_cast<size_t>(pos >> VOLUME_SHIFT);
+    if (index >= FADE_TABLE_SIZE) {
+        return table[FADE_TABLE_SIZE];
+    }
+    int64_t frac = static_cast<int64_t>(pos & (INT32_VOLUME_MAX - 1));
+    return table[index] + static_cast<int32_t>(((table[index + 1] - table[index]) * frac) >> VOLUME_SHIFT);
+}
+
+// The gain changes every frame, so it is expanded to one gain per sample for a block of frames and the kernel
+// multiplies sample by gain.
+template <AudioSampleFormat format>
+static void FadeFrames(uint8_t *ptr, size_t frameCount, size_t channel, bool isFadeOut)
+{
+    using Kernel = VolumeKernel<format>;
+    const auto &table = GetFadeTable();
+    int32_t gains[FADE_BLOCK_FRAMES * CHANNEL_MAX];
+    for (size_t blockStart = 0; blockStart < frameCount; blockStart += FADE_BLOCK_FRAMES) {
+        size_t blockFrames = std::min(FADE_BLOCK_FRAMES, frameCount - blockStart);
+        for (size_t i = 0; i < blockFrames; i++) {
+            std::fill_n(gains + i * channel, channel, GetFadeGain(table, blockStart + i, frameCount, isFadeOut));
+        }
+        Kernel::ApplyGains(ptr, blockFrames * channel, gains);
+        ptr += blockFrames * channel * Kernel::SAMPLE_SIZE;
+    }
+}
+
+using FadeFramesFunc = void (*)(uint8_t *ptr, size_t frameCount, size_t channel, bool isFadeOut);
+
+static FadeFramesFunc GetFadeFramesFunc(AudioSampleFormat format)
+{
+    switch (format) {
+        case SAMPLE_U8:
+            return FadeFrames<SAMPLE_U8>;
+        case SAMPLE_S16LE:
+            return FadeFrames<SAMPLE_S16LE>;
+        case SAMPLE_S24LE:
+            return FadeFrames<SAMPLE_S24LE>;
+        case SAMPLE_S32LE:
+            return FadeFrames<SAMPLE_S32LE>;
+        case SAMPLE_F32LE:
+            return FadeFrames<SAMPLE_F32LE>;
+        default:
+            return nullptr;
+    }
+}
+
+int32_t VolumeTools::ProcessFade(const BufferDesc &bufferDesc, AudioSampleFormat format, AudioChannel channel,
+    bool isFadeOut)
+{
+    CHECK_AND_RETURN_RET_LOG(bufferDesc.buffer != nullptr && bufferDesc.dataLength <= bufferDesc.bufLength &&
+        channel >= MONO && channel <= CHANNEL_16, ERR_INVALID_PARAM, "invalid bufferDesc or channel");
+    FadeFramesFunc fadeFrames = GetFadeFramesFunc(format);
+    CHECK_AND_RETURN_RET_LOG(fadeFrames != nullptr, ERR_INVALID_PARAM, "invalid format %{public}d", format);
+    size_t frameCount = bufferDesc.dataLength / (GetByteSize(format) * channel);
+    CHECK_AND_RETURN_RET_LOG(frameCount >= MIN_FRAME_SIZE, ERR_INVALID_PARAM, "no frame to fade, size is %{public}zu",
+        bufferDesc.dataLength);
+    fadeFrames(bufferDesc.buffer, frameCount, channel, isFadeOut);
+    return SUCCESS;
+}
+
 double VolumeTools::GetVolDb(AudioSampleFormat format, int32_t vol)
 {
     double volume = static_cast<double>(vol);
@@ -279,247 +606,277 @@ double VolumeTools::GetVolDb(AudioSampleFormat format, int32_t vol)
     return std::log10(volume);
 }
 
-static void CountU8Volume(const BufferDesc &buffer, AudioChannel channel, ChannelVolumes &volMaps, size_t split,
-    AudioSampleFormat format)
-{
-    if (split == 0) {
-        AUDIO_ERR_LOG("invalid split");
-        return;
-    }
-    size_t byteSizePerData = VolumeTools::GetByteSize(format);
-    size_t byteSizePerFrame = byteSizePerData * channel;
-    if (buffer.buffer == nullptr || byteSizePerFrame == 0 || buffer.bufLength % byteSizePerFrame != 0) {
-        AUDIO_ERR_LOG("invalid buffer, size is %{public}zu", buffer.bufLength);
-        return;
-    }
-    size_t frameSize = buffer.bufLength / byteSizePerFrame;
-    if (frameSize < MIN_FRAME_SIZE || frameSize >= MAX_FRAME_SIZE) {
-        AUDIO_ERR_LOG("invalid frameSize, size is %{public}zu", frameSize);
-        return;
-    }
+// Level of one sample as used by CountVolumeLevel. Sum, peak, silence and clipping of a buffer are all derived from
+// it, so they can be gathered in a single pass.
+template <AudioSampleFormat format>
+struct LevelKernel;
 
-    // Calculate the average value
-    size_t size = frameSize / split;
-    if (size == 0) {
-        AUDIO_ERR_LOG("invalid size");
-        return;
-    }
+template <>
+struct LevelKernel<SAMPLE_U8> {
+    using LevelType = int64_t;
+    static constexpr size_t SAMPLE_SIZE = sizeof(uint8_t);
+    static constexpr LevelType FULL_SCALE = INT8_MAX;
 
-    // reset maps
-    for (size_t index = 0; index < channel; index++) {
-        volMaps.volStart[index] = 0;
-        volMaps.volEnd[index] = 0;
-    }
-    uint8_t *raw8 = buffer.buffer;
-    for (size_t frameIndex = 0; frameIndex < frameSize - (split - 1); frameIndex += split) {
-        for (size_t channelIdx = 0; channelIdx < channel; channelIdx++) {
-            volMaps.volStart[channelIdx] += (*raw8 >= UINT8_SHIFT ? *raw8 - UINT8_SHIFT : UINT8_SHIFT - *raw8);
-            raw8++;
-        }
-        raw8 += (split - 1) * channel;
+    static inline LevelType Level(const uint8_t *ptr)
+    {
+        return *ptr >= UINT8_SHIFT ? *ptr - UINT8_SHIFT : UINT8_SHIFT - *ptr;
     }
 
-    for (size_t index = 0; index < channel; index++) {
-        volMaps.volStart[index] /= static_cast<int32_t>(size);
+    static inline int32_t ToVolume(LevelType sum, size_t size)
+    {
+        return static_cast<int32_t>(sum / static_cast<int64_t>(size));
     }
-    return;
-}
+};
 
-static void CountS16Volume(const BufferDesc &buffer, AudioChannel channel, ChannelVolumes &volMaps, size_t split,
-    AudioSampleFormat format)
-{
-    if (split == 0) {
-        AUDIO_ERR_LOG("invalid split");
-        return;
-    }
-    size_t byteSizePerData = VolumeTools::GetByteSize(format);
-    size_t byteSizePerFrame = byteSizePerData * channel;
-    if (buffer.buffer == nullptr || byteSizePerFrame == 0 || buffer.bufLength % byteSizePerFrame != 0) {
-        AUDIO_ERR_LOG("invalid buffer, size is %{public}zu", buffer.bufLength);
-        return;
-    }
-    size_t frameSize = buffer.bufLength / byteSizePerFrame;
-    if (frameSize < MIN_FRAME_SIZE || frameSize >= MAX_FRAME_SIZE) {
-        AUDIO_ERR_LOG("invalid frameSize, size is %{public}zu", frameSize);
-        return;
-    }
+template <>
+struct LevelKernel<SAMPLE_S16LE> {
+    using LevelType = int64_t;
+    static constexpr size_t SAMPLE_SIZE = sizeof(int16_t);
+    static constexpr LevelType FULL_SCALE = INT16_MAX;
 
-    // Calculate the average value
-    size_t size = frameSize / split;
-    if (size == 0) {
-        AUDIO_ERR_LOG("invalid size");
-        return;
+    static inline LevelType Level(const uint8_t *ptr)
+    {
+        int16_t sample = *reinterpret_cast<const int16_t *>(ptr);
+        return sample >= 0 ? sample : -static_cast<LevelType>(sample);
     }
 
-    // reset maps
-    for (size_t index = 0; index < channel; index++) {
-        volMaps.volStart[index] = 0;
-        volMaps.volEnd[index] = 0;
-    }
-    int16_t *raw16 = reinterpret_cast<int16_t *>(buffer.buffer);
-    for (size_t frameIndex = 0; frameIndex < frameSize - (split - 1); frameIndex += split) {
-        for (size_t channelIdx = 0; channelIdx < channel; channelIdx++) {
-            volMaps.volStart[channelIdx] += (*raw16 >= 0 ? *raw16 : (-*raw16));
-            raw16++;
-        }
-        raw16 += (split - 1) * channel;
+    static inline int32_t ToVolume(LevelType sum, size_t size)
+    {
+        return static_cast<int32_t>(sum / static_cast<int64_t>(size));
     }
+};
 
-    for (size_t index = 0; index < channel; index++) {
-        volMaps.volStart[index] /= static_cast<int32_t>(size);
-    }
-    return;
-}
+template <>
+struct LevelKernel<SAMPLE_S24LE> {
+    using LevelType = int64_t;
+    static constexpr size_t SAMPLE_SIZE = 3; // 3 bytes per sample
+    static constexpr LevelType FULL_SCALE = INT24_MAX_VALUE;
 
-static void CountS24Volume(const BufferDesc &buffer, AudioChannel channel, ChannelVolumes &volMaps, size_t split,
-    AudioSampleFormat format)
-{
-    if (split == 0) {
-        AUDIO_ERR_LOG("invalid split");
-        return;
-    }
-    const size_t byteSizePerData = VolumeTools::GetByteSize(format);
-    size_t byteSizePerFrame = byteSizePerData * channel;
-    if (buffer.buffer == nullptr || byteSizePerFrame == 0 || buffer.bufLength % byteSizePerFrame != 0) {
-        AUDIO_ERR_LOG("invalid buffer, size is %{public}zu", buffer.bufLength);
-        return;
-    }
-    size_t frameSize = buffer.bufLength / byteSizePerFrame;
-    if (frameSize < MIN_FRAME_SIZE || frameSize >= MAX_FRAME_SIZE) {
-        AUDIO_ERR_LOG("invalid frameSize, size is %{public}zu", frameSize);
-        return;
+    static inline LevelType Level(const uint8_t *ptr)
+    {
+        int32_t sample = static_cast<int32_t>(ReadInt24LE(ptr) << INT24_SHIFT) >> INT24_SHIFT;
+        return sample >= 0 ? sample : -static_cast<LevelType>(sample);
     }
 
-    // Calculate the average value
-    size_t size = frameSize / split;
-    if (size == 0) {
-        AUDIO_ERR_LOG("invalid size");
-        return;
+    static inline int32_t ToVolume(LevelType sum, size_t size)
+    {
+        return static_cast<int32_t>(sum / static_cast<int64_t>(size));
     }
+};
 
-    // reset maps
-    for (size_t index = 0; index < channel; index++) {
-        volMaps.volStart[index] = 0;
-        volMaps.volEnd[index] = 0;
-    }
-    int64_t volSums[CHANNEL_MAX] = {0};
-    uint8_t *raw8 = buffer.buffer;
-    for (size_t frameIndex = 0; frameIndex < frameSize - (split - 1); frameIndex += split) {
-        for (size_t channelIdx = 0; channelIdx < channel; channelIdx++) {
-            int32_t sample = static_cast<int32_t>(ReadInt24LE(raw8) << INT24_SHIFT);
-            volSums[channelIdx] += std::abs(sample);
-            raw8 += byteSizePerData;
-        }
-        raw8 += (split - 1) * channel * byteSizePerData;
-    }
+template <>
+struct LevelKernel<SAMPLE_S32LE> {
+    using LevelType = int64_t;
+    static constexpr size_t SAMPLE_SIZE = sizeof(int32_t);
+    static constexpr LevelType FULL_SCALE = INT32_MAX;
 
-    for (size_t index = 0; index < channel; index++) {
-        volSums[index] /= RIGHT_SHIFT_8; // equal to " >> INT24_SHIFT"
-        volMaps.volStart[index] = static_cast<int32_t>(volSums[index] / size);
+    static inline LevelType Level(const uint8_t *ptr)
+    {
+        int32_t sample = *reinterpret_cast<const int32_t *>(ptr);
+        return sample >= 0 ? sample : -static_cast<LevelType>(sample);
     }
-    return;
-}
 
-static void CountS32Volume(const BufferDesc &buffer, AudioChannel channel, ChannelVolumes &volMaps, size_t split,
-    AudioSampleFormat format)
-{
-    if (split == 0) {
-        AUDIO_ERR_LOG("invalid split");
-        return;
-    }
-    const size_t byteSizePerData = VolumeTools::GetByteSize(format);
-    size_t byteSizePerFrame = byteSizePerData * channel;
-    if (buffer.buffer == nullptr || byteSizePerFrame == 0 || buffer.bufLength % byteSizePerFrame != 0) {
-        AUDIO_ERR_LOG("invalid buffer, size is %{public}zu", buffer.bufLength);
-        return;
-    }
-    size_t frameSize = buffer.bufLength / byteSizePerFrame;
-    if (frameSize < MIN_FRAME_SIZE || frameSize >= MAX_FRAME_SIZE) {
-        AUDIO_ERR_LOG("invalid frameSize, size is %{public}zu", frameSize);
-        return;
+    static inline int32_t ToVolume(LevelType sum, size_t size)
+    {
+        return static_cast<int32_t>(sum / static_cast<int64_t>(size));
     }
+};
 
-    // Calculate the average value
-    size_t size = frameSize / split;
-    if (size == 0) {
-        AUDIO_ERR_LOG("invalid size");
-        return;
+template <>
+struct LevelKernel<SAMPLE_F32LE> {
+    using LevelType = double;
+    static constexpr size_t SAMPLE_SIZE = sizeof(float);
+    static constexpr LevelType FULL_SCALE = 1.0;
+
+    static inline LevelType Level(const uint8_t *ptr)
+    {
+        float sample = *reinterpret_cast<const float *>(ptr);
+        return sample >= 0 ? sample : -sample;
     }
 
-    // reset maps
-    int64_t volSums[CHANNEL_MAX] = {0};
-    for (size_t index = 0; index < CHANNEL_MAX; index++) {
-        volSums[index] = 0;
+    static inline int32_t ToVolume(LevelType sum, size_t size)
+    {
+        return static_cast<int32_t>((sum * INT32_MAX) / static_cast<double>(size));
     }
-    int32_t *raw32 = reinterpret_cast<int32_t *>(buffer.buffer);
-    for (size_t frameIndex = 0; frameIndex < frameSize - (split - 1); frameIndex += split) {
-        for (size_t channelIdx = 0; channelIdx < channel; channelIdx++) {
-            if (*raw32 >= 0) {
-                volSums[channelIdx] += *raw32;
-            } else {
-                volSums[channelIdx] -= *raw32;
+};
+
+// Vector part of CountLevel for frames that are not split. Returns the frames visited, the scalar loop does the rest.
+// Formats without a vector path visit none.
+template <AudioSampleFormat format>
+static size_t CountLevelNeon(const uint8_t *ptr, size_t frameCount, size_t channel,
+    typename LevelKernel<format>::LevelType *sums, typename LevelKernel<format>::LevelType &peak, VolumeStats &stats)
+{
+    return 0;
+}
+
+#if USE_ARM_NEON == 1
+// Continues the silent run over a block of frames. A block with no zero sample ends the run, one that is all zero
+// extends it, only a block with both needs to be checked frame by frame.
+template <typename T>
+static inline void UpdateZeroRun(const T *src, size_t blockFrames, size_t channel, bool allZero, bool anyZero,
+    VolumeStats &stats)
+{
+    if (allZero) {
+        stats.zeroRun += blockFrames;
+    } else if (!anyZero) {
+        stats.zeroRun = 0;
+    } else {
+        for (size_t frame = 0; frame < blockFrames; frame++) {
+            bool isSilent = true;
+            for (size_t channelIdx = 0; channelIdx < channel; channelIdx++) {
+                isSilent = isSilent && (src[frame * channel + channelIdx] == 0);
             }
-            raw32++;
+            stats.zeroRun = isSilent ? stats.zeroRun + 1 : 0;
+            stats.maxZeroRun = std::max(stats.maxZeroRun, stats.zeroRun);
         }
-        raw32 += (split - 1) * channel;
     }
+    stats.maxZeroRun = std::max(stats.maxZeroRun, stats.zeroRun);
+}
 
-    for (size_t index = 0; index < channel; index++) {
-        volSums[index] /= static_cast<int64_t>(size);
-        volMaps.volStart[index] = static_cast<int32_t>(volSums[index]);
-    }
-    return;
+static inline bool IsAnyLaneSet(uint16x8_t mask)
+{
+    return vget_lane_u64(vreinterpret_u64_u16(vorr_u16(vget_low_u16(mask), vget_high_u16(mask))), 0) != 0;
 }
 
-static void CountF32Volume(const BufferDesc &buffer, AudioChannel channel, ChannelVolumes &volMaps, size_t split,
-    AudioSampleFormat format)
+static inline bool IsAnyLaneSet(uint32x4_t mask)
 {
-    if (split == 0) {
-        AUDIO_ERR_LOG("invalid split");
-        return;
-    }
-    size_t byteSizePerData = VolumeTools::GetByteSize(format);
-    size_t byteSizePerFrame = byteSizePerData * channel;
-    if (buffer.buffer == nullptr || byteSizePerFrame == 0 || buffer.bufLength % byteSizePerFrame != 0) {
-        AUDIO_ERR_LOG("invalid buffer, size is %{public}zu", buffer.bufLength);
-        return;
-    }
-    size_t frameSize = buffer.bufLength / byteSizePerFrame;
-    if (frameSize < MIN_FRAME_SIZE || frameSize >= MAX_FRAME_SIZE) {
-        AUDIO_ERR_LOG("invalid frameSize, size is %{public}zu", frameSize);
-        return;
-    }
+    return vget_lane_u64(vreinterpret_u64_u32(vorr_u32(vget_low_u32(mask), vget_high_u32(mask))), 0) != 0;
+}
 
-    // Calculate the average value
-    size_t size = frameSize / split;
-    if (size == 0) {
-        AUDIO_ERR_LOG("invalid size");
-        return;
-    }
+// Every lane always holds the same channel when the channel count divides the lane count, so the lane sums fold
+// into per channel sums after the loop. A lane sums at most MAX_FRAME_SIZE levels of 1 << 15, which fits in 32 bits.
+template <>
+size_t CountLevelNeon<SAMPLE_S16LE>(const uint8_t *ptr, size_t frameCount, size_t channel, int64_t *sums,
+    int64_t &peak, VolumeStats &stats)
+{
+    if (channel == 0 || NEON_S16_LANES % channel != 0) {
+        return 0;
+    }
+    size_t blockFrames = NEON_S16_LANES / channel;
+    size_t blockCount = frameCount / blockFrames;
+    const int16_t *src = reinterpret_cast<const int16_t *>(ptr);
+    const uint16x8_t fullScale = vdupq_n_u16(INT16_MAX);
+    const uint16x8_t zero = vdupq_n_u16(0);
+    uint32x4_t sumLow = vdupq_n_u32(0);
+    uint32x4_t sumHigh = vdupq_n_u32(0);
+    uint32x4_t clip = vdupq_n_u32(0);
+    uint16x8_t peak16x8 = zero;
+    for (size_t block = 0; block < blockCount; block++, src += NEON_S16_LANES) {
+        // vabsq leaves INT16_MIN as 0x8000, which is its level read unsigned
+        uint16x8_t level = vreinterpretq_u16_s16(vabsq_s16(vld1q_s16(src)));
+        sumLow = vaddw_u16(sumLow, vget_low_u16(level));
+        sumHigh = vaddw_u16(sumHigh, vget_high_u16(level));
+        peak16x8 = vmaxq_u16(peak16x8, level);
+        clip = vpadalq_u16(clip, vshrq_n_u16(vcgeq_u16(level, fullScale), 15)); // 15: mask to 1
+        UpdateZeroRun(src, blockFrames, channel, !IsAnyLaneSet(level), IsAnyLaneSet(vceqq_u16(level, zero)), stats);
+    }
+
+    uint32_t laneSums[NEON_S16_LANES];
+    uint16_t lanePeaks[NEON_S16_LANES];
+    uint32_t laneClips[NEON_S32_LANES];
+    vst1q_u32(laneSums, sumLow);
+    vst1q_u32(laneSums + NEON_S32_LANES, sumHigh);
+    vst1q_u16(lanePeaks, peak16x8);
+    vst1q_u32(laneClips, clip);
+    for (size_t lane = 0; lane < NEON_S16_LANES; lane++) {
+        sums[lane % channel] += laneSums[lane];
+        peak = std::max(peak, static_cast<int64_t>(lanePeaks[lane]));
+    }
+    for (size_t lane = 0; lane < NEON_S32_LANES; lane++) {
+        stats.clipCount += laneClips[lane];
+    }
+    return blockCount * blockFrames;
+}
 
-    // reset maps
-    double volSums[CHANNEL_MAX] = {0};
-    for (size_t index = 0; index < CHANNEL_MAX; index++) {
-        volSums[index] = 0.0;
-    }
-    float *raw32 = reinterpret_cast<float *>(buffer.buffer);
-    for (size_t frameIndex = 0; frameIndex < frameSize - (split - 1); frameIndex += split) {
+template <>
+size_t CountLevelNeon<SAMPLE_S32LE>(const uint8_t *ptr, size_t frameCount, size_t channel, int64_t *sums,
+    int64_t &peak, VolumeStats &stats)
+{
+    if (channel == 0 || NEON_S32_LANES % channel != 0) {
+        return 0;
+    }
+    size_t blockFrames = NEON_S32_LANES / channel;
+    size_t blockCount = frameCount / blockFrames;
+    const int32_t *src = reinterpret_cast<const int32_t *>(ptr);
+    const uint32x4_t fullScale = vdupq_n_u32(INT32_MAX);
+    const uint32x4_t zero = vdupq_n_u32(0);
+    uint64x2_t sumLow = vdupq_n_u64(0);
+    uint64x2_t sumHigh = vdupq_n_u64(0);
+    uint32x4_t clip = zero;
+    uint32x4_t peak32x4 = zero;
+    for (size_t block = 0; block < blockCount; block++, src += NEON_S32_LANES) {
+        // vabsq leaves INT32_MIN as 0x80000000, which is its level read unsigned
+        uint32x4_t level = vreinterpretq_u32_s32(vabsq_s32(vld1q_s32(src)));
+        sumLow = vaddw_u32(sumLow, vget_low_u32(level));
+        sumHigh = vaddw_u32(sumHigh, vget_high_u32(level));
+        peak32x4 = vmaxq_u32(peak32x4, level);
+        clip = vsubq_u32(clip, vcgeq_u32(level, fullScale)); // a set mask is -1
+        UpdateZeroRun(src, blockFrames, channel, !IsAnyLaneSet(level), IsAnyLaneSet(vceqq_u32(level, zero)), stats);
+    }
+
+    uint64_t laneSums[NEON_S32_LANES];
+    uint32_t lanePeaks[NEON_S32_LANES];
+    uint32_t laneClips[NEON_S32_LANES];
+    vst1q_u64(laneSums, sumLow);
+    vst1q_u64(laneSums + NEON_S32_LANES / HALF_FACTOR, sumHigh);
+    vst1q_u32(lanePeaks, peak32x4);
+    vst1q_u32(laneClips, clip);
+    for (size_t lane = 0; lane < NEON_S32_LANES; lane++) {
+        sums[lane % channel] += static_cast<int64_t>(laneSums[lane]);
+        peak = std::max(peak, static_cast<int64_t>(lanePeaks[lane]));
+        stats.clipCount += laneClips[lane];
+    }
+    return blockCount * blockFrames;
+}
+#endif
+
+// Visits every split-th frame once: mean level of each channel goes to vols, the rest is accumulated into stats.
+template <AudioSampleFormat format>
+static void CountLevel(const uint8_t *ptr, size_t frameSize, size_t channel, size_t split, ChannelVolumes &vols,
+    VolumeStats &stats)
+{
+    using Kernel = LevelKernel<format>;
+    using LevelType = typename Kernel::LevelType;
+    size_t size = frameSize / split;
+    size_t frameStride = split * channel * Kernel::SAMPLE_SIZE;
+    LevelType sums[CHANNEL_MAX] = {};
+    LevelType peak = 0;
+    size_t frameIndex = 0;
+    if (split == 1) {
+        frameIndex = CountLevelNeon<format>(ptr, size, channel, sums, peak, stats);
+        ptr += frameIndex * frameStride;
+    }
+    for (; frameIndex < size; frameIndex++) {
+        bool isSilent = true;
         for (size_t channelIdx = 0; channelIdx < channel; channelIdx++) {
-            volSums[channelIdx] += (*raw32 >= 0 ? *raw32 : (-*raw32));
-            raw32++;
+            LevelType level = Kernel::Level(ptr + channelIdx * Kernel::SAMPLE_SIZE);
+            sums[channelIdx] += level;
+            peak = std::max(peak, level);
+            stats.clipCount += (level >= Kernel::FULL_SCALE) ? 1 : 0;
+            isSilent = isSilent && (level == 0);
         }
-        raw32 += (split - 1) * channel;
+        stats.zeroRun = isSilent ? stats.zeroRun + 1 : 0;
+        stats.maxZeroRun = std::max(stats.maxZeroRun, stats.zeroRun);
+        ptr += frameStride;
     }
 
     for (size_t index = 0; index < channel; index++) {
-        volSums[index] = (volSums[index] * INT32_MAX) / static_cast<double>(size);
-        volMaps.volStart[index] = static_cast<int32_t>(volSums[index]);
+        vols.volStart[index] = Kernel::ToVolume(sums[index], size);
     }
-    return;
+    float normPeak = static_cast<float>(static_cast<double>(peak) / static_cast<double>(Kernel::FULL_SCALE));
+    stats.peak = std::max(stats.peak, std::min(normPeak, 1.0f));
+    stats.frameCount += size;
 }
 
 ChannelVolumes VolumeTools::CountVolumeLevel(const BufferDesc &buffer, AudioSampleFormat format, AudioChannel channel,
     size_t split)
+{
+    VolumeStats stats;
+    return CountVolumeLevel(buffer, format, channel, stats, split);
+}
+
+ChannelVolumes VolumeTools::CountVolumeLevel(const BufferDesc &buffer, AudioSampleFormat format, AudioChannel channel,
+    VolumeStats &stats, size_t split)
 {
     ChannelVolumes channelVols = {};
     channelVols.channel = channel;
@@ -527,21 +884,34 @@ ChannelVolumes VolumeTools::CountVolumeLevel(const BufferDesc &buffer, AudioSamp
         AUDIO_DEBUG_LOG("failed with invalid params");
         return channelVols;
     }
+    CHECK_AND_RETURN_RET_LOG(split != 0, channelVols, "invalid split");
+    size_t byteSizePerFrame = GetByteSize(format) * channel;
+    if (buffer.buffer == nullptr || byteSizePerFrame == 0 || buffer.bufLength % byteSizePerFrame != 0) {
+        AUDIO_ERR_LOG("invalid buffer, size is %{public}zu", buffer.bufLength);
+        return channelVols;
+    }
+    size_t frameSize = buffer.bufLength / byteSizePerFrame;
+    if (frameSize < MIN_FRAME_SIZE || frameSize >= MAX_FRAME_SIZE) {
+        AUDIO_ERR_LOG("invalid frameSize, size is %{public}zu", frameSize);
+        return channelVols;
+    }
+    CHECK_AND_RETURN_RET_LOG(frameSize / split != 0, channelVols, "invalid size");
+
     switch (format) {
         case SAMPLE_U8:
-            CountU8Volume(buffer, channel, channelVols, split, format);
+            CountLevel<SAMPLE_U8>(buffer.buffer, frameSize, channel, split, channelVols, stats);
             break;
         case SAMPLE_S16LE:
-            CountS16Volume(buffer, channel, channelVols, split, format);
+            CountLevel<SAMPLE_S16LE>(buffer.buffer, frameSize, channel, split, channelVols, stats);
             break;
         case SAMPLE_S24LE:
-            CountS24Volume(buffer, channel, channelVols, split, format);
+            CountLevel<SAMPLE_S24LE>(buffer.buffer, frameSize, channel, split, channelVols, stats);
             break;
         case SAMPLE_S32LE:
-            CountS32Volume(buffer, channel, channelVols, split, format);
+            CountLevel<SAMPLE_S32LE>(buffer.buffer, frameSize, channel, split, channelVols, stats);
             break;
         case SAMPLE_F32LE:
-            CountF32Volume(buffer, channel, channelVols, split, format);
+            CountLevel<SAMPLE_F32LE>(buffer.buffer, frameSize, channel, split, channelVols, stats);
             break;
         default:
             break;
@@ -550,48 +920,24 @@ ChannelVolumes VolumeTools::CountVolumeLevel(const BufferDesc &buffer, AudioSamp
     return channelVols;
 }
 
-void VolumeTools::DfxOperation(const BufferDesc &buffer, AudioStreamInfo streamInfo, std::string logTag,
-    int64_t &volumeDataCount, size_t split)
-{
-    size_t byteSizePerData = GetByteSize(streamInfo.format);
-    size_t frameLen = byteSizePerData * static_cast<size_t>(streamInfo.channels) *
-        static_cast<size_t>(streamInfo.samplingRate) * 0.02; // 0.02s
-    CHECK_AND_RETURN_LOG(frameLen > 0, "frameLen is invalid");
-    int64_t minVolume = INT_32_MAX;
-    for (size_t index = 0; index < (buffer.bufLength + frameLen - 1) / frameLen; index++) {
-        BufferDesc temp = {buffer.buffer + frameLen * index, std::min(buffer.bufLength - frameLen * index, frameLen),
-            std::min(buffer.dataLength - frameLen * index, frameLen)};
-        ChannelVolumes vols = CountVolumeLevel(temp, streamInfo.format, streamInfo.channels, split);
-        if (streamInfo.channels == MONO) {
-            minVolume = std::min(minVolume, static_cast<int64_t>(vols.volStart[0]));
-        } else {
-            minVolume = std::min(minVolume, static_cast<int64_t>(vols.volStart[0]) / HALF_FACTOR
-            + static_cast<int64_t>(vols.volStart[1]) / HALF_FACTOR);
-        }
-        AudioLogUtils::ProcessVolumeData(logTag, vols, volumeDataCount);
-    }
-    Trace::Count(logTag, minVolume);
-}
-
-void VolumeTools::CalcMuteFrame(BufferDesc &buffer, AudioStreamInfo streamInfo, std::string logTag,
-    int64_t &volumeDataCount, int64_t &muteFrameCnt, size_t split)
+// Counts and reports the volume of every 20ms chunk, returns the frames of the chunks reported as mute.
+static int64_t CountChunkVolumeLevel(const BufferDesc &buffer, const AudioStreamInfo &streamInfo,
+    const std::string &logTag, int64_t &volumeDataCount, VolumeStats &stats, size_t split)
 {
     size_t byteSizePerData = VolumeTools::GetByteSize(streamInfo.format);
     size_t byteSizePerFrame = byteSizePerData * streamInfo.channels;
     size_t frameLen = byteSizePerData * static_cast<size_t>(streamInfo.channels) *
         static_cast<size_t>(streamInfo.samplingRate) * 0.02; // 0.02s
+    stats = {};
+    CHECK_AND_RETURN_RET_LOG(frameLen > 0, 0, "frameLen is invalid");
 
-    if (frameLen == 0) {
-        AUDIO_ERR_LOG("invalid size");
-        return;
-    }
+    int64_t muteFrameCnt = 0;
     int64_t minVolume = INT_32_MAX;
     for (size_t index = 0; index < (buffer.bufLength + frameLen - 1) / frameLen; index++) {
         BufferDesc temp = {buffer.buffer + frameLen * index, std::min(buffer.bufLength - frameLen * index, frameLen),
             std::min(buffer.dataLength - frameLen * index, frameLen)};
-
-        size_t frameSize = temp.bufLength / byteSizePerFrame;
-        ChannelVolumes vols = VolumeTools::CountVolumeLevel(temp, streamInfo.format, streamInfo.channels, split);
+        ChannelVolumes vols = VolumeTools::CountVolumeLevel(temp, streamInfo.format, streamInfo.channels, stats,
+            split);
         if (streamInfo.channels == MONO) {
             minVolume = std::min(minVolume, static_cast<int64_t>(vols.volStart[0]));
         } else {
@@ -600,10 +946,37 @@ void VolumeTools::CalcMuteFrame(BufferDesc &buffer, AudioStreamInfo streamInfo,
         }
         AudioLogUtils::ProcessVolumeData(logTag, vols, volumeDataCount);
         if (volumeDataCount < 0) {
-            muteFrameCnt += static_cast<int64_t>(frameSize);
+            muteFrameCnt += static_cast<int64_t>(temp.bufLength / byteSizePerFrame);
         }
     }
     Trace::Count(logTag, minVolume);
+    return muteFrameCnt;
+}
+
+void VolumeTools::DfxOperation(const BufferDesc &buffer, AudioStreamInfo streamInfo, std::string logTag,
+    int64_t &volumeDataCount, size_t split)
+{
+    VolumeStats stats;
+    CountChunkVolumeLevel(buffer, streamInfo, logTag, volumeDataCount, stats, split);
+}
+
+void VolumeTools::DfxOperation(const BufferDesc &buffer, AudioStreamInfo streamInfo, std::string logTag,
+    int64_t &volumeDataCount, VolumeStats &stats, size_t split)
+{
+    CountChunkVolumeLevel(buffer, streamInfo, logTag, volumeDataCount, stats, split);
+}
+
+void VolumeTools::CalcMuteFrame(BufferDesc &buffer, AudioStreamInfo streamInfo, std::string logTag,
+    int64_t &volumeDataCount, int64_t &muteFrameCnt, size_t split)
+{
+    VolumeStats stats;
+    muteFrameCnt += CountChunkVolumeLevel(buffer, streamInfo, logTag, volumeDataCount, stats, split);
+}
+
+void VolumeTools::CalcMuteFrame(BufferDesc &buffer, AudioStreamInfo streamInfo, std::string logTag,
+    int64_t &volumeDataCount, int64_t &muteFrameCnt, VolumeStats &stats, size_t split)
+{
+    muteFrameCnt += CountChunkVolumeLevel(buffer, streamInfo, logTag, volumeDataCount, stats, split);
 }
 
 bool VolumeTools::IsZeroVolume(float volume)
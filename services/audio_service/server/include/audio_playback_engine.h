@@ -14,6 +14,7 @@
  */
 #ifndef AUDIO_PLAYBACK_ENGINE_H
 #define AUDIO_PLAYBACK_ENGINE_H
+#include <atomic>
 #include <memory>
 #include "i_audio_engine.h"
 #include "i_renderer_stream.h"
@@ -21,6 +22,8 @@
 
 namespace OHOS {
 namespace AudioStandard {
+class IAudioRenderSink;
+
 class AudioPlaybackEngine : public IAudioEngine {
 public:
     AudioPlaybackEngine();
@@ -39,11 +42,19 @@ public:
 
 protected:
     virtual void MixStreams() {}
+    // Sink of renderId_ for the playback thread. It is looked up once and kept until InvalidateRenderSink, which
+    // has to follow every change of renderId_.
+    std::shared_ptr<IAudioRenderSink> GetCachedRenderSink();
+    void InvalidateRenderSink();
 
 protected:
     uint32_t renderId_;
     std::unique_ptr<AudioThreadTask> playbackThread_;
     std::vector<std::shared_ptr<IRendererStream>> streams_;
+
+private:
+    std::shared_ptr<IAudioRenderSink> renderSink_ = nullptr;
+    std::atomic<bool> isRenderSinkValid_ = false;
 };
 } // namespace AudioStandard
 } // namespace OHOS
@@ -37,7 +37,7 @@ struct AudioWorkgroupCgroupLimit {
 class AudioWorkgroup {
 public:
     explicit AudioWorkgroup(int32_t id);
-    ~AudioWorkgroup() {};
+    ~AudioWorkgroup();
 
     int32_t GetWorkgroupId();
     uint32_t GetThreadsNums();
@@ -50,6 +50,11 @@ public:
     std::shared_ptr<AudioWorkgroupCallbackForMonitor> callback;
 
 private:
+    void ScheduleThreads(uint64_t periodNs);
+
+    // period of the last Start when the threads are scheduled by AudioRtSchedule, 0 before the first one
+    uint64_t periodNs_ = 0;
+
     int32_t workgroupId;
     std::unordered_map<int32_t, bool> threads;
     AudioWorkgroupCgroupLimit cgroupLimit;
@@ -47,7 +47,7 @@ private:
     int32_t InitSink(const AudioStreamInfo &clientStreamInfo);
     int32_t InitSink(uint32_t channel, AudioSampleFormat format, uint32_t rate, AudioChannelLayout layout);
     int32_t StopAudioSink();
-    void DoRenderFrame(std::vector<char> &audioBufferConverted, int32_t index, int32_t appUid);
+    void DoRenderFrame(const BufferDesc &bufferDesc, int32_t index, int32_t appUid);
     void DirectCallback(const RenderCallbackType type);
     int32_t RegisterWriteCallback();
     int32_t GetDirectFormatByteSize(AudioSampleFormat format);
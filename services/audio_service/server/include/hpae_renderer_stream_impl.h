@@ -73,7 +73,7 @@ public:
     // offload end
 
     int32_t UpdateSpatializationState(bool spatializationEnabled, bool headTrackingEnabled) override;
-    int32_t Peek(std::vector<char> *audioBuffer, int32_t &index) override;
+    int32_t Peek(BufferDesc &bufferDesc, int32_t &index) override;
     int32_t ReturnIndex(int32_t index) override;
     AudioProcessConfig GetAudioProcessConfig() const noexcept override;
     int32_t SetClientVolume(float clientVolume) override;
@@ -69,7 +69,8 @@ public:
     virtual int32_t UpdateSpatializationState(bool spatializationEnabled, bool headTrackingEnabled) = 0;
     virtual int32_t UpdateMaxLength(uint32_t maxLength) = 0;
 
-    virtual int32_t Peek(std::vector<char> *audioBuffer, int32_t &index) = 0;
+    // bufferDesc points into a buffer owned by the stream, it stays valid until index is given back by ReturnIndex
+    virtual int32_t Peek(BufferDesc &bufferDesc, int32_t &index) = 0;
     virtual int32_t ReturnIndex(int32_t index) = 0;
     virtual AudioProcessConfig GetAudioProcessConfig() const noexcept = 0;
     virtual int32_t SetClientVolume(float clientVolume) = 0;
@@ -49,7 +49,7 @@ private:
     void PauseAsync();
     int32_t StopAudioSink();
     void DoFadeinOut(bool isFadeOut, char* buffer, size_t bufferSize);
-    void DoRenderFrame(std::vector<char> &audioBufferConverted, int32_t index, int32_t appUid);
+    void DoRenderFrame(const BufferDesc &bufferDesc, int32_t index, int32_t appUid);
 
     AudioSamplingRate GetDirectSampleRate(AudioSamplingRate sampleRate);
     AudioSamplingRate GetDirectVoipSampleRate(AudioSamplingRate sampleRate);
@@ -79,6 +79,7 @@ private:
     std::atomic<bool> startFadeout_;
     uint32_t uChannel_;
     int32_t uFormat_;
+    AudioSampleFormat uSampleFormat_;
     uint32_t uSampleRate_;
     bool firstSetVolume_;
 };
@@ -72,7 +72,7 @@ public:
     int32_t UpdateMaxLength(uint32_t maxLength) override;
 
     AudioProcessConfig GetAudioProcessConfig() const noexcept override;
-    int32_t Peek(std::vector<char> *audioBuffer, int32_t &index) override;
+    int32_t Peek(BufferDesc &bufferDesc, int32_t &index) override;
     int32_t ReturnIndex(int32_t index) override;
     int32_t SetClientVolume(float clientVolume) override;
     int32_t SetLoudnessGain(float loudnessGain) override;
@@ -85,7 +85,7 @@ private:
     void ConvertSrcToFloat(const BufferDesc &bufferDesc);
     void ConvertFloatToDes(int32_t writeIndex);
     void GetStreamVolume();
-    void PopSinkBuffer(std::vector<char> *audioBuffer, int32_t &index);
+    void PopSinkBuffer(BufferDesc &bufferDesc, int32_t &index);
     int32_t PopWriteBufferIndex();
     void SetOffloadDisable();
     void InitBasicInfo(const AudioStreamInfo &streamInfo);
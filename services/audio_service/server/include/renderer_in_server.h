@@ -252,6 +252,8 @@ private:
     size_t bufferTotalSizeInFrame_ = 0;
     size_t spanSizeInFrame_ = 0;
     size_t spanSizeInByte_ = 0;
+    // one span of zeros, never written after config, shared by every silence back-fill on the render thread
+    std::vector<uint8_t> silencePage_;
     size_t byteSizePerFrame_ = 0;
     bool isBufferConfiged_  = false;
     std::atomic<bool> isInited_ = false;
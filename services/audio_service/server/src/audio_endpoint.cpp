@@ -2130,7 +2130,8 @@ void AudioEndpointInner::CheckWakeUpTime(int64_t &wakeUpTime)
 void AudioEndpointInner::EndpointWorkLoopFuc()
 {
     BindCore();
-    bool setPriorityResult = SetEndpointThreadPriority();
+    // the loop wakes once per span
+    bool setPriorityResult = SetEndpointThreadPriorityWithPeriod(static_cast<uint64_t>(spanDuration_), 0);
     if (!setPriorityResult) {
         SetThreadQosLevel();
     }
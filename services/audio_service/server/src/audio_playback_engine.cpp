@@ -16,6 +16,8 @@
 #include "audio_playback_engine.h"
 #include "audio_errors.h"
 #include "common/hdi_adapter_info.h"
+#include "manager/hdi_adapter_manager.h"
+#include "sink/i_audio_render_sink.h"
 namespace OHOS {
 namespace AudioStandard {
 AudioPlaybackEngine::AudioPlaybackEngine()
@@ -74,5 +76,22 @@ uint64_t AudioPlaybackEngine::GetLatency() noexcept
 {
     return 0;
 }
+
+std::shared_ptr<IAudioRenderSink> AudioPlaybackEngine::GetCachedRenderSink()
+{
+    // a lookup racing with InvalidateRenderSink leaves the flag cleared, the next period looks up again
+    if (!isRenderSinkValid_.exchange(true)) {
+        renderSink_ = HdiAdapterManager::GetInstance().GetRenderSink(renderId_);
+        if (renderSink_ == nullptr) {
+            isRenderSinkValid_.store(false);
+        }
+    }
+    return renderSink_;
+}
+
+void AudioPlaybackEngine::InvalidateRenderSink()
+{
+    isRenderSinkValid_.store(false);
+}
 } // namespace AudioStandard
 } // namespace OHOS
@@ -22,10 +22,15 @@
 #include "audio_common_log.h"
 #include "audio_utils.h"
 #include "concurrent_task_client.h"
+#include "audio_rt_schedule.h"
 
 namespace OHOS {
 namespace AudioStandard {
+#ifdef RESSCHE_ENABLE
 constexpr unsigned int MS_PER_SECOND = 1000;
+#else
+constexpr uint64_t NS_PER_MS = 1000000;
+#endif
 
 AudioWorkgroup::AudioWorkgroup(int32_t id) : workgroupId(id)
 {
@@ -33,6 +38,18 @@ AudioWorkgroup::AudioWorkgroup(int32_t id) : workgroupId(id)
     SetCgroupLimitParams(0, -1);
 }
 
+AudioWorkgroup::~AudioWorkgroup()
+{
+#ifndef RESSCHE_ENABLE
+    // the group goes away with its threads still in it, they fall back to the normal class
+    if (periodNs_ > 0) {
+        for (const auto &thread : threads) {
+            AudioRtSchedule::GetInstance().Unschedule(thread.first);
+        }
+    }
+#endif
+}
+
 int32_t AudioWorkgroup::GetWorkgroupId()
 {
     return workgroupId;
@@ -47,6 +64,15 @@ int32_t AudioWorkgroup::AddThread(int32_t tid)
 {
     Trace trace("[WorkgroupInServer] AddThread tid:" + std::to_string(tid) +
         " workgroupId:" + std::to_string(workgroupId));
+#ifndef RESSCHE_ENABLE
+    // no frame aware scheduler behind the group, its threads get a deadline once Start gives the period
+    threads[tid] = true;
+    if (periodNs_ > 0) {
+        AudioRtSchedule::GetInstance().Schedule(tid, periodNs_, AUDIO_RT_DEFAULT_RUNTIME_NS,
+            AUDIO_RT_DEFAULT_FIFO_PRIORITY);
+    }
+    return AUDIO_OK;
+#else
     ConcurrentTask::IntervalReply reply;
     reply.paramA = cgroupLimit.clientPid;
     reply.paramB = cgroupLimit.globalCgroupId;
@@ -58,12 +84,19 @@ int32_t AudioWorkgroup::AddThread(int32_t tid)
     }
     threads[tid] = true;
     return AUDIO_OK;
+#endif
 }
 
 int32_t AudioWorkgroup::RemoveThread(int32_t tid)
 {
     Trace trace("[WorkgroupInServer] RemoveThread tid:" + std::to_string(tid) +
         " workgroupId:" + std::to_string(workgroupId));
+#ifndef RESSCHE_ENABLE
+    if (threads.erase(tid) > 0 && periodNs_ > 0) {
+        AudioRtSchedule::GetInstance().Unschedule(tid);
+    }
+    return AUDIO_OK;
+#else
     ConcurrentTask::IntervalReply reply;
     reply.paramA = cgroupLimit.clientPid;
     reply.paramB = cgroupLimit.globalCgroupId;
@@ -75,6 +108,7 @@ int32_t AudioWorkgroup::RemoveThread(int32_t tid)
     }
     threads.erase(tid);
     return AUDIO_OK;
+#endif
 }
 
 int32_t AudioWorkgroup::Start(uint64_t startTime, uint64_t deadlineTime)
@@ -85,24 +119,44 @@ int32_t AudioWorkgroup::Start(uint64_t startTime, uint64_t deadlineTime)
         AUDIO_ERR_LOG("[WorkgroupInServer] Invalid params When Start.");
         return AUDIO_ERR;
     }
+#ifndef RESSCHE_ENABLE
+    ScheduleThreads((deadlineTime - startTime) * NS_PER_MS);
+    return AUDIO_OK;
+#else
     RME::SetFrameRateAndPrioType(workgroupId, MS_PER_SECOND/(deadlineTime - startTime), 0);
     if (RME::BeginFrameFreq(deadlineTime - startTime) != 0) {
         AUDIO_ERR_LOG("[WorkgroupInServer] Audio Deadline BeginFrame failed");
         return AUDIO_ERR;
     }
     return AUDIO_OK;
+#endif
 }
 
 int32_t AudioWorkgroup::Stop()
 {
     Trace trace("[WorkgroupInServer] Stop workgroupId:" + std::to_string(workgroupId));
+#ifdef RESSCHE_ENABLE
     if (RME::EndFrameFreq(0) != 0) {
         AUDIO_ERR_LOG("[WorkgroupInServer] Audio Deadline EndFrame failed");
         return AUDIO_ERR;
     }
+#endif
     return AUDIO_OK;
 }
 
+#ifndef RESSCHE_ENABLE
+void AudioWorkgroup::ScheduleThreads(uint64_t periodNs)
+{
+    // Start comes every cycle, the threads are only touched when the period changes
+    CHECK_AND_RETURN(periodNs != periodNs_);
+    periodNs_ = periodNs;
+    for (const auto &thread : threads) {
+        AudioRtSchedule::GetInstance().Schedule(thread.first, periodNs_, AUDIO_RT_DEFAULT_RUNTIME_NS,
+            AUDIO_RT_DEFAULT_FIFO_PRIORITY);
+    }
+}
+#endif
+
 int32_t AudioWorkgroup::GetCgroupLimitId()
 {
     return cgroupLimit.globalCgroupId;
@@ -75,6 +75,7 @@ int32_t DirectPlayBackEngine::Init(const AudioDeviceDescriptor &type, bool isVoi
             sink->DeInit();
         }
         HdiAdapterManager::GetInstance().ReleaseId(renderId_);
+        InvalidateRenderSink();
     }
     return SUCCESS;
 }
@@ -176,12 +177,12 @@ int32_t DirectPlayBackEngine::RegisterWriteCallback()
     return sink->RegistDirectHdiCallback(callback);
 }
 
-void DirectPlayBackEngine::DoRenderFrame(std::vector<char> &audioBufferConverted, int32_t index, int32_t appUid)
+void DirectPlayBackEngine::DoRenderFrame(const BufferDesc &bufferDesc, int32_t index, int32_t appUid)
 {
     uint64_t written = 0;
-    std::shared_ptr<IAudioRenderSink> sink = HdiAdapterManager::GetInstance().GetRenderSink(renderId_);
+    std::shared_ptr<IAudioRenderSink> sink = GetCachedRenderSink();
     CHECK_AND_RETURN(sink != nullptr);
-    sink->RenderFrame(*audioBufferConverted.data(), audioBufferConverted.size(), written);
+    sink->RenderFrame(*reinterpret_cast<char *>(bufferDesc.buffer), bufferDesc.dataLength, written);
     CHECK_AND_RETURN(stream_ != nullptr);
     stream_->ReturnIndex(index);
 }
@@ -196,10 +197,10 @@ void DirectPlayBackEngine::MixStreams()
         AUDIO_WARNING_LOG("failed count is overflow.");
         return;
     }
-    std::vector<char> audioBuffer;
+    BufferDesc bufferDesc = {nullptr, 0, 0};
     int32_t appUid = stream_->GetAudioProcessConfig().appInfo.appUid;
     int32_t index = -1;
-    int32_t result = stream_->Peek(&audioBuffer, index);
+    int32_t result = stream_->Peek(bufferDesc, index);
     uint32_t sessionId = stream_->GetStreamIndex();
     if (index < 0) {
         AUDIO_WARNING_LOG("peek buffer failed.result:%{public}d,buffer size:%{public}d", result, index);
@@ -210,7 +211,7 @@ void DirectPlayBackEngine::MixStreams()
     }
     AudioPerformanceMonitor::GetInstance().RecordSilenceState(sessionId, false, PIPE_TYPE_DIRECT_OUT, appUid);
     failedCount_ = 0;
-    DoRenderFrame(audioBuffer, index, appUid);
+    DoRenderFrame(bufferDesc, index, appUid);
 }
 
 int32_t DirectPlayBackEngine::AddRenderer(const std::shared_ptr<IRendererStream> &stream)
@@ -291,6 +292,7 @@ int32_t DirectPlayBackEngine::InitSink(uint32_t channel, AudioSampleFormat forma
 {
     std::string sinkName = EAC3_SINK_NAME;
     renderId_ = HdiAdapterManager::GetInstance().GetId(HDI_ID_BASE_RENDER, HDI_ID_TYPE_EAC3, sinkName, true);
+    InvalidateRenderSink();
     std::shared_ptr<IAudioRenderSink> sink = HdiAdapterManager::GetInstance().GetRenderSink(renderId_, true);
     if (sink == nullptr) {
         AUDIO_ERR_LOG("get render fail, sinkName: %{public}s", sinkName.c_str());
@@ -733,7 +733,7 @@ AudioProcessConfig HpaeRendererStreamImpl::GetAudioProcessConfig() const noexcep
     return processConfig_;
 }
 
-int32_t HpaeRendererStreamImpl::Peek(std::vector<char> *audioBuffer, int32_t &index)
+int32_t HpaeRendererStreamImpl::Peek(BufferDesc &bufferDesc, int32_t &index)
 {
     return SUCCESS;
 }
@@ -26,6 +26,7 @@
 #include "none_mix_engine.h"
 #include "audio_performance_monitor.h"
 #include "audio_volume.h"
+#include "volume_tools.h"
 #include "format_converter.h"
 #include "audio_service.h"
 #include "audio_mute_factor_manager.h"
@@ -61,6 +62,7 @@ NoneMixEngine::NoneMixEngine()
       startFadeout_(false),
       uChannel_(0),
       uFormat_(sizeof(int32_t)),
+      uSampleFormat_(SAMPLE_S32LE),
       uSampleRate_(0),
       firstSetVolume_(true)
 {
@@ -103,6 +105,7 @@ int32_t NoneMixEngine::Init(const AudioDeviceDescriptor &type, bool isVoip)
             sink->DeInit();
         }
         HdiAdapterManager::GetInstance().ReleaseId(renderId_);
+        InvalidateRenderSink();
     }
     return SUCCESS;
 }
@@ -225,36 +228,15 @@ int32_t NoneMixEngine::Flush()
     return SUCCESS;
 }
 
-template <typename T, typename = std::enable_if_t<std::is_integral<T>::value>>
-static void DoFadeInOut(T *dest, size_t count, bool isFadeOut, uint32_t channel)
-{
-    if (count <= 0) {
-        return;
-    }
-    float fadeStep = 1.0f / count;
-    for (size_t i = 0; i < count; i++) {
-        float fadeFactor;
-        if (isFadeOut) {
-            fadeFactor = 1.0f - ((i + 1) * fadeStep);
-        } else {
-            fadeFactor = (i + 1) * fadeStep;
-        }
-        for (uint32_t j = 0; j < channel; j++) {
-            dest[i * channel + j] *= fadeFactor;
-        }
-    }
-}
-
 void NoneMixEngine::DoFadeinOut(bool isFadeOut, char *pBuffer, size_t bufferSize)
 {
     CHECK_AND_RETURN_LOG(pBuffer != nullptr && bufferSize > 0 && uChannel_ > 0, "buffer is null.");
-    size_t dataLength = bufferSize / (static_cast<uint32_t>(uFormat_) * uChannel_);
-    if (uFormat_ == sizeof(int16_t)) {
-        AUDIO_INFO_LOG("int16 fading frame length:%{public}zu", dataLength);
-        DoFadeInOut(reinterpret_cast<int16_t *>(pBuffer), dataLength, isFadeOut, uChannel_);
-    } else if (uFormat_ == sizeof(int32_t)) {
-        AUDIO_INFO_LOG("int32 fading frame length:%{public}zu", dataLength);
-        DoFadeInOut(reinterpret_cast<int32_t *>(pBuffer), dataLength, isFadeOut, uChannel_);
+    AUDIO_INFO_LOG("format:%{public}d fading length:%{public}zu", uSampleFormat_, bufferSize);
+    BufferDesc bufferDesc = {reinterpret_cast<uint8_t *>(pBuffer), bufferSize, bufferSize};
+    int32_t ret = VolumeTools::ProcessFade(bufferDesc, uSampleFormat_, static_cast<AudioChannel>(uChannel_),
+        isFadeOut);
+    if (ret != SUCCESS) {
+        AUDIO_WARNING_LOG("fade failed, ret:%{public}d", ret);
     }
     if (isFadeOut) {
         startFadeout_.store(false);
@@ -284,12 +266,12 @@ void NoneMixEngine::AdjustVoipVolume()
     }
 }
 
-void NoneMixEngine::DoRenderFrame(std::vector<char> &audioBufferConverted, int32_t index, int32_t appUid)
+void NoneMixEngine::DoRenderFrame(const BufferDesc &bufferDesc, int32_t index, int32_t appUid)
 {
     uint64_t written = 0;
-    std::shared_ptr<IAudioRenderSink> sink = HdiAdapterManager::GetInstance().GetRenderSink(renderId_);
+    std::shared_ptr<IAudioRenderSink> sink = GetCachedRenderSink();
     CHECK_AND_RETURN(sink != nullptr);
-    sink->RenderFrame(*audioBufferConverted.data(), audioBufferConverted.size(), written);
+    sink->RenderFrame(*reinterpret_cast<char *>(bufferDesc.buffer), bufferDesc.dataLength, written);
     stream_->ReturnIndex(index);
     sink->UpdateAppsUid({appUid});
 }
@@ -305,10 +287,10 @@ void NoneMixEngine::MixStreams()
         PauseAsync();
         return;
     }
-    std::vector<char> audioBuffer;
+    BufferDesc bufferDesc = {nullptr, 0, 0};
     int32_t appUid = stream_->GetAudioProcessConfig().appInfo.appUid;
     int32_t index = -1;
-    int32_t result = stream_->Peek(&audioBuffer, index);
+    int32_t result = stream_->Peek(bufferDesc, index);
     uint32_t sessionId = stream_->GetStreamIndex();
     writeCount_++;
     if (index < 0) {
@@ -332,10 +314,10 @@ void NoneMixEngine::MixStreams()
         if (startFadeout_) {
             stream_->BlockStream();
         }
-        DoFadeinOut(startFadeout_, audioBuffer.data(), audioBuffer.size());
+        DoFadeinOut(startFadeout_, reinterpret_cast<char *>(bufferDesc.buffer), bufferDesc.dataLength);
         cvFading_.notify_all();
     }
-    DoRenderFrame(audioBuffer, index, appUid);
+    DoRenderFrame(bufferDesc, index, appUid);
     StandbySleep();
 }
 
@@ -500,6 +482,7 @@ int32_t NoneMixEngine::InitSink(uint32_t channel, AudioSampleFormat format, uint
         sinkName = VOIP_SINK_NAME;
     }
     renderId_ = HdiAdapterManager::GetInstance().GetId(HDI_ID_BASE_RENDER, HDI_ID_TYPE_PRIMARY, sinkName, true);
+    InvalidateRenderSink();
     std::shared_ptr<IAudioRenderSink> sink = HdiAdapterManager::GetInstance().GetRenderSink(renderId_, true);
     if (sink == nullptr) {
         AUDIO_ERR_LOG("get render fail, sinkName: %{public}s", sinkName.c_str());
@@ -528,6 +511,7 @@ int32_t NoneMixEngine::InitSink(uint32_t channel, AudioSampleFormat format, uint
     uChannel_ = attr.channel;
     uSampleRate_ = attr.sampleRate;
     uFormat_ = GetDirectFormatByteSize(attr.format);
+    uSampleFormat_ = attr.format;
 
     return ret;
 }
@@ -1316,7 +1316,7 @@ AudioProcessConfig PaRendererStreamImpl::GetAudioProcessConfig() const noexcept
     return processConfig_;
 }
 
-int32_t PaRendererStreamImpl::Peek(std::vector<char> *audioBuffer, int32_t &index)
+int32_t PaRendererStreamImpl::Peek(BufferDesc &bufferDesc, int32_t &index)
 {
     return SUCCESS;
 }
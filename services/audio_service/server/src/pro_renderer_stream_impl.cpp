@@ -530,7 +530,7 @@ bool ProRendererStreamImpl::GetAudioTime(uint64_t &framePos, int64_t &sec, int64
     return true;
 }
 
-int32_t ProRendererStreamImpl::Peek(std::vector<char> *audioBuffer, int32_t &index)
+int32_t ProRendererStreamImpl::Peek(BufferDesc &bufferDesc, int32_t &index)
 {
     Trace trace("ProRendererStreamImpl::Peek::" + std::to_string(streamIndex_));
     int32_t result = SUCCESS;
@@ -538,7 +538,7 @@ int32_t ProRendererStreamImpl::Peek(std::vector<char> *audioBuffer, int32_t &ind
         return ERR_WRITE_BUFFER;
     }
     if (!readQueue_.empty()) {
-        PopSinkBuffer(audioBuffer, index);
+        PopSinkBuffer(bufferDesc, index);
         return result;
     }
 
@@ -556,7 +556,7 @@ int32_t ProRendererStreamImpl::Peek(std::vector<char> *audioBuffer, int32_t &ind
                 break;
             }
             case SUCCESS: {
-                PopSinkBuffer(audioBuffer, index);
+                PopSinkBuffer(bufferDesc, index);
                 if (result != ERR_RENDERER_IN_SERVER_UNDERRUN) {
                     isFirstNoUnderrunFrame_ = true;
                     result = SUCCESS;
@@ -613,7 +613,7 @@ int32_t ProRendererStreamImpl::PopWriteBufferIndex()
     return writeIndex;
 }
 
-void ProRendererStreamImpl::PopSinkBuffer(std::vector<char> *audioBuffer, int32_t &index)
+void ProRendererStreamImpl::PopSinkBuffer(BufferDesc &bufferDesc, int32_t &index)
 {
     if (readQueue_.empty() && isFirstFrame_) {
         std::unique_lock firstFrameLock(firstFrameMutex);
@@ -628,7 +628,10 @@ void ProRendererStreamImpl::PopSinkBuffer(std::vector<char> *audioBuffer, int32_
         index = readQueue_.front();
         readQueue_.pop();
         isFirstFrame_ = false;
-        *audioBuffer = sinkBuffer_[index];
+        // hand out the span, the slot is not reused before the engine returns its index
+        bufferDesc.buffer = reinterpret_cast<uint8_t *>(sinkBuffer_[index].data());
+        bufferDesc.bufLength = sinkBuffer_[index].size();
+        bufferDesc.dataLength = bufferDesc.bufLength;
     }
     if (readQueue_.empty() && isDrain_) {
         drainSync_.notify_all();
@@ -133,6 +133,7 @@ int32_t RendererInServer::ConfigServerBuffer()
 
     spanSizeInByte_ = spanSizeInFrame_ * byteSizePerFrame_;
     CHECK_AND_RETURN_RET_LOG(spanSizeInByte_ != 0, ERR_OPERATION_FAILED, "Config oh audio buffer failed!");
+    silencePage_.assign(spanSizeInByte_, 0);
     AUDIO_INFO_LOG("engineTotalSizeInFrame_: %{public}zu, spanSizeInFrame_: %{public}zu, byteSizePerFrame_:%{public}zu "
         "spanSizeInByte_: %{public}zu, bufferTotalSizeInFrame_: %{public}zu", engineTotalSizeInFrame_,
         spanSizeInFrame_, byteSizePerFrame_, spanSizeInByte_, bufferTotalSizeInFrame_);
@@ -845,20 +846,18 @@ void RendererInServer::InnerCaptureEnqueueBuffer(const BufferDesc &bufferDesc, C
     int32_t innerCapId)
 {
     int32_t engineFlag = GetEngineFlag();
-    if (renderEmptyCountForInnerCapToInnerCapIdMap_.find(innerCapId) !=
-        renderEmptyCountForInnerCapToInnerCapIdMap_.end() &&
-        renderEmptyCountForInnerCapToInnerCapIdMap_[innerCapId] > 0) {
-        size_t emptyBufferSize = static_cast<size_t>
-            (renderEmptyCountForInnerCapToInnerCapIdMap_[innerCapId]) * spanSizeInByte_;
-        auto buffer = std::make_unique<uint8_t []>(emptyBufferSize);
-        BufferDesc emptyBufferDesc = {buffer.get(), emptyBufferSize, emptyBufferSize};
-        memset_s(emptyBufferDesc.buffer, emptyBufferDesc.bufLength, 0, emptyBufferDesc.bufLength);
-        if (engineFlag == 1) {
-            WriteDupBufferInner(emptyBufferDesc, innerCapId);
-        } else {
-            captureInfo.dupStream->EnqueueBuffer(emptyBufferDesc);
+    auto emptyCountIter = renderEmptyCountForInnerCapToInnerCapIdMap_.find(innerCapId);
+    if (emptyCountIter != renderEmptyCountForInnerCapToInnerCapIdMap_.end() && emptyCountIter->second > 0) {
+        // back-fill span by span from the shared silence page, the dup streams only read it
+        BufferDesc emptyBufferDesc = {silencePage_.data(), silencePage_.size(), silencePage_.size()};
+        for (int32_t i = 0; i < emptyCountIter->second && !silencePage_.empty(); i++) {
+            if (engineFlag == 1) {
+                WriteDupBufferInner(emptyBufferDesc, innerCapId);
+            } else {
+                captureInfo.dupStream->EnqueueBuffer(emptyBufferDesc);
+            }
         }
-        renderEmptyCountForInnerCapToInnerCapIdMap_[innerCapId] = 0;
+        emptyCountIter->second = 0;
     }
     if (engineFlag == 1) {
         AUDIO_DEBUG_LOG("OtherStreamEnqueue running");
@@ -1705,12 +1704,11 @@ int32_t RendererInServer::DisableDualTone()
 
 void RendererInServer::PreDualToneBufferSilenceForOffload()
 {
-    if (offloadEnable_) {
-        size_t emptyBufferSize = OFFLOAD_DUAL_RENDER_PREBUF * spanSizeInByte_;
-        auto buffer = std::make_unique<uint8_t []>(emptyBufferSize);
-        BufferDesc emptyBufferDesc = {buffer.get(), emptyBufferSize, emptyBufferSize};
-        memset_s(emptyBufferDesc.buffer, emptyBufferSize, 0, emptyBufferSize);
-        dualToneStream_->EnqueueBuffer(emptyBufferDesc);
+    if (offloadEnable_ && !silencePage_.empty()) {
+        BufferDesc emptyBufferDesc = {silencePage_.data(), silencePage_.size(), silencePage_.size()};
+        for (size_t i = 0; i < OFFLOAD_DUAL_RENDER_PREBUF; i++) {
+            dualToneStream_->EnqueueBuffer(emptyBufferDesc);
+        }
     }
 }
 
@@ -2378,14 +2376,15 @@ int32_t RendererInServer::CreateDupBufferInner(int32_t innerCapId)
 int32_t RendererInServer::WriteDupBufferInner(const BufferDesc &bufferDesc, int32_t innerCapId)
 {
     size_t targetSize = bufferDesc.bufLength;
-    CHECK_AND_RETURN_RET_LOG(innerCapIdToDupStreamCallbackMap_.find(innerCapId) !=
-        innerCapIdToDupStreamCallbackMap_.end(), ERROR,
+    auto callbackIter = innerCapIdToDupStreamCallbackMap_.find(innerCapId);
+    CHECK_AND_RETURN_RET_LOG(callbackIter != innerCapIdToDupStreamCallbackMap_.end(), ERROR,
         "innerCapIdToDupStreamCallbackMap_ is no find innerCapId: %{public}d", innerCapId);
-    CHECK_AND_RETURN_RET_LOG(innerCapIdToDupStreamCallbackMap_[innerCapId] != nullptr,
+    CHECK_AND_RETURN_RET_LOG(callbackIter->second != nullptr,
         ERROR, "innerCapIdToDupStreamCallbackMap_ is null, innerCapId: %{public}d", innerCapId);
-    CHECK_AND_RETURN_RET_LOG(innerCapIdToDupStreamCallbackMap_[innerCapId]->GetDupRingBuffer() != nullptr,
-        ERROR, "DupRingBuffe is null, innerCapId: %{public}d", innerCapId);
-    OptResult result = innerCapIdToDupStreamCallbackMap_[innerCapId]->GetDupRingBuffer()->GetWritableSize();
+    std::unique_ptr<AudioRingCache> &dupRingBuffer = callbackIter->second->GetDupRingBuffer();
+    CHECK_AND_RETURN_RET_LOG(dupRingBuffer != nullptr, ERROR, "DupRingBuffe is null, innerCapId: %{public}d",
+        innerCapId);
+    OptResult result = dupRingBuffer->GetWritableSize();
     // todo get writeable size failed
     CHECK_AND_RETURN_RET_LOG(result.ret == OPERATION_SUCCESS, ERROR,
         "DupRingBuffer write invalid size is:%{public}zu", result.size);
@@ -2396,7 +2395,8 @@ int32_t RendererInServer::WriteDupBufferInner(const BufferDesc &bufferDesc, int3
     if (lastTarget_ == INJECT_TO_VOICE_COMMUNICATION_CAPTURE) {
         WriteSilenceDupBuffer(bufferDesc, bufferWrap, innerCapId);
     } else if (writeSize > 0) {
-        result = innerCapIdToDupStreamCallbackMap_[innerCapId]->GetDupRingBuffer()->Enqueue(bufferWrap);
+        // each capture session drains its own ring at its own pace, so this is the only copy it gets
+        result = dupRingBuffer->Enqueue(bufferWrap);
         if (result.ret != OPERATION_SUCCESS) {
             AUDIO_ERR_LOG("RingCache Enqueue failed ret:%{public}d size:%{public}zu", result.ret, result.size);
         }
@@ -2407,13 +2407,15 @@ int32_t RendererInServer::WriteDupBufferInner(const BufferDesc &bufferDesc, int3
 
 void RendererInServer::WriteSilenceDupBuffer(const BufferDesc &bufferDesc, BufferWrap &bufferWrap, int32_t innerCapId)
 {
-    CHECK_AND_RETURN(bufferWrap.dataSize > 0);
-    auto buffer = std::make_unique<uint8_t []>(bufferWrap.dataSize);
-    bufferWrap.dataPtr = buffer.get();
-    memset_s(bufferWrap.dataPtr, bufferWrap.dataSize, 0, bufferWrap.dataSize);
-    OptResult result = innerCapIdToDupStreamCallbackMap_[innerCapId]->GetDupRingBuffer()->Enqueue(bufferWrap);
-    if (result.ret != OPERATION_SUCCESS) {
-        AUDIO_ERR_LOG("RingCache Enqueue failed ret:%{public}d size:%{public}zu", result.ret, result.size);
+    CHECK_AND_RETURN(bufferWrap.dataSize > 0 && !silencePage_.empty());
+    std::unique_ptr<AudioRingCache> &dupRingBuffer = innerCapIdToDupStreamCallbackMap_[innerCapId]->GetDupRingBuffer();
+    for (size_t offset = 0; offset < bufferWrap.dataSize; offset += silencePage_.size()) {
+        BufferWrap silenceWrap = {silencePage_.data(), std::min(silencePage_.size(), bufferWrap.dataSize - offset)};
+        OptResult result = dupRingBuffer->Enqueue(silenceWrap);
+        if (result.ret != OPERATION_SUCCESS) {
+            AUDIO_ERR_LOG("RingCache Enqueue failed ret:%{public}d size:%{public}zu", result.ret, result.size);
+            break;
+        }
     }
     DumpFileUtil::WriteDumpFile(dumpDupIn_, static_cast<void *>(bufferDesc.buffer), bufferWrap.dataSize);
 }
@@ -16,6 +16,7 @@
 #include <gtest/gtest.h>
 #include "audio_resource_service.h"
 #include "audio_workgroup.h"
+#include "audio_rt_schedule.h"
 #include "audio_errors.h"
 #include "iipc_stream.h"
 #include "message_parcel.h"
@@ -929,5 +930,69 @@ HWTEST(AudioWorkgroupUnitTest, SetCgroupLimitParams_Overwrite, TestSize.Level0)
     EXPECT_EQ(workgroup.GetCgroupLimitId(), 9);
     EXPECT_EQ(workgroup.cgroupLimit.clientPid, 201);
 }
+
+#ifndef RESSCHE_ENABLE
+class RecordingRtScheduleShim : public AudioRtScheduleShim {
+public:
+    int32_t SetDeadline(pid_t tid, const AudioRtScheduleParam &param) override
+    {
+        deadlineCalls.push_back({tid, param});
+        return 0;
+    }
+
+    int32_t SetNormal(pid_t tid) override
+    {
+        normalCalls.push_back(tid);
+        return 0;
+    }
+
+    std::vector<std::pair<pid_t, AudioRtScheduleParam>> deadlineCalls;
+    std::vector<pid_t> normalCalls;
+};
+
+/**
+ * @tc.name  : Test Start without the platform scheduler
+ * @tc.type  : FUNC
+ * @tc.number: AudioWorkgroupRtSchedule_001
+ * @tc.desc  : The group threads get a deadline reservation with the period of Start, once per period change.
+ */
+HWTEST(AudioWorkgroupUnitTest, AudioWorkgroupRtSchedule_001, TestSize.Level1)
+{
+    constexpr uint64_t periodMs = 5;
+    constexpr uint64_t nsPerMs = 1000000;
+    auto shim = std::make_shared<RecordingRtScheduleShim>();
+    AudioRtSchedule::GetInstance().SetShim(shim);
+
+    AudioWorkgroup workgroup(4);
+    EXPECT_EQ(workgroup.AddThread(1001), AUDIO_OK);
+    EXPECT_TRUE(shim->deadlineCalls.empty());
+
+    EXPECT_EQ(workgroup.Start(100, 100 + periodMs), AUDIO_OK);
+    ASSERT_EQ(shim->deadlineCalls.size(), 1u);
+    EXPECT_EQ(shim->deadlineCalls[0].first, 1001);
+    EXPECT_EQ(shim->deadlineCalls[0].second.periodNs, periodMs * nsPerMs);
+    EXPECT_EQ(shim->deadlineCalls[0].second.deadlineNs, periodMs * nsPerMs);
+
+    EXPECT_EQ(workgroup.Start(200, 200 + periodMs), AUDIO_OK);
+    EXPECT_EQ(shim->deadlineCalls.size(), 1u);
+
+    EXPECT_EQ(workgroup.AddThread(1002), AUDIO_OK);
+    ASSERT_EQ(shim->deadlineCalls.size(), 2u);
+    EXPECT_EQ(shim->deadlineCalls[1].first, 1002);
+
+    EXPECT_EQ(workgroup.RemoveThread(1001), AUDIO_OK);
+    ASSERT_EQ(shim->normalCalls.size(), 1u);
+    EXPECT_EQ(shim->normalCalls[0], 1001);
+    EXPECT_EQ(workgroup.RemoveThread(1002), AUDIO_OK);
+    {
+        AudioWorkgroup released(5);
+        EXPECT_EQ(released.AddThread(1003), AUDIO_OK);
+        EXPECT_EQ(released.Start(300, 300 + periodMs), AUDIO_OK);
+    }
+    ASSERT_EQ(shim->normalCalls.size(), 3u);
+    EXPECT_EQ(shim->normalCalls[2], 1003);
+    AudioRtSchedule::GetInstance().SetShim(nullptr);
+}
+#endif
 } // namespace AudioStandard
 } // namespace OHOS
\ No newline at end of file
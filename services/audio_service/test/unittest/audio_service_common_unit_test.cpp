@@ -16,6 +16,7 @@
 #include "audio_errors.h"
 #include "audio_service_log.h"
 #include "audio_info.h"
+#include "audio_mirrored_ring.h"
 #include "audio_ring_cache.h"
 #include "audio_process_config.h"
 #include "linear_pos_time_model.h"
@@ -23,6 +24,7 @@
 #include "va_shared_buffer.h"
 #include "va_shared_buffer_operator.h"
 #include <thread>
+#include <vector>
 #include <gtest/gtest.h>
 
 using namespace testing::ext;
@@ -2175,5 +2177,165 @@ HWTEST(AudioServiceCommonUnitTest, VASharedBufferOperator_0010, TestSize.Level1)
     EXPECT_NE(SharedStatusInfo_->statusInfo_, nullptr);
 }
 
+/**
+* @tc.name  : Test AudioMirroredRing API
+* @tc.type  : FUNC
+* @tc.number: AudioMirroredRing_001
+* @tc.desc  : A memfd ring mapped twice sees every write in both views, spans across the wrap are contiguous.
+*/
+HWTEST(AudioServiceCommonUnitTest, AudioMirroredRing_001, TestSize.Level1)
+{
+    size_t size = AudioMirroredRing::GetPageSize();
+    std::unique_ptr<AudioMirroredRing> ring = AudioMirroredRing::CreateFromMemfd(size, "mirrored_ring_test");
+    ASSERT_NE(ring, nullptr);
+    EXPECT_EQ(ring->GetSize(), size);
+
+    uint8_t *base = ring->GetBase();
+    base[0] = 1;
+    EXPECT_EQ(base[size], 1);
+    base[size + size - 1] = 2;
+    EXPECT_EQ(base[size - 1], 2);
+
+    // write a pattern that wraps, then read it back from the logical positions
+    const size_t chunk = size / 2;
+    std::vector<uint8_t> pattern(chunk);
+    for (size_t i = 0; i < chunk; i++) {
+        pattern[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+    uint64_t pos = size * 3 - chunk / 2;
+    EXPECT_EQ(memcpy_s(ring->GetSpan(pos), size, pattern.data(), chunk), EOK);
+    for (size_t i = 0; i < chunk; i++) {
+        EXPECT_EQ(base[(pos + i) % size], pattern[i]);
+    }
+    std::vector<uint8_t> readBack(chunk);
+    EXPECT_EQ(memcpy_s(readBack.data(), chunk, ring->GetSpan(pos), chunk), EOK);
+    EXPECT_EQ(readBack, pattern);
+}
+
+/**
+* @tc.name  : Test AudioMirroredRing API
+* @tc.type  : FUNC
+* @tc.number: AudioMirroredRing_002
+* @tc.desc  : Sizes that are not page multiples are rejected.
+*/
+HWTEST(AudioServiceCommonUnitTest, AudioMirroredRing_002, TestSize.Level1)
+{
+    size_t pageSize = AudioMirroredRing::GetPageSize();
+    EXPECT_EQ(AudioMirroredRing::CreateFromMemfd(0, "mirrored_ring_test"), nullptr);
+    EXPECT_EQ(AudioMirroredRing::CreateFromMemfd(pageSize + 1, "mirrored_ring_test"), nullptr);
+    EXPECT_EQ(AudioMirroredRing::CreateFromFd(-1, pageSize), nullptr);
+    EXPECT_EQ(AudioMirroredRing::RoundUpSize(1), pageSize);
+    EXPECT_EQ(AudioMirroredRing::RoundUpSize(pageSize), pageSize);
+    EXPECT_EQ(AudioMirroredRing::RoundUpSize(pageSize + 1), pageSize * 2);
+}
+
+/**
+* @tc.name  : Test VASharedBufferOperator API
+* @tc.type  : FUNC
+* @tc.number: VASharedBufferOperator_Mirrored_001
+* @tc.desc  : A page aligned buffer takes the mirrored path and keeps data intact across the wrap.
+*/
+HWTEST(AudioServiceCommonUnitTest, VASharedBufferOperator_Mirrored_001, TestSize.Level1)
+{
+    size_t capacity = AudioMirroredRing::GetPageSize();
+    std::shared_ptr<VASharedBuffer> buffer = VASharedBuffer::CreateFromLocal(capacity);
+    ASSERT_NE(buffer, nullptr);
+    VASharedBufferOperator bufferOperator(*buffer);
+    ASSERT_NE(bufferOperator.mirroredRing_, nullptr);
+
+    const size_t chunk = capacity / 3;
+    std::vector<uint8_t> writeData(chunk);
+    std::vector<uint8_t> readData(chunk);
+    for (uint32_t round = 0; round < 10; round++) {
+        for (size_t i = 0; i < chunk; i++) {
+            writeData[i] = static_cast<uint8_t>(round * 31 + i);
+        }
+        ASSERT_EQ(bufferOperator.Write(writeData.data(), chunk), chunk);
+        ASSERT_EQ(bufferOperator.Read(readData.data(), chunk), chunk);
+        EXPECT_EQ(readData, writeData);
+    }
+}
+
+/**
+* @tc.name  : Test VASharedBufferOperator API
+* @tc.type  : FUNC
+* @tc.number: VASharedBufferOperator_ZeroCopy_001
+* @tc.desc  : Data produced in place through AcquireWrite/CommitWrite is seen by AcquireRead/ReleaseRead, the
+*             spans split at the wrap of an unmirrored ring.
+*/
+HWTEST(AudioServiceCommonUnitTest, VASharedBufferOperator_ZeroCopy_001, TestSize.Level1)
+{
+    const size_t capacity = 1000;
+    std::shared_ptr<VASharedBuffer> buffer = VASharedBuffer::CreateFromLocal(capacity);
+    ASSERT_NE(buffer, nullptr);
+    VASharedBufferOperator bufferOperator(*buffer);
+    EXPECT_EQ(bufferOperator.mirroredRing_, nullptr);
+
+    // move both positions close to the end of the ring
+    std::vector<uint8_t> data(capacity);
+    ASSERT_EQ(bufferOperator.Write(data.data(), 900), 900);
+    ASSERT_EQ(bufferOperator.Read(data.data(), 900), 900);
+
+    RingBufferWrapper span;
+    EXPECT_EQ(bufferOperator.AcquireWrite(span), SUCCESS);
+    EXPECT_EQ(span.dataLength, capacity);
+    EXPECT_EQ(span.basicBufferDescs[0].bufLength, 100);
+    EXPECT_EQ(span.basicBufferDescs[1].bufLength, 900);
+    EXPECT_EQ(span.basicBufferDescs[1].buffer, buffer->GetDataBase());
+    span.SetBuffersValueWithBufLen(0x5a);
+    EXPECT_EQ(bufferOperator.CommitWrite(capacity + 1), ERR_INVALID_PARAM);
+    EXPECT_EQ(bufferOperator.CommitWrite(300), SUCCESS);
+    EXPECT_EQ(bufferOperator.GetReadableSize(), 300);
+
+    EXPECT_EQ(bufferOperator.AcquireRead(span), SUCCESS);
+    EXPECT_EQ(span.dataLength, 300);
+    EXPECT_EQ(span.basicBufferDescs[0].bufLength, 100);
+    EXPECT_EQ(span.basicBufferDescs[1].bufLength, 200);
+    for (const auto &[spanBuffer, spanLength] : span.basicBufferDescs) {
+        for (size_t i = 0; i < spanLength; i++) {
+            EXPECT_EQ(spanBuffer[i], 0x5a);
+        }
+    }
+    EXPECT_EQ(bufferOperator.ReleaseRead(301), ERR_INVALID_PARAM);
+    EXPECT_EQ(bufferOperator.ReleaseRead(300), SUCCESS);
+    EXPECT_EQ(bufferOperator.GetReadableSize(), 0);
+}
+
+/**
+* @tc.name  : Test VASharedBufferOperator API
+* @tc.type  : FUNC
+* @tc.number: VASharedBufferOperator_ZeroCopy_002
+* @tc.desc  : A mirrored ring hands out one contiguous span across the wrap.
+*/
+HWTEST(AudioServiceCommonUnitTest, VASharedBufferOperator_ZeroCopy_002, TestSize.Level1)
+{
+    const size_t capacity = AudioMirroredRing::GetPageSize();
+    std::shared_ptr<VASharedBuffer> buffer = VASharedBuffer::CreateFromLocal(capacity);
+    ASSERT_NE(buffer, nullptr);
+    VASharedBufferOperator bufferOperator(*buffer);
+    ASSERT_NE(bufferOperator.mirroredRing_, nullptr);
+
+    const size_t headSize = capacity - capacity / 4;
+    std::vector<uint8_t> data(capacity);
+    ASSERT_EQ(bufferOperator.Write(data.data(), headSize), headSize);
+    ASSERT_EQ(bufferOperator.Read(data.data(), headSize), headSize);
+
+    RingBufferWrapper span;
+    EXPECT_EQ(bufferOperator.AcquireWrite(span), SUCCESS);
+    EXPECT_EQ(span.basicBufferDescs[0].bufLength, capacity);
+    EXPECT_EQ(span.basicBufferDescs[1].buffer, nullptr);
+    const size_t commitSize = capacity / 2;
+    for (size_t i = 0; i < commitSize; i++) {
+        span.basicBufferDescs[0].buffer[i] = static_cast<uint8_t>(i);
+    }
+    EXPECT_EQ(bufferOperator.CommitWrite(commitSize), SUCCESS);
+
+    std::vector<uint8_t> readData(commitSize);
+    ASSERT_EQ(bufferOperator.Read(readData.data(), commitSize), commitSize);
+    for (size_t i = 0; i < commitSize; i++) {
+        EXPECT_EQ(readData[i], static_cast<uint8_t>(i));
+    }
+}
+
 } // namespace AudioStandard
 } // namespace OHOS
\ No newline at end of file
@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 #include <gtest/gtest.h>
+#include <thread>
 #include "audio_stream_checker.h"
 #include "audio_stream_checker_thread.h"
 #include "audio_errors.h"
@@ -81,16 +82,81 @@ HWTEST(AudioStreamCheckerTest, RecordFrame_001, TestSize.Level1)
     std::shared_ptr<AudioStreamChecker> checker = std::make_shared<AudioStreamChecker>(cfg);
     checker->InitChecker(para, 100000, 100000);
     checker->RecordMuteFrame();
-    int32_t num = checker->checkParaVector_[0].muteFrameNum;
+    int32_t num = checker->muteFrameNum_.load();
     EXPECT_GT(num, 0);
     checker->RecordNodataFrame();
-    num = checker->checkParaVector_[0].noDataFrameNum;
+    num = checker->noDataFrameNum_.load();
     EXPECT_GT(num, 0);
     checker->RecordNormalFrame();
-    num = checker->checkParaVector_[0].normalFrameCount;
+    num = checker->normalFrameCount_.load();
     EXPECT_GT(num, 0);
 }
 
+/**
+ * @tc.name  : Test RecordFrame API
+ * @tc.type  : FUNC
+ * @tc.number: RecordFrame_002
+ * @tc.desc  : Recorded frames are moved into every check para when the checker thread polls.
+ */
+HWTEST(AudioStreamCheckerTest, RecordFrame_002, TestSize.Level1)
+{
+    AudioProcessConfig cfg;
+    DataTransferMonitorParam para;
+    para.timeInterval = INT64_MAX; // never due, so the counters are not cleaned by a check
+    std::shared_ptr<AudioStreamChecker> checker = std::make_shared<AudioStreamChecker>(cfg);
+    checker->InitChecker(para, 100000, 100000);
+    checker->RecordMuteFrame();
+    checker->RecordNormalFrame();
+    // frames before a callback registered are not counted for it
+    checker->InitChecker(para, 100001, 100001);
+    checker->RecordNodataFrame();
+    checker->RecordNormalFrame();
+    checker->MonitorCheckFrame();
+
+    EXPECT_EQ(checker->muteFrameNum_.load(), 0);
+    EXPECT_EQ(checker->noDataFrameNum_.load(), 0);
+    EXPECT_EQ(checker->normalFrameCount_.load(), 0);
+    ASSERT_EQ(checker->checkParaVector_.size(), 2);
+    EXPECT_EQ(checker->checkParaVector_[0].muteFrameNum, 1);
+    EXPECT_EQ(checker->checkParaVector_[0].noDataFrameNum, 1);
+    EXPECT_EQ(checker->checkParaVector_[0].normalFrameCount, 2);
+    EXPECT_EQ(checker->checkParaVector_[1].muteFrameNum, 0);
+    EXPECT_EQ(checker->checkParaVector_[1].noDataFrameNum, 1);
+    EXPECT_EQ(checker->checkParaVector_[1].normalFrameCount, 1);
+}
+
+/**
+ * @tc.name  : Test RecordFrame API
+ * @tc.type  : FUNC
+ * @tc.number: RecordFrame_003
+ * @tc.desc  : No frame is lost when the data path records while the checker thread polls.
+ */
+HWTEST(AudioStreamCheckerTest, RecordFrame_003, TestSize.Level1)
+{
+    AudioProcessConfig cfg;
+    DataTransferMonitorParam para;
+    para.timeInterval = INT64_MAX;
+    std::shared_ptr<AudioStreamChecker> checker = std::make_shared<AudioStreamChecker>(cfg);
+    checker->InitChecker(para, 100000, 100000);
+    const int64_t frameNum = 10000;
+    std::thread recordThread([checker, frameNum] {
+        for (int64_t i = 0; i < frameNum; i++) {
+            checker->RecordMuteFrame();
+            checker->RecordNodataFrame();
+            checker->RecordNormalFrame();
+        }
+    });
+    for (int32_t i = 0; i < 100; i++) { // poll 100 times while recording
+        checker->MonitorCheckFrame();
+    }
+    recordThread.join();
+    checker->MonitorCheckFrame();
+
+    EXPECT_EQ(checker->checkParaVector_[0].muteFrameNum, frameNum);
+    EXPECT_EQ(checker->checkParaVector_[0].noDataFrameNum, frameNum);
+    EXPECT_EQ(checker->checkParaVector_[0].normalFrameCount, frameNum);
+}
+
 /**
  * @tc.name  : Test GetAppUid API
  * @tc.type  : FUNC
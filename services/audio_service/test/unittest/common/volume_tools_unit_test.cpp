@@ -14,16 +14,48 @@
  */
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
 
 #include "audio_service_log.h"
 #include "audio_errors.h"
 #include "volume_tools.h"
+#include "ring_buffer_wrapper.h"
 
 using namespace testing::ext;
 
 namespace OHOS {
 namespace AudioStandard {
 static const size_t MAX_FRAME_SIZE = 100000;
+static const int32_t HALF_VOLUME = 32768;
+static const int32_t FULL_VOLUME = 65536;
+static const size_t TEST_FRAME_COUNT = 37;
+static const size_t TEST_SPLIT_FRAME = 11;
+static const int32_t HALF_FACTOR = 2;
+static const size_t S24_SAMPLE_SIZE = 3;
+static const int32_t INT24_MAX = (1 << 23) - 1;
+
+static void WriteS24(uint8_t *p, int32_t value)
+{
+    p[0] = static_cast<uint8_t>(value);
+    p[1] = static_cast<uint8_t>(value >> 8); // 8 bits per byte
+    p[2] = static_cast<uint8_t>(value >> 16); // 16 bits for the high byte
+}
+
+static int32_t ReadS24(const uint8_t *p)
+{
+    // shift the sign bit up to bit 31 and back
+    return static_cast<int32_t>((static_cast<uint32_t>(p[2]) << 24) | (static_cast<uint32_t>(p[1]) << 16) |
+        (static_cast<uint32_t>(p[0]) << 8)) >> 8;
+}
+
+static int64_t StepEnergy(int32_t from, int32_t to)
+{
+    int64_t step = static_cast<int64_t>(to) - from;
+    return step * step;
+}
+
 class VolumeToolsUnitTest : public testing::Test {
 public:
     static void SetUpTestCase(void);
@@ -431,5 +463,309 @@ HWTEST(VolumeToolsUnitTest, IsVolumeValid_006, TestSize.Level4)
     AUDIO_INFO_LOG("AudioSystemManagerUnitTest IsVolumeValid_006 result:%{public}d", ret);
     EXPECT_EQ(ret, false);
 }
+
+/**
+ * @tc.name  : Test Process API
+ * @tc.type  : FUNC
+ * @tc.number: Process_005
+ * @tc.desc  : Test Process interface, flat volume is applied to every sample of every format.
+ */
+HWTEST(VolumeToolsUnitTest, Process_005, TestSize.Level1)
+{
+    std::vector<int16_t> s16(TEST_FRAME_COUNT * STEREO, INT16_MAX);
+    BufferDesc s16Desc = {reinterpret_cast<uint8_t *>(s16.data()), s16.size() * sizeof(int16_t),
+        s16.size() * sizeof(int16_t)};
+    ChannelVolumes vols = VolumeTools::GetChannelVolumes(STEREO, HALF_VOLUME, HALF_VOLUME);
+    EXPECT_EQ(VolumeTools::Process(s16Desc, SAMPLE_S16LE, vols), SUCCESS);
+    for (int16_t sample : s16) {
+        EXPECT_EQ(sample, INT16_MAX / 2); // 2 is half volume
+    }
+
+    std::vector<int32_t> s32(TEST_FRAME_COUNT * STEREO, INT32_MIN);
+    BufferDesc s32Desc = {reinterpret_cast<uint8_t *>(s32.data()), s32.size() * sizeof(int32_t),
+        s32.size() * sizeof(int32_t)};
+    EXPECT_EQ(VolumeTools::Process(s32Desc, SAMPLE_S32LE, vols), SUCCESS);
+    for (int32_t sample : s32) {
+        EXPECT_EQ(sample, INT32_MIN / 2); // 2 is half volume
+    }
+
+    std::vector<float> f32(TEST_FRAME_COUNT * STEREO, 1.0f);
+    BufferDesc f32Desc = {reinterpret_cast<uint8_t *>(f32.data()), f32.size() * sizeof(float),
+        f32.size() * sizeof(float)};
+    EXPECT_EQ(VolumeTools::Process(f32Desc, SAMPLE_F32LE, vols), SUCCESS);
+    for (float sample : f32) {
+        EXPECT_FLOAT_EQ(sample, 0.5f);
+    }
+}
+
+/**
+ * @tc.name  : Test Process API
+ * @tc.type  : FUNC
+ * @tc.number: Process_006
+ * @tc.desc  : Test Process interface, a ramp over a wrapped ring buffer matches the ramp over one buffer.
+ */
+HWTEST(VolumeToolsUnitTest, Process_006, TestSize.Level1)
+{
+    std::vector<int16_t> linear(TEST_FRAME_COUNT * STEREO, INT16_MAX);
+    std::vector<int16_t> wrapped(linear);
+    ChannelVolumes vols = VolumeTools::GetChannelVolumes(STEREO, FULL_VOLUME, 0);
+
+    BufferDesc linearDesc = {reinterpret_cast<uint8_t *>(linear.data()), linear.size() * sizeof(int16_t),
+        linear.size() * sizeof(int16_t)};
+    EXPECT_EQ(VolumeTools::Process(linearDesc, SAMPLE_S16LE, vols), SUCCESS);
+
+    size_t firstLen = TEST_SPLIT_FRAME * STEREO * sizeof(int16_t);
+    size_t totalLen = wrapped.size() * sizeof(int16_t);
+    RingBufferWrapper ringBuffer;
+    ringBuffer.basicBufferDescs[0] = {reinterpret_cast<uint8_t *>(wrapped.data()), firstLen};
+    ringBuffer.basicBufferDescs[1] = {reinterpret_cast<uint8_t *>(wrapped.data()) + firstLen, totalLen - firstLen};
+    ringBuffer.dataLength = totalLen;
+    EXPECT_EQ(VolumeTools::Process(ringBuffer, SAMPLE_S16LE, vols), SUCCESS);
+
+    EXPECT_EQ(linear, wrapped);
+    EXPECT_EQ(linear.front(), INT16_MAX);
+    EXPECT_EQ(linear.back(), 0);
+    for (size_t i = STEREO; i < linear.size(); i++) {
+        EXPECT_LE(linear[i], linear[i - STEREO]);
+    }
+}
+
+/**
+ * @tc.name  : Test Process API
+ * @tc.type  : FUNC
+ * @tc.number: Process_007
+ * @tc.desc  : Test Process interface, per channel volumes are kept when they differ.
+ */
+HWTEST(VolumeToolsUnitTest, Process_007, TestSize.Level1)
+{
+    std::vector<float> f32(TEST_FRAME_COUNT * STEREO, 1.0f);
+    BufferDesc f32Desc = {reinterpret_cast<uint8_t *>(f32.data()), f32.size() * sizeof(float),
+        f32.size() * sizeof(float)};
+    ChannelVolumes vols = {STEREO, {FULL_VOLUME, HALF_VOLUME}, {FULL_VOLUME, HALF_VOLUME}};
+    EXPECT_EQ(VolumeTools::Process(f32Desc, SAMPLE_F32LE, vols), SUCCESS);
+    for (size_t i = 0; i < TEST_FRAME_COUNT; i++) {
+        EXPECT_FLOAT_EQ(f32[i * STEREO], 1.0f);
+        EXPECT_FLOAT_EQ(f32[i * STEREO + 1], 0.5f);
+    }
+}
+
+/**
+ * @tc.name  : Test CountVolumeLevel API
+ * @tc.type  : FUNC
+ * @tc.number: CountVolumeLevel_009
+ * @tc.desc  : Test CountVolumeLevel interface, peak, clipping and silence are counted in the same pass.
+ */
+HWTEST(VolumeToolsUnitTest, CountVolumeLevel_009, TestSize.Level1)
+{
+    std::vector<int16_t> s16(TEST_FRAME_COUNT * STEREO, 0);
+    s16[TEST_SPLIT_FRAME * STEREO] = INT16_MIN;
+    s16[TEST_SPLIT_FRAME * STEREO + 1] = INT16_MAX / HALF_FACTOR;
+    BufferDesc s16Desc = {reinterpret_cast<uint8_t *>(s16.data()), s16.size() * sizeof(int16_t),
+        s16.size() * sizeof(int16_t)};
+    VolumeStats stats;
+    ChannelVolumes vols = VolumeTools::CountVolumeLevel(s16Desc, SAMPLE_S16LE, STEREO, stats);
+    EXPECT_EQ(vols.volStart[0], (INT16_MAX + 1) / static_cast<int32_t>(TEST_FRAME_COUNT));
+    EXPECT_EQ(vols.volStart[1], (INT16_MAX / HALF_FACTOR) / static_cast<int32_t>(TEST_FRAME_COUNT));
+    EXPECT_FLOAT_EQ(stats.peak, 1.0f);
+    EXPECT_EQ(stats.clipCount, 1u);
+    EXPECT_EQ(stats.frameCount, TEST_FRAME_COUNT);
+    EXPECT_EQ(stats.maxZeroRun, TEST_FRAME_COUNT - TEST_SPLIT_FRAME - 1);
+    EXPECT_EQ(stats.zeroRun, TEST_FRAME_COUNT - TEST_SPLIT_FRAME - 1);
+    EXPECT_FALSE(stats.IsAllZero());
+}
+
+/**
+ * @tc.name  : Test DfxOperation API
+ * @tc.type  : FUNC
+ * @tc.number: DfxOperation_001
+ * @tc.desc  : Test DfxOperation interface, stats of all 20ms chunks are merged and silence runs across chunks.
+ */
+HWTEST(VolumeToolsUnitTest, DfxOperation_001, TestSize.Level1)
+{
+    AudioStreamInfo streamInfo(SAMPLE_RATE_48000, ENCODING_PCM, SAMPLE_F32LE, STEREO);
+    size_t frameCount = SAMPLE_RATE_48000 / HALF_FACTOR / HALF_FACTOR; // 250ms, 13 chunks
+    std::vector<float> f32(frameCount * STEREO, 0.0f);
+    BufferDesc f32Desc = {reinterpret_cast<uint8_t *>(f32.data()), f32.size() * sizeof(float),
+        f32.size() * sizeof(float)};
+    int64_t volumeDataCount = 0;
+    VolumeStats stats;
+    VolumeTools::DfxOperation(f32Desc, streamInfo, "DfxOperation_001", volumeDataCount, stats);
+    EXPECT_EQ(stats.frameCount, frameCount);
+    EXPECT_TRUE(stats.IsAllZero());
+    EXPECT_FLOAT_EQ(stats.peak, 0.0f);
+
+    f32[f32.size() - 1] = -0.5f;
+    int64_t muteFrameCnt = 0;
+    VolumeTools::CalcMuteFrame(f32Desc, streamInfo, "DfxOperation_001", volumeDataCount, muteFrameCnt, stats);
+    EXPECT_EQ(stats.frameCount, frameCount);
+    EXPECT_EQ(stats.maxZeroRun, frameCount - 1);
+    EXPECT_EQ(stats.zeroRun, 0u);
+    EXPECT_EQ(stats.clipCount, 0u);
+    EXPECT_FLOAT_EQ(stats.peak, 0.5f);
+}
+
+/**
+ * @tc.name  : Test ProcessFade API
+ * @tc.type  : FUNC
+ * @tc.number: ProcessFade_001
+ * @tc.desc  : Test ProcessFade interface, the gain follows an equal-power curve and ends on 1.0 or 0.0.
+ */
+HWTEST(VolumeToolsUnitTest, ProcessFade_001, TestSize.Level1)
+{
+    const size_t frameCount = 960; // 20ms at 48k
+    std::vector<float> fadeIn(frameCount, 1.0f);
+    std::vector<float> fadeOut(frameCount, 1.0f);
+    BufferDesc fadeInDesc = {reinterpret_cast<uint8_t *>(fadeIn.data()), frameCount * sizeof(float),
+        frameCount * sizeof(float)};
+    BufferDesc fadeOutDesc = {reinterpret_cast<uint8_t *>(fadeOut.data()), frameCount * sizeof(float),
+        frameCount * sizeof(float)};
+    EXPECT_EQ(VolumeTools::ProcessFade(fadeInDesc, SAMPLE_F32LE, MONO, false), SUCCESS);
+    EXPECT_EQ(VolumeTools::ProcessFade(fadeOutDesc, SAMPLE_F32LE, MONO, true), SUCCESS);
+
+    const float tolerance = 1e-4f;
+    for (size_t i = 0; i < frameCount; i++) {
+        float phase = static_cast<float>(M_PI_2) * (i + 1) / frameCount;
+        EXPECT_NEAR(fadeIn[i], std::sin(phase), tolerance);
+        EXPECT_NEAR(fadeOut[i], std::cos(phase), tolerance);
+        // equal power, a crossfade of the two keeps the level
+        EXPECT_NEAR(fadeIn[i] * fadeIn[i] + fadeOut[i] * fadeOut[i], 1.0f, HALF_FACTOR * tolerance);
+    }
+    EXPECT_FLOAT_EQ(fadeIn.back(), 1.0f);
+    EXPECT_FLOAT_EQ(fadeOut.back(), 0.0f);
+}
+
+/**
+ * @tc.name  : Test ProcessFade API
+ * @tc.type  : FUNC
+ * @tc.number: ProcessFade_002
+ * @tc.desc  : Test ProcessFade interface, every integer format follows the same curve as float.
+ */
+HWTEST(VolumeToolsUnitTest, ProcessFade_002, TestSize.Level1)
+{
+    std::vector<float> f32(TEST_FRAME_COUNT * STEREO, 1.0f);
+    BufferDesc f32Desc = {reinterpret_cast<uint8_t *>(f32.data()), f32.size() * sizeof(float),
+        f32.size() * sizeof(float)};
+    EXPECT_EQ(VolumeTools::ProcessFade(f32Desc, SAMPLE_F32LE, STEREO, true), SUCCESS);
+
+    std::vector<int16_t> s16(TEST_FRAME_COUNT * STEREO, INT16_MAX);
+    BufferDesc s16Desc = {reinterpret_cast<uint8_t *>(s16.data()), s16.size() * sizeof(int16_t),
+        s16.size() * sizeof(int16_t)};
+    EXPECT_EQ(VolumeTools::ProcessFade(s16Desc, SAMPLE_S16LE, STEREO, true), SUCCESS);
+
+    std::vector<int32_t> s32(TEST_FRAME_COUNT * STEREO, INT32_MAX);
+    BufferDesc s32Desc = {reinterpret_cast<uint8_t *>(s32.data()), s32.size() * sizeof(int32_t),
+        s32.size() * sizeof(int32_t)};
+    EXPECT_EQ(VolumeTools::ProcessFade(s32Desc, SAMPLE_S32LE, STEREO, true), SUCCESS);
+
+    std::vector<uint8_t> s24(TEST_FRAME_COUNT * STEREO * S24_SAMPLE_SIZE, 0);
+    for (size_t i = 0; i < TEST_FRAME_COUNT * STEREO; i++) {
+        WriteS24(s24.data() + i * S24_SAMPLE_SIZE, INT24_MAX);
+    }
+    BufferDesc s24Desc = {s24.data(), s24.size(), s24.size()};
+    EXPECT_EQ(VolumeTools::ProcessFade(s24Desc, SAMPLE_S24LE, STEREO, true), SUCCESS);
+
+    const float tolerance = 1e-4f;
+    for (size_t i = 0; i < TEST_FRAME_COUNT * STEREO; i++) {
+        EXPECT_NEAR(static_cast<float>(s16[i]) / INT16_MAX, f32[i], tolerance);
+        EXPECT_NEAR(static_cast<float>(ReadS24(s24.data() + i * S24_SAMPLE_SIZE)) / INT24_MAX, f32[i], tolerance);
+        EXPECT_NEAR(static_cast<float>(s32[i]) / INT32_MAX, f32[i], tolerance);
+    }
+    EXPECT_EQ(s16.back(), 0);
+    EXPECT_EQ(s32.back(), 0);
+    EXPECT_EQ(ReadS24(s24.data() + s24.size() - S24_SAMPLE_SIZE), 0);
+}
+
+/**
+ * @tc.name  : Test ProcessFade API
+ * @tc.type  : FUNC
+ * @tc.number: ProcessFade_003
+ * @tc.desc  : Test ProcessFade interface, splicing the faded period between the stream and silence has no click.
+ */
+HWTEST(VolumeToolsUnitTest, ProcessFade_003, TestSize.Level1)
+{
+    const size_t frameCount = 960; // 20ms at 48k
+    const float toneStep = 2.0f * static_cast<float>(M_PI) * 1000 / 48000; // 1kHz tone at 48k
+    std::vector<int16_t> tone(frameCount + 1);
+    for (size_t i = 0; i < tone.size(); i++) {
+        tone[i] = static_cast<int16_t>(INT16_MAX * std::sin(toneStep * i + 1.0f));
+    }
+    // energy of the largest step inside the tone, a step well above it at a boundary is heard as a click
+    int64_t toneEnergy = 0;
+    for (size_t i = 1; i < tone.size(); i++) {
+        toneEnergy = std::max(toneEnergy, StepEnergy(tone[i - 1], tone[i]));
+    }
+
+    // fade out: last unfaded sample -> faded period -> silence
+    std::vector<int16_t> fadeOut(tone.begin() + 1, tone.end());
+    BufferDesc fadeOutDesc = {reinterpret_cast<uint8_t *>(fadeOut.data()), frameCount * sizeof(int16_t),
+        frameCount * sizeof(int16_t)};
+    EXPECT_EQ(VolumeTools::ProcessFade(fadeOutDesc, SAMPLE_S16LE, MONO, true), SUCCESS);
+    EXPECT_LE(StepEnergy(tone.front(), fadeOut.front()), toneEnergy);
+    EXPECT_EQ(StepEnergy(fadeOut.back(), 0), 0);
+    for (size_t i = 1; i < frameCount; i++) {
+        EXPECT_LE(StepEnergy(fadeOut[i - 1], fadeOut[i]), toneEnergy);
+    }
+
+    // fade in: silence -> faded period -> next unfaded sample
+    std::vector<int16_t> fadeIn(tone.begin(), tone.end() - 1);
+    BufferDesc fadeInDesc = {reinterpret_cast<uint8_t *>(fadeIn.data()), frameCount * sizeof(int16_t),
+        frameCount * sizeof(int16_t)};
+    EXPECT_EQ(VolumeTools::ProcessFade(fadeInDesc, SAMPLE_S16LE, MONO, false), SUCCESS);
+    EXPECT_LE(StepEnergy(0, fadeIn.front()), toneEnergy);
+    EXPECT_EQ(fadeIn.back(), tone[frameCount - 1]);
+    for (size_t i = 1; i < frameCount; i++) {
+        EXPECT_LE(StepEnergy(fadeIn[i - 1], fadeIn[i]), toneEnergy);
+    }
+}
+
+/**
+ * @tc.name  : Test ProcessFade API
+ * @tc.type  : FUNC
+ * @tc.number: ProcessFade_004
+ * @tc.desc  : Test ProcessFade interface, invalid buffer, channel and format are rejected.
+ */
+HWTEST(VolumeToolsUnitTest, ProcessFade_004, TestSize.Level1)
+{
+    std::vector<int16_t> s16(STEREO, INT16_MAX);
+    BufferDesc s16Desc = {reinterpret_cast<uint8_t *>(s16.data()), s16.size() * sizeof(int16_t),
+        s16.size() * sizeof(int16_t)};
+    BufferDesc nullDesc = {nullptr, s16Desc.bufLength, s16Desc.dataLength};
+    EXPECT_EQ(VolumeTools::ProcessFade(nullDesc, SAMPLE_S16LE, STEREO, true), ERR_INVALID_PARAM);
+    EXPECT_EQ(VolumeTools::ProcessFade(s16Desc, SAMPLE_S16LE, static_cast<AudioChannel>(0), true),
+        ERR_INVALID_PARAM);
+    EXPECT_EQ(VolumeTools::ProcessFade(s16Desc, INVALID_WIDTH, STEREO, true), ERR_INVALID_PARAM);
+    // less than one frame
+    EXPECT_EQ(VolumeTools::ProcessFade(s16Desc, SAMPLE_S32LE, STEREO, true), ERR_INVALID_PARAM);
+    EXPECT_EQ(s16[0], INT16_MAX);
+}
+
+/**
+ * @tc.name  : Test CountVolumeLevel API
+ * @tc.type  : FUNC
+ * @tc.number: CountVolumeLevel_010
+ * @tc.desc  : Test CountVolumeLevel interface, full vector blocks and the tail give the same stats as a plain loop.
+ */
+HWTEST(VolumeToolsUnitTest, CountVolumeLevel_010, TestSize.Level1)
+{
+    std::vector<int32_t> s32(TEST_FRAME_COUNT * STEREO, 0);
+    for (size_t i = 0; i < TEST_SPLIT_FRAME * STEREO; i++) {
+        s32[i] = (i % HALF_FACTOR == 0) ? INT32_MIN : static_cast<int32_t>(i * HALF_VOLUME);
+    }
+    s32[s32.size() - 1] = INT32_MAX; // silent run from the split frame up to the last frame
+    int64_t sums[STEREO] = {};
+    for (size_t i = 0; i < s32.size(); i++) {
+        sums[i % STEREO] += std::abs(static_cast<int64_t>(s32[i]));
+    }
+    BufferDesc s32Desc = {reinterpret_cast<uint8_t *>(s32.data()), s32.size() * sizeof(int32_t),
+        s32.size() * sizeof(int32_t)};
+    VolumeStats stats;
+    ChannelVolumes vols = VolumeTools::CountVolumeLevel(s32Desc, SAMPLE_S32LE, STEREO, stats);
+    EXPECT_EQ(vols.volStart[0], static_cast<int32_t>(sums[0] / static_cast<int64_t>(TEST_FRAME_COUNT)));
+    EXPECT_EQ(vols.volStart[1], static_cast<int32_t>(sums[1] / static_cast<int64_t>(TEST_FRAME_COUNT)));
+    EXPECT_FLOAT_EQ(stats.peak, 1.0f);
+    EXPECT_EQ(stats.clipCount, TEST_SPLIT_FRAME + 1);
+    EXPECT_EQ(stats.maxZeroRun, TEST_FRAME_COUNT - TEST_SPLIT_FRAME - 1);
+    EXPECT_EQ(stats.zeroRun, 0u);
+}
 } // namespace AudioStandard
 } // namespace OHOS
\ No newline at end of file
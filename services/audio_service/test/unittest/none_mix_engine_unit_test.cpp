@@ -1704,5 +1704,36 @@ HWTEST_F(NoneMixEngineUnitTest, NoneMixEngine_051, TestSize.Level1)
     ret = noneMixEngineRet.GetDirectVoipDeviceFormat(formatRet);
     EXPECT_EQ(SAMPLE_S16LE, ret);
 }
+
+/**
+ * @tc.name  : Test NoneMixEngine API
+ * @tc.type  : FUNC
+ * @tc.number: NoneMixEngine_054
+ * @tc.desc  : Test NoneMixEngine::DoFadeinOut(), packed 24 bit output is faded out to silence.
+ */
+HWTEST_F(NoneMixEngineUnitTest, NoneMixEngine_054, TestSize.Level1)
+{
+    auto ptrNoneMixEngine = std::make_shared<NoneMixEngine>();
+    ASSERT_TRUE(ptrNoneMixEngine != nullptr);
+
+    const size_t frameCount = 48;
+    const size_t sampleSize = 3; // packed 24 bit
+    std::vector<uint8_t> buffer(frameCount * STEREO * sampleSize, 0);
+    for (size_t i = 0; i < frameCount * STEREO; i++) {
+        buffer[i * sampleSize] = 0xff;
+        buffer[i * sampleSize + 1] = 0xff;
+        buffer[i * sampleSize + 2] = 0x7f; // 0x7fffff, max of int24
+    }
+    ptrNoneMixEngine->uChannel_ = STEREO;
+    ptrNoneMixEngine->uSampleFormat_ = SAMPLE_S24LE;
+    ptrNoneMixEngine->startFadeout_ = true;
+    ptrNoneMixEngine->DoFadeinOut(true, reinterpret_cast<char *>(buffer.data()), buffer.size());
+
+    EXPECT_FALSE(ptrNoneMixEngine->startFadeout_);
+    EXPECT_EQ(buffer[2], 0x7f); // first frame is barely attenuated
+    for (size_t i = (frameCount - 1) * STEREO * sampleSize; i < buffer.size(); i++) {
+        EXPECT_EQ(buffer[i], 0);
+    }
+}
 } // namespace AudioStandard
 } // namespace OHOS
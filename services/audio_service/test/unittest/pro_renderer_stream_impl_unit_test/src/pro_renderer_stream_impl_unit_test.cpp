@@ -865,10 +865,10 @@ HWTEST(ProRendererStreamImplUnitTest, PopSinkBuffer_001, TestSize.Level1)
     std::shared_ptr<ProRendererStreamImpl> rendererStreamImpl =
         std::make_shared<ProRendererStreamImpl>(processConfig, isDirect);
 
-    std::vector<char> audioBuffer;
+    BufferDesc bufferDesc;
     int32_t index;
     rendererStreamImpl->isFirstFrame_ = true;
-    rendererStreamImpl->PopSinkBuffer(&audioBuffer, index);
+    rendererStreamImpl->PopSinkBuffer(bufferDesc, index);
     EXPECT_EQ(rendererStreamImpl->isFirstFrame_, true);
 }
 
@@ -884,11 +884,11 @@ HWTEST(ProRendererStreamImplUnitTest, PopSinkBuffer_002, TestSize.Level1)
     std::shared_ptr<ProRendererStreamImpl> rendererStreamImpl =
         std::make_shared<ProRendererStreamImpl>(processConfig, isDirect);
 
-    std::vector<char> audioBuffer;
+    BufferDesc bufferDesc;
     int32_t index;
     rendererStreamImpl->isFirstFrame_ = false;
     rendererStreamImpl->isDrain_ = true;
-    rendererStreamImpl->PopSinkBuffer(&audioBuffer, index);
+    rendererStreamImpl->PopSinkBuffer(bufferDesc, index);
     EXPECT_EQ(rendererStreamImpl->isFirstFrame_, false);
 }
 
@@ -904,20 +904,24 @@ HWTEST(ProRendererStreamImplUnitTest, PopSinkBuffer_003, TestSize.Level1)
     std::shared_ptr<ProRendererStreamImpl> rendererStreamImpl =
         std::make_shared<ProRendererStreamImpl>(processConfig, isDirect);
 
-    std::vector<char> audioBuffer;
+    BufferDesc bufferDesc;
     std::vector<char> tmp = {'1', '2', '3'};
     int32_t index = 0;
     rendererStreamImpl->isFirstFrame_ = true;
     rendererStreamImpl->isBlock_ = true;
     rendererStreamImpl->isDrain_ = true;
-    rendererStreamImpl->PopSinkBuffer(&audioBuffer, index);
+    rendererStreamImpl->PopSinkBuffer(bufferDesc, index);
     EXPECT_EQ(rendererStreamImpl->isFirstFrame_, true);
 
     rendererStreamImpl->readQueue_.push(1);
     rendererStreamImpl->sinkBuffer_.push_back(tmp);
     rendererStreamImpl->sinkBuffer_.push_back(tmp);
-    rendererStreamImpl->PopSinkBuffer(&audioBuffer, index);
+    rendererStreamImpl->PopSinkBuffer(bufferDesc, index);
     EXPECT_EQ(rendererStreamImpl->isDrain_, true);
+    // the span points into the sink buffer, nothing is copied
+    EXPECT_EQ(index, 1);
+    EXPECT_EQ(bufferDesc.buffer, reinterpret_cast<uint8_t *>(rendererStreamImpl->sinkBuffer_[1].data()));
+    EXPECT_EQ(bufferDesc.dataLength, tmp.size());
 }
 
 /**
@@ -1192,11 +1196,11 @@ HWTEST(ProRendererStreamImplUnitTest, Peek_001, TestSize.Level0)
     bool isDirect = true;
     std::shared_ptr<ProRendererStreamImpl> rendererStreamImpl =
         std::make_shared<ProRendererStreamImpl>(processConfig, isDirect);
-    std::vector<char> audioBuffer;
+    BufferDesc bufferDesc;
     int32_t index = 0;
 
     rendererStreamImpl->isBlock_ = false;
-    EXPECT_NE(rendererStreamImpl->Peek(&audioBuffer, index), SUCCESS);
+    EXPECT_NE(rendererStreamImpl->Peek(bufferDesc, index), SUCCESS);
 }
 
 /**
@@ -1214,11 +1218,11 @@ HWTEST(ProRendererStreamImplUnitTest, Peek_002, TestSize.Level0)
     std::shared_ptr<RendererInServer> rendererInServer =
         std::make_shared<RendererInServer>(processConfig, streamListenerHolder);
     rendererStreamImpl->RegisterWriteCallback(rendererInServer);
-    std::vector<char> audioBuffer;
+    BufferDesc bufferDesc;
     int32_t index = 0;
 
     rendererStreamImpl->isBlock_ = true;
-    EXPECT_EQ(rendererStreamImpl->Peek(&audioBuffer, index), ERR_WRITE_BUFFER);
+    EXPECT_EQ(rendererStreamImpl->Peek(bufferDesc, index), ERR_WRITE_BUFFER);
 }
 
 /**
@@ -1232,12 +1236,12 @@ HWTEST(ProRendererStreamImplUnitTest, Peek_003, TestSize.Level0)
     bool isDirect = true;
     std::shared_ptr<ProRendererStreamImpl> rendererStreamImpl =
         std::make_shared<ProRendererStreamImpl>(processConfig, isDirect);
-    std::vector<char> audioBuffer;
+    BufferDesc bufferDesc;
     int32_t index = 0;
     int32_t ret = 0;
 
     rendererStreamImpl->isBlock_ = false;
-    ret = rendererStreamImpl->Peek(&audioBuffer, index);
+    ret = rendererStreamImpl->Peek(bufferDesc, index);
     EXPECT_EQ(ret, ERR_WRITE_BUFFER);
 }
 
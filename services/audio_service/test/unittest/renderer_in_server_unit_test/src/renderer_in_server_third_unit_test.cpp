@@ -1051,6 +1051,34 @@ HWTEST_F(RendererInServerThirdUnitTest, RendererInServerInnerCaptureEnqueueBuffe
     EXPECT_EQ(rendererInServer->renderEmptyCountForInnerCapToInnerCapIdMap_[innerCapId], 0);
 }
 
+/**
+ * @tc.name  : Test InnerCaptureEnqueueBuffer API
+ * @tc.type  : FUNC
+ * @tc.number: RendererInServerInnerCaptureEnqueueBuffer_003
+ * @tc.desc  : Test InnerCaptureEnqueueBuffer back-fills from the silence page and leaves it untouched.
+ */
+HWTEST_F(RendererInServerThirdUnitTest, RendererInServerInnerCaptureEnqueueBuffer_003, TestSize.Level1)
+{
+    AudioStreamInfo testStreamInfo(SAMPLE_RATE_48000, ENCODING_PCM, SAMPLE_S16LE, MONO,
+        AudioChannelLayout::CH_LAYOUT_MONO);
+    InitAudioProcessConfig(testStreamInfo, DEVICE_TYPE_USB_HEADSET, AUDIO_USAGE_NORMAL);
+    rendererInServer = std::make_shared<RendererInServer>(processConfig, streamListener);
+    EXPECT_NE(nullptr, rendererInServer);
+    ASSERT_EQ(SUCCESS, rendererInServer->Init());
+    ASSERT_EQ(rendererInServer->silencePage_.size(), rendererInServer->spanSizeInByte_);
+
+    std::vector<uint8_t> data(rendererInServer->spanSizeInByte_, 1);
+    BufferDesc bufferDesc = {data.data(), data.size(), data.size()};
+    CaptureInfo captureInfo;
+    int32_t innerCapId = 1;
+    rendererInServer->renderEmptyCountForInnerCapToInnerCapIdMap_[innerCapId] = 3;
+    rendererInServer->InnerCaptureEnqueueBuffer(bufferDesc, captureInfo, innerCapId);
+    EXPECT_EQ(rendererInServer->renderEmptyCountForInnerCapToInnerCapIdMap_[innerCapId], 0);
+    for (uint8_t value : rendererInServer->silencePage_) {
+        EXPECT_EQ(value, 0);
+    }
+}
+
 /**
  * @tc.name  : Test InnerCaptureOtherStream API
  * @tc.type  : FUNC
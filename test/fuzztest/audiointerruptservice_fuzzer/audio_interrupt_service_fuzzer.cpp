@@ -755,7 +755,7 @@ void AudioInterruptServicePrintLogsOfFocusStrategyBaseMusicFuzzTest(const uint8_
     AudioFocusEntry focusEntry;
     focusEntry.hintType = INTERRUPT_HINT_STOP;
     focusEntry.actionOn = CURRENT;
-    interruptService->focusCfgMap_.insert(std::make_pair(focusPair, focusEntry));
+    interruptService->focusMatrix_.Build({{focusPair, focusEntry}});
     uint32_t index = *reinterpret_cast<const uint32_t *>(rawData);
     audioInterrupt.sessionStrategy.concurrencyMode = concurrencyModes[index % concurrencyModes.size()];
 
@@ -681,8 +681,8 @@ void ProRendererPeekFuzzTest()
     AudioProcessConfig config = InitProcessConfig();
     std::shared_ptr<ProRendererStreamImpl> rendererStream = std::make_shared<ProRendererStreamImpl>(config, true);
     int32_t index = g_fuzzUtils.GetData<int32_t>();
-    std::vector<char> audioBuffer = {0x01, 0x02, 0x03, 0x04, 0x05};
-    rendererStream->Peek(&audioBuffer, index);
+    BufferDesc bufferDesc;
+    rendererStream->Peek(bufferDesc, index);
 }
 
 void ProRendererReturnIndexFuzzTest()
@@ -722,8 +722,8 @@ void ProRendererPopSinkBufferFuzzTest()
     AudioProcessConfig config = InitProcessConfig();
     std::shared_ptr<ProRendererStreamImpl> rendererStream = std::make_shared<ProRendererStreamImpl>(config, true);
     int32_t index = g_fuzzUtils.GetData<int32_t>();
-    std::vector<char> audioBuffer = {0x01, 0x02, 0x03, 0x04, 0x05};
-    rendererStream->PopSinkBuffer(&audioBuffer, index);
+    BufferDesc bufferDesc;
+    rendererStream->PopSinkBuffer(bufferDesc, index);
 }
 
 void ProRendererGetStreamVolumeFuzzTest()